@@ -0,0 +1,5970 @@
+/* Auto generated - DO NOT EDIT */
+
+#include <stdint.h>
+
+static const unsigned char bytes_janet_gen_core[] = {
+	0x23, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x65,
+	0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x6C, 0x69, 0x62,
+	0x72, 0x61, 0x72, 0x79, 0x0A, 0x23, 0x20, 0x43, 0x6F, 0x70,
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x31,
+	0x39, 0x20, 0x28, 0x43, 0x29, 0x20, 0x43, 0x61, 0x6C, 0x76,
+	0x69, 0x6E, 0x20, 0x52, 0x6F, 0x73, 0x65, 0x0A, 0x0A, 0x23,
+	0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23,
+	0x20, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 0x46, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x23, 0x23,
+	0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x20, 0x22, 0x54,
+	0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+	0x6E, 0x74, 0x2E, 0x22, 0x20, 0x5F, 0x65, 0x6E, 0x76, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x20, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x3A, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x0A, 0x20,
+	0x20, 0x22, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x6D,
+	0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x5C,
+	0x6E, 0x5C, 0x6E, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20,
+	0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x2E, 0x20, 0x45, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65,
+	0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x28, 0x66, 0x6E, 0x20,
+	0x6E, 0x61, 0x6D, 0x65, 0x20, 0x5B, 0x61, 0x72, 0x67, 0x73,
+	0x5D, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x29, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D,
+	0x6F, 0x72, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72,
+	0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x6F, 0x63, 0x73,
+	0x74, 0x72, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x75, 0x72, 0x20, 0x5B,
+	0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7B, 0x69, 0x20, 0x69,
+	0x74, 0x68, 0x7D, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x74, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x69, 0x74, 0x68, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x74, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x64, 0x6F, 0x63,
+	0x73, 0x74, 0x72, 0x20, 0x69, 0x74, 0x68, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x75, 0x73, 0x68, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x69, 0x65, 0x72, 0x73, 0x20, 0x69, 0x74, 0x68, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3C, 0x20,
+	0x69, 0x20, 0x6C, 0x65, 0x6E, 0x29, 0x20, 0x28, 0x72, 0x65,
+	0x63, 0x75, 0x72, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x28, 0x66, 0x73, 0x74, 0x61, 0x72, 0x74,
+	0x20, 0x30, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x72, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x23, 0x20, 0x41, 0x64, 0x64, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x69, 0x67, 0x6E,
+	0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x64,
+	0x6F, 0x63, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x72, 0x67, 0x6C,
+	0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x62, 0x75, 0x66,
+	0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x22,
+	0x28, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65,
+	0x20, 0x28, 0x3C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+	0x61, 0x72, 0x67, 0x6C, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x20, 0x22, 0x20,
+	0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x70, 0x72, 0x65,
+	0x74, 0x74, 0x79, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29,
+	0x20, 0x34, 0x20, 0x62, 0x75, 0x66, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x75, 0x73, 0x68, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x69, 0x65, 0x72, 0x73, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x20, 0x22, 0x29, 0x5C,
+	0x6E, 0x5C, 0x6E, 0x22, 0x20, 0x64, 0x6F, 0x63, 0x73, 0x74,
+	0x72, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20,
+	0x42, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x7E, 0x28, 0x64, 0x65, 0x66, 0x20, 0x2C,
+	0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2C, 0x3B, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20, 0x28, 0x66, 0x6E,
+	0x20, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2C, 0x3B, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+	0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x3A, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x0A, 0x20, 0x20, 0x22, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65,
+	0x20, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3A, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D,
+	0x0A, 0x20, 0x20, 0x22, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65,
+	0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+	0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74,
+	0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74,
+	0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6E, 0x61,
+	0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+	0x3A, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x3A, 0x70, 0x72,
+	0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0x0A,
+	0x20, 0x20, 0x22, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F,
+	0x72, 0x74, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72,
+	0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x61, 0x70, 0x70, 0x6C,
+	0x79, 0x20, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6E, 0x61, 0x6D,
+	0x65, 0x20, 0x3A, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x64,
+	0x65, 0x66, 0x2D, 0x0A, 0x20, 0x20, 0x22, 0x44, 0x65, 0x66,
+	0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76,
+	0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70,
+	0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F,
+	0x72, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3A, 0x70,
+	0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x2C, 0x3B, 0x6D,
+	0x6F, 0x72, 0x65, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6F, 0x62,
+	0x61, 0x6C, 0x0A, 0x20, 0x20, 0x22, 0x44, 0x79, 0x6E, 0x61,
+	0x6D, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x63, 0x72,
+	0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67, 0x6C, 0x6F,
+	0x62, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x66, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2A, 0x20, 0x28, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20,
+	0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+	0x2A, 0x20, 0x40, 0x7B, 0x3A, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x7D, 0x29, 0x0A, 0x20,
+	0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x76, 0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62,
+	0x61, 0x6C, 0x0A, 0x20, 0x20, 0x22, 0x44, 0x79, 0x6E, 0x61,
+	0x6D, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x63, 0x72,
+	0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67, 0x6C, 0x6F,
+	0x62, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x72, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x6E,
+	0x69, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2A, 0x20, 0x28, 0x73, 0x79,
+	0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x2A,
+	0x65, 0x6E, 0x76, 0x2A, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2A,
+	0x20, 0x40, 0x7B, 0x3A, 0x72, 0x65, 0x66, 0x20, 0x40, 0x5B,
+	0x69, 0x6E, 0x69, 0x74, 0x5D, 0x7D, 0x29, 0x0A, 0x20, 0x20,
+	0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x0A, 0x23, 0x20, 0x42, 0x61,
+	0x73, 0x69, 0x63, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63,
+	0x61, 0x74, 0x65, 0x73, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0x22, 0x20, 0x5B,
+	0x78, 0x5D, 0x20, 0x28, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x28,
+	0x25, 0x20, 0x78, 0x20, 0x32, 0x29, 0x29, 0x29, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x3F, 0x20,
+	0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x64, 0x64, 0x2E, 0x22,
+	0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D,
+	0x20, 0x30, 0x20, 0x28, 0x25, 0x20, 0x78, 0x20, 0x32, 0x29,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x7A,
+	0x65, 0x72, 0x6F, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x7A, 0x65, 0x72, 0x6F, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D,
+	0x20, 0x28, 0x3D, 0x3D, 0x20, 0x78, 0x20, 0x30, 0x29, 0x29,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x70, 0x6F, 0x73,
+	0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+	0x30, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3E,
+	0x20, 0x78, 0x20, 0x30, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6E, 0x65, 0x67, 0x3F, 0x20, 0x22, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68,
+	0x61, 0x6E, 0x20, 0x30, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D,
+	0x20, 0x28, 0x3C, 0x20, 0x78, 0x20, 0x30, 0x29, 0x29, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x3F,
+	0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x61,
+	0x6C, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x2E, 0x22, 0x20, 0x5B,
+	0x78, 0x5D, 0x20, 0x28, 0x3D, 0x3D, 0x20, 0x78, 0x20, 0x31,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6E,
+	0x75, 0x6D, 0x62, 0x65, 0x72, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20,
+	0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x20, 0x3A,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x29, 0x29, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D,
+	0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x78, 0x29, 0x20, 0x3A, 0x66, 0x69, 0x62, 0x65, 0x72, 0x29,
+	0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E,
+	0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x20, 0x3A, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x29, 0x29, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+	0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x78, 0x29, 0x20, 0x3A, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0x20, 0x22,
+	0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77,
+	0x6F, 0x72, 0x64, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20,
+	0x28, 0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78,
+	0x29, 0x20, 0x3A, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20,
+	0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x20, 0x3A,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x29, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x63, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x2E, 0x22,
+	0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x3D, 0x20,
+	0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x20, 0x3A,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x29,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x63, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0x20, 0x22, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x61, 0x20, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D,
+	0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x20,
+	0x3A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x78, 0x29, 0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x22, 0x20,
+	0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x78, 0x29, 0x20, 0x3A, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3F, 0x20, 0x22,
+	0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28,
+	0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29,
+	0x20, 0x3A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x29, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x78, 0x29, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x62,
+	0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x3F, 0x20, 0x22, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65,
+	0x61, 0x6E, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28,
+	0x3D, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29,
+	0x20, 0x3A, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x29,
+	0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20,
+	0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2C, 0x20, 0x6F, 0x72,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x22, 0x20,
+	0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x74, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x74, 0x20, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x29, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A, 0x73, 0x79,
+	0x6D, 0x62, 0x6F, 0x6C, 0x29, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20,
+	0x3A, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20,
+	0x3A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x64,
+	0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x3F,
+	0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x74, 0x20, 0x28, 0x74, 0x79, 0x70,
+	0x65, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x29, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+	0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F,
+	0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x74, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20,
+	0x3A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x61, 0x62,
+	0x6C, 0x65, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6B,
+	0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x6F, 0x72, 0x20, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x74, 0x20, 0x28, 0x74,
+	0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20, 0x3A,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x20, 0x28, 0x3D, 0x20, 0x74, 0x20,
+	0x3A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x3F, 0x20, 0x22, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x3D, 0x20, 0x78, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0x22, 0x20,
+	0x5B, 0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20, 0x78, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x3F, 0x20, 0x22, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x22, 0x20, 0x5B,
+	0x78, 0x5D, 0x20, 0x28, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x69,
+	0x6C, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x65, 0x6D, 0x70, 0x74, 0x79, 0x3F, 0x20, 0x22, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x22,
+	0x20, 0x5B, 0x78, 0x73, 0x5D, 0x20, 0x28, 0x3D, 0x20, 0x30,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x78,
+	0x73, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74,
+	0x3F, 0x0A, 0x20, 0x20, 0x22, 0x28, 0x69, 0x64, 0x65, 0x6D,
+	0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0x20, 0x78, 0x29,
+	0x5C, 0x6E, 0x5C, 0x6E, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6C, 0x66,
+	0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x61, 0x74, 0x6F, 0x6D,
+	0x69, 0x63, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x73, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x3A, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x7D, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x69, 0x64, 0x65, 0x6D,
+	0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x61, 0x74, 0x6F, 0x6D,
+	0x69, 0x63, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x69,
+	0x64, 0x65, 0x6D, 0x70, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20,
+	0x62, 0x65, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65,
+	0x6E, 0x64, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x74, 0x6F, 0x20, 0x61, 0x74, 0x6F, 0x6D, 0x2E, 0x20, 0x49,
+	0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x69, 0x64, 0x65, 0x6D,
+	0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x20, 0x28, 0x61, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+	0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x29, 0x2C, 0x20, 0x6D,
+	0x61, 0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x69,
+	0x6E, 0x67, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x6F,
+	0x6E, 0x63, 0x65, 0x2C, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20,
+	0x69, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x63, 0x6F,
+	0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x6D, 0x75, 0x6C,
+	0x74, 0x69, 0x70, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x63, 0x6F,
+	0x70, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E,
+	0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x72, 0x65,
+	0x73, 0x75, 0x6C, 0x74, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73,
+	0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x24, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x28, 0x67,
+	0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x7E, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x2C, 0x24, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x2C, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x2C,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74,
+	0x65, 0x6E, 0x74, 0x3F, 0x20, 0x2C, 0x24, 0x66, 0x6F, 0x72,
+	0x6D, 0x29, 0x20, 0x2C, 0x24, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x2C, 0x24, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20,
+	0x28, 0x64, 0x6F, 0x20, 0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3D, 0x20, 0x2C, 0x24, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x2C, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2C,
+	0x24, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x64, 0x6F, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x2C, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2C, 0x24, 0x66,
+	0x6F, 0x72, 0x6D, 0x29, 0x20, 0x2C, 0x24, 0x72, 0x65, 0x73,
+	0x75, 0x6C, 0x74, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x23,
+	0x20, 0x43, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x20, 0x6D,
+	0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x70, 0x65, 0x72, 0x61,
+	0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x75, 0x67, 0x61, 0x72,
+	0x2E, 0x20, 0x4E, 0x6F, 0x20, 0x62, 0x69, 0x74, 0x77, 0x69,
+	0x73, 0x65, 0x20, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x2E,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x69, 0x6E, 0x63,
+	0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x78, 0x20, 0x2B, 0x20, 0x31, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x2B, 0x20, 0x78, 0x20, 0x31, 0x29, 0x29,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x65, 0x63,
+	0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x78, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x22, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x2D, 0x20, 0x78, 0x20, 0x31, 0x29, 0x29,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x2B, 0x2B, 0x20, 0x22, 0x49, 0x6E, 0x63, 0x72, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x76, 0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31,
+	0x2E, 0x22, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x7E, 0x28, 0x73,
+	0x65, 0x74, 0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C, 0x2B, 0x20,
+	0x2C, 0x78, 0x20, 0x2C, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x2D,
+	0x2D, 0x20, 0x22, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+	0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31, 0x2E, 0x22,
+	0x20, 0x5B, 0x78, 0x5D, 0x20, 0x7E, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C, 0x2D, 0x20, 0x2C, 0x78,
+	0x20, 0x2C, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x2B, 0x3D, 0x20,
+	0x22, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x20,
+	0x78, 0x20, 0x62, 0x79, 0x20, 0x6E, 0x2E, 0x22, 0x20, 0x5B,
+	0x78, 0x20, 0x6E, 0x5D, 0x20, 0x7E, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C, 0x2B, 0x20, 0x2C, 0x78,
+	0x20, 0x2C, 0x6E, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x2D, 0x3D, 0x20,
+	0x22, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x20,
+	0x78, 0x20, 0x62, 0x79, 0x20, 0x6E, 0x2E, 0x22, 0x20, 0x5B,
+	0x78, 0x20, 0x6E, 0x5D, 0x20, 0x7E, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C, 0x2D, 0x20, 0x2C, 0x78,
+	0x20, 0x2C, 0x6E, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x2A, 0x3D, 0x20,
+	0x22, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x78, 0x20, 0x28, 0x2A, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29,
+	0x2E, 0x22, 0x20, 0x5B, 0x78, 0x20, 0x6E, 0x5D, 0x20, 0x7E,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C,
+	0x2A, 0x20, 0x2C, 0x78, 0x20, 0x2C, 0x6E, 0x29, 0x29, 0x29,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x2F, 0x3D, 0x20, 0x22, 0x53, 0x68, 0x6F, 0x72, 0x74,
+	0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x78, 0x20, 0x28, 0x2F, 0x20, 0x78,
+	0x20, 0x6E, 0x29, 0x29, 0x2E, 0x22, 0x20, 0x5B, 0x78, 0x20,
+	0x6E, 0x5D, 0x20, 0x7E, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2C,
+	0x78, 0x20, 0x28, 0x2C, 0x2F, 0x20, 0x2C, 0x78, 0x20, 0x2C,
+	0x6E, 0x29, 0x29, 0x29, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D,
+	0x61, 0x63, 0x72, 0x6F, 0x20, 0x25, 0x3D, 0x20, 0x22, 0x53,
+	0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20,
+	0x28, 0x25, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0x22,
+	0x20, 0x5B, 0x78, 0x20, 0x6E, 0x5D, 0x20, 0x7E, 0x28, 0x73,
+	0x65, 0x74, 0x20, 0x2C, 0x78, 0x20, 0x28, 0x2C, 0x25, 0x20,
+	0x2C, 0x78, 0x20, 0x2C, 0x6E, 0x29, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x0A, 0x20, 0x20,
+	0x22, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E,
+	0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x0A,
+	0x20, 0x20, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79,
+	0x6D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x20, 0x76, 0x61,
+	0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x73, 0x79, 0x6D, 0x20, 0x76, 0x61, 0x6C, 0x5D,
+	0x0A, 0x20, 0x20, 0x7E, 0x28, 0x64, 0x65, 0x66, 0x20, 0x2C,
+	0x73, 0x79, 0x6D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x6E, 0x69, 0x6C, 0x20, 0x2C, 0x73, 0x79, 0x6D, 0x29,
+	0x20, 0x2C, 0x76, 0x61, 0x6C, 0x20, 0x2C, 0x73, 0x79, 0x6D,
+	0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D,
+	0x61, 0x63, 0x72, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+	0x6E, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x49, 0x67, 0x6E, 0x6F,
+	0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x5D, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x69, 0x66, 0x2D,
+	0x6E, 0x6F, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x53, 0x68, 0x6F,
+	0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20,
+	0x2E, 0x2E, 0x2E, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x63,
+	0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x65,
+	0x78, 0x70, 0x2D, 0x31, 0x20, 0x65, 0x78, 0x70, 0x2D, 0x32,
+	0x20, 0x26, 0x5D, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66,
+	0x20, 0x2C, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x2C, 0x65, 0x78, 0x70, 0x2D, 0x32, 0x20, 0x2C,
+	0x65, 0x78, 0x70, 0x2D, 0x31, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x77,
+	0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x22, 0x45, 0x76, 0x61,
+	0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77,
+	0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5D, 0x0A, 0x20,
+	0x20, 0x7E, 0x28, 0x69, 0x66, 0x20, 0x2C, 0x63, 0x6F, 0x6E,
+	0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x64, 0x6F,
+	0x20, 0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x20, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x0A, 0x20,
+	0x20, 0x22, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E,
+	0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x2E, 0x2E, 0x2E,
+	0x20, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x63, 0x6F, 0x6E, 0x64,
+	0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66,
+	0x20, 0x2C, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x28, 0x64, 0x6F, 0x20,
+	0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x63, 0x6F, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x22, 0x45,
+	0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x63,
+	0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+	0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x69, 0x73, 0x20, 0x66,
+	0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x74, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75,
+	0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F,
+	0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x61, 0x6E, 0x0A, 0x20, 0x20, 0x6F, 0x64, 0x64, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+	0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x20, 0x69,
+	0x66, 0x20, 0x6E, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x0A, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x74,
+	0x63, 0x68, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+	0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x2C,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69,
+	0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x61, 0x75, 0x78, 0x20, 0x5B, 0x69,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E, 0x20, 0x28,
+	0x2D, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+	0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x20, 0x69, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E, 0x20,
+	0x30, 0x29, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20,
+	0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E, 0x20, 0x31, 0x29,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70, 0x61, 0x69, 0x72,
+	0x73, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x27, 0x69, 0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70, 0x61,
+	0x69, 0x72, 0x73, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61,
+	0x75, 0x78, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x32, 0x29,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x61,
+	0x75, 0x78, 0x20, 0x30, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x63, 0x61,
+	0x73, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x53, 0x65, 0x6C, 0x65,
+	0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x71, 0x75,
+	0x61, 0x6C, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69,
+	0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x0A, 0x20, 0x20, 0x68, 0x61, 0x73,
+	0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72,
+	0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x20, 0x20, 0x49, 0x66, 0x20,
+	0x6E, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69,
+	0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x64, 0x69, 0x73, 0x70, 0x61,
+	0x74, 0x63, 0x68, 0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x61, 0x74, 0x6D, 0x20, 0x28, 0x69, 0x64, 0x65, 0x6D, 0x70,
+	0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0x20, 0x64, 0x69, 0x73,
+	0x70, 0x61, 0x74, 0x63, 0x68, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x61, 0x74, 0x6D, 0x20, 0x64, 0x69, 0x73,
+	0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x67, 0x65, 0x6E,
+	0x73, 0x79, 0x6D, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x61, 0x75, 0x78, 0x20, 0x5B,
+	0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E, 0x20,
+	0x28, 0x2D, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x20, 0x69, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x28, 0x3D, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E,
+	0x20, 0x30, 0x29, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x72, 0x65, 0x73, 0x74, 0x6C, 0x65, 0x6E, 0x20, 0x31,
+	0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70, 0x61, 0x69,
+	0x72, 0x73, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x27, 0x69, 0x66, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x69,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x28,
+	0x2B, 0x20, 0x69, 0x20, 0x31, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x75, 0x78, 0x20, 0x28, 0x2B,
+	0x20, 0x69, 0x20, 0x32, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x61, 0x74, 0x6D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x75, 0x78, 0x20,
+	0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x79, 0x6D, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61,
+	0x74, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x75, 0x78,
+	0x20, 0x30, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x6C, 0x65,
+	0x74, 0x0A, 0x20, 0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x20, 0x61, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2E, 0x20, 0x45, 0x61,
+	0x63, 0x68, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x69, 0x6E,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x69, 0x73, 0x0A, 0x20, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67,
+	0x6E, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x66, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6C, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x0A, 0x20, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x26, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x6F, 0x64, 0x64, 0x3F, 0x20, 0x28, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x73, 0x29, 0x29, 0x20, 0x28, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63,
+	0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x6E,
+	0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x6C, 0x65, 0x74, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28,
+	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x30, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x61, 0x63, 0x63,
+	0x75, 0x6D, 0x20, 0x40, 0x5B, 0x27, 0x64, 0x6F, 0x5D, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+	0x28, 0x3C, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7B,
+	0x69, 0x20, 0x6B, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31,
+	0x29, 0x20, 0x76, 0x7D, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x6B,
+	0x20, 0x76, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x2B, 0x3D, 0x20, 0x69, 0x20, 0x32, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F,
+	0x6E, 0x63, 0x61, 0x74, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D,
+	0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+	0x65, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x20, 0x30, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x20, 0x74, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x22,
+	0x54, 0x72, 0x79, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61,
+	0x74, 0x63, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73,
+	0x2E, 0x20, 0x42, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x6E, 0x79, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x0A, 0x20, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x68,
+	0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69,
+	0x73, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x0A, 0x20, 0x20,
+	0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x61, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x66, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x72, 0x61, 0x70,
+	0x70, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73,
+	0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x6F, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+	0x20, 0x6F, 0x66, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20,
+	0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74,
+	0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x0A, 0x20, 0x20, 0x72,
+	0x75, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E,
+	0x6F, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73,
+	0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x63,
+	0x61, 0x74, 0x63, 0x68, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x6C,
+	0x65, 0x74, 0x20, 0x5B, 0x5B, 0x5B, 0x65, 0x72, 0x72, 0x20,
+	0x66, 0x69, 0x62, 0x5D, 0x5D, 0x20, 0x63, 0x61, 0x74, 0x63,
+	0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x66, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+	0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x66,
+	0x69, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7E,
+	0x28, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x2C, 0x66, 0x20, 0x28,
+	0x2C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+	0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x5D, 0x20, 0x2C, 0x62,
+	0x6F, 0x64, 0x79, 0x29, 0x20, 0x3A, 0x65, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x2C, 0x72, 0x20, 0x28, 0x72, 0x65, 0x73, 0x75,
+	0x6D, 0x65, 0x20, 0x2C, 0x66, 0x29, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x28, 0x3D, 0x20, 0x28, 0x2C, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x2C,
+	0x66, 0x29, 0x20, 0x3A, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x6F, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x2C, 0x65, 0x72, 0x72, 0x20, 0x2C, 0x72, 0x29, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x2C, 0x66, 0x69, 0x62, 0x20,
+	0x2C, 0x66, 0x29, 0x20, 0x2C, 0x3B, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x63,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x31, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x2C, 0x72, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x7E, 0x28, 0x74, 0x72, 0x79, 0x2A, 0x20, 0x2C, 0x62,
+	0x6F, 0x64, 0x79, 0x20, 0x2C, 0x28, 0x69, 0x66, 0x20, 0x65,
+	0x72, 0x72, 0x20, 0x65, 0x72, 0x72, 0x20, 0x72, 0x29, 0x20,
+	0x28, 0x64, 0x6F, 0x20, 0x2C, 0x3B, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x63,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x31, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20,
+	0x22, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+	0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70,
+	0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x6F, 0x74,
+	0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x0A, 0x20, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x72, 0x65, 0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+	0x28, 0x3E, 0x20, 0x69, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x2D, 0x2D, 0x20, 0x69, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65,
+	0x74, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x72,
+	0x65, 0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x73, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x69,
+	0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x20, 0x69, 0x29, 0x20, 0x72, 0x65, 0x74, 0x29,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x20, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x22, 0x45, 0x76,
+	0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69,
+	0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x63,
+	0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65,
+	0x72, 0x77, 0x69, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x65, 0x76,
+	0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x74,
+	0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x69, 0x20, 0x6C, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x3E, 0x20, 0x69,
+	0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2D,
+	0x2D, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x66, 0x69, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x69, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74,
+	0x3F, 0x20, 0x66, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27,
+	0x69, 0x66, 0x20, 0x66, 0x69, 0x20, 0x66, 0x69, 0x20, 0x72,
+	0x65, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x66, 0x69,
+	0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65,
+	0x66, 0x20, 0x24, 0x66, 0x69, 0x20, 0x66, 0x69, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x69, 0x66, 0x20, 0x24, 0x66, 0x69, 0x20,
+	0x24, 0x66, 0x69, 0x20, 0x72, 0x65, 0x74, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x22,
+	0x41, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20,
+	0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20,
+	0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61,
+	0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
+	0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x4C, 0x69, 0x73, 0x70,
+	0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x2C, 0x20, 0x61, 0x6C, 0x74, 0x68, 0x6F,
+	0x75, 0x67, 0x68, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6D, 0x75,
+	0x63, 0x68, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72,
+	0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65, 0x2E,
+	0x0A, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64,
+	0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
+	0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x0A,
+	0x20, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x6F, 0x72,
+	0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x61, 0x6C, 0x73, 0x2E, 0x20, 0x41, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x73,
+	0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x74,
+	0x6F, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65,
+	0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65,
+	0x64, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x3A, 0x5C, 0x6E, 0x5C,
+	0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x3A, 0x76, 0x65, 0x72, 0x62, 0x20,
+	0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2F, 0x65, 0x78, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5C, 0x6E, 0x5C,
+	0x6E, 0x0A, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 0x65, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x2C, 0x20, 0x3A,
+	0x76, 0x65, 0x72, 0x62, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E,
+	0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74,
+	0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+	0x64, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+	0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69,
+	0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x65, 0x72, 0x62,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x3A, 0x5C, 0x6E, 0x5C, 0x6E,
+	0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A, 0x69, 0x74, 0x65, 0x72,
+	0x61, 0x74, 0x65, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x70, 0x65,
+	0x61, 0x74, 0x65, 0x64, 0x6C, 0x79, 0x20, 0x65, 0x76, 0x61,
+	0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
+	0x6F, 0x6E, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x69,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68,
+	0x79, 0x2E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x2D, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x20,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x73, 0x68,
+	0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x74, 0x77,
+	0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x0A, 0x20,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x68,
+	0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x2C, 0x20,
+	0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E,
+	0x64, 0x29, 0x2E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74,
+	0x3A, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x2D, 0x20, 0x49, 0x74,
+	0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+	0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A, 0x70, 0x61,
+	0x69, 0x72, 0x73, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72,
+	0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+	0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A, 0x69, 0x6E,
+	0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+	0x63, 0x65, 0x2E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74,
+	0x3A, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20,
+	0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20,
+	0x6F, 0x76, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x65, 0x64, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x62, 0x65,
+	0x20, 0x70, 0x61, 0x69, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6E,
+	0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64,
+	0x75, 0x63, 0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75,
+	0x6D, 0x65, 0x72, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x61,
+	0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 0x63, 0x6F, 0x6E,
+	0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x72, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x69, 0x6E,
+	0x67, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x2E,
+	0x20, 0x43, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x61, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x66,
+	0x0A, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x3A, 0x5C, 0x6E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C,
+	0x74, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x5C,
+	0x6E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x77, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+	0x72, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6B, 0x65, 0x79,
+	0x77, 0x6F, 0x72, 0x64, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E,
+	0x64, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x20, 0x20, 0x3A, 0x6D,
+	0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x63, 0x61,
+	0x6E, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F,
+	0x66, 0x3A, 0x5C, 0x6E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C,
+	0x74, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x78,
+	0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x2D,
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x73, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x79, 0x2E, 0x5C, 0x6E, 0x0A, 0x20,
+	0x20, 0x5C, 0x74, 0x3A, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x2D, 0x20, 0x64,
+	0x65, 0x66, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x69,
+	0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
+	0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+	0x65, 0x74, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x5C,
+	0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A, 0x62, 0x65, 0x66,
+	0x6F, 0x72, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D,
+	0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x61, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65,
+	0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6F,
+	0x72, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2E, 0x5C, 0x6E, 0x0A, 0x20,
+	0x20, 0x5C, 0x74, 0x3A, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x20, 0x73, 0x61, 0x6D,
+	0x65, 0x20, 0x61, 0x73, 0x20, 0x3A, 0x62, 0x65, 0x66, 0x6F,
+	0x72, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x66, 0x66,
+	0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x70, 0x70, 0x65, 0x6E,
+	0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E,
+	0x65, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2E, 0x5C, 0x6E,
+	0x0A, 0x20, 0x20, 0x5C, 0x74, 0x3A, 0x72, 0x65, 0x70, 0x65,
+	0x61, 0x74, 0x20, 0x6E, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x70,
+	0x65, 0x61, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+	0x65, 0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6E, 0x20, 0x74, 0x69, 0x6D,
+	0x65, 0x73, 0x2E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x5C, 0x74,
+	0x3A, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x64,
+	0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x20, 0x6F, 0x6E,
+	0x6C, 0x79, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+	0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E,
+	0x5C, 0x6E, 0x5C, 0x6E, 0x0A, 0x20, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65,
+	0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x68, 0x65, 0x61, 0x64, 0x20, 0x26, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x68, 0x65, 0x61, 0x64, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x6F, 0x74,
+	0x3D, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x20, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74,
+	0x65, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x5B, 0x69, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x73, 0x20, 0x26, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x73, 0x20, 0x40, 0x5B, 0x27, 0x61, 0x6E,
+	0x64, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3E, 0x3D, 0x20, 0x69, 0x20, 0x6C, 0x65,
+	0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x70, 0x72, 0x65, 0x70,
+	0x65, 0x6E, 0x64, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x27,
+	0x64, 0x6F, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7B, 0x69, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31, 0x29,
+	0x20, 0x76, 0x65, 0x72, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x2B, 0x20, 0x69, 0x20, 0x32, 0x29, 0x20, 0x6F, 0x62,
+	0x6A, 0x65, 0x63, 0x74, 0x7D, 0x20, 0x68, 0x65, 0x61, 0x64,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+	0x72, 0x64, 0x3F, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x64,
+	0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x75, 0x73, 0x68, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73,
+	0x20, 0x76, 0x65, 0x72, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20,
+	0x32, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x6C, 0x65, 0x74, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x6C, 0x65, 0x74, 0x20,
+	0x76, 0x65, 0x72, 0x62, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E,
+	0x65, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x32, 0x29, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3A, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x69, 0x66, 0x20, 0x76, 0x65, 0x72,
+	0x62, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28,
+	0x2B, 0x20, 0x69, 0x20, 0x32, 0x29, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x62, 0x65,
+	0x66, 0x6F, 0x72, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x64, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x62,
+	0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B,
+	0x20, 0x69, 0x20, 0x32, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x61, 0x66, 0x74,
+	0x65, 0x72, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x27, 0x64, 0x6F, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65,
+	0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x32, 0x29, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x73, 0x29, 0x20, 0x76, 0x65, 0x72, 0x62,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3A, 0x72, 0x65, 0x70, 0x65, 0x61,
+	0x74, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x6E, 0x20, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x70, 0x72, 0x65,
+	0x64, 0x73, 0x20, 0x40, 0x5B, 0x27, 0x61, 0x6E, 0x64, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x3C, 0x20, 0x24,
+	0x69, 0x74, 0x65, 0x72, 0x20, 0x24, 0x6E, 0x29, 0x5D, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x75,
+	0x62, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28,
+	0x2B, 0x20, 0x69, 0x20, 0x32, 0x29, 0x20, 0x73, 0x70, 0x72,
+	0x65, 0x64, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20,
+	0x24, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x62, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x76, 0x61, 0x72, 0x20,
+	0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x30, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x73, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x73, 0x65, 0x74, 0x20, 0x24, 0x69, 0x74,
+	0x65, 0x72, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x2B, 0x20, 0x31, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75,
+	0x62, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x22, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63,
+	0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x3A, 0x20,
+	0x22, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65, 0x20,
+	0x76, 0x65, 0x72, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x69, 0x74,
+	0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x28, 0x64, 0x6F, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69,
+	0x74, 0x65, 0x72, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79,
+	0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x20, 0x40, 0x5B,
+	0x27, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x73, 0x65, 0x74, 0x20, 0x24, 0x69, 0x74,
+	0x65, 0x72, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x29,
+	0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x28,
+	0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B, 0x20, 0x69,
+	0x20, 0x33, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x76, 0x61, 0x72, 0x20, 0x24, 0x69,
+	0x74, 0x65, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65,
+	0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73,
+	0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F,
+	0x6F, 0x70, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x72,
+	0x61, 0x6E, 0x67, 0x65, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x5F, 0x69, 0x6E, 0x63,
+	0x5D, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x69, 0x6E, 0x63, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x5F, 0x69, 0x6E, 0x63, 0x20, 0x5F,
+	0x69, 0x6E, 0x63, 0x20, 0x31, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x79, 0x6D,
+	0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69, 0x74,
+	0x65, 0x72, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x73, 0x20, 0x40, 0x5B, 0x27, 0x61, 0x6E,
+	0x64, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x3C,
+	0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x65, 0x6E, 0x64,
+	0x73, 0x79, 0x6D, 0x29, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B,
+	0x20, 0x69, 0x20, 0x33, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x27, 0x76, 0x61, 0x72, 0x20, 0x24, 0x69, 0x74, 0x65,
+	0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x65,
+	0x6E, 0x64, 0x73, 0x79, 0x6D, 0x20, 0x65, 0x6E, 0x64, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x24,
+	0x69, 0x74, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x27, 0x73, 0x65, 0x74, 0x20, 0x24, 0x69, 0x74, 0x65,
+	0x72, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x2B,
+	0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x63,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x6B,
+	0x65, 0x79, 0x73, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x24, 0x64, 0x69, 0x63, 0x74, 0x20, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20,
+	0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73,
+	0x20, 0x40, 0x5B, 0x27, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x3D, 0x20,
+	0x6E, 0x69, 0x6C, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29,
+	0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x75,
+	0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x28, 0x64, 0x6F, 0x6F,
+	0x6E, 0x65, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x33, 0x29,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x24,
+	0x64, 0x69, 0x63, 0x74, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63,
+	0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x76, 0x61,
+	0x72, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20,
+	0x24, 0x64, 0x69, 0x63, 0x74, 0x20, 0x6E, 0x69, 0x6C, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x24, 0x69,
+	0x74, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+	0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x73,
+	0x65, 0x74, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74,
+	0x20, 0x24, 0x64, 0x69, 0x63, 0x74, 0x20, 0x24, 0x69, 0x74,
+	0x65, 0x72, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3A, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x28, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6D,
+	0x3F, 0x20, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x64,
+	0x69, 0x63, 0x74, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79,
+	0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28, 0x67, 0x65, 0x6E,
+	0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x20, 0x40, 0x5B,
+	0x27, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x6E, 0x69, 0x6C,
+	0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29, 0x5D, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x75, 0x62, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E, 0x65,
+	0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x33, 0x29, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x24,
+	0x64, 0x69, 0x63, 0x74, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63,
+	0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x76,
+	0x61, 0x72, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74,
+	0x20, 0x24, 0x64, 0x69, 0x63, 0x74, 0x20, 0x6E, 0x69, 0x6C,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77,
+	0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72,
+	0x65, 0x64, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x3F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x67, 0x65, 0x74, 0x20, 0x24, 0x64, 0x69,
+	0x63, 0x74, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x3F,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64,
+	0x65, 0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x30, 0x29, 0x20,
+	0x24, 0x69, 0x74, 0x65, 0x72, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74,
+	0x20, 0x73, 0x79, 0x6D, 0x3F, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x31, 0x29, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x67, 0x65, 0x74, 0x20, 0x24, 0x64, 0x69, 0x63,
+	0x74, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x6C,
+	0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x73, 0x65, 0x74,
+	0x20, 0x24, 0x69, 0x74, 0x65, 0x72, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x24,
+	0x64, 0x69, 0x63, 0x74, 0x20, 0x24, 0x69, 0x74, 0x65, 0x72,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x69,
+	0x6E, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24,
+	0x6C, 0x65, 0x6E, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79,
+	0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69, 0x20,
+	0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x24, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+	0x64, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73,
+	0x20, 0x40, 0x5B, 0x27, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x3C, 0x20, 0x24, 0x69, 0x20,
+	0x24, 0x6C, 0x65, 0x6E, 0x29, 0x5D, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x28,
+	0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B, 0x20, 0x69,
+	0x20, 0x33, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x6F, 0x62, 0x6A,
+	0x65, 0x63, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65,
+	0x66, 0x20, 0x24, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x24, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x76, 0x61, 0x72, 0x20, 0x24,
+	0x69, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x73, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x67, 0x65, 0x74, 0x20,
+	0x24, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x24,
+	0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x6C,
+	0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x73, 0x65, 0x74, 0x20, 0x24, 0x69,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x2B, 0x20,
+	0x31, 0x20, 0x24, 0x69, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
+	0x65, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x24, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x79, 0x69, 0x65, 0x6C,
+	0x64, 0x76, 0x61, 0x6C, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73,
+	0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x20, 0x40, 0x5B, 0x27,
+	0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73,
+	0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64,
+	0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x73, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x24,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x6F,
+	0x72, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x3D,
+	0x20, 0x73, 0x20, 0x3A, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x29, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x3D, 0x20, 0x73, 0x20, 0x3A, 0x6E, 0x65, 0x77, 0x29, 0x29,
+	0x29, 0x29, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x75, 0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x28,
+	0x64, 0x6F, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x2B, 0x20, 0x69,
+	0x20, 0x33, 0x29, 0x20, 0x70, 0x72, 0x65, 0x64, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27,
+	0x64, 0x65, 0x66, 0x20, 0x24, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x76, 0x61, 0x72, 0x20, 0x24,
+	0x79, 0x69, 0x65, 0x6C, 0x64, 0x76, 0x61, 0x6C, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75,
+	0x6D, 0x65, 0x20, 0x24, 0x66, 0x69, 0x62, 0x65, 0x72, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x73, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64,
+	0x65, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x24, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x76, 0x61,
+	0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75,
+	0x62, 0x6C, 0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x73,
+	0x65, 0x74, 0x20, 0x24, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x76,
+	0x61, 0x6C, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x24, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x75, 0x6E, 0x65,
+	0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x76, 0x65, 0x72, 0x62, 0x3A, 0x20, 0x22,
+	0x20, 0x76, 0x65, 0x72, 0x62, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x6F, 0x6E,
+	0x65, 0x20, 0x30, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x73, 0x65, 0x71, 0x0A, 0x20, 0x20, 0x22, 0x53, 0x69,
+	0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x6C,
+	0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x61,
+	0x63, 0x63, 0x75, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+	0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x2E, 0x0A, 0x20, 0x20, 0x53,
+	0x65, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x68, 0x65, 0x61, 0x64, 0x20,
+	0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x24, 0x61, 0x63, 0x63, 0x75,
+	0x6D, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x64, 0x6F, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x2C, 0x24, 0x61, 0x63, 0x63, 0x75,
+	0x6D, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x20, 0x28, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x2C, 0x68, 0x65, 0x61, 0x64, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x20, 0x2C, 0x24, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x20, 0x28,
+	0x64, 0x6F, 0x20, 0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29,
+	0x29, 0x29, 0x20, 0x2C, 0x24, 0x61, 0x63, 0x63, 0x75, 0x6D,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x20, 0x61, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+	0x61, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x73, 0x69, 0x6E,
+	0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x53, 0x65, 0x65, 0x20,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x64,
+	0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x68, 0x65, 0x61, 0x64, 0x20, 0x26, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D, 0x20, 0x28, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x2C, 0x68, 0x65, 0x61, 0x64, 0x20, 0x28,
+	0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x28, 0x64, 0x6F, 0x20,
+	0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x0A, 0x20, 0x20,
+	0x22, 0x44, 0x6F, 0x20, 0x61, 0x20, 0x63, 0x20, 0x73, 0x74,
+	0x79, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x64,
+	0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E,
+	0x69, 0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x26, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x61, 0x70, 0x70,
+	0x6C, 0x79, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+	0x5B, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x5D, 0x5D, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x65, 0x61, 0x63,
+	0x68, 0x0A, 0x20, 0x20, 0x22, 0x4C, 0x6F, 0x6F, 0x70, 0x20,
+	0x6F, 0x76, 0x65, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x69,
+	0x6E, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69,
+	0x6E, 0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x3A, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x63, 0x6F, 0x72,
+	0x6F, 0x0A, 0x20, 0x20, 0x22, 0x41, 0x20, 0x77, 0x72, 0x61,
+	0x70, 0x70, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D,
+	0x61, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x73, 0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61,
+	0x73, 0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E,
+	0x65, 0x77, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D,
+	0x20, 0x2E, 0x2E, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E,
+	0x65, 0x77, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x27, 0x66, 0x6E, 0x20, 0x27, 0x5B, 0x26, 0x5D, 0x20, 0x3B,
+	0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x73, 0x75, 0x6D, 0x0A, 0x20,
+	0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+	0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73,
+	0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x30,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x61, 0x63, 0x63,
+	0x75, 0x6D, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78, 0x20, 0x3A, 0x69, 0x6E,
+	0x20, 0x78, 0x73, 0x5D, 0x20, 0x28, 0x2B, 0x3D, 0x20, 0x61,
+	0x63, 0x63, 0x75, 0x6D, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75,
+	0x63, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72,
+	0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78,
+	0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+	0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x31, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x78, 0x73, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D,
+	0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x78, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x78,
+	0x73, 0x5D, 0x20, 0x28, 0x2A, 0x3D, 0x20, 0x61, 0x63, 0x63,
+	0x75, 0x6D, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x61,
+	0x63, 0x63, 0x75, 0x6D, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x69, 0x66, 0x2D,
+	0x6C, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x6B,
+	0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x74,
+	0x68, 0x79, 0x2C, 0x0A, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x75, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+	0x72, 0x75, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x49,
+	0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E,
+	0x69, 0x6C, 0x2C, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x0A, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x42,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x68, 0x61,
+	0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+	0x65, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x61,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x74, 0x20,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x74, 0x72, 0x75, 0x20, 0x66, 0x61, 0x6C, 0x20, 0x26, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65,
+	0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x7A, 0x65,
+	0x72, 0x6F, 0x3F, 0x20, 0x6C, 0x65, 0x6E, 0x29, 0x20, 0x28,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x22, 0x65, 0x78, 0x70,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6C,
+	0x65, 0x61, 0x73, 0x74, 0x20, 0x31, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x64, 0x64, 0x3F, 0x20,
+	0x6C, 0x65, 0x6E, 0x29, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x61, 0x75, 0x78, 0x20, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x62, 0x6C, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x62, 0x72, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x28, 0x2B, 0x20, 0x31, 0x20, 0x69,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3E, 0x3D, 0x20, 0x69, 0x20, 0x6C, 0x65,
+	0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+	0x72, 0x75, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x74, 0x6D, 0x20,
+	0x28, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E,
+	0x74, 0x3F, 0x20, 0x62, 0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x79, 0x6D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x61,
+	0x74, 0x6D, 0x20, 0x62, 0x6C, 0x20, 0x28, 0x67, 0x65, 0x6E,
+	0x73, 0x79, 0x6D, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x61,
+	0x74, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x23, 0x20, 0x53, 0x69, 0x6D, 0x70, 0x6C,
+	0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20,
+	0x73, 0x79, 0x6D, 0x20, 0x62, 0x72, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x27, 0x69, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20,
+	0x28, 0x61, 0x75, 0x78, 0x20, 0x28, 0x2B, 0x20, 0x32, 0x20,
+	0x69, 0x29, 0x29, 0x20, 0x66, 0x61, 0x6C, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x23, 0x20, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x75, 0x72, 0x65, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x62, 0x72, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x69, 0x66, 0x20, 0x73,
+	0x79, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x64, 0x65, 0x66,
+	0x20, 0x62, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x61, 0x75, 0x78, 0x20, 0x28, 0x2B, 0x20, 0x32, 0x20,
+	0x69, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+	0x61, 0x6C, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x61, 0x75, 0x78, 0x20, 0x30, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74, 0x0A,
+	0x20, 0x20, 0x22, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73,
+	0x20, 0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x28, 0x64,
+	0x6F, 0x20, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+	0x5D, 0x0A, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66, 0x2D, 0x6C,
+	0x65, 0x74, 0x20, 0x2C, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x73, 0x20, 0x28, 0x64, 0x6F, 0x20, 0x2C, 0x3B, 0x62,
+	0x6F, 0x64, 0x79, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x0A, 0x20,
+	0x20, 0x22, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x6D, 0x75,
+	0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x73, 0x69, 0x74,
+	0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x26, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x6E, 0x69, 0x6C, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+	0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x32, 0x20,
+	0x28, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x5B, 0x66, 0x20, 0x67,
+	0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5D, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x66, 0x20,
+	0x28, 0x67, 0x20, 0x78, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x33, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x20,
+	0x5B, 0x5B, 0x66, 0x20, 0x67, 0x20, 0x68, 0x5D, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x73, 0x5D, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x78,
+	0x5D, 0x20, 0x28, 0x66, 0x20, 0x28, 0x67, 0x20, 0x28, 0x68,
+	0x20, 0x78, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x34, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x5B,
+	0x5B, 0x66, 0x20, 0x67, 0x20, 0x68, 0x20, 0x69, 0x5D, 0x20,
+	0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x73, 0x5D, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x78, 0x5D,
+	0x20, 0x28, 0x66, 0x20, 0x28, 0x67, 0x20, 0x28, 0x68, 0x20,
+	0x28, 0x69, 0x20, 0x78, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x20,
+	0x5B, 0x5B, 0x66, 0x20, 0x67, 0x20, 0x68, 0x20, 0x69, 0x20,
+	0x6A, 0x5D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x63, 0x6F, 0x6D, 0x70, 0x20, 0x28, 0x66, 0x6E, 0x20,
+	0x5B, 0x78, 0x5D, 0x20, 0x28, 0x66, 0x20, 0x28, 0x67, 0x20,
+	0x28, 0x68, 0x20, 0x28, 0x69, 0x20, 0x28, 0x6A, 0x20, 0x78,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3B, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C,
+	0x69, 0x63, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x73, 0x20, 0x35, 0x20, 0x2D, 0x31, 0x29, 0x29,
+	0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x0A,
+	0x20, 0x20, 0x22, 0x41, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67,
+	0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x22,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+	0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x66, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x66,
+	0x6E, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x6E, 0x6F, 0x74,
+	0x20, 0x28, 0x66, 0x20, 0x78, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65, 0x78, 0x74,
+	0x72, 0x65, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6D, 0x6F, 0x73, 0x74, 0x20, 0x65, 0x78, 0x74, 0x72, 0x65,
+	0x6D, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x62, 0x61, 0x73,
+	0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x2E, 0x0A, 0x20, 0x20, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64,
+	0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x74, 0x77, 0x6F, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x20, 0x28, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61,
+	0x72, 0x69, 0x73, 0x6F, 0x6E, 0x29, 0x2E, 0x0A, 0x20, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x69, 0x66, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+	0x61, 0x72, 0x67, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x28, 0x70, 0x6F, 0x73, 0x3F, 0x20, 0x6C, 0x65, 0x6E, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x5B, 0x72, 0x65, 0x74, 0x5D, 0x20, 0x61, 0x72, 0x67, 0x73,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67,
+	0x65, 0x20, 0x5B, 0x30, 0x20, 0x6C, 0x65, 0x6E, 0x5D, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x76, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x20, 0x76, 0x20, 0x72, 0x65, 0x74,
+	0x29, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x74,
+	0x20, 0x76, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x72, 0x65, 0x74, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6D, 0x61, 0x78, 0x0A, 0x20, 0x20, 0x22,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x20,
+	0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5D, 0x20, 0x28, 0x65,
+	0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x3E, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6D, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x22,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x20,
+	0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5D, 0x20, 0x28, 0x65,
+	0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x3C, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61,
+	0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F,
+	0x74, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65,
+	0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5D,
+	0x20, 0x28, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x6D, 0x69, 0x6E, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72,
+	0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x69, 0x6E, 0x69,
+	0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+	0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61,
+	0x6C, 0x0A, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+	0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5D, 0x20, 0x28,
+	0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x47, 0x65,
+	0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x78, 0x73, 0x20,
+	0x30, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x47,
+	0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x78, 0x73, 0x20,
+	0x28, 0x2D, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x78, 0x73, 0x29, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23,
+	0x23, 0x23, 0x20, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+	0x20, 0x43, 0x6F, 0x6D, 0x62, 0x69, 0x6E, 0x61, 0x74, 0x6F,
+	0x72, 0x73, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x6F, 0x72,
+	0x74, 0x0A, 0x20, 0x20, 0x22, 0x28, 0x73, 0x6F, 0x72, 0x74,
+	0x20, 0x78, 0x73, 0x20, 0x5B, 0x2C, 0x20, 0x62, 0x79, 0x5D,
+	0x29, 0x5C, 0x6E, 0x5C, 0x6E, 0x53, 0x6F, 0x72, 0x74, 0x20,
+	0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69,
+	0x6E, 0x2D, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2E, 0x20, 0x55,
+	0x73, 0x65, 0x73, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6B, 0x2D,
+	0x73, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x70,
+	0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x61, 0x20, 0x6C, 0x6F,
+	0x20, 0x68, 0x69, 0x20, 0x62, 0x79, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x70,
+	0x69, 0x76, 0x6F, 0x74, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20,
+	0x61, 0x20, 0x68, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20,
+	0x6C, 0x6F, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x6A, 0x20, 0x3A,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x6C, 0x6F, 0x20,
+	0x68, 0x69, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x6A,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x6A, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x62, 0x79, 0x20,
+	0x61, 0x6A, 0x20, 0x70, 0x69, 0x76, 0x6F, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x69, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x61, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x28, 0x61, 0x20, 0x69, 0x29, 0x20,
+	0x61, 0x6A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x28,
+	0x61, 0x20, 0x6A, 0x29, 0x20, 0x61, 0x69, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x2B, 0x2B, 0x20, 0x69, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x28,
+	0x61, 0x20, 0x68, 0x69, 0x29, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x61, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x61,
+	0x20, 0x69, 0x29, 0x20, 0x70, 0x69, 0x76, 0x6F, 0x74, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x73, 0x6F, 0x72, 0x74, 0x2D, 0x68, 0x65, 0x6C, 0x70,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x61, 0x20,
+	0x6C, 0x6F, 0x20, 0x68, 0x69, 0x20, 0x62, 0x79, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x28, 0x3E, 0x20, 0x68, 0x69, 0x20, 0x6C, 0x6F,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x69, 0x76, 0x20, 0x28,
+	0x70, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x61, 0x20, 0x6C, 0x6F, 0x20, 0x68, 0x69, 0x20, 0x62, 0x79,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x2D, 0x68, 0x65, 0x6C,
+	0x70, 0x20, 0x61, 0x20, 0x6C, 0x6F, 0x20, 0x28, 0x2D, 0x20,
+	0x70, 0x69, 0x76, 0x20, 0x31, 0x29, 0x20, 0x62, 0x79, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x6F, 0x72, 0x74, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x20,
+	0x61, 0x20, 0x28, 0x2B, 0x20, 0x70, 0x69, 0x76, 0x20, 0x31,
+	0x29, 0x20, 0x68, 0x69, 0x20, 0x62, 0x79, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x29, 0x0A, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x73, 0x6F,
+	0x72, 0x74, 0x20, 0x5B, 0x61, 0x20, 0x62, 0x79, 0x20, 0x26,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73,
+	0x6F, 0x72, 0x74, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x61,
+	0x20, 0x30, 0x20, 0x28, 0x2D, 0x20, 0x28, 0x6C, 0x65, 0x6E,
+	0x67, 0x74, 0x68, 0x20, 0x61, 0x29, 0x20, 0x31, 0x29, 0x20,
+	0x28, 0x6F, 0x72, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0x3C, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x73, 0x6F, 0x72, 0x74,
+	0x65, 0x64, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74,
+	0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x6F,
+	0x6E, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x69, 0x6E,
+	0x64, 0x20, 0x62, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x73,
+	0x6F, 0x72, 0x74, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x64,
+	0x29, 0x20, 0x62, 0x79, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65,
+	0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x64, 0x75, 0x63, 0x65,
+	0x2C, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6B, 0x6E, 0x6F,
+	0x77, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x2D,
+	0x6C, 0x65, 0x66, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61,
+	0x6E, 0x79, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67,
+	0x65, 0x73, 0x2C, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+	0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x29, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F,
+	0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x66, 0x20,
+	0x69, 0x6E, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x73,
+	0x20, 0x69, 0x6E, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78, 0x20, 0x3A, 0x69,
+	0x6E, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20,
+	0x28, 0x66, 0x20, 0x72, 0x65, 0x73, 0x20, 0x78, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6D, 0x61, 0x70, 0x0A,
+	0x20, 0x20, 0x22, 0x4D, 0x61, 0x70, 0x20, 0x61, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x76,
+	0x65, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+	0x74, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x66, 0x20,
+	0x26, 0x20, 0x69, 0x6E, 0x64, 0x73, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x69, 0x6E, 0x64, 0x73,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x69,
+	0x6E, 0x64, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3D, 0x20, 0x30, 0x20, 0x6E, 0x69, 0x6E,
+	0x64, 0x73, 0x29, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64,
+	0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20,
+	0x31, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20,
+	0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72,
+	0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x28, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20,
+	0x69, 0x6E, 0x64, 0x73, 0x20, 0x30, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69,
+	0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30,
+	0x20, 0x6E, 0x69, 0x6E, 0x64, 0x73, 0x5D, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x20,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x73, 0x20, 0x69, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x28, 0x3C, 0x20, 0x6C, 0x20, 0x6C, 0x69, 0x6D, 0x69,
+	0x74, 0x29, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6C, 0x69,
+	0x6D, 0x69, 0x74, 0x20, 0x6C, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x5B, 0x69, 0x31, 0x20,
+	0x69, 0x32, 0x20, 0x69, 0x33, 0x20, 0x69, 0x34, 0x5D, 0x20,
+	0x69, 0x6E, 0x64, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x73, 0x20, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6C, 0x69,
+	0x6D, 0x69, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x63,
+	0x61, 0x73, 0x65, 0x20, 0x6E, 0x69, 0x6E, 0x64, 0x73, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67,
+	0x65, 0x20, 0x5B, 0x30, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74,
+	0x5D, 0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x72,
+	0x65, 0x73, 0x20, 0x69, 0x29, 0x20, 0x28, 0x66, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x69, 0x31, 0x20, 0x69, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x32, 0x20, 0x28,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72,
+	0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x20, 0x6C, 0x69,
+	0x6D, 0x69, 0x74, 0x5D, 0x5D, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x28, 0x72, 0x65, 0x73, 0x20, 0x69, 0x29, 0x20, 0x28,
+	0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69, 0x31, 0x20,
+	0x69, 0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69, 0x32,
+	0x20, 0x69, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x33, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B,
+	0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B,
+	0x30, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x5D, 0x5D, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x72, 0x65, 0x73, 0x20,
+	0x69, 0x29, 0x20, 0x28, 0x66, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x69, 0x31, 0x20, 0x69, 0x29, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x69, 0x32, 0x20, 0x69, 0x29, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x69, 0x33, 0x20, 0x69, 0x29, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x34, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x20, 0x6C, 0x69, 0x6D,
+	0x69, 0x74, 0x5D, 0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x28, 0x72, 0x65, 0x73, 0x20, 0x69, 0x29, 0x20, 0x28, 0x66,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69, 0x31, 0x20, 0x69,
+	0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69, 0x32, 0x20,
+	0x69, 0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69, 0x33,
+	0x20, 0x69, 0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69,
+	0x34, 0x20, 0x69, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69,
+	0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30,
+	0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x5D, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x61, 0x72, 0x67, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6E, 0x69, 0x6E, 0x64,
+	0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x6A, 0x20, 0x3A,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x20, 0x6E,
+	0x69, 0x6E, 0x64, 0x73, 0x5D, 0x5D, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x20, 0x6A, 0x29,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x69, 0x6E, 0x64, 0x73, 0x20, 0x6A, 0x29, 0x20, 0x69,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x72, 0x65, 0x73, 0x20,
+	0x69, 0x29, 0x20, 0x28, 0x66, 0x20, 0x3B, 0x61, 0x72, 0x67,
+	0x73, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65,
+	0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0x0A, 0x20, 0x20, 0x22,
+	0x4D, 0x61, 0x70, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+	0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20,
+	0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74,
+	0x65, 0x6E, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x66, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72, 0x65, 0x73,
+	0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78, 0x20, 0x3A, 0x69, 0x6E,
+	0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E,
+	0x63, 0x61, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x28, 0x66,
+	0x20, 0x78, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65,
+	0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x73,
+	0x79, 0x6D, 0x73, 0x0A, 0x20, 0x20, 0x22, 0x45, 0x76, 0x61,
+	0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63,
+	0x68, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x69,
+	0x6E, 0x20, 0x73, 0x79, 0x6D, 0x73, 0x20, 0x62, 0x6F, 0x75,
+	0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x67, 0x65,
+	0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x75,
+	0x6E, 0x69, 0x71, 0x75, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62,
+	0x6F, 0x6C, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x73, 0x79,
+	0x6D, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5D,
+	0x0A, 0x20, 0x20, 0x7E, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x2C,
+	0x28, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0x20, 0x28, 0x66,
+	0x6E, 0x20, 0x5B, 0x73, 0x5D, 0x20, 0x40, 0x5B, 0x73, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x67, 0x65, 0x6E,
+	0x73, 0x79, 0x6D, 0x29, 0x5D, 0x29, 0x20, 0x73, 0x79, 0x6D,
+	0x73, 0x29, 0x20, 0x2C, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66,
+	0x69, 0x6C, 0x74, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x22, 0x47,
+	0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74, 0x61,
+	0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x6C,
+	0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x66, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63,
+	0x68, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x65, 0x6C,
+	0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20,
+	0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+	0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x72, 0x65, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x74,
+	0x65, 0x6D, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6D,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20,
+	0x72, 0x65, 0x73, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E,
+	0x74, 0x0A, 0x20, 0x20, 0x22, 0x43, 0x6F, 0x75, 0x6E, 0x74,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28, 0x70,
+	0x72, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x0A,
+	0x20, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20,
+	0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20,
+	0x30, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x5B, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3A, 0x69, 0x6E,
+	0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20,
+	0x69, 0x74, 0x65, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x2B, 0x2B, 0x20, 0x63, 0x6F, 0x75, 0x6E,
+	0x74, 0x65, 0x72, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x63,
+	0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x0A,
+	0x20, 0x20, 0x22, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C,
+	0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x0A, 0x20, 0x20,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28, 0x70, 0x72, 0x65,
+	0x64, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68,
+	0x79, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20,
+	0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x72, 0x65, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B,
+	0x69, 0x74, 0x65, 0x6D, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x69,
+	0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x79, 0x20, 0x28,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x29,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20,
+	0x72, 0x65, 0x73, 0x20, 0x79, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x0A, 0x20,
+	0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x5B, 0x73,
+	0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x67, 0x69,
+	0x76, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x65, 0x70, 0x2E, 0x0A,
+	0x20, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x65,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x2C, 0x20,
+	0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68,
+	0x20, 0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x61, 0x20, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74,
+	0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69,
+	0x74, 0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2C, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20,
+	0x73, 0x74, 0x65, 0x70, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x31,
+	0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x5B, 0x6E,
+	0x5D, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6E, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x20, 0x6E, 0x5D, 0x5D,
+	0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72, 0x20,
+	0x69, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x32, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x5B, 0x6E, 0x20, 0x6D, 0x5D, 0x20, 0x61, 0x72,
+	0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x72, 0x72,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+	0x77, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+	0x5B, 0x6E, 0x20, 0x6D, 0x5D, 0x5D, 0x20, 0x28, 0x70, 0x75,
+	0x74, 0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x2D, 0x20, 0x69,
+	0x20, 0x6E, 0x29, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x33, 0x20, 0x28, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x5B, 0x6E, 0x20, 0x6D, 0x20, 0x73,
+	0x5D, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6E, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x20, 0x5B, 0x6E, 0x20, 0x6D, 0x20, 0x73,
+	0x5D, 0x5D, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72,
+	0x72, 0x20, 0x28, 0x2D, 0x20, 0x69, 0x20, 0x6E, 0x29, 0x20,
+	0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x22, 0x65,
+	0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x31, 0x20,
+	0x74, 0x6F, 0x20, 0x33, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x22, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x2D,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x0A, 0x20, 0x20, 0x22, 0x46,
+	0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69,
+	0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x30, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x67, 0x6F,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x28, 0x3C, 0x20, 0x69, 0x20, 0x6C, 0x65,
+	0x6E, 0x29, 0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x69,
+	0x74, 0x65, 0x6D, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x69,
+	0x6E, 0x64, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64,
+	0x20, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x61,
+	0x6C, 0x73, 0x65, 0x29, 0x20, 0x28, 0x2B, 0x2B, 0x20, 0x69,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+	0x69, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x66, 0x69, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x22, 0x46,
+	0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+	0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x69, 0x65, 0x73, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x0A, 0x20, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E,
+	0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x69,
+	0x72, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x77, 0x61,
+	0x79, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65,
+	0x72, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x74, 0x65, 0x20, 0x61,
+	0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+	0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+	0x2E, 0x20, 0x43, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72,
+	0x20, 0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65,
+	0x78, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x73, 0x73, 0x75,
+	0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65,
+	0x64, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x69, 0x20, 0x28, 0x66, 0x69, 0x6E,
+	0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x70, 0x72,
+	0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x69, 0x20,
+	0x6E, 0x69, 0x6C, 0x29, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x69, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C,
+	0x0A, 0x20, 0x20, 0x22, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E,
+	0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x61,
+	0x74, 0x69, 0x73, 0x66, 0x79, 0x0A, 0x20, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x62, 0x6F,
+	0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64,
+	0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x69, 0x20, 0x28, 0x66, 0x69, 0x6E, 0x64,
+	0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69,
+	0x63, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x30, 0x20, 0x69,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x74,
+	0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x0A,
+	0x20, 0x20, 0x22, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73,
+	0x20, 0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74,
+	0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29,
+	0x20, 0x69, 0x6E, 0x64, 0x29, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75,
+	0x6E, 0x74, 0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x29, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x72, 0x6F, 0x70,
+	0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x22,
+	0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72,
+	0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72,
+	0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x79, 0x0A, 0x20,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+	0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75,
+	0x72, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70,
+	0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x69, 0x20, 0x28, 0x66,
+	0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x20,
+	0x69, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0x0A, 0x20, 0x20, 0x22, 0x53, 0x61, 0x6D, 0x65, 0x20,
+	0x61, 0x73, 0x20, 0x28, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x75,
+	0x6E, 0x74, 0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x29, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+	0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x72, 0x6F, 0x70,
+	0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F,
+	0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x29, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6A, 0x75,
+	0x78, 0x74, 0x2A, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6A,
+	0x75, 0x78, 0x74, 0x61, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+	0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x6F, 0x72, 0x64,
+	0x73, 0x2C, 0x0A, 0x20, 0x20, 0x28, 0x28, 0x6A, 0x75, 0x78,
+	0x74, 0x2A, 0x20, 0x61, 0x20, 0x62, 0x20, 0x63, 0x29, 0x20,
+	0x78, 0x29, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+	0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x28, 0x61, 0x20,
+	0x78, 0x29, 0x20, 0x28, 0x62, 0x20, 0x78, 0x29, 0x20, 0x28,
+	0x63, 0x20, 0x78, 0x29, 0x29, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x20, 0x61, 0x72,
+	0x67, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x74, 0x20, 0x40, 0x5B, 0x5D,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x66, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x66,
+	0x75, 0x6E, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x20, 0x72, 0x65, 0x74, 0x20, 0x28, 0x66, 0x20,
+	0x3B, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x72, 0x65, 0x74, 0x20,
+	0x30, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x6A, 0x75, 0x78, 0x74,
+	0x0A, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x75,
+	0x78, 0x74, 0x2A, 0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20,
+	0x62, 0x65, 0x68, 0x61, 0x76, 0x69, 0x6F, 0x72, 0x20, 0x62,
+	0x75, 0x74, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66,
+	0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x61,
+	0x72, 0x74, 0x73, 0x20, 0x40, 0x5B, 0x27, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x24, 0x61, 0x72, 0x67, 0x73, 0x20, 0x28, 0x67,
+	0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x66, 0x20, 0x3A,
+	0x69, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x75, 0x73, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x70,
+	0x70, 0x6C, 0x79, 0x20, 0x66, 0x20, 0x24, 0x61, 0x72, 0x67,
+	0x73, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x27, 0x66, 0x6E, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x27, 0x26, 0x20, 0x24, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x61,
+	0x72, 0x74, 0x73, 0x20, 0x30, 0x29, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x22, 0x54, 0x68, 0x72, 0x65,
+	0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73,
+	0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x0A, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73,
+	0x65, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69,
+	0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+	0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x0A,
+	0x20, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F,
+	0x6E, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C,
+	0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20,
+	0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x6F, 0x70,
+	0x20, 0x5B, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x5B,
+	0x68, 0x20, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6E, 0x20,
+	0x30, 0x29, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x6E, 0x20, 0x31, 0x29,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x20, 0x40, 0x5B,
+	0x5D, 0x5D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E,
+	0x63, 0x61, 0x74, 0x20, 0x40, 0x5B, 0x68, 0x20, 0x6C, 0x61,
+	0x73, 0x74, 0x5D, 0x20, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73,
+	0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73,
+	0x20, 0x30, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x72, 0x65,
+	0x64, 0x75, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x70, 0x20, 0x78,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x2D, 0x3E, 0x3E, 0x0A, 0x20, 0x20, 0x22, 0x54, 0x68, 0x72,
+	0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+	0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x0A,
+	0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65,
+	0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72,
+	0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+	0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+	0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E,
+	0x2E, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69,
+	0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74,
+	0x61, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20, 0x26,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x6F, 0x70, 0x20,
+	0x5B, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x5B, 0x68,
+	0x20, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x74,
+	0x79, 0x70, 0x65, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6E, 0x20, 0x30,
+	0x29, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73,
+	0x6C, 0x69, 0x63, 0x65, 0x20, 0x6E, 0x20, 0x31, 0x29, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x20, 0x40, 0x5B, 0x5D,
+	0x5D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63,
+	0x61, 0x74, 0x20, 0x40, 0x5B, 0x68, 0x5D, 0x20, 0x74, 0x20,
+	0x40, 0x5B, 0x6C, 0x61, 0x73, 0x74, 0x5D, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x73, 0x20, 0x30, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x70,
+	0x20, 0x78, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x20, 0x2D, 0x3F, 0x3E, 0x0A, 0x20, 0x20, 0x22, 0x53,
+	0x68, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75,
+	0x69, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20,
+	0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x78, 0x20,
+	0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x69, 0x6E,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+	0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D,
+	0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+	0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x69,
+	0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72,
+	0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+	0x2E, 0x0A, 0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65,
+	0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78,
+	0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x6F,
+	0x70, 0x20, 0x5B, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x5B, 0x68, 0x20, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x28, 0x3D, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6E, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6E,
+	0x20, 0x30, 0x29, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x6E, 0x20, 0x31,
+	0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x5B, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x20, 0x40,
+	0x5B, 0x5D, 0x5D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x61,
+	0x72, 0x74, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x40, 0x5B,
+	0x68, 0x20, 0x73, 0x79, 0x6D, 0x5D, 0x20, 0x74, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x6C, 0x65, 0x74,
+	0x20, 0x5B, 0x2C, 0x73, 0x79, 0x6D, 0x20, 0x2C, 0x6C, 0x61,
+	0x73, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x2C, 0x73,
+	0x79, 0x6D, 0x20, 0x2C, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x73, 0x20, 0x30, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x66,
+	0x6F, 0x70, 0x20, 0x78, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x2D, 0x3F, 0x3E, 0x3E, 0x0A, 0x20,
+	0x20, 0x22, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E,
+	0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49,
+	0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x78, 0x20, 0x61,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+	0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61,
+	0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x69, 0x66,
+	0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6D,
+	0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+	0x0A, 0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C,
+	0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20,
+	0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x6F, 0x70,
+	0x20, 0x5B, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x5B,
+	0x68, 0x20, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6E, 0x20,
+	0x30, 0x29, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x6E, 0x20, 0x31, 0x29,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x20, 0x40, 0x5B,
+	0x5D, 0x5D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x28, 0x67,
+	0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x40, 0x5B, 0x68,
+	0x5D, 0x20, 0x74, 0x20, 0x40, 0x5B, 0x73, 0x79, 0x6D, 0x5D,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x6C,
+	0x65, 0x74, 0x20, 0x5B, 0x2C, 0x73, 0x79, 0x6D, 0x20, 0x2C,
+	0x6C, 0x61, 0x73, 0x74, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x2C, 0x73, 0x79, 0x6D, 0x20, 0x2C, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x74, 0x73, 0x20, 0x30, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65,
+	0x20, 0x66, 0x6F, 0x70, 0x20, 0x78, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E, 0x64,
+	0x20, 0x5B, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x74, 0x20, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6C, 0x65,
+	0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x65, 0x61, 0x63,
+	0x68, 0x20, 0x78, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x28, 0x66, 0x20, 0x78, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x77, 0x61, 0x6C,
+	0x6B, 0x2D, 0x64, 0x69, 0x63, 0x74, 0x20, 0x5B, 0x66, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x74, 0x20, 0x40, 0x7B, 0x7D,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x5B, 0x6B, 0x20, 0x3A, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x70, 0x75, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x28, 0x66,
+	0x20, 0x6B, 0x29, 0x20, 0x28, 0x66, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6B, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x77, 0x61, 0x6C,
+	0x6B, 0x0A, 0x20, 0x20, 0x22, 0x49, 0x74, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x66, 0x0A, 0x20, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x43,
+	0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x61, 0x73, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x0A, 0x20, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C,
+	0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+	0x28, 0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x64, 0x69, 0x63, 0x74,
+	0x20, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F,
+	0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x28, 0x77,
+	0x61, 0x6C, 0x6B, 0x2D, 0x64, 0x69, 0x63, 0x74, 0x20, 0x66,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x28,
+	0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E, 0x64, 0x20, 0x66,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x28, 0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E, 0x64,
+	0x20, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x70, 0x75, 0x74, 0x20, 0x5F, 0x65, 0x6E,
+	0x76, 0x20, 0x27, 0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E,
+	0x64, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x28, 0x70, 0x75,
+	0x74, 0x20, 0x5F, 0x65, 0x6E, 0x76, 0x20, 0x27, 0x77, 0x61,
+	0x6C, 0x6B, 0x2D, 0x64, 0x69, 0x63, 0x74, 0x20, 0x6E, 0x69,
+	0x6C, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x70, 0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B, 0x0A, 0x20,
+	0x20, 0x22, 0x44, 0x6F, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x73,
+	0x74, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x72,
+	0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x28, 0x66, 0x20,
+	0x78, 0x29, 0x0A, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x76,
+	0x65, 0x72, 0x79, 0x20, 0x76, 0x69, 0x73, 0x69, 0x74, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x66, 0x20, 0x28, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x70, 0x6F,
+	0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x78,
+	0x29, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x70, 0x72,
+	0x65, 0x77, 0x61, 0x6C, 0x6B, 0x0A, 0x20, 0x20, 0x22, 0x53,
+	0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20,
+	0x70, 0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B, 0x2C, 0x20,
+	0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x70, 0x72, 0x65,
+	0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x72, 0x61,
+	0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x28, 0x66,
+	0x6E, 0x20, 0x5B, 0x78, 0x5D, 0x20, 0x28, 0x70, 0x72, 0x65,
+	0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x78, 0x29, 0x29,
+	0x20, 0x28, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x20, 0x61, 0x73, 0x2D, 0x3E, 0x0A, 0x20, 0x20,
+	0x22, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68,
+	0x65, 0x72, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x0A, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x6C,
+	0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20, 0x61, 0x73, 0x20,
+	0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x65, 0x76,
+	0x20, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3A, 0x69,
+	0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79,
+	0x6D, 0x20, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6E, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x65, 0x76,
+	0x20, 0x28, 0x70, 0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B,
+	0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x79, 0x5D, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x79, 0x20, 0x61, 0x73,
+	0x29, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x79, 0x29, 0x29, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x70, 0x72, 0x65, 0x76,
+	0x20, 0x7E, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x2C, 0x73,
+	0x79, 0x6D, 0x20, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x5D, 0x20,
+	0x2C, 0x6E, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x65, 0x76,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x20, 0x61, 0x73, 0x3F, 0x2D, 0x3E, 0x0A, 0x20,
+	0x20, 0x22, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74,
+	0x68, 0x65, 0x72, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x0A, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x78, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61,
+	0x6E, 0x79, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72,
+	0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x3B, 0x20, 0x6F,
+	0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x0A, 0x20, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x78, 0x20, 0x61, 0x73, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72,
+	0x20, 0x70, 0x72, 0x65, 0x76, 0x20, 0x78, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x28, 0x67, 0x65,
+	0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x65, 0x78, 0x74,
+	0x2D, 0x70, 0x72, 0x65, 0x76, 0x20, 0x28, 0x70, 0x6F, 0x73,
+	0x74, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x28, 0x66, 0x6E, 0x20,
+	0x5B, 0x79, 0x5D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x79, 0x20, 0x61, 0x73, 0x29, 0x20, 0x73, 0x79, 0x6D,
+	0x20, 0x79, 0x29, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x70, 0x72, 0x65, 0x76, 0x20, 0x7E, 0x28, 0x69, 0x66,
+	0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x2C, 0x73, 0x79, 0x6D,
+	0x20, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x5D, 0x20, 0x2C, 0x6E,
+	0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x65, 0x76, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x69, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x22, 0x50, 0x61,
+	0x72, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69,
+	0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x66, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x7A,
+	0x65, 0x72, 0x6F, 0x3F, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x29, 0x20,
+	0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x6E, 0x20,
+	0x5B, 0x26, 0x20, 0x72, 0x5D, 0x20, 0x28, 0x66, 0x20, 0x3B,
+	0x6D, 0x6F, 0x72, 0x65, 0x20, 0x3B, 0x72, 0x29, 0x29, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65,
+	0x76, 0x65, 0x72, 0x79, 0x3F, 0x0A, 0x20, 0x20, 0x22, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20,
+	0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0A,
+	0x20, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x72, 0x65, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x5B, 0x78, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+	0x20, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x65,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x78, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
+	0x73, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x76, 0x65,
+	0x72, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72,
+	0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x74, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x74, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6E,
+	0x20, 0x28, 0x64, 0x65, 0x63, 0x20, 0x6C, 0x65, 0x6E, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72,
+	0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 0x20, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6C,
+	0x65, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x28, 0x3E, 0x3D, 0x20, 0x6E, 0x20,
+	0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x72,
+	0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x74, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x2D, 0x2D, 0x20, 0x6E, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
+	0x64, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x0A, 0x20, 0x20, 0x22,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x77,
+	0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B,
+	0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x61, 0x72, 0x65,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+	0x6C, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x68, 0x61,
+	0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+	0x65, 0x0A, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x6F,
+	0x6E, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x62, 0x65, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72,
+	0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x64, 0x73,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72,
+	0x65, 0x74, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x6B, 0x20, 0x3A,
+	0x6B, 0x65, 0x79, 0x73, 0x20, 0x64, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x72, 0x65,
+	0x74, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x64, 0x73, 0x20,
+	0x6B, 0x29, 0x20, 0x6B, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72,
+	0x65, 0x74, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0x0A, 0x20,
+	0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+	0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x73, 0x2F, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73,
+	0x2E, 0x0A, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6B,
+	0x65, 0x79, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72, 0x65, 0x73,
+	0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x6C, 0x6B, 0x20, 0x28, 0x6C, 0x65, 0x6E,
+	0x67, 0x74, 0x68, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x76,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x76,
+	0x61, 0x6C, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x28, 0x3C, 0x20, 0x6C, 0x6B, 0x20, 0x6C, 0x76, 0x29,
+	0x20, 0x6C, 0x6B, 0x20, 0x6C, 0x76, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20,
+	0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x20,
+	0x6C, 0x65, 0x6E, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x70, 0x75, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x69,
+	0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C,
+	0x73, 0x20, 0x69, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72,
+	0x65, 0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20,
+	0x22, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 0x61,
+	0x20, 0x6B, 0x65, 0x79, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61,
+	0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x27, 0x20,
+	0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20,
+	0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x2E, 0x0A, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6B, 0x65,
+	0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x2C, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65,
+	0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x73, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x64, 0x73, 0x20,
+	0x6B, 0x65, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x26,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x28,
+	0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x20, 0x28, 0x66,
+	0x75, 0x6E, 0x63, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x3B, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D,
+	0x69, 0x6E, 0x74, 0x6F, 0x0A, 0x20, 0x20, 0x22, 0x4D, 0x65,
+	0x72, 0x67, 0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69,
+	0x70, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73,
+	0x2F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20, 0x69,
+	0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65,
+	0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68,
+	0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x63,
+	0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+	0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65,
+	0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72,
+	0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79,
+	0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20,
+	0x6F, 0x6E, 0x65, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x74, 0x61, 0x62, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x5B, 0x63, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x63, 0x6F,
+	0x6C, 0x6C, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3A, 0x6B, 0x65,
+	0x79, 0x73, 0x20, 0x63, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x74, 0x61, 0x62, 0x20,
+	0x6B, 0x65, 0x79, 0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20,
+	0x63, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x0A, 0x20,
+	0x20, 0x22, 0x4D, 0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x6D,
+	0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E,
+	0x20, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C,
+	0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74,
+	0x68, 0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70,
+	0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70,
+	0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F, 0x6E,
+	0x65, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x26, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x40, 0x7B, 0x7D,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x5B, 0x63, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x63, 0x6F, 0x6C,
+	0x6C, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3A, 0x6B, 0x65, 0x79,
+	0x73, 0x20, 0x63, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x61,
+	0x69, 0x6E, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x63, 0x20, 0x6B, 0x65, 0x79,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+	0x61, 0x69, 0x6E, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x0A, 0x20,
+	0x20, 0x22, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E,
+	0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69,
+	0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x28, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x78, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6B, 0x20,
+	0x28, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x78, 0x20, 0x6E, 0x69,
+	0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x6B, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73,
+	0x68, 0x20, 0x61, 0x72, 0x72, 0x20, 0x6B, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6B, 0x20,
+	0x28, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x78, 0x20, 0x6B, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x22, 0x47, 0x65, 0x74,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x73,
+	0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x75, 0x72, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x61, 0x72, 0x72, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x6E, 0x65, 0x77, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x78, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x6B, 0x20, 0x28, 0x6E, 0x65,
+	0x78, 0x74, 0x20, 0x78, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+	0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+	0x6B, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x61,
+	0x72, 0x72, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x78, 0x20,
+	0x6B, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73,
+	0x65, 0x74, 0x20, 0x6B, 0x20, 0x28, 0x6E, 0x65, 0x78, 0x74,
+	0x20, 0x78, 0x20, 0x6B, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x0A, 0x20, 0x20,
+	0x22, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74,
+	0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x28,
+	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x78, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6B,
+	0x20, 0x28, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x78, 0x20, 0x6E,
+	0x69, 0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20,
+	0x6E, 0x69, 0x6C, 0x20, 0x6B, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x20, 0x61, 0x72, 0x72, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x6B, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x78, 0x20, 0x6B, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6B, 0x20, 0x28,
+	0x6E, 0x65, 0x78, 0x74, 0x20, 0x78, 0x20, 0x6B, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x72, 0x65, 0x71,
+	0x75, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x0A, 0x20, 0x20,
+	0x22, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+	0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6F,
+	0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73,
+	0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x72, 0x65, 0x71, 0x73,
+	0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x78,
+	0x20, 0x3A, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x66, 0x72, 0x65, 0x71,
+	0x73, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x28, 0x66, 0x72, 0x65, 0x71,
+	0x73, 0x20, 0x78, 0x29, 0x20, 0x28, 0x69, 0x66, 0x20, 0x6E,
+	0x20, 0x28, 0x2B, 0x20, 0x31, 0x20, 0x6E, 0x29, 0x20, 0x31,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x66, 0x72, 0x65, 0x71,
+	0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x72, 0x6C, 0x65, 0x61, 0x76, 0x65,
+	0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+	0x20, 0x63, 0x6F, 0x6C, 0x2C, 0x0A, 0x20, 0x20, 0x74, 0x68,
+	0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+	0x6F, 0x6E, 0x64, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x63, 0x6F, 0x6C, 0x73,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72,
+	0x65, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x63, 0x6F, 0x6C, 0x20,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x63, 0x6F,
+	0x6C, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68,
+	0x65, 0x6E, 0x20, 0x28, 0x3E, 0x20, 0x6E, 0x63, 0x6F, 0x6C,
+	0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6D, 0x69,
+	0x6E, 0x20, 0x3B, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x5B, 0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E,
+	0x67, 0x65, 0x20, 0x5B, 0x30, 0x20, 0x6C, 0x65, 0x6E, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x63, 0x69, 0x20, 0x3A, 0x72, 0x61, 0x6E, 0x67,
+	0x65, 0x20, 0x5B, 0x30, 0x20, 0x6E, 0x63, 0x6F, 0x6C, 0x5D,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73,
+	0x68, 0x20, 0x72, 0x65, 0x73, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x73,
+	0x20, 0x63, 0x69, 0x29, 0x20, 0x69, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x69, 0x73, 0x74, 0x69,
+	0x6E, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x64, 0x65, 0x64, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61,
+	0x74, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x78, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x74, 0x20, 0x40, 0x5B, 0x5D,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73,
+	0x65, 0x65, 0x6E, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78, 0x20,
+	0x3A, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x5D, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x73, 0x65, 0x65,
+	0x6E, 0x20, 0x78, 0x29, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x28,
+	0x64, 0x6F, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x73, 0x65,
+	0x65, 0x6E, 0x20, 0x78, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x20, 0x72, 0x65, 0x74, 0x20, 0x78, 0x29, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x66, 0x6C, 0x61,
+	0x74, 0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0x0A,
+	0x20, 0x20, 0x22, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x29,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x70, 0x70, 0x65,
+	0x6E, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65,
+	0x70, 0x74, 0x68, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x74, 0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20,
+	0x6F, 0x66, 0x0A, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x27, 0x69,
+	0x6E, 0x74, 0x6F, 0x27, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+	0x69, 0x6E, 0x74, 0x6F, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x69, 0x6E, 0x74, 0x6F, 0x20, 0x78, 0x73, 0x5D, 0x0A, 0x20,
+	0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78, 0x20,
+	0x3A, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x65, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x6C, 0x61, 0x74,
+	0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x69,
+	0x6E, 0x74, 0x6F, 0x20, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x75, 0x73, 0x68, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+	0x78, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x0A, 0x20, 0x20,
+	0x22, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x29, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74,
+	0x68, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72,
+	0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66,
+	0x0A, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x78, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x66, 0x6C, 0x61,
+	0x74, 0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+	0x40, 0x5B, 0x5D, 0x20, 0x78, 0x73, 0x29, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x6B, 0x76, 0x73, 0x0A,
+	0x20, 0x20, 0x22, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61,
+	0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+	0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x0A, 0x20, 0x20,
+	0x6C, 0x69, 0x6B, 0x65, 0x20, 0x40, 0x5B, 0x6B, 0x20, 0x76,
+	0x20, 0x6B, 0x20, 0x76, 0x20, 0x2E, 0x2E, 0x2E, 0x5D, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x64, 0x69, 0x63, 0x74,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72,
+	0x65, 0x74, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x6E, 0x65, 0x77, 0x20, 0x28, 0x2A, 0x20, 0x32, 0x20, 0x28,
+	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x64, 0x69, 0x63,
+	0x74, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C,
+	0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x6B, 0x20, 0x3A, 0x6B, 0x65,
+	0x79, 0x73, 0x20, 0x64, 0x69, 0x63, 0x74, 0x5D, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x6B, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x64, 0x69, 0x63, 0x74, 0x20, 0x6B, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x72, 0x70, 0x6F, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73,
+	0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x64,
+	0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64,
+	0x20, 0x62, 0x79, 0x0A, 0x20, 0x20, 0x73, 0x65, 0x70, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x73, 0x65, 0x70, 0x20,
+	0x69, 0x6E, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E,
+	0x67, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72, 0x65, 0x74,
+	0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+	0x77, 0x20, 0x28, 0x2D, 0x20, 0x28, 0x2A, 0x20, 0x32, 0x20,
+	0x6C, 0x65, 0x6E, 0x29, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3E, 0x20, 0x6C,
+	0x65, 0x6E, 0x20, 0x30, 0x29, 0x20, 0x28, 0x70, 0x75, 0x74,
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x30, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x30, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20,
+	0x31, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0x20, 0x28, 0x3C, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x72, 0x65,
+	0x74, 0x20, 0x73, 0x65, 0x70, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x69, 0x6E, 0x64, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x2B, 0x2B, 0x20, 0x69, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A, 0x0A, 0x23,
+	0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23,
+	0x20, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x4D,
+	0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x0A, 0x23, 0x23,
+	0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x23, 0x20, 0x53,
+	0x65, 0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6C, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x69,
+	0x73, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x2D, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x69,
+	0x6E, 0x65, 0x6C, 0x20, 0x7E, 0x27, 0x2C, 0x28, 0x67, 0x65,
+	0x6E, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x2D, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x2D, 0x31, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x61, 0x74, 0x74,
+	0x65, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x20, 0x6F,
+	0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x65, 0x65,
+	0x6E, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x64,
+	0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x79, 0x6D,
+	0x62, 0x6F, 0x6C, 0x3F, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65,
+	0x72, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x73, 0x65, 0x65,
+	0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3D, 0x20, 0x2C, 0x70, 0x61, 0x74, 0x74,
+	0x65, 0x72, 0x6E, 0x20, 0x2C, 0x65, 0x78, 0x70, 0x72, 0x29,
+	0x20, 0x2C, 0x28, 0x6F, 0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x29, 0x20, 0x2C, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x6E, 0x65,
+	0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6E,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x6E, 0x69, 0x6C, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x2C, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x2C,
+	0x65, 0x78, 0x70, 0x72, 0x29, 0x29, 0x20, 0x2C, 0x73, 0x65,
+	0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6C, 0x20, 0x2C, 0x28, 0x6F,
+	0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x3F, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6D, 0x61,
+	0x74, 0x63, 0x68, 0x2D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70, 0x61, 0x74,
+	0x74, 0x65, 0x72, 0x6E, 0x20, 0x30, 0x29, 0x20, 0x65, 0x78,
+	0x70, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x61, 0x6E, 0x64, 0x20, 0x2C, 0x3B, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x31, 0x29, 0x29,
+	0x20, 0x2C, 0x28, 0x6F, 0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x29, 0x20, 0x2C, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x6E, 0x65,
+	0x6C, 0x29, 0x29, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3F, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6C, 0x65, 0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x2D, 0x31, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x69, 0x74,
+	0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x61, 0x72, 0x72,
+	0x20, 0x65, 0x78, 0x70, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0x20, 0x2C,
+	0x24, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2C, 0x28, 0x28,
+	0x66, 0x6E, 0x20, 0x61, 0x75, 0x78, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2B, 0x2B, 0x20, 0x69,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x28, 0x3D, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6F,
+	0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0x2D, 0x31, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x69, 0x29, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x67, 0x65, 0x74,
+	0x20, 0x24, 0x61, 0x72, 0x72, 0x20, 0x69, 0x29, 0x20, 0x61,
+	0x75, 0x78, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x29, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x2C, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x6E,
+	0x65, 0x6C, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x72, 0x79, 0x3F, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x6E, 0x69, 0x6C, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x64, 0x69,
+	0x63, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7E, 0x28, 0x69, 0x66,
+	0x20, 0x28, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x72, 0x79, 0x3F, 0x20, 0x2C, 0x24, 0x64, 0x69, 0x63, 0x74,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x2C, 0x28, 0x28, 0x66, 0x6E, 0x20, 0x61,
+	0x75, 0x78, 0x20, 0x5B, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x28, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x70, 0x61, 0x74, 0x74,
+	0x65, 0x72, 0x6E, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28,
+	0x3D, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x6E, 0x69, 0x6C, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6F,
+	0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0x2D, 0x31, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x6B, 0x65, 0x79,
+	0x29, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x67,
+	0x65, 0x74, 0x20, 0x24, 0x64, 0x69, 0x63, 0x74, 0x20, 0x6B,
+	0x65, 0x79, 0x29, 0x20, 0x61, 0x75, 0x78, 0x20, 0x73, 0x65,
+	0x65, 0x6E, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2C, 0x73,
+	0x65, 0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6C, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x65, 0x6C, 0x73,
+	0x65, 0x20, 0x7E, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20,
+	0x2C, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x2C,
+	0x65, 0x78, 0x70, 0x72, 0x29, 0x20, 0x2C, 0x28, 0x6F, 0x6E,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x29, 0x20, 0x2C, 0x73, 0x65,
+	0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6C, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x22,
+	0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x6D, 0x61,
+	0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x4D, 0x61,
+	0x74, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x78, 0x20,
+	0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x0A, 0x20, 0x20,
+	0x61, 0x6E, 0x79, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x2E,
+	0x20, 0x45, 0x61, 0x73, 0x79, 0x20, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x74,
+	0x65, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x74,
+	0x63, 0x68, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74,
+	0x2C, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64,
+	0x0A, 0x20, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x20, 0x65,
+	0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+	0x74, 0x6F, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+	0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x69, 0x73,
+	0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x2E, 0x20,
+	0x41, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x0A, 0x20, 0x20,
+	0x61, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
+	0x61, 0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x2C, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x78, 0x27,
+	0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x62,
+	0x6F, 0x6C, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x0A, 0x20, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+	0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66,
+	0x20, 0x69, 0x74, 0x27, 0x73, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65,
+	0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E,
+	0x0A, 0x20, 0x20, 0x78, 0x2E, 0x20, 0x41, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6D,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x73,
+	0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x78, 0x2E, 0x20, 0x41, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
+	0x69, 0x66, 0x20, 0x69, 0x74, 0x27, 0x73, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x0A, 0x20,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65,
+	0x64, 0x20, 0x61, 0x73, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+	0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20,
+	0x41, 0x6E, 0x79, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74,
+	0x65, 0x72, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F,
+	0x6E, 0x6C, 0x79, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20,
+	0x78, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20, 0x26,
+	0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D,
+	0x70, 0x20, 0x24, 0x78, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65,
+	0x6E, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+	0x63, 0x61, 0x73, 0x65, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C,
+	0x65, 0x6E, 0x2D, 0x31, 0x20, 0x28, 0x64, 0x65, 0x63, 0x20,
+	0x6C, 0x65, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x28, 0x66, 0x6E, 0x20, 0x61, 0x75, 0x78,
+	0x20, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x64, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x3D, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x2D, 0x31, 0x29,
+	0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65,
+	0x73, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3C, 0x20, 0x69, 0x20,
+	0x6C, 0x65, 0x6E, 0x2D, 0x31, 0x29, 0x20, 0x28, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0x20, 0x5B, 0x24,
+	0x72, 0x65, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7E,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x2C, 0x73, 0x65,
+	0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6C, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x2C, 0x24, 0x72, 0x65, 0x73, 0x20, 0x2C, 0x28,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x2D, 0x31, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x20, 0x69,
+	0x29, 0x20, 0x24, 0x78, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B,
+	0x5D, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x63, 0x61, 0x73,
+	0x65, 0x73, 0x20, 0x28, 0x69, 0x6E, 0x63, 0x20, 0x69, 0x29,
+	0x29, 0x29, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2C, 0x28, 0x61,
+	0x75, 0x78, 0x20, 0x28, 0x2B, 0x20, 0x32, 0x20, 0x69, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2C,
+	0x24, 0x72, 0x65, 0x73, 0x29, 0x29, 0x29, 0x29, 0x20, 0x30,
+	0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x70, 0x75, 0x74, 0x20,
+	0x5F, 0x65, 0x6E, 0x76, 0x20, 0x27, 0x73, 0x65, 0x6E, 0x74,
+	0x69, 0x6E, 0x65, 0x6C, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A,
+	0x28, 0x70, 0x75, 0x74, 0x20, 0x5F, 0x65, 0x6E, 0x76, 0x20,
+	0x27, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2D, 0x31, 0x20, 0x6E,
+	0x69, 0x6C, 0x29, 0x0A, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23,
+	0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x20, 0x44, 0x6F, 0x63,
+	0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x0A,
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x2A, 0x64, 0x6F, 0x63, 0x2D,
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x2A, 0x0A, 0x20, 0x20, 0x22,
+	0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x63,
+	0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20,
+	0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x63, 0x75,
+	0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x38, 0x30, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x6F, 0x63, 0x2D, 0x66,
+	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x52,
+	0x65, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x74, 0x65,
+	0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x61, 0x70,
+	0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x74, 0x65, 0x78, 0x74, 0x5D, 0x0A, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6D, 0x61, 0x78, 0x63,
+	0x6F, 0x6C, 0x20, 0x28, 0x2D, 0x20, 0x2A, 0x64, 0x6F, 0x63,
+	0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2A, 0x20, 0x38, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x62,
+	0x75, 0x66, 0x20, 0x40, 0x22, 0x20, 0x20, 0x20, 0x20, 0x22,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x77,
+	0x6F, 0x72, 0x64, 0x20, 0x40, 0x22, 0x22, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x30, 0x29, 0x0A, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x70, 0x75, 0x73, 0x68,
+	0x77, 0x6F, 0x72, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6F, 0x6C, 0x64, 0x63, 0x75, 0x72, 0x20, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x70, 0x61, 0x63,
+	0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x28, 0x3C, 0x3D, 0x20, 0x6D, 0x61, 0x78,
+	0x63, 0x6F, 0x6C, 0x20, 0x28, 0x2B, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+	0x74, 0x68, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x20, 0x31,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x6F, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x30, 0x29,
+	0x20, 0x22, 0x5C, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x22, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x20, 0x28, 0x2B, 0x2B, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x22, 0x20, 0x22, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2B, 0x3D,
+	0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x28,
+	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x77, 0x6F, 0x72,
+	0x64, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x28, 0x3E, 0x20, 0x6F, 0x6C, 0x64, 0x63, 0x75,
+	0x72, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70,
+	0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x62, 0x75, 0x66, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65,
+	0x72, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75,
+	0x66, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+	0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x77, 0x6F, 0x72, 0x64,
+	0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x5B, 0x62, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x74,
+	0x65, 0x78, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x6E,
+	0x6F, 0x74, 0x3D, 0x20, 0x62, 0x20, 0x31, 0x30, 0x29, 0x20,
+	0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x62, 0x20, 0x33, 0x32,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x62, 0x20,
+	0x39, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x22, 0x20,
+	0x20, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x62, 0x79, 0x74,
+	0x65, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x62, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3E, 0x20,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x77, 0x6F,
+	0x72, 0x64, 0x29, 0x20, 0x30, 0x29, 0x20, 0x28, 0x70, 0x75,
+	0x73, 0x68, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x3D, 0x20, 0x62, 0x20,
+	0x31, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x20,
+	0x22, 0x5C, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x30, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x0A, 0x0A, 0x20, 0x20, 0x23, 0x20, 0x4C, 0x61, 0x73,
+	0x74, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x0A, 0x20, 0x20, 0x28,
+	0x70, 0x75, 0x73, 0x68, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x62, 0x75, 0x66, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x6F, 0x63, 0x2A, 0x0A,
+	0x20, 0x20, 0x22, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+	0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x69, 0x6E,
+	0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x65,
+	0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x65, 0x6E, 0x76, 0x20,
+	0x73, 0x79, 0x6D, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x78, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x65,
+	0x6E, 0x76, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20,
+	0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x72,
+	0x69, 0x6E, 0x74, 0x20, 0x22, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x20, 0x22, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x22, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E,
+	0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2D, 0x74, 0x79, 0x70,
+	0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x20,
+	0x20, 0x20, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x63, 0x6F, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x78, 0x20, 0x3A, 0x72,
+	0x65, 0x66, 0x29, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x3A, 0x76, 0x61, 0x72, 0x20, 0x22, 0x20, 0x28,
+	0x22, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x28, 0x78, 0x20, 0x3A, 0x72, 0x65, 0x66,
+	0x29, 0x20, 0x30, 0x29, 0x29, 0x20, 0x22, 0x29, 0x22, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x78, 0x20, 0x3A, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x29, 0x20,
+	0x3A, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x28, 0x78, 0x20, 0x3A, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x5C, 0x6E, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x6D,
+	0x20, 0x28, 0x78, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x2D, 0x6D, 0x61, 0x70, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x64,
+	0x20, 0x28, 0x78, 0x20, 0x3A, 0x64, 0x6F, 0x63, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x72,
+	0x69, 0x6E, 0x74, 0x20, 0x22, 0x5C, 0x6E, 0x5C, 0x6E, 0x22,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x64, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x5B, 0x70, 0x61, 0x74,
+	0x68, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x65, 0x6E,
+	0x64, 0x5D, 0x20, 0x73, 0x6D, 0x5D, 0x20, 0x28, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x22, 0x20, 0x28,
+	0x22, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x22, 0x3A,
+	0x22, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x22, 0x29, 0x5C, 0x6E,
+	0x22, 0x29, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x64, 0x20,
+	0x73, 0x6D, 0x29, 0x20, 0x22, 0x5C, 0x6E, 0x22, 0x20, 0x22,
+	0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x64, 0x20, 0x28, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F, 0x72,
+	0x6D, 0x61, 0x74, 0x20, 0x64, 0x29, 0x20, 0x22, 0x6E, 0x6F,
+	0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+	0x2E, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5C, 0x6E,
+	0x5C, 0x6E, 0x22, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x64,
+	0x6F, 0x63, 0x0A, 0x20, 0x20, 0x22, 0x53, 0x68, 0x6F, 0x77,
+	0x73, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x73, 0x79, 0x6D, 0x5D, 0x0A, 0x20, 0x20, 0x7E,
+	0x28, 0x2C, 0x64, 0x6F, 0x63, 0x2A, 0x20, 0x2A, 0x65, 0x6E,
+	0x76, 0x2A, 0x20, 0x27, 0x2C, 0x73, 0x79, 0x6D, 0x29, 0x29,
+	0x0A, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A,
+	0x23, 0x23, 0x23, 0x20, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x45, 0x78, 0x70, 0x61, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x0A,
+	0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x6D, 0x61, 0x63, 0x65, 0x78,
+	0x31, 0x0A, 0x20, 0x20, 0x22, 0x45, 0x78, 0x70, 0x61, 0x6E,
+	0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x20,
+	0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74,
+	0x20, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65,
+	0x6C, 0x79, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x64, 0x6F, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x5B, 0x74, 0x20, 0x6F, 0x6E, 0x2D, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6E, 0x65, 0x77, 0x74, 0x20, 0x40,
+	0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76,
+	0x61, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x28, 0x6E, 0x65,
+	0x78, 0x74, 0x20, 0x74, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x6E, 0x65,
+	0x77, 0x74, 0x20, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31,
+	0x20, 0x6B, 0x65, 0x79, 0x29, 0x20, 0x28, 0x6F, 0x6E, 0x2D,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x6B, 0x65, 0x79, 0x20, 0x28, 0x6E, 0x65, 0x78, 0x74,
+	0x20, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x6E, 0x65, 0x77, 0x74, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65,
+	0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x73, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3A, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x65, 0x78, 0x70, 0x61,
+	0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x65, 0x78, 0x70, 0x61,
+	0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x28,
+	0x64, 0x6F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x78, 0x20,
+	0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F,
+	0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x28, 0x64,
+	0x6F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x78, 0x20, 0x65,
+	0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31,
+	0x20, 0x78, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E,
+	0x64, 0x64, 0x65, 0x66, 0x20, 0x5B, 0x74, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x61,
+	0x73, 0x74, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x74, 0x20,
+	0x28, 0x2D, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x74, 0x29, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x62, 0x6F,
+	0x75, 0x6E, 0x64, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x74,
+	0x20, 0x31, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+	0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61,
+	0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x40, 0x5B, 0x28, 0x67, 0x65, 0x74, 0x20, 0x74, 0x20, 0x30,
+	0x29, 0x20, 0x28, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x62,
+	0x6F, 0x75, 0x6E, 0x64, 0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x74, 0x20,
+	0x32, 0x20, 0x2D, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x5B, 0x28, 0x6D, 0x61, 0x63,
+	0x65, 0x78, 0x31, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x29, 0x5D,
+	0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x61,
+	0x6C, 0x6C, 0x20, 0x5B, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x61, 0x72, 0x67, 0x73,
+	0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x65,
+	0x78, 0x31, 0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x74, 0x20, 0x31, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x74,
+	0x20, 0x30, 0x29, 0x20, 0x3B, 0x61, 0x72, 0x67, 0x73, 0x29,
+	0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x66, 0x6E, 0x20,
+	0x5B, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x74, 0x31, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x74, 0x20, 0x31, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x73, 0x79, 0x6D, 0x62,
+	0x6F, 0x6C, 0x3F, 0x20, 0x74, 0x31, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x28, 0x6D, 0x61, 0x70,
+	0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x74, 0x20, 0x33, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x66, 0x6E, 0x20, 0x74, 0x31, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x74, 0x20, 0x32, 0x29, 0x20,
+	0x3B, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x28, 0x6D, 0x61, 0x70,
+	0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x74, 0x20, 0x32, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x27, 0x66, 0x6E, 0x20, 0x74, 0x31, 0x20,
+	0x3B, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65,
+	0x78, 0x70, 0x61, 0x6E, 0x64, 0x71, 0x71, 0x20, 0x5B, 0x74,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x71, 0x71, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x78, 0x30, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x78,
+	0x20, 0x30, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x72, 0x20,
+	0x28, 0x3D, 0x20, 0x27, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74,
+	0x65, 0x20, 0x78, 0x30, 0x29, 0x20, 0x28, 0x3D, 0x20, 0x27,
+	0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x2D, 0x73, 0x70,
+	0x6C, 0x69, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x78, 0x30, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x78, 0x30,
+	0x20, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x78, 0x20, 0x31, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69,
+	0x63, 0x65, 0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x71, 0x71,
+	0x20, 0x78, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x71, 0x71, 0x20,
+	0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x28, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x28, 0x6D, 0x61, 0x70, 0x20,
+	0x71, 0x71, 0x20, 0x28, 0x6B, 0x76, 0x73, 0x20, 0x78, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x28, 0x6D, 0x61,
+	0x70, 0x20, 0x71, 0x71, 0x20, 0x28, 0x6B, 0x76, 0x73, 0x20,
+	0x78, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x74, 0x20, 0x30, 0x29, 0x20, 0x28, 0x71,
+	0x71, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x74, 0x20, 0x31,
+	0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x73, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x7B, 0x27, 0x73, 0x65, 0x74, 0x20, 0x65,
+	0x78, 0x70, 0x61, 0x6E, 0x64, 0x64, 0x65, 0x66, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x27, 0x64, 0x65, 0x66, 0x20, 0x65,
+	0x78, 0x70, 0x61, 0x6E, 0x64, 0x64, 0x65, 0x66, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x27, 0x64, 0x6F, 0x20, 0x65, 0x78,
+	0x70, 0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6C, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x27, 0x66, 0x6E, 0x20, 0x65, 0x78, 0x70,
+	0x61, 0x6E, 0x64, 0x66, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x27, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E,
+	0x64, 0x61, 0x6C, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x27, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x20, 0x69, 0x64, 0x65,
+	0x6E, 0x74, 0x69, 0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x27, 0x71, 0x75, 0x61, 0x73, 0x69, 0x71, 0x75, 0x6F,
+	0x74, 0x65, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x71,
+	0x71, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x76, 0x61,
+	0x72, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x64, 0x65,
+	0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+	0x61, 0x6C, 0x6C, 0x7D, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x6F, 0x74, 0x75, 0x70,
+	0x20, 0x5B, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x68, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x74, 0x20, 0x30, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x73, 0x20, 0x68,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x28, 0x6F,
+	0x72, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x2A, 0x65, 0x6E,
+	0x76, 0x2A, 0x20, 0x68, 0x29, 0x20, 0x7B, 0x7D, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x6D, 0x20, 0x28, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x3A,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6D, 0x3F, 0x20,
+	0x28, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x3A, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x63, 0x6F, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x73, 0x20, 0x28, 0x73, 0x20, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x3F, 0x20, 0x28,
+	0x6D, 0x20, 0x3B, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x74, 0x20, 0x31, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x65,
+	0x78, 0x31, 0x20, 0x74, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72, 0x65, 0x74,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x75, 0x70, 0x20,
+	0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x28, 0x6D, 0x61, 0x70,
+	0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x78, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x20, 0x78, 0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x78, 0x20, 0x6D, 0x61, 0x63, 0x65,
+	0x78, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x61, 0x6C,
+	0x6C, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20,
+	0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x64, 0x20, 0x78,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x72, 0x65, 0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x78,
+	0x20, 0x3A, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x3A, 0x77,
+	0x68, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x74, 0x5D, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x28,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x74, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x0A, 0x20,
+	0x20, 0x22, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E,
+	0x69, 0x6C, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+	0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x72,
+	0x65, 0x64, 0x20, 0x78, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x74, 0x20, 0x6E, 0x69,
+	0x6C, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x5B, 0x78, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x78, 0x73,
+	0x20, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x6E,
+	0x6F, 0x74, 0x20, 0x72, 0x65, 0x74, 0x29, 0x5D, 0x20, 0x28,
+	0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x79, 0x20,
+	0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x29, 0x5D, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x79,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x64, 0x65,
+	0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x0A, 0x20, 0x20,
+	0x22, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x3D,
+	0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6D, 0x75, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2C, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x73, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64,
+	0x0A, 0x20, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x69,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76,
+	0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61,
+	0x6C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+	0x65, 0x2E, 0x20, 0x4D, 0x75, 0x63, 0x68, 0x20, 0x73, 0x6C,
+	0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+	0x6E, 0x6F, 0x74, 0x3D, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x78, 0x20, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x74, 0x78, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65,
+	0x20, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6F, 0x72,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D,
+	0x20, 0x74, 0x78, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x79, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63,
+	0x61, 0x73, 0x65, 0x20, 0x74, 0x78, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x28, 0x6F, 0x72, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x78, 0x29,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x79,
+	0x29, 0x29, 0x20, 0x28, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x69,
+	0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x28, 0x6D,
+	0x61, 0x70, 0x20, 0x64, 0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F,
+	0x74, 0x3D, 0x20, 0x78, 0x20, 0x79, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x28, 0x6E, 0x6F,
+	0x74, 0x3D, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x78, 0x29, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+	0x68, 0x20, 0x79, 0x29, 0x29, 0x20, 0x28, 0x73, 0x6F, 0x6D,
+	0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79,
+	0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x64, 0x65, 0x65, 0x70,
+	0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78, 0x20, 0x79, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x28, 0x64, 0x65,
+	0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x28, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x20, 0x78, 0x29, 0x20, 0x28, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x20, 0x79, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x28, 0x64, 0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F,
+	0x74, 0x3D, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x78, 0x29, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x79, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x28, 0x6E,
+	0x6F, 0x74, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x78, 0x29, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x79, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78,
+	0x20, 0x79, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x64, 0x65, 0x65, 0x70, 0x3D, 0x0A,
+	0x20, 0x20, 0x22, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x3D, 0x2C,
+	0x20, 0x62, 0x75, 0x74, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2C, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x73, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63,
+	0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x0A,
+	0x20, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x69, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65,
+	0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+	0x2E, 0x20, 0x4D, 0x75, 0x63, 0x68, 0x20, 0x73, 0x6C, 0x6F,
+	0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x3D,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x20, 0x79, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x28, 0x64,
+	0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78,
+	0x20, 0x79, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x0A, 0x20,
+	0x20, 0x22, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x6D,
+	0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x6C, 0x65, 0x74, 0x65, 0x6C, 0x79, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73,
+	0x20, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72,
+	0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x28,
+	0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x78, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x6F,
+	0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x30, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x64,
+	0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x63,
+	0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65,
+	0x76, 0x69, 0x6F, 0x75, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3E, 0x20, 0x28, 0x2B,
+	0x2B, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x29,
+	0x20, 0x32, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x22,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x61,
+	0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x6F, 0x20,
+	0x6E, 0x65, 0x73, 0x74, 0x65, 0x64, 0x22, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x70,
+	0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78,
+	0x31, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x70, 0x70, 0x0A, 0x20, 0x20, 0x22, 0x50, 0x72, 0x65,
+	0x74, 0x74, 0x79, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78, 0x5D, 0x0A, 0x20, 0x20,
+	0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x28, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x70, 0x72, 0x65, 0x74, 0x74,
+	0x79, 0x20, 0x78, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x23, 0x23,
+	0x23, 0x0A, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x23, 0x23, 0x20,
+	0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x23, 0x23, 0x23,
+	0x0A, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76,
+	0x0A, 0x20, 0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+	0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x68, 0x65, 0x72, 0x69, 0x74,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x62,
+	0x75, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x6F, 0x6C,
+	0x6C, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x26, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x61,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x5F, 0x65, 0x6E, 0x76, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E,
+	0x65, 0x77, 0x65, 0x6E, 0x76, 0x20, 0x28, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74,
+	0x6F, 0x20, 0x40, 0x7B, 0x7D, 0x20, 0x70, 0x61, 0x72, 0x65,
+	0x6E, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x6E, 0x65, 0x77,
+	0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x0A, 0x20, 0x20, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x5B, 0x70, 0x20, 0x77, 0x68, 0x65, 0x72,
+	0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65,
+	0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x64,
+	0x65, 0x72, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x69, 0x6E, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x77, 0x68, 0x65, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x20, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x70, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x3A, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x6F, 0x72, 0x20, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x70, 0x29, 0x20,
+	0x22, 0x75, 0x6E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64,
+	0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72,
+	0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5C, 0x6E,
+	0x22, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x44, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+	0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6D, 0x73, 0x67,
+	0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x66, 0x20, 0x77, 0x68,
+	0x65, 0x72, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73,
+	0x74, 0x64, 0x65, 0x72, 0x72, 0x20, 0x22, 0x63, 0x6F, 0x6D,
+	0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x3A, 0x20, 0x22, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x22, 0x20,
+	0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x20, 0x77, 0x68,
+	0x65, 0x72, 0x65, 0x20, 0x22, 0x5C, 0x6E, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x66, 0x20, 0x28, 0x64, 0x65, 0x62, 0x75,
+	0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61,
+	0x63, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x66, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x0A, 0x20, 0x20,
+	0x22, 0x52, 0x65, 0x61, 0x64, 0x20, 0x61, 0x20, 0x6C, 0x69,
+	0x6E, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74,
+	0x64, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x62, 0x75, 0x66, 0x20, 0x70, 0x20, 0x26,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x62, 0x75, 0x66, 0x20, 0x40, 0x22, 0x22,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x70, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x77, 0x72,
+	0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74,
+	0x20, 0x70, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x20, 0x73, 0x74,
+	0x64, 0x69, 0x6E, 0x20, 0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+	0x62, 0x75, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x62, 0x75, 0x66,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x72,
+	0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74,
+	0x0A, 0x20, 0x20, 0x22, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x20, 0x54,
+	0x68, 0x69, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x73, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E,
+	0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+	0x6E, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x61, 0x70, 0x73, 0x75,
+	0x6C, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x75, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x20, 0x20,
+	0x6F, 0x70, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6F,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C,
+	0x6C, 0x6F, 0x77, 0x73, 0x3A, 0x5C, 0x6E, 0x5C, 0x6E, 0x5C,
+	0x74, 0x0A, 0x20, 0x20, 0x3A, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+	0x73, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61,
+	0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64,
+	0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66,
+	0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x67, 0x65,
+	0x74, 0x6C, 0x69, 0x6E, 0x65, 0x5C, 0x6E, 0x5C, 0x74, 0x0A,
+	0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20,
+	0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77,
+	0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E,
+	0x67, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x2D, 0x20,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x5C, 0x6E, 0x5C, 0x74, 0x0A, 0x20, 0x20, 0x3A, 0x65, 0x6E,
+	0x76, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+	0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+	0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x2D,
+	0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x5C, 0x6E, 0x5C,
+	0x74, 0x0A, 0x20, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x2D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x62, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x73, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x5C, 0x22, 0x3C,
+	0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x3E,
+	0x5C, 0x22, 0x5C, 0x6E, 0x5C, 0x74, 0x0A, 0x20, 0x20, 0x3A,
+	0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+	0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x63,
+	0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77, 0x68,
+	0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73,
+	0x20, 0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+	0x20, 0x69, 0x73, 0x20, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x5C, 0x6E, 0x5C, 0x74, 0x0A,
+	0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62,
+	0x61, 0x63, 0x6B, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x64, 0x20,
+	0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5C,
+	0x6E, 0x5C, 0x74, 0x0A, 0x20, 0x20, 0x3A, 0x62, 0x61, 0x74,
+	0x63, 0x68, 0x20, 0x2D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x6F, 0x66,
+	0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65,
+	0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6D,
+	0x70, 0x69, 0x6C, 0x65, 0x2D, 0x62, 0x61, 0x74, 0x63, 0x68,
+	0x2C, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x0A,
+	0x20, 0x20, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72,
+	0x20, 0x72, 0x75, 0x6E, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66,
+	0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x61,
+	0x6C, 0x73, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6F, 0x70,
+	0x74, 0x73, 0x5D, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x7B, 0x3A, 0x65, 0x6E, 0x76, 0x20, 0x65, 0x6E,
+	0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3A, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x63, 0x68,
+	0x75, 0x6E, 0x6B, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61,
+	0x74, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F,
+	0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20,
+	0x62, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x7D, 0x20, 0x6F,
+	0x70, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x20,
+	0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x63, 0x68,
+	0x75, 0x6E, 0x6B, 0x73, 0x20, 0x67, 0x65, 0x74, 0x6C, 0x69,
+	0x6E, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x61, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x6E, 0x73, 0x74, 0x61,
+	0x74, 0x75, 0x73, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+	0x73, 0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x62,
+	0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+	0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x22, 0x3C, 0x61,
+	0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x3E, 0x22,
+	0x29, 0x0A, 0x0A, 0x20, 0x20, 0x23, 0x20, 0x41, 0x72, 0x65,
+	0x20, 0x77, 0x65, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x79,
+	0x65, 0x74, 0x3F, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72,
+	0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x23, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x6F,
+	0x62, 0x6A, 0x65, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x70, 0x20, 0x28, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x29, 0x29, 0x0A, 0x0A,
+	0x20, 0x20, 0x23, 0x20, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x69, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x23, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x64, 0x2E, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73,
+	0x20, 0x40, 0x5B, 0x30, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x6E,
+	0x20, 0x5B, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x69, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x67, 0x6F, 0x6F, 0x64, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x6E, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E,
+	0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x72, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x5B,
+	0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x73, 0x5D,
+	0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D,
+	0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x20, 0x69, 0x29, 0x20, 0x65, 0x6E,
+	0x76, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x70, 0x72,
+	0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x29, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x73, 0x20, 0x69, 0x29, 0x20, 0x65, 0x6E, 0x76,
+	0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x72, 0x65, 0x73, 0x29, 0x20, 0x3A, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x66, 0x61, 0x6C,
+	0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x7B, 0x3A, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x65, 0x72, 0x72, 0x20, 0x3A, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3A, 0x65,
+	0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x3A, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x66, 0x7D, 0x20,
+	0x72, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6D, 0x73, 0x67, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3C,
+	0x3D, 0x20, 0x30, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x3A, 0x20, 0x22, 0x20, 0x65, 0x72, 0x72, 0x20, 0x22,
+	0x20, 0x61, 0x74, 0x20, 0x28, 0x22, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x22, 0x3A, 0x22, 0x20, 0x65, 0x6E, 0x64,
+	0x20, 0x22, 0x29, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x6F, 0x6E, 0x2D, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x65, 0x72, 0x72, 0x66,
+	0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x61, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70,
+	0x75, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73,
+	0x73, 0x20, 0x30, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72, 0x65, 0x73, 0x20,
+	0x28, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x66, 0x20,
+	0x6E, 0x69, 0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x67, 0x6F, 0x6F, 0x64,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67,
+	0x20, 0x28, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x20, 0x66, 0x20, 0x72, 0x65, 0x73, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x41, 0x66, 0x74, 0x65,
+	0x72, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x2C, 0x20, 0x67, 0x6F, 0x20, 0x6F, 0x6E, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x28,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x66, 0x29, 0x20, 0x3A, 0x64, 0x65, 0x61,
+	0x64, 0x29, 0x20, 0x6E, 0x20, 0x28, 0x2B, 0x20, 0x31, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+	0x65, 0x73, 0x73, 0x20, 0x30, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x6C,
+	0x64, 0x65, 0x6E, 0x76, 0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2A,
+	0x65, 0x6E, 0x76, 0x2A, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x23, 0x20, 0x52, 0x75, 0x6E, 0x20, 0x6C,
+	0x6F, 0x6F, 0x70, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x62, 0x75, 0x66, 0x20, 0x40, 0x22, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x67,
+	0x6F, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x65,
+	0x61, 0x72, 0x20, 0x62, 0x75, 0x66, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20,
+	0x62, 0x75, 0x66, 0x20, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x70, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x70, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6C, 0x65, 0x6E,
+	0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x62,
+	0x75, 0x66, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 0x20,
+	0x30, 0x29, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x67, 0x6F,
+	0x69, 0x6E, 0x67, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x28, 0x3E, 0x20, 0x6C, 0x65, 0x6E, 0x20,
+	0x70, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x2B, 0x3D, 0x20, 0x70, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x20, 0x28, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65,
+	0x20, 0x70, 0x20, 0x62, 0x75, 0x66, 0x20, 0x70, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65,
+	0x20, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68,
+	0x61, 0x73, 0x2D, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x28, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x72, 0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75,
+	0x63, 0x65, 0x20, 0x70, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69,
+	0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x3C, 0x20,
+	0x69, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2B, 0x3D, 0x20,
+	0x69, 0x20, 0x28, 0x65, 0x76, 0x61, 0x6C, 0x6E, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x20, 0x69, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+	0x70, 0x29, 0x20, 0x3A, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x70, 0x20, 0x77, 0x68, 0x65,
+	0x72, 0x65, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x20, 0x70, 0x29, 0x20, 0x3A, 0x70, 0x65, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x70,
+	0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29, 0x29, 0x0A, 0x0A,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x65, 0x6E,
+	0x76, 0x2A, 0x20, 0x6F, 0x6C, 0x64, 0x65, 0x6E, 0x76, 0x29,
+	0x0A, 0x0A, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20,
+	0x22, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+	0x72, 0x6F, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x0A, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x73,
+	0x65, 0x20, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
+	0x65, 0x78, 0x74, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x73,
+	0x74, 0x72, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x61,
+	0x74, 0x65, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x73, 0x74, 0x72, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+	0x73, 0x20, 0x5B, 0x62, 0x75, 0x66, 0x20, 0x5F, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x72,
+	0x65, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x73,
+	0x74, 0x61, 0x74, 0x65, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x72, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x62, 0x75, 0x66, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x20, 0x22,
+	0x5C, 0x6E, 0x22, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x76, 0x61, 0x6C, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
+	0x65, 0x78, 0x74, 0x20, 0x7B, 0x3A, 0x65, 0x6E, 0x76, 0x20,
+	0x65, 0x6E, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3A, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x63, 0x68,
+	0x75, 0x6E, 0x6B, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+	0x28, 0x66, 0x6E, 0x20, 0x5B, 0x66, 0x20, 0x76, 0x61, 0x6C,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x76, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x28, 0x3D,
+	0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74,
+	0x61, 0x74, 0x75, 0x73, 0x20, 0x66, 0x29, 0x20, 0x3A, 0x64,
+	0x65, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74, 0x72,
+	0x61, 0x63, 0x65, 0x20, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x22, 0x65, 0x76,
+	0x61, 0x6C, 0x22, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x0A,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x0A, 0x20, 0x20, 0x22, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x49,
+	0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x72, 0x6F, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x75,
+	0x73, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E,
+	0x74, 0x65, 0x78, 0x74, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x26,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x2A, 0x65, 0x6E,
+	0x76, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x72, 0x65, 0x73, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x65,
+	0x6E, 0x76, 0x20, 0x22, 0x65, 0x76, 0x61, 0x6C, 0x22, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+	0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x72, 0x65, 0x73,
+	0x29, 0x20, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x72, 0x65,
+	0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3A,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0x0A, 0x20,
+	0x20, 0x22, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x73, 0x74,
+	0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2E,
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
+	0x77, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x73, 0x75, 0x62,
+	0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x65, 0x66, 0x6F,
+	0x72, 0x6D, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x61,
+	0x63, 0x68, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x3A,
+	0x73, 0x79, 0x73, 0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D,
+	0x65, 0x73, 0x0A, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2F, 0x2A, 0x73, 0x79, 0x73, 0x70, 0x61, 0x74, 0x68,
+	0x2A, 0x2C, 0x20, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20,
+	0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x6E, 0x61,
+	0x6D, 0x65, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x2F, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+	0x6C, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6C, 0x6C, 0x79, 0x2E,
+	0x0A, 0x20, 0x20, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69,
+	0x63, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E,
+	0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x75, 0x73, 0x75, 0x61,
+	0x6C, 0x6C, 0x79, 0x20, 0x64, 0x6C, 0x6C, 0x0A, 0x20, 0x20,
+	0x6F, 0x72, 0x20, 0x73, 0x6F, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x40, 0x5B, 0x22, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x22, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x22, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0x2F, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65,
+	0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3A, 0x73,
+	0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x22, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61,
+	0x6C, 0x6C, 0x3A, 0x2F, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x22, 0x5D, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2D,
+	0x70, 0x61, 0x74, 0x68, 0x73, 0x0A, 0x20, 0x20, 0x22, 0x53,
+	0x65, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61,
+	0x74, 0x68, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x40, 0x5B, 0x22,
+	0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x3A, 0x6E,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x22, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0x2F, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x2E, 0x3A, 0x6E,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x22, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A,
+	0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x74, 0x69,
+	0x76, 0x65, 0x3A, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22,
+	0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C,
+	0x3A, 0x2F, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x2E, 0x3A,
+	0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x22, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x22,
+	0x5D, 0x29, 0x0A, 0x0A, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73, 0x79, 0x73,
+	0x70, 0x61, 0x74, 0x68, 0x2A, 0x0A, 0x20, 0x20, 0x22, 0x54,
+	0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68,
+	0x65, 0x72, 0x65, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C,
+	0x65, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69,
+	0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6C, 0x6F, 0x63,
+	0x61, 0x74, 0x65, 0x64, 0x2E, 0x0A, 0x20, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x4A, 0x41, 0x4E, 0x45, 0x54, 0x5F,
+	0x50, 0x41, 0x54, 0x48, 0x2C, 0x0A, 0x20, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74,
+	0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x6F, 0x63, 0x61,
+	0x6C, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A, 0x61, 0x6E, 0x65,
+	0x74, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x75, 0x78,
+	0x2F, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x2C, 0x20, 0x61, 0x6E,
+	0x64, 0x0A, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x69, 0x6E,
+	0x64, 0x6F, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x28, 0x6F, 0x72, 0x20, 0x28, 0x6F, 0x73, 0x2F, 0x67,
+	0x65, 0x74, 0x65, 0x6E, 0x76, 0x20, 0x22, 0x4A, 0x41, 0x4E,
+	0x45, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20,
+	0x28, 0x3D, 0x20, 0x3A, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77,
+	0x73, 0x20, 0x28, 0x6F, 0x73, 0x2F, 0x77, 0x68, 0x69, 0x63,
+	0x68, 0x29, 0x29, 0x20, 0x22, 0x22, 0x20, 0x22, 0x2F, 0x75,
+	0x73, 0x72, 0x2F, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2F, 0x6C,
+	0x69, 0x62, 0x2F, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x22, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E,
+	0x64, 0x0A, 0x20, 0x20, 0x22, 0x54, 0x72, 0x79, 0x20, 0x74,
+	0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2E, 0x22, 0x0A, 0x20,
+	0x20, 0x5B, 0x70, 0x61, 0x74, 0x68, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x28, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74,
+	0x20, 0x22, 0x2F, 0x22, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E,
+	0x61, 0x6D, 0x65, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x70,
+	0x61, 0x72, 0x74, 0x73, 0x20, 0x28, 0x2D, 0x20, 0x28, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74,
+	0x73, 0x29, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x3A, 0x77, 0x69,
+	0x6E, 0x64, 0x6F, 0x77, 0x73, 0x20, 0x28, 0x6F, 0x73, 0x2F,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0x29, 0x29, 0x20, 0x22, 0x64,
+	0x6C, 0x6C, 0x22, 0x20, 0x22, 0x73, 0x6F, 0x22, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x73,
+	0x75, 0x62, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x5B, 0x70, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x2D, 0x3E, 0x3E, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63,
+	0x65, 0x20, 0x22, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63,
+	0x65, 0x20, 0x22, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x22, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73, 0x79,
+	0x73, 0x70, 0x61, 0x74, 0x68, 0x2A, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x65, 0x20, 0x22, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x3A, 0x22, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70,
+	0x6C, 0x61, 0x63, 0x65, 0x20, 0x22, 0x3A, 0x61, 0x6C, 0x6C,
+	0x3A, 0x22, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x73, 0x75,
+	0x62, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x73, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x63, 0x61,
+	0x63, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x54, 0x61, 0x62,
+	0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67,
+	0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74,
+	0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20,
+	0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x22,
+	0x0A, 0x20, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x0A, 0x20,
+	0x20, 0x22, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61,
+	0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6C, 0x6F, 0x61, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E,
+	0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x70,
+	0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x63,
+	0x69, 0x72, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x64, 0x65,
+	0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A,
+	0x0A, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x2A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D,
+	0x63, 0x61, 0x63, 0x68, 0x65, 0x2A, 0x0A, 0x20, 0x20, 0x22,
+	0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C,
+	0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x73,
+	0x61, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x65, 0x6E,
+	0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x0A, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x63, 0x6F,
+	0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x6F, 0x75,
+	0x72, 0x63, 0x65, 0x2C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70,
+	0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
+	0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x73,
+	0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x75,
+	0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x6F,
+	0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x74,
+	0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x2C,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20,
+	0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 0x0A,
+	0x23, 0x20, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20,
+	0x68, 0x65, 0x6C, 0x70, 0x65, 0x72, 0x73, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x2D, 0x20, 0x66, 0x65, 0x78, 0x69, 0x73,
+	0x74, 0x73, 0x20, 0x5B, 0x70, 0x61, 0x74, 0x68, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x20, 0x28,
+	0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x20, 0x28,
+	0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65,
+	0x20, 0x66, 0x29, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29,
+	0x29, 0x0A, 0x0A, 0x23, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x73,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75,
+	0x69, 0x72, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65,
+	0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x6D, 0x70,
+	0x20, 0x66, 0x6F, 0x72, 0x0A, 0x23, 0x20, 0x65, 0x61, 0x63,
+	0x68, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74,
+	0x73, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
+	0x6D, 0x70, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x73,
+	0x0A, 0x23, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65,
+	0x6E, 0x63, 0x69, 0x65, 0x73, 0x2E, 0x0A, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64,
+	0x65, 0x70, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x2D, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x73, 0x20, 0x40,
+	0x7B, 0x7D, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x2D, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64,
+	0x69, 0x67, 0x65, 0x73, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x44,
+	0x69, 0x67, 0x65, 0x73, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x69, 0x74, 0x73, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x33,
+	0x32, 0x20, 0x62, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
+	0x65, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x73, 0x74,
+	0x72, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x73, 0x74, 0x72, 0x29, 0x20, 0x22, 0x3A, 0x22, 0x20,
+	0x28, 0x68, 0x61, 0x73, 0x68, 0x20, 0x73, 0x74, 0x72, 0x29,
+	0x20, 0x22, 0x3A, 0x22, 0x20, 0x28, 0x68, 0x61, 0x73, 0x68,
+	0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72,
+	0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72,
+	0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x2D, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D,
+	0x73, 0x74, 0x61, 0x6D, 0x70, 0x0A, 0x20, 0x20, 0x5B, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64, 0x65, 0x70, 0x73,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x2D, 0x22, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x62, 0x75, 0x69, 0x6C,
+	0x64, 0x20, 0x22, 0x20, 0x22, 0x20, 0x6D, 0x61, 0x72, 0x73,
+	0x68, 0x61, 0x6C, 0x2F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F,
+	0x6E, 0x20, 0x22, 0x20, 0x22, 0x20, 0x28, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2D, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B,
+	0x28, 0x6D, 0x61, 0x70, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B,
+	0x64, 0x65, 0x70, 0x5D, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x22, 0x20, 0x22, 0x20, 0x28, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x69, 0x67, 0x65, 0x73,
+	0x74, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x73,
+	0x20, 0x64, 0x65, 0x70, 0x29, 0x29, 0x29, 0x29, 0x20, 0x64,
+	0x65, 0x70, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x23, 0x20,
+	0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65,
+	0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x62,
+	0x79, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x73,
+	0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F,
+	0x70, 0x69, 0x65, 0x64, 0x2E, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x2D, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x74, 0x79,
+	0x70, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x7B, 0x3A, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x3A,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x20, 0x3A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x20, 0x3A, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x3A,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x20, 0x3A, 0x63, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+	0x3A, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x7D, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x2D, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65,
+	0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x0A, 0x20, 0x20,
+	0x22, 0x46, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x6C,
+	0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x4E, 0x61, 0x6D, 0x65,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x6F, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75,
+	0x69, 0x72, 0x65, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x65, 0x6E, 0x76, 0x20, 0x64, 0x65, 0x70, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6F, 0x72,
+	0x65, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x67,
+	0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x20, 0x65, 0x6E,
+	0x76, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x40, 0x7B,
+	0x27, 0x65, 0x6E, 0x76, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x27,
+	0x63, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x65, 0x7D,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x61, 0x64, 0x64, 0x20, 0x5B, 0x70, 0x72, 0x65, 0x66, 0x69,
+	0x78, 0x20, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x5B, 0x6B, 0x20, 0x65,
+	0x6E, 0x74, 0x72, 0x79, 0x5D, 0x20, 0x3A, 0x70, 0x61, 0x69,
+	0x72, 0x73, 0x20, 0x65, 0x20, 0x3A, 0x77, 0x68, 0x65, 0x6E,
+	0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x65,
+	0x6E, 0x74, 0x72, 0x79, 0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61,
+	0x6D, 0x65, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x22, 0x20,
+	0x22, 0x20, 0x6B, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x6C, 0x6F, 0x6F,
+	0x6B, 0x75, 0x70, 0x20, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x20, 0x22, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x22,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x20, 0x65, 0x6E, 0x74,
+	0x72, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x76, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x3A, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x74, 0x79,
+	0x70, 0x65, 0x73, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x76, 0x29, 0x29, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x6C,
+	0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x28, 0x73, 0x79, 0x6D,
+	0x62, 0x6F, 0x6C, 0x20, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x20, 0x76,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x72, 0x20,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79,
+	0x20, 0x3A, 0x72, 0x65, 0x66, 0x29, 0x5D, 0x20, 0x28, 0x70,
+	0x75, 0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+	0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x22, 0x72,
+	0x65, 0x66, 0x20, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29,
+	0x20, 0x72, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x61, 0x64, 0x64, 0x20, 0x22, 0x63, 0x6F, 0x72, 0x65, 0x22,
+	0x20, 0x63, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x65, 0x61, 0x63, 0x68, 0x20, 0x64, 0x65, 0x70, 0x20, 0x64,
+	0x65, 0x70, 0x73, 0x20, 0x28, 0x61, 0x64, 0x64, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x20, 0x22, 0x20, 0x64, 0x65, 0x70,
+	0x29, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20,
+	0x64, 0x65, 0x70, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x6C,
+	0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x29, 0x0A, 0x0A, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x2D, 0x20, 0x73, 0x61, 0x76, 0x65, 0x2D,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x57,
+	0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+	0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x0A, 0x20, 0x20, 0x62,
+	0x65, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x65,
+	0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6B, 0x69, 0x70,
+	0x70, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6D,
+	0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x65, 0x6E, 0x76,
+	0x20, 0x64, 0x65, 0x70, 0x73, 0x20, 0x73, 0x6F, 0x75, 0x72,
+	0x63, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x40, 0x7B, 0x7D, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B,
+	0x5B, 0x6B, 0x20, 0x76, 0x5D, 0x20, 0x3A, 0x70, 0x61, 0x69,
+	0x72, 0x73, 0x20, 0x65, 0x6E, 0x76, 0x5D, 0x20, 0x28, 0x70,
+	0x75, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x6B, 0x20, 0x76, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65,
+	0x20, 0x28, 0x74, 0x72, 0x79, 0x20, 0x28, 0x6D, 0x61, 0x72,
+	0x73, 0x68, 0x61, 0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x28, 0x69, 0x6E, 0x76, 0x65, 0x72,
+	0x74, 0x20, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x6C,
+	0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x65, 0x6E, 0x76, 0x20,
+	0x64, 0x65, 0x70, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x5B, 0x5F, 0x5D,
+	0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x20, 0x28, 0x69, 0x66,
+	0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x28, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x22, 0x2E, 0x6A, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x22, 0x29, 0x20, 0x3A, 0x77, 0x62, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x66, 0x20,
+	0x28, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x7B,
+	0x3A, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x73, 0x74, 0x61,
+	0x6D, 0x70, 0x20, 0x3A, 0x64, 0x65, 0x70, 0x73, 0x20, 0x64,
+	0x65, 0x70, 0x73, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x3A,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x28, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x29,
+	0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+	0x66, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x61,
+	0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2C, 0x20, 0x6F,
+	0x72, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x6D, 0x6F, 0x64, 0x70, 0x61,
+	0x74, 0x68, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x66, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F,
+	0x70, 0x65, 0x6E, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20,
+	0x22, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x22, 0x29,
+	0x20, 0x3A, 0x72, 0x62, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x77, 0x68, 0x65, 0x6E, 0x20, 0x66, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x68, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x20, 0x28, 0x74, 0x72, 0x79, 0x20, 0x28, 0x75,
+	0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x28,
+	0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x20,
+	0x66, 0x20, 0x3A, 0x61, 0x6C, 0x6C, 0x29, 0x29, 0x20, 0x28,
+	0x5B, 0x5F, 0x5D, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65,
+	0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x61,
+	0x6E, 0x64, 0x20, 0x28, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x61, 0x72, 0x79, 0x3F, 0x20, 0x68, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x29, 0x20, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78,
+	0x65, 0x64, 0x3F, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x68,
+	0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3A, 0x64, 0x65, 0x70,
+	0x73, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0x20, 0x6C,
+	0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x0A,
+	0x20, 0x20, 0x22, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x61, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x69,
+	0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65,
+	0x64, 0x2E, 0x0A, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x64, 0x61, 0x74, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x6F, 0x75,
+	0x72, 0x63, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x64, 0x65, 0x70, 0x73, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3A,
+	0x64, 0x65, 0x70, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20,
+	0x28, 0x3D, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72,
+	0x63, 0x65, 0x29, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3D, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+	0x3A, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x29, 0x20, 0x28, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x6D,
+	0x70, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64,
+	0x65, 0x70, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6E, 0x76, 0x20,
+	0x28, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x28, 0x74, 0x72, 0x79, 0x20, 0x28, 0x75, 0x6E, 0x6D, 0x61,
+	0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3A, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x29, 0x20, 0x28, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+	0x65, 0x6E, 0x76, 0x20, 0x64, 0x65, 0x70, 0x73, 0x29, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x5B, 0x5F, 0x5D, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E,
+	0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x5B, 0x5B, 0x6B, 0x20, 0x76, 0x5D, 0x20, 0x3A, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x5D, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20,
+	0x65, 0x6E, 0x76, 0x20, 0x6B, 0x20, 0x76, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x29,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x2D,
+	0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x43,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x72, 0x75, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72,
+	0x20, 0x69, 0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x22, 0x0A, 0x20, 0x20,
+	0x5B, 0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74,
+	0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x65,
+	0x77, 0x65, 0x6E, 0x76, 0x20, 0x28, 0x6D, 0x61, 0x6B, 0x65,
+	0x2D, 0x65, 0x6E, 0x76, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x73, 0x6F,
+	0x75, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x6E, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73,
+	0x20, 0x5B, 0x62, 0x75, 0x66, 0x20, 0x5F, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63,
+	0x68, 0x75, 0x6E, 0x6B, 0x20, 0x28, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x20, 0x63,
+	0x68, 0x75, 0x6E, 0x6B, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E,
+	0x6B, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+	0x78, 0x74, 0x20, 0x7B, 0x3A, 0x65, 0x6E, 0x76, 0x20, 0x6E,
+	0x65, 0x77, 0x65, 0x6E, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20,
+	0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61,
+	0x74, 0x75, 0x73, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x66,
+	0x20, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28,
+	0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x28, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x66,
+	0x29, 0x20, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x20, 0x78, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x65, 0x78, 0x69, 0x74,
+	0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x28, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0x20, 0x31,
+	0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x6D, 0x73, 0x67, 0x20, 0x66, 0x20,
+	0x77, 0x68, 0x65, 0x72, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x67, 0x6F,
+	0x6F, 0x64, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x61, 0x64,
+	0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x6D,
+	0x73, 0x67, 0x20, 0x66, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B,
+	0x70, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x67, 0x6F,
+	0x6F, 0x64, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x61, 0x64, 0x2D, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x20, 0x70, 0x20, 0x77, 0x68, 0x65,
+	0x72, 0x65, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x3A, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x70, 0x61, 0x74, 0x68, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x65,
+	0x6E, 0x76, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x72, 0x65, 0x71,
+	0x75, 0x69, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x22, 0x52, 0x65,
+	0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x61, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C,
+	0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74,
+	0x68, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61, 0x73,
+	0x20, 0x61, 0x20, 0x72, 0x61, 0x77, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E,
+	0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2E, 0x20, 0x53, 0x65, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x2D, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2A, 0x0A, 0x20,
+	0x20, 0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63,
+	0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3A, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x6F, 0x66, 0x66, 0x0A, 0x20, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x61,
+	0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5D,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7B, 0x3A,
+	0x65, 0x78, 0x69, 0x74, 0x20, 0x65, 0x78, 0x69, 0x74, 0x2D,
+	0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3A,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x7D, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+	0x3B, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x75, 0x73, 0x65, 0x2D, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x2D, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2A,
+	0x20, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x70, 0x73, 0x20,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73,
+	0x68, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64,
+	0x65, 0x70, 0x73, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74,
+	0x20, 0x5B, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x28, 0x67,
+	0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F,
+	0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68,
+	0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x65,
+	0x63, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+	0x2D, 0x6C, 0x65, 0x74, 0x20, 0x5B, 0x6D, 0x6F, 0x64, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20,
+	0x66, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x28, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0x29, 0x29,
+	0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x6C, 0x6F,
+	0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x70,
+	0x61, 0x74, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x22, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20,
+	0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79,
+	0x3A, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x20, 0x6D,
+	0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x22, 0x20, 0x69,
+	0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x22,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x23, 0x20, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C,
+	0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x66, 0x20, 0x28,
+	0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20,
+	0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+	0x20, 0x3A, 0x61, 0x6C, 0x6C, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x66,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x74, 0x72,
+	0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x6C, 0x64,
+	0x64, 0x65, 0x70, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2D, 0x64, 0x65, 0x70, 0x73, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x65,
+	0x70, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x75, 0x73, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x20, 0x28, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74,
+	0x68, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x20, 0x28, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x64, 0x65, 0x70, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20, 0x68,
+	0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3A, 0x64, 0x65, 0x70,
+	0x73, 0x29, 0x20, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+	0x65, 0x20, 0x64, 0x65, 0x70, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+	0x28, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x29, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x66, 0x61, 0x6C,
+	0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20,
+	0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64,
+	0x65, 0x70, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x5B, 0x65, 0x6E, 0x76, 0x20, 0x67,
+	0x6F, 0x6F, 0x64, 0x5D, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x20, 0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74,
+	0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6E, 0x65, 0x77,
+	0x65, 0x6E, 0x76, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x28,
+	0x61, 0x6E, 0x64, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x75,
+	0x73, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x29, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x20, 0x64, 0x65, 0x70, 0x73, 0x20,
+	0x28, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x63, 0x74, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x70,
+	0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x61,
+	0x6D, 0x70, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x73, 0x6F, 0x75,
+	0x72, 0x63, 0x65, 0x20, 0x64, 0x65, 0x70, 0x73, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x73, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x20, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x28, 0x73, 0x61,
+	0x76, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6E, 0x65, 0x77,
+	0x65, 0x6E, 0x76, 0x20, 0x64, 0x65, 0x70, 0x73, 0x20, 0x73,
+	0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6D,
+	0x70, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x70, 0x73, 0x20, 0x6F,
+	0x6C, 0x64, 0x64, 0x65, 0x70, 0x73, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x6C, 0x6F,
+	0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E,
+	0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x54, 0x72,
+	0x79, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E,
+	0x20, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x66, 0x65, 0x78,
+	0x69, 0x73, 0x74, 0x73, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F,
+	0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x61, 0x74,
+	0x68, 0x73, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E,
+	0x6F, 0x74, 0x20, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x22, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F,
+	0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x20, 0x22, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x65, 0x20, 0x28, 0x6D,
+	0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6E,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6E, 0x20, 0x65, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x6E, 0x20, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x70, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x20, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x65, 0x29, 0x29, 0x29, 0x29, 0x0A,
+	0x0A, 0x28, 0x70, 0x75, 0x74, 0x20, 0x5F, 0x65, 0x6E, 0x76,
+	0x20, 0x27, 0x66, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20,
+	0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x28, 0x70, 0x75, 0x74, 0x20,
+	0x5F, 0x65, 0x6E, 0x76, 0x20, 0x27, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2D, 0x64, 0x65, 0x70, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A, 0x0A, 0x20, 0x20,
+	0x22, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54,
+	0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x0A, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6F,
+	0x66, 0x20, 0x28, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20,
+	0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x73, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x74,
+	0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+	0x6E, 0x74, 0x0A, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x65, 0x6E, 0x76, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x7B, 0x3A, 0x61, 0x73, 0x20, 0x61, 0x73, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x70, 0x72, 0x65,
+	0x66, 0x69, 0x78, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+	0x7D, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x3B,
+	0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76,
+	0x20, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x3B, 0x61, 0x72, 0x67, 0x73,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x28, 0x6F, 0x72,
+	0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x73, 0x20, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20,
+	0x22, 0x2F, 0x22, 0x29, 0x29, 0x20, 0x70, 0x72, 0x65, 0x66,
+	0x69, 0x78, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x22, 0x2F, 0x22, 0x29,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x5B, 0x5B, 0x6B, 0x20, 0x76, 0x5D, 0x20, 0x3A, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E,
+	0x76, 0x20, 0x3A, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x6E,
+	0x6F, 0x74, 0x20, 0x28, 0x76, 0x20, 0x3A, 0x70, 0x72, 0x69,
+	0x76, 0x61, 0x74, 0x65, 0x29, 0x29, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x65, 0x77,
+	0x76, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73,
+	0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x20, 0x40, 0x7B,
+	0x3A, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x7D, 0x20, 0x76, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x65, 0x6E,
+	0x76, 0x20, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20,
+	0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6B, 0x29, 0x20,
+	0x6E, 0x65, 0x77, 0x76, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x69,
+	0x6D, 0x70, 0x6F, 0x72, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x49,
+	0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2E, 0x20, 0x46, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x6E, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x69,
+	0x74, 0x73, 0x0A, 0x20, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x61,
+	0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2E, 0x0A,
+	0x20, 0x20, 0x28, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x3A, 0x61, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x3A, 0x70,
+	0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6F, 0x70, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x74, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x29, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x72, 0x65,
+	0x66, 0x69, 0x78, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F,
+	0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x75,
+	0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x6D,
+	0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61,
+	0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x20,
+	0x61, 0x72, 0x67, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x61, 0x72, 0x67, 0x6D, 0x20, 0x28, 0x6D,
+	0x61, 0x70, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x78, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+	0x72, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x78,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x69, 0x6D, 0x70,
+	0x6F, 0x72, 0x74, 0x2A, 0x20, 0x27, 0x2A, 0x65, 0x6E, 0x76,
+	0x2A, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x3B, 0x61, 0x72, 0x67,
+	0x6D, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E,
+	0x20, 0x72, 0x65, 0x70, 0x6C, 0x0A, 0x20, 0x20, 0x22, 0x52,
+	0x75, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x2E,
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61,
+	0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x0A, 0x20, 0x20, 0x67, 0x65,
+	0x74, 0x20, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20,
+	0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x63, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x70, 0x61,
+	0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+	0x20, 0x69, 0x73, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x75, 0x67,
+	0x68, 0x74, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x63, 0x68,
+	0x75, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x6E, 0x73, 0x69, 0x67,
+	0x6E, 0x61, 0x6C, 0x20, 0x26, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E, 0x76,
+	0x20, 0x28, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x6F, 0x6E, 0x73, 0x69, 0x67, 0x6E,
+	0x61, 0x6C, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x66, 0x20,
+	0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74,
+	0x61, 0x74, 0x75, 0x73, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x20, 0x28, 0x64,
+	0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x6E,
+	0x65, 0x77, 0x65, 0x6E, 0x76, 0x20, 0x27, 0x5F, 0x20, 0x40,
+	0x7B, 0x3A, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x7D,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74,
+	0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x70,
+	0x72, 0x65, 0x74, 0x74, 0x79, 0x20, 0x78, 0x20, 0x32, 0x30,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x20, 0x78, 0x29,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x72, 0x75, 0x6E,
+	0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x7B,
+	0x3A, 0x65, 0x6E, 0x76, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x6E,
+	0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x63,
+	0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x63, 0x68, 0x75, 0x6E,
+	0x6B, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A,
+	0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+	0x6F, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72,
+	0x63, 0x65, 0x20, 0x22, 0x72, 0x65, 0x70, 0x6C, 0x22, 0x7D,
+	0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x6D, 0x65, 0x74, 0x61, 0x0A, 0x20,
+	0x20, 0x22, 0x41, 0x64, 0x64, 0x20, 0x6D, 0x65, 0x74, 0x61,
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x26, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x20, 0x28, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x3B, 0x61, 0x72, 0x67, 0x73, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x5B, 0x5B, 0x6B, 0x20, 0x76, 0x5D, 0x20, 0x3A, 0x70, 0x61,
+	0x69, 0x72, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x2A,
+	0x65, 0x6E, 0x76, 0x2A, 0x20, 0x6B, 0x20, 0x76, 0x29, 0x29,
+	0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x61,
+	0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x0A, 0x20, 0x20, 0x22, 0x47, 0x65, 0x74, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+	0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x22, 0x0A,
+	0x20, 0x20, 0x5B, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x5D, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+	0x20, 0x65, 0x6E, 0x76, 0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x65,
+	0x6E, 0x76, 0x73, 0x20, 0x40, 0x5B, 0x5D, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x64, 0x6F, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x65, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x20, 0x28, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x65, 0x20, 0x28, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x65, 0x6E,
+	0x76, 0x73, 0x20, 0x65, 0x29, 0x20, 0x28, 0x73, 0x65, 0x74,
+	0x20, 0x65, 0x20, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x20, 0x65,
+	0x29, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2D, 0x73,
+	0x65, 0x74, 0x20, 0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20,
+	0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x5B, 0x65, 0x6E, 0x76,
+	0x69, 0x20, 0x3A, 0x69, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x73,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x6B, 0x20, 0x3A, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x65, 0x6E,
+	0x76, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0x20, 0x6B, 0x29, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20,
+	0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2D, 0x73, 0x65, 0x74,
+	0x20, 0x6B, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x20, 0x28, 0x6B,
+	0x65, 0x79, 0x73, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+	0x2D, 0x73, 0x65, 0x74, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28,
+	0x64, 0x65, 0x66, 0x6E, 0x20, 0x73, 0x6C, 0x75, 0x72, 0x70,
+	0x0A, 0x20, 0x20, 0x22, 0x52, 0x65, 0x61, 0x64, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6C, 0x6F, 0x73,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x61, 0x74, 0x68,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x66,
+	0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65,
+	0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x3A, 0x72, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F,
+	0x74, 0x20, 0x66, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22,
+	0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x22, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x28, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x20, 0x3A,
+	0x61, 0x6C, 0x6C, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+	0x66, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+	0x6E, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x73, 0x70, 0x69, 0x74, 0x0A, 0x20, 0x20, 0x22,
+	0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x74, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x2E, 0x0A, 0x20, 0x20, 0x43, 0x61, 0x6E, 0x20,
+	0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79,
+	0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+	0x22, 0x0A, 0x20, 0x20, 0x5B, 0x70, 0x61, 0x74, 0x68, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D,
+	0x6F, 0x64, 0x65, 0x20, 0x26, 0x5D, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x6D, 0x6F,
+	0x64, 0x65, 0x20, 0x3A, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x66, 0x20, 0x28, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x66,
+	0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x63, 0x6F, 0x75,
+	0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65,
+	0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x22, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x22, 0x20, 0x6D, 0x6F,
+	0x64, 0x65, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20,
+	0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+	0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x29, 0x0A, 0x20,
+	0x20, 0x6E, 0x69, 0x6C, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x70, 0x6F,
+	0x69, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x72,
+	0x73, 0x68, 0x61, 0x6C, 0x20, 0x78, 0x2C, 0x20, 0x77, 0x68,
+	0x69, 0x63, 0x68, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x63, 0x6F,
+	0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x73, 0x75, 0x73, 0x70,
+	0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20,
+	0x63, 0x61, 0x6E, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x62, 0x75,
+	0x69, 0x6C, 0x64, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72,
+	0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x46, 0x69, 0x62,
+	0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x61,
+	0x76, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+	0x68, 0x65, 0x69, 0x72, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x73, 0x2C, 0x0A, 0x20, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x75,
+	0x72, 0x65, 0x73, 0x2C, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+	0x6C, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x73, 0x2C, 0x20, 0x62,
+	0x75, 0x64, 0x67, 0x65, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x71, 0x75, 0x6F, 0x74, 0x61, 0x73, 0x2E, 0x20, 0x43,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61,
+	0x63, 0x74, 0x0A, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65,
+	0x64, 0x20, 0x61, 0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72,
+	0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74,
+	0x68, 0x65, 0x69, 0x72, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x6E, 0x76,
+	0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+	0x6D, 0x75, 0x73, 0x74, 0x0A, 0x20, 0x20, 0x68, 0x61, 0x76,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72,
+	0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x41,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x75, 0x6E,
+	0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x77, 0x61, 0x69,
+	0x74, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20,
+	0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2C, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+	0x74, 0x20, 0x62, 0x65, 0x0A, 0x20, 0x20, 0x73, 0x61, 0x76,
+	0x65, 0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6F,
+	0x20, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61,
+	0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B, 0x78,
+	0x20, 0x65, 0x6E, 0x76, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x26, 0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x2A, 0x65,
+	0x6E, 0x76, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x72, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+	0x40, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x5B, 0x5B, 0x6B, 0x20, 0x76, 0x5D, 0x20,
+	0x3A, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x28, 0x65, 0x6E,
+	0x76, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x65,
+	0x6E, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x3A, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28,
+	0x6F, 0x72, 0x20, 0x28, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x3F, 0x20, 0x76, 0x29, 0x20, 0x28, 0x61,
+	0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3F, 0x20, 0x76,
+	0x29, 0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70,
+	0x75, 0x74, 0x20, 0x72, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70,
+	0x20, 0x76, 0x20, 0x6B, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x69, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x6D,
+	0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x78, 0x20, 0x72,
+	0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x29, 0x20, 0x28, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61,
+	0x6C, 0x20, 0x78, 0x20, 0x72, 0x6C, 0x6F, 0x6F, 0x6B, 0x75,
+	0x70, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x0A,
+	0x20, 0x20, 0x22, 0x52, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x64,
+	0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73,
+	0x61, 0x76, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x63, 0x68, 0x65, 0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x74, 0x6F, 0x72,
+	0x65, 0x64, 0x0A, 0x20, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x73, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x77, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72,
+	0x65, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65,
+	0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x73,
+	0x75, 0x6D, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x5B,
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x26,
+	0x5D, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6C, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x2A, 0x65, 0x6E,
+	0x76, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x75, 0x6E, 0x6D,
+	0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x64, 0x61, 0x74,
+	0x61, 0x20, 0x28, 0x65, 0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F,
+	0x6B, 0x75, 0x70, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x29, 0x29,
+	0x0A, 0x0A, 0x23, 0x20, 0x55, 0x73, 0x65, 0x20, 0x64, 0x79,
+	0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20, 0x2A, 0x65, 0x6E, 0x76,
+	0x2A, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6E, 0x6F, 0x77,
+	0x20, 0x6F, 0x6E, 0x0A, 0x28, 0x70, 0x75, 0x74, 0x20, 0x5F,
+	0x65, 0x6E, 0x76, 0x20, 0x27, 0x5F, 0x65, 0x6E, 0x76, 0x20,
+	0x6E, 0x69, 0x6C, 0x29, 0x0A
+};
+
+const unsigned char *janet_gen_core = bytes_janet_gen_core;
+
+int32_t janet_gen_core_size = 59595;
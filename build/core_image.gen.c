@@ -0,0 +1,10260 @@
+/* Auto generated - DO NOT EDIT */
+
+#include <stdint.h>
+
+static const unsigned char bytes_janet_core_image[] = {
+	0xDE, 0x03, 0xD3, 0xDC, 0x02, 0xCF, 0x08, 0x6F, 0x73, 0x2F,
+	0x63, 0x6C, 0x6F, 0x63, 0x6B, 0xD3, 0x02, 0xD0, 0x05, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x63,
+	0x6C, 0x6F, 0x63, 0x6B, 0xD0, 0x03, 0x64, 0x6F, 0x63, 0xCE,
+	0x83, 0x01, 0x28, 0x6F, 0x73, 0x2F, 0x63, 0x6C, 0x6F, 0x63,
+	0x6B, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E,
+	0x64, 0x73, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x73,
+	0x6F, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20,
+	0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74,
+	0x69, 0x6D, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63,
+	0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x67, 0x75,
+	0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x64, 0x20, 0x74,
+	0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x6F, 0x6E, 0x20, 0x64,
+	0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20,
+	0x69, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x74, 0x69,
+	0x6D, 0x65, 0x2E, 0xCF, 0x06, 0x64, 0x69, 0x73, 0x61, 0x73,
+	0x6D, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x06, 0x64, 0x69, 0x73,
+	0x61, 0x73, 0x6D, 0xDA, 0x05, 0xCE, 0xAB, 0x01, 0x28, 0x64,
+	0x69, 0x73, 0x61, 0x73, 0x6D, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64,
+	0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62,
+	0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A,
+	0x66, 0x75, 0x6E, 0x63, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20,
+	0x62, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61,
+	0x20, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+	0x72, 0x6F, 0x77, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x61,
+	0x64, 0x6C, 0x79, 0x0A, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF,
+	0x07, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x99, 0x01, 0x28, 0x72, 0x65,
+	0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x61, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x68, 0x65, 0x63,
+	0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20,
+	0x52, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x73, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x69, 0x6E, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x73, 0x75, 0x73,
+	0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x2E,
+	0xD0, 0x0A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x6D,
+	0x61, 0x70, 0xD2, 0x03, 0xCE, 0x0A, 0x63, 0x6F, 0x72, 0x65,
+	0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0xCD, 0xEA, 0x9E, 0x07,
+	0xCD, 0xA8, 0xA2, 0x07, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xC0, 0x09, 0x03, 0x02, 0x03, 0x0B, 0xCE, 0x07, 0x72, 0x65,
+	0x73, 0x74, 0x6F, 0x72, 0x65, 0xDA, 0x10, 0xD1, 0x01, 0xDA,
+	0x00, 0xD8, 0x0A, 0x65, 0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F,
+	0x6B, 0x75, 0x70, 0xD8, 0x09, 0x75, 0x6E, 0x6D, 0x61, 0x72,
+	0x73, 0x68, 0x61, 0x6C, 0x22, 0x02, 0x00, 0x00, 0x48, 0x02,
+	0x02, 0x01, 0x1A, 0x02, 0x03, 0x00, 0x26, 0x01, 0x00, 0x00,
+	0x35, 0x01, 0x01, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x01,
+	0x01, 0x00, 0x2F, 0x02, 0x01, 0x00, 0x2C, 0x00, 0x02, 0x00,
+	0x26, 0x01, 0x02, 0x00, 0x30, 0x01, 0x00, 0x00, 0x0B, 0x05,
+	0xBA, 0xA1, 0x07, 0x24, 0x03, 0x4C, 0x05, 0x03, 0x1F, 0x22,
+	0xCF, 0x06, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3F, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x36, 0x28, 0x62, 0x79, 0x74,
+	0x65, 0x73, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2C, 0x20,
+	0x6F, 0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x96, 0x30, 0xCD,
+	0xE8, 0x32, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x02, 0x01, 0x05, 0x15, 0xCE, 0x06, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x3F, 0xDA, 0x10, 0xD8, 0x04, 0x74, 0x79, 0x70, 0x65,
+	0xD0, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xD0, 0x06,
+	0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0xD0, 0x07, 0x6B, 0x65,
+	0x79, 0x77, 0x6F, 0x72, 0x64, 0xD0, 0x06, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x48,
+	0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x23, 0x01, 0x00,
+	0x00, 0x03, 0x01, 0x00, 0x00, 0x26, 0x01, 0x02, 0x00, 0x48,
+	0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x23, 0x01, 0x00,
+	0x00, 0x03, 0x01, 0x00, 0x00, 0x26, 0x01, 0x03, 0x00, 0x48,
+	0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x23, 0x01, 0x00,
+	0x00, 0x03, 0x01, 0x00, 0x00, 0x26, 0x01, 0x04, 0x00, 0x1F,
+	0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x1B, 0x03, 0xA4,
+	0x31, 0x0E, 0x02, 0x20, 0x0A, 0x03, 0x07, 0x92, 0x01, 0x02,
+	0x36, 0x91, 0x01, 0x03, 0x07, 0x62, 0x02, 0x36, 0x5F, 0x03,
+	0x07, 0x30, 0x03, 0x30, 0x31, 0xCF, 0x02, 0x2B, 0x3D, 0xD4,
+	0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x2B, 0x3D,
+	0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x63,
+	0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79,
+	0x20, 0x6E, 0x2E, 0xD0, 0x05, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xB4, 0x4E,
+	0xCD, 0xBC, 0x4F, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x03, 0x02, 0x02, 0x07, 0xCE, 0x02, 0x2B, 0x3D, 0xDA,
+	0x10, 0xD7, 0xCD, 0x92, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00,
+	0x13, 0xCE, 0x01, 0x2B, 0x17, 0x01, 0x00, 0x00, 0x20, 0x02,
+	0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02,
+	0x05, 0x00, 0x25, 0x03, 0x00, 0x00, 0x4B, 0x04, 0x00, 0x00,
+	0x06, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x4B, 0x03,
+	0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05,
+	0x06, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02,
+	0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00,
+	0xCF, 0x03, 0x73, 0x65, 0x74, 0x26, 0x02, 0x00, 0x00, 0x2D,
+	0x02, 0x00, 0x01, 0x3D, 0x01, 0x00, 0x00, 0x26, 0x02, 0x01,
+	0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x02, 0x00, 0x00, 0x03,
+	0x02, 0x00, 0x00, 0x04, 0x07, 0x94, 0x4F, 0x26, 0xCF, 0x0A,
+	0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x67, 0x63, 0x69, 0x6E,
+	0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0xDA, 0x05, 0xCE, 0x70,
+	0x28, 0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61,
+	0x6C, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x67, 0x65, 0x72, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74,
+	0x65, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x72,
+	0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x6F, 0x66, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+	0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x2E, 0xCF, 0x0B, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x62, 0x79, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x0B, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x62, 0x79,
+	0x74, 0x65, 0xDA, 0x05, 0xCE, 0x5C, 0x28, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x29, 0x0A, 0x0A,
+	0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73, 0x69,
+	0x6E, 0x67, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xCF, 0x04,
+	0x6F, 0x64, 0x64, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x1C, 0x28, 0x6F, 0x64, 0x64, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x64, 0x64, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xA8, 0x1E, 0xCD,
+	0x90, 0x1F, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x02, 0x01, 0x01, 0x0B, 0xCE, 0x04, 0x6F, 0x64, 0x64, 0x3F,
+	0xDA, 0x10, 0xD8, 0x01, 0x25, 0x25, 0x01, 0x02, 0x00, 0x2C,
+	0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x00,
+	0x00, 0x25, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x19,
+	0x00, 0x03, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07,
+	0x04, 0x80, 0x1F, 0x0C, 0x07, 0x0F, 0x12, 0xCF, 0x06, 0x72,
+	0x65, 0x64, 0x75, 0x63, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x95, 0x01, 0x28, 0x72, 0x65, 0x64, 0x75, 0x63,
+	0x65, 0x20, 0x66, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x69,
+	0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x64, 0x75, 0x63,
+	0x65, 0x2C, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6B, 0x6E,
+	0x6F, 0x77, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x64,
+	0x2D, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x6D,
+	0x61, 0x6E, 0x79, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61,
+	0x67, 0x65, 0x73, 0x2C, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+	0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x29, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F,
+	0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xEA, 0xD3, 0x02, 0xCD, 0xB4, 0xD7, 0x02, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06, 0x03, 0x00, 0x0B, 0xCE,
+	0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0xDA, 0x10, 0x37,
+	0x03, 0x02, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00,
+	0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x06, 0x00, 0x33,
+	0x05, 0x02, 0x03, 0x2C, 0x01, 0x05, 0x00, 0x2F, 0x01, 0x00,
+	0x00, 0x49, 0x03, 0x04, 0x01, 0x18, 0xFC, 0xFF, 0xFF, 0x03,
+	0x01, 0x00, 0x00, 0x10, 0x06, 0xD4, 0xD6, 0x02, 0x52, 0x02,
+	0x3E, 0x41, 0x02, 0x3D, 0x42, 0x01, 0xE9, 0x02, 0xF8, 0x02,
+	0xCF, 0x03, 0x69, 0x6E, 0x63, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x17, 0x28, 0x69, 0x6E, 0x63, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x78, 0x20, 0x2B, 0x20, 0x31, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0x84, 0x4B, 0xCD, 0xD0, 0x4B, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x01, 0x01, 0x00, 0x02,
+	0xCE, 0x03, 0x69, 0x6E, 0x63, 0xDA, 0x10, 0x05, 0x00, 0x00,
+	0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x02, 0xC2, 0x4B, 0x0C,
+	0xCF, 0x06, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0xC4, 0x01, 0x28, 0x69, 0x66,
+	0x2D, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x73, 0x20, 0x74, 0x72, 0x75, 0x20, 0x66, 0x61,
+	0x6C, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x6B, 0x65,
+	0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68,
+	0x79, 0x2C, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x75,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x49, 0x66, 0x20,
+	0x61, 0x6E, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61,
+	0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C,
+	0x2C, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+	0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x42, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x73,
+	0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0x80, 0x9A, 0x02, 0xCD, 0xE6, 0xA9, 0x02,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD0, 0x0B, 0x09, 0x03,
+	0x03, 0x1F, 0x01, 0xCE, 0x06, 0x69, 0x66, 0x2D, 0x6C, 0x65,
+	0x74, 0xDA, 0x10, 0xCE, 0x1B, 0x65, 0x78, 0x70, 0x65, 0x63,
+	0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61,
+	0x73, 0x74, 0x20, 0x31, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0xDA, 0x3C, 0xCE, 0x23, 0x65, 0x78, 0x70, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x76,
+	0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+	0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x28, 0x03, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x17,
+	0x05, 0x04, 0x00, 0x17, 0x06, 0x05, 0x00, 0x25, 0x07, 0x00,
+	0x00, 0x42, 0x06, 0x06, 0x07, 0x17, 0x08, 0x06, 0x00, 0x1A,
+	0x08, 0x03, 0x00, 0x26, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00,
+	0x00, 0x17, 0x06, 0x05, 0x00, 0x25, 0x07, 0x02, 0x00, 0x2C,
+	0x06, 0x07, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x07, 0x06,
+	0x00, 0x25, 0x06, 0x00, 0x00, 0x1F, 0x06, 0x06, 0x07, 0x19,
+	0x06, 0x04, 0x00, 0x23, 0x06, 0x00, 0x00, 0x17, 0x08, 0x06,
+	0x00, 0x18, 0x03, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x17,
+	0x08, 0x06, 0x00, 0x1A, 0x08, 0x03, 0x00, 0x26, 0x06, 0x02,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x17,
+	0x07, 0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00,
+	0x00, 0x30, 0x07, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D,
+	0x08, 0x01, 0x08, 0x46, 0x01, 0xCE, 0x03, 0x61, 0x75, 0x78,
+	0xDA, 0x10, 0xDA, 0x1D, 0xD5, 0x05, 0xDA, 0x21, 0xCB, 0xD0,
+	0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xCB, 0xD0, 0x06, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0xCB, 0xD0, 0x05, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0xCB, 0xD0, 0x05, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0xCB, 0xD8, 0x03, 0x6E, 0x6F, 0x74, 0xD8, 0x06, 0x67,
+	0x65, 0x6E, 0x73, 0x79, 0x6D, 0xCF, 0x03, 0x64, 0x65, 0x66,
+	0xD8, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xCF, 0x02, 0x69,
+	0x66, 0xCF, 0x02, 0x64, 0x6F, 0x28, 0x01, 0x00, 0x00, 0x27,
+	0x02, 0x00, 0x00, 0x33, 0x02, 0x02, 0x00, 0x05, 0x03, 0x00,
+	0x01, 0x27, 0x04, 0x00, 0x00, 0x33, 0x03, 0x04, 0x03, 0x27,
+	0x04, 0x00, 0x05, 0x46, 0x04, 0x00, 0x04, 0x1A, 0x04, 0x03,
+	0x00, 0x27, 0x04, 0x00, 0x01, 0x03, 0x04, 0x00, 0x00, 0x2B,
+	0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x04, 0x04,
+	0x00, 0x26, 0x05, 0x01, 0x00, 0x33, 0x04, 0x05, 0x04, 0x2B,
+	0x04, 0x00, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2F, 0x06, 0x04,
+	0x00, 0x17, 0x04, 0x06, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17,
+	0x05, 0x02, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x07, 0x03,
+	0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x05, 0x06, 0x00, 0x17,
+	0x06, 0x05, 0x00, 0x1A, 0x04, 0x12, 0x00, 0x26, 0x05, 0x04,
+	0x00, 0x2D, 0x05, 0x06, 0x03, 0x26, 0x07, 0x05, 0x00, 0x2F,
+	0x05, 0x07, 0x00, 0x05, 0x07, 0x00, 0x02, 0x2B, 0x07, 0x00,
+	0x00, 0x2F, 0x02, 0x01, 0x00, 0x26, 0x07, 0x06, 0x00, 0x2D,
+	0x07, 0x06, 0x02, 0x27, 0x07, 0x00, 0x02, 0x2B, 0x07, 0x00,
+	0x00, 0x26, 0x00, 0x05, 0x00, 0x2F, 0x07, 0x00, 0x00, 0x26,
+	0x02, 0x07, 0x00, 0x2D, 0x02, 0x05, 0x07, 0x26, 0x02, 0x05,
+	0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x05, 0x04, 0x00, 0x2D,
+	0x05, 0x06, 0x03, 0x26, 0x07, 0x05, 0x00, 0x2F, 0x05, 0x07,
+	0x00, 0x26, 0x07, 0x04, 0x00, 0x2D, 0x07, 0x02, 0x06, 0x26,
+	0x02, 0x05, 0x00, 0x2F, 0x07, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x2B, 0x02, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x26,
+	0x02, 0x07, 0x00, 0x2D, 0x02, 0x07, 0x00, 0x26, 0x00, 0x05,
+	0x00, 0x2F, 0x02, 0x00, 0x00, 0x26, 0x07, 0x06, 0x00, 0x2D,
+	0x07, 0x06, 0x02, 0x27, 0x07, 0x00, 0x02, 0x2B, 0x07, 0x00,
+	0x00, 0x26, 0x00, 0x05, 0x00, 0x2F, 0x07, 0x00, 0x00, 0x26,
+	0x02, 0x07, 0x00, 0x2D, 0x02, 0x05, 0x07, 0x26, 0x02, 0x05,
+	0x00, 0x30, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x5E, 0x01, 0xDE, 0x9F, 0x02, 0xF2, 0x09, 0x02, 0x34, 0xD3,
+	0x09, 0x01, 0x58, 0x11, 0x02, 0x1B, 0x1E, 0x02, 0x40, 0x17,
+	0x03, 0x07, 0xB6, 0x08, 0x08, 0x68, 0xA9, 0x08, 0x01, 0x11,
+	0x14, 0x03, 0x58, 0x0B, 0x02, 0x16, 0x17, 0x01, 0x15, 0x18,
+	0x01, 0x11, 0x14, 0x01, 0x4E, 0xA0, 0x06, 0x04, 0x92, 0x01,
+	0xB5, 0x06, 0x01, 0x72, 0x17, 0x02, 0x09, 0x0C, 0x06, 0x1D,
+	0x28, 0x04, 0x81, 0x01, 0x84, 0x01, 0x04, 0xD6, 0x02, 0x9F,
+	0x01, 0x04, 0xEC, 0x01, 0x00, 0x01, 0x70, 0x17, 0x02, 0x09,
+	0x0C, 0x04, 0xB9, 0x01, 0xBC, 0x01, 0x06, 0x4D, 0x88, 0x01,
+	0x04, 0x81, 0x01, 0x84, 0x01, 0x29, 0x01, 0x80, 0x9A, 0x02,
+	0xE6, 0x0F, 0x01, 0xC2, 0x03, 0xC5, 0x0F, 0x01, 0x11, 0x14,
+	0x04, 0x44, 0x1F, 0x01, 0x07, 0x56, 0x02, 0x20, 0x21, 0x0D,
+	0x5A, 0x35, 0x01, 0x07, 0x66, 0x02, 0x1E, 0x1F, 0x02, 0x62,
+	0x9A, 0x09, 0x03, 0xFA, 0x09, 0xE5, 0x09, 0xCF, 0x07, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x07, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xDA,
+	0x05, 0xCE, 0x84, 0x02, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x20, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6E, 0x76,
+	0x20, 0x5B, 0x2C, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+	0x5D, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x41, 0x62, 0x73, 0x74,
+	0x72, 0x61, 0x63, 0x74, 0x20, 0x53, 0x79, 0x6E, 0x74, 0x61,
+	0x78, 0x20, 0x54, 0x72, 0x65, 0x65, 0x20, 0x28, 0x61, 0x73,
+	0x74, 0x29, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x50, 0x61, 0x69, 0x72,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x74,
+	0x6F, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x6F, 0x65,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69,
+	0x66, 0x79, 0x20, 0x61, 0x73, 0x74, 0x2E, 0x20, 0x54, 0x68,
+	0x72, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x61, 0x73, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x64, 0x2E, 0xCF, 0x02, 0x2D, 0x2D, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x22, 0x28, 0x2D, 0x2D, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+	0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xAC, 0x4D, 0xCD, 0xB0, 0x4E, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xE0, 0x09, 0x03, 0x01, 0x02, 0x08, 0xCE, 0x02, 0x2D,
+	0x2D, 0xDA, 0x10, 0xD7, 0xCD, 0x94, 0x80, 0xC8, 0x20, 0x06,
+	0x00, 0x00, 0x13, 0xCE, 0x01, 0x2D, 0x17, 0x01, 0x00, 0x00,
+	0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01,
+	0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x00, 0x00, 0x4B, 0x04,
+	0x00, 0x00, 0x07, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00,
+	0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04,
+	0x00, 0x05, 0x07, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01,
+	0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03,
+	0x00, 0x00, 0xDA, 0x2C, 0x26, 0x01, 0x00, 0x00, 0x25, 0x02,
+	0x01, 0x00, 0x2D, 0x01, 0x00, 0x02, 0x3D, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x01,
+	0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x08, 0x88, 0x4E,
+	0x26, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F,
+	0x67, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74,
+	0x68, 0x2F, 0x6C, 0x6F, 0x67, 0xDA, 0x05, 0xCE, 0x26, 0x28,
+	0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20,
+	0x32, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02,
+	0xDA, 0x03, 0xD8, 0x09, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x6E, 0x65, 0x77, 0xDA, 0x05, 0xCE, 0xF5, 0x01, 0x28, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63,
+	0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A,
+	0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x70, 0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x63,
+	0x61, 0x74, 0x65, 0x64, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+	0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x70, 0x61,
+	0x63, 0x69, 0x74, 0x79, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69,
+	0x65, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D,
+	0x65, 0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x69, 0x66, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6B, 0x6E, 0x6F,
+	0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6E, 0x74,
+	0x72, 0x69, 0x65, 0x73, 0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x6E,
+	0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+	0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x6D, 0x65, 0x6D,
+	0x6F, 0x72, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x65, 0x64, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x2E, 0xCF, 0x02, 0x2D, 0x3D, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x2D, 0x3D, 0x20, 0x78,
+	0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x63, 0x72, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x76, 0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x6E,
+	0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xC0, 0x4F, 0xCD, 0xC8, 0x50, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x03, 0x02, 0x02, 0x07, 0xCE, 0x02,
+	0x2D, 0x3D, 0xDA, 0x10, 0xDA, 0x6C, 0xDA, 0x2C, 0x26, 0x02,
+	0x00, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x02,
+	0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x07, 0xA0, 0x50,
+	0x26, 0xCF, 0x09, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68,
+	0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x15, 0xDA, 0x05,
+	0xCE, 0xFA, 0x03, 0x28, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73,
+	0x68, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x20, 0x5B, 0x2C, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+	0x5B, 0x2C, 0x6C, 0x61, 0x7A, 0x79, 0x5D, 0x5D, 0x29, 0x0A,
+	0x0A, 0x55, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+	0x20, 0x61, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20,
+	0x41, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x6C, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x65,
+	0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65,
+	0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x6C, 0x61, 0x7A, 0x79, 0x20, 0x69, 0x73, 0x20, 0x74,
+	0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20,
+	0x6F, 0x66, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+	0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x64, 0x20, 0x77,
+	0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x63,
+	0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x63, 0x61,
+	0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20,
+	0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x70, 0x69, 0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x77, 0x61,
+	0x73, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C,
+	0x65, 0x64, 0x20, 0x74, 0x6F, 0x2C, 0x20, 0x69, 0x6E, 0x20,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65,
+	0x20, 0x6F, 0x6E, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+	0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x64, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x61, 0x7A, 0x79, 0x20,
+	0x69, 0x73, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64,
+	0x2E, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x65, 0x64, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x73, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66,
+	0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x64,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+	0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C,
+	0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+	0x02, 0x2D, 0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0xDD, 0x01, 0x28, 0x2D, 0x3E, 0x20, 0x78, 0x20, 0x26, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+	0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72,
+	0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E,
+	0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x20, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F,
+	0x6E, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C,
+	0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xDA, 0x9E, 0x03, 0xCD, 0x94, 0xA6, 0x03,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x2B, 0x06, 0x01,
+	0x00, 0x0C, 0x01, 0xCE, 0x02, 0x2D, 0x3E, 0xDA, 0x10, 0x2A,
+	0x02, 0x00, 0x00, 0x17, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03,
+	0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A,
+	0x05, 0x06, 0x00, 0x4A, 0x05, 0x01, 0x03, 0x2C, 0x00, 0x05,
+	0x00, 0x2F, 0x00, 0x02, 0x00, 0x49, 0x03, 0x04, 0x01, 0x18,
+	0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x05, 0x02, 0x06, 0x23, 0xCE, 0x03, 0x66, 0x6F,
+	0x70, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x58, 0xD8, 0x0B, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+	0xDA, 0x5D, 0xD8, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0xD8, 0x0B, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x2B,
+	0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03,
+	0x00, 0x26, 0x04, 0x01, 0x00, 0x48, 0x03, 0x04, 0x02, 0x1A,
+	0x03, 0x0B, 0x00, 0x25, 0x04, 0x00, 0x00, 0x33, 0x02, 0x01,
+	0x04, 0x25, 0x04, 0x01, 0x00, 0x2C, 0x01, 0x04, 0x00, 0x26,
+	0x01, 0x02, 0x00, 0x2F, 0x04, 0x01, 0x00, 0x2C, 0x02, 0x04,
+	0x00, 0x26, 0x01, 0x03, 0x00, 0x2F, 0x01, 0x01, 0x00, 0x18,
+	0x06, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x2C, 0x01, 0x02,
+	0x00, 0x26, 0x01, 0x03, 0x00, 0x2F, 0x04, 0x01, 0x00, 0x17,
+	0x01, 0x04, 0x00, 0x35, 0x02, 0x01, 0x00, 0x17, 0x03, 0x02,
+	0x00, 0x35, 0x02, 0x01, 0x01, 0x17, 0x04, 0x02, 0x00, 0x2C,
+	0x03, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x04,
+	0x00, 0x26, 0x01, 0x04, 0x00, 0x2F, 0x01, 0x01, 0x00, 0x17,
+	0x02, 0x01, 0x00, 0x25, 0x01, 0x00, 0x00, 0x2C, 0x02, 0x01,
+	0x00, 0x26, 0x01, 0x05, 0x00, 0x30, 0x01, 0x00, 0x00, 0x32,
+	0x03, 0x9C, 0xA3, 0x03, 0x0E, 0x02, 0x13, 0x16, 0x01, 0x07,
+	0xB2, 0x01, 0x02, 0x60, 0xC5, 0x01, 0x04, 0x14, 0x10, 0x03,
+	0x21, 0x24, 0x01, 0x51, 0x92, 0x01, 0x04, 0xBC, 0x01, 0xBD,
+	0x01, 0x01, 0xBB, 0x01, 0xBE, 0x01, 0x04, 0x15, 0x18, 0x05,
+	0x90, 0x02, 0xBB, 0x01, 0x01, 0x15, 0x18, 0x04, 0x56, 0x21,
+	0x0B, 0x01, 0xBC, 0xA2, 0x03, 0xA8, 0x03, 0x0B, 0xB0, 0x03,
+	0x81, 0x03, 0xCF, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73,
+	0x70, 0x6C, 0x69, 0x74, 0xDA, 0x05, 0xCE, 0xDC, 0x01, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x70, 0x6C,
+	0x69, 0x74, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x20, 0x73,
+	0x74, 0x72, 0x29, 0x0A, 0x0A, 0x53, 0x70, 0x6C, 0x69, 0x74,
+	0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x73, 0x74, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x64, 0x65, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72, 0x20,
+	0x64, 0x65, 0x6C, 0x69, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+	0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+	0x61, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65,
+	0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65,
+	0x6C, 0x69, 0x6D, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x64, 0x65,
+	0x6C, 0x69, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+	0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6F, 0x6E, 0x65,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF,
+	0x09, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3F,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x61, 0x62, 0x73, 0x74,
+	0x72, 0x61, 0x63, 0x74, 0x3F, 0xDA, 0x05, 0xCE, 0x2E, 0x28,
+	0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3F, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E,
+	0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20,
+	0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF, 0x04, 0x63, 0x6F, 0x72,
+	0x6F, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x51, 0x28,
+	0x63, 0x6F, 0x72, 0x6F, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x29, 0x0A, 0x0A, 0x41, 0x20, 0x77, 0x72, 0x61, 0x70,
+	0x70, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x61,
+	0x6B, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x73, 0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73,
+	0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65,
+	0x77, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D, 0x20,
+	0x2E, 0x2E, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xCC, 0x93, 0x02, 0xCD, 0xE2, 0x95, 0x02, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x29, 0x03, 0x00, 0x04, 0x0A, 0xCE,
+	0x04, 0x63, 0x6F, 0x72, 0x6F, 0xDA, 0x10, 0xCF, 0x02, 0x66,
+	0x6E, 0xD2, 0x01, 0xCF, 0x01, 0x26, 0xDA, 0x5D, 0xD8, 0x09,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x26,
+	0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2C, 0x01, 0x02,
+	0x00, 0x4C, 0x00, 0x00, 0x00, 0x26, 0x02, 0x02, 0x00, 0x2F,
+	0x01, 0x02, 0x00, 0x26, 0x02, 0x03, 0x00, 0x2C, 0x02, 0x01,
+	0x00, 0x26, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0x08,
+	0x06, 0xB4, 0x95, 0x02, 0x2A, 0x04, 0x21, 0x24, 0xCF, 0x04,
+	0x6C, 0x61, 0x73, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x3F, 0x28, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+	0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20,
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xD0, 0xC4, 0x02, 0xCD, 0x9E, 0xC6, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00,
+	0x04, 0xCE, 0x04, 0x6C, 0x61, 0x73, 0x74, 0xDA, 0x10, 0x37,
+	0x01, 0x00, 0x00, 0x05, 0x01, 0x01, 0xFF, 0x33, 0x01, 0x00,
+	0x01, 0x03, 0x01, 0x00, 0x00, 0x0B, 0x01, 0x80, 0xC6, 0x02,
+	0x14, 0x01, 0x05, 0x0C, 0x02, 0x0F, 0x12, 0xCF, 0x04, 0x6E,
+	0x65, 0x67, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x24, 0x28, 0x6E, 0x65, 0x67, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20,
+	0x74, 0x68, 0x61, 0x6E, 0x20, 0x30, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xE4, 0x20, 0xCD, 0xCA, 0x21, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00,
+	0x03, 0xCE, 0x04, 0x6E, 0x65, 0x67, 0x3F, 0xDA, 0x10, 0x25,
+	0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
+	0x00, 0x04, 0x03, 0xBC, 0x21, 0x0C, 0xCF, 0x0D, 0x67, 0x63,
+	0x73, 0x65, 0x74, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61,
+	0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x67, 0x63, 0x73,
+	0x65, 0x74, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C,
+	0xDA, 0x05, 0xCE, 0xD4, 0x01, 0x28, 0x67, 0x63, 0x73, 0x65,
+	0x74, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x29, 0x0A,
+	0x0A, 0x53, 0x65, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63,
+	0x61, 0x74, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65,
+	0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x67,
+	0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x6C,
+	0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x4C,
+	0x6F, 0x77, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x69,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72,
+	0x76, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+	0x65, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x62,
+	0x75, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6C, 0x65, 0x73,
+	0x73, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E, 0x20,
+	0x48, 0x69, 0x67, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+	0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74,
+	0x20, 0x75, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20,
+	0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E, 0xCF, 0x04, 0x64,
+	0x65, 0x66, 0x2D, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x45, 0x28, 0x64, 0x65, 0x66, 0x2D, 0x20, 0x6E, 0x61, 0x6D,
+	0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A,
+	0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20,
+	0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65,
+	0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xFC, 0x16, 0xCD, 0xE2, 0x18, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xC8, 0x29, 0x04, 0x01, 0x02, 0x06, 0xCE, 0x04, 0x64,
+	0x65, 0x66, 0x2D, 0xDA, 0x10, 0xDA, 0x5C, 0xD0, 0x07, 0x70,
+	0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x26, 0x02, 0x00, 0x00,
+	0x26, 0x03, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x03, 0x4C, 0x01,
+	0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0x06, 0xAA, 0x18, 0x36, 0xCF, 0x0C, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2F, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0xDA, 0x05, 0xCE,
+	0xA6, 0x02, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x65,
+	0x6E, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x72, 0x72, 0x20,
+	0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A,
+	0x0A, 0x45, 0x6E, 0x73, 0x75, 0x72, 0x65, 0x73, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65,
+	0x6D, 0x6F, 0x72, 0x79, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x69,
+	0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x6F,
+	0x75, 0x67, 0x68, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+	0x69, 0x74, 0x79, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2E,
+	0x20, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20,
+	0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0x20,
+	0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63,
+	0x6B, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+	0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x72,
+	0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67,
+	0x68, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68,
+	0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+	0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65,
+	0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6D,
+	0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x6F,
+	0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20,
+	0x73, 0x70, 0x61, 0x63, 0x65, 0x2E, 0xCF, 0x08, 0x6B, 0x65,
+	0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x26, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+	0x72, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+	0x64, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xC2,
+	0x26, 0xCD, 0xC8, 0x27, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x08, 0x6B, 0x65,
+	0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0x20, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+	0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x1F, 0x00,
+	0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0xA4, 0x27,
+	0x0E, 0x03, 0x05, 0x1A, 0xCF, 0x06, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x1F,
+	0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x98, 0x2B,
+	0xCD, 0x8C, 0x2C, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x06, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x57, 0x2B,
+	0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
+	0x00, 0x26, 0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03,
+	0x00, 0x00, 0x00, 0x07, 0x03, 0xEC, 0x2B, 0x0E, 0x03, 0x05,
+	0x16, 0xCF, 0x05, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x52, 0x28, 0x63, 0x6F, 0x75,
+	0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+	0x64, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28, 0x70, 0x72,
+	0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x20,
+	0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD6, 0xEF, 0x02, 0xCD, 0xCA,
+	0xF2, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x06, 0x02, 0x00, 0x0E, 0xCE, 0x05, 0x63, 0x6F, 0x75, 0x6E,
+	0x74, 0xDA, 0x10, 0x25, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01,
+	0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43,
+	0x05, 0x03, 0x04, 0x1A, 0x05, 0x08, 0x00, 0x33, 0x05, 0x01,
+	0x03, 0x2B, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x00, 0x00, 0x1A,
+	0x05, 0x02, 0x00, 0x05, 0x02, 0x02, 0x01, 0x49, 0x03, 0x04,
+	0x01, 0x18, 0xFA, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x19,
+	0x01, 0x98, 0xF1, 0x02, 0x1C, 0x06, 0x24, 0x5C, 0x02, 0x3A,
+	0x63, 0x01, 0x07, 0x30, 0x01, 0x2C, 0x2D, 0x02, 0x5D, 0x62,
+	0x01, 0xE5, 0x01, 0xFC, 0x01, 0xCF, 0x10, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x62,
+	0x79, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x10, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68,
+	0x2D, 0x62, 0x79, 0x74, 0x65, 0xDA, 0x05, 0xCE, 0xA6, 0x01,
+	0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x41,
+	0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C,
+	0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61,
+	0x73, 0x20, 0x6E, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72,
+	0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72,
+	0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72,
+	0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0A, 0x64, 0x6F,
+	0x63, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x39, 0x28, 0x64, 0x6F, 0x63,
+	0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x74, 0x65,
+	0x78, 0x74, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x66, 0x6F, 0x72,
+	0x6D, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74,
+	0x6F, 0x20, 0x77, 0x72, 0x61, 0x70, 0x20, 0x61, 0x74, 0x20,
+	0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x6C, 0x69,
+	0x6E, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xB4, 0xC5, 0x04, 0xCD, 0xD2, 0xD2, 0x04, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xF0, 0x0B, 0x14, 0x01, 0x07, 0x48, 0x01,
+	0xCE, 0x0A, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F, 0x72, 0x6D,
+	0x61, 0x74, 0xDA, 0x10, 0xD1, 0x01, 0x50, 0xCE, 0x04, 0x20,
+	0x20, 0x20, 0x20, 0xCE, 0x00, 0xCE, 0x02, 0x20, 0x20, 0xD8,
+	0x12, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75,
+	0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xDA,
+	0xD3, 0x01, 0xCE, 0x05, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x35, 0x03, 0x03,
+	0x00, 0x25, 0x04, 0x08, 0x00, 0x07, 0x02, 0x03, 0x04, 0x17,
+	0x03, 0x02, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2B, 0x04, 0x00,
+	0x00, 0x39, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x26,
+	0x06, 0x02, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00,
+	0x00, 0x17, 0x07, 0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2A,
+	0x09, 0x00, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x17, 0x0B, 0x00,
+	0x00, 0x37, 0x0C, 0x0B, 0x00, 0x17, 0x0D, 0x0C, 0x00, 0x25,
+	0x0C, 0x00, 0x00, 0x43, 0x0E, 0x0C, 0x0D, 0x1A, 0x0E, 0x30,
+	0x00, 0x33, 0x0F, 0x0B, 0x0C, 0x17, 0x10, 0x0F, 0x00, 0x25,
+	0x12, 0x0A, 0x00, 0x1F, 0x11, 0x10, 0x12, 0x19, 0x11, 0x03,
+	0x00, 0x23, 0x11, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+	0x11, 0x00, 0x00, 0x1A, 0x11, 0x09, 0x00, 0x25, 0x13, 0x20,
+	0x00, 0x1F, 0x12, 0x10, 0x13, 0x19, 0x12, 0x03, 0x00, 0x23,
+	0x12, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x12, 0x00,
+	0x00, 0x17, 0x0F, 0x12, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+	0x0F, 0x00, 0x00, 0x1A, 0x0F, 0x0D, 0x00, 0x25, 0x12, 0x09,
+	0x00, 0x48, 0x11, 0x10, 0x12, 0x1A, 0x11, 0x06, 0x00, 0x26,
+	0x12, 0x03, 0x00, 0x2C, 0x07, 0x12, 0x00, 0x26, 0x13, 0x04,
+	0x00, 0x2F, 0x12, 0x13, 0x00, 0x18, 0x12, 0x00, 0x00, 0x2C,
+	0x07, 0x10, 0x00, 0x26, 0x13, 0x05, 0x00, 0x2F, 0x12, 0x13,
+	0x00, 0x18, 0x0E, 0x00, 0x00, 0x37, 0x11, 0x07, 0x00, 0x25,
+	0x13, 0x00, 0x00, 0x45, 0x12, 0x11, 0x13, 0x1A, 0x12, 0x02,
+	0x00, 0x2F, 0x11, 0x0A, 0x00, 0x25, 0x12, 0x0A, 0x00, 0x48,
+	0x11, 0x10, 0x12, 0x1A, 0x11, 0x06, 0x00, 0x26, 0x12, 0x06,
+	0x00, 0x2C, 0x05, 0x12, 0x00, 0x26, 0x13, 0x04, 0x00, 0x2F,
+	0x12, 0x13, 0x00, 0x25, 0x08, 0x00, 0x00, 0x25, 0x0F, 0x01,
+	0x00, 0x06, 0x0C, 0x0F, 0x0C, 0x18, 0xD0, 0xFF, 0xFF, 0x2F,
+	0x0B, 0x0A, 0x00, 0x03, 0x05, 0x00, 0x00, 0xCD, 0x80, 0x80,
+	0xE0, 0x0D, 0x04, 0x00, 0x04, 0x26, 0x01, 0xCE, 0x08, 0x70,
+	0x75, 0x73, 0x68, 0x77, 0x6F, 0x72, 0x64, 0xDA, 0x10, 0xCE,
+	0x05, 0x0A, 0x20, 0x20, 0x20, 0x20, 0xCE, 0x01, 0x20, 0xDA,
+	0xDF, 0x01, 0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x27, 0x00, 0x00, 0x08,
+	0x27, 0x02, 0x00, 0x07, 0x37, 0x01, 0x02, 0x00, 0x27, 0x03,
+	0x00, 0x08, 0x06, 0x02, 0x03, 0x01, 0x05, 0x02, 0x02, 0x01,
+	0x27, 0x03, 0x00, 0x03, 0x44, 0x01, 0x03, 0x02, 0x1A, 0x01,
+	0x05, 0x00, 0x25, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x08,
+	0x26, 0x01, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x27, 0x03,
+	0x00, 0x08, 0x05, 0x02, 0x03, 0x01, 0x29, 0x02, 0x00, 0x08,
+	0x26, 0x01, 0x01, 0x00, 0x27, 0x03, 0x00, 0x07, 0x37, 0x02,
+	0x03, 0x00, 0x27, 0x03, 0x00, 0x08, 0x06, 0x03, 0x03, 0x02,
+	0x29, 0x03, 0x00, 0x08, 0x25, 0x03, 0x00, 0x00, 0x45, 0x02,
+	0x00, 0x03, 0x1A, 0x02, 0x05, 0x00, 0x27, 0x03, 0x00, 0x05,
+	0x2C, 0x03, 0x01, 0x00, 0x26, 0x00, 0x02, 0x00, 0x2F, 0x03,
+	0x00, 0x00, 0x27, 0x02, 0x00, 0x05, 0x27, 0x03, 0x00, 0x07,
+	0x2C, 0x02, 0x03, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x02,
+	0x03, 0x00, 0x27, 0x03, 0x00, 0x07, 0x2B, 0x03, 0x00, 0x00,
+	0x26, 0x03, 0x03, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x3C, 0x01, 0xAA, 0xC8, 0x04, 0x26, 0x02,
+	0x8A, 0x01, 0x0D, 0x03, 0x15, 0x1C, 0x02, 0x15, 0x18, 0x01,
+	0x07, 0x92, 0x01, 0x02, 0x70, 0xC1, 0x01, 0x02, 0x6F, 0xC2,
+	0x01, 0x03, 0xBC, 0x01, 0xC7, 0x01, 0x01, 0xBB, 0x01, 0xC8,
+	0x01, 0x02, 0x84, 0x02, 0xC5, 0x01, 0x03, 0x17, 0x1A, 0x02,
+	0x46, 0x1B, 0x01, 0x07, 0x56, 0x04, 0x2E, 0x2F, 0x05, 0x4A,
+	0x03, 0x04, 0x44, 0x13, 0x70, 0x01, 0xB4, 0xC5, 0x04, 0x9E,
+	0x0D, 0x04, 0xA8, 0x01, 0xFD, 0x0C, 0x01, 0x17, 0x1A, 0x04,
+	0x42, 0x19, 0x04, 0x28, 0x05, 0x01, 0x22, 0x02, 0x02, 0x26,
+	0xFA, 0x04, 0x08, 0xA0, 0x05, 0x21, 0x06, 0x40, 0xDF, 0x04,
+	0x01, 0x09, 0x24, 0x06, 0x22, 0x23, 0x03, 0x21, 0x24, 0x01,
+	0x07, 0x8C, 0x04, 0x02, 0x5C, 0xB7, 0x04, 0x01, 0x07, 0xA4,
+	0x01, 0x04, 0x2C, 0x75, 0x01, 0x2B, 0x76, 0x03, 0x7E, 0x7F,
+	0x01, 0xD1, 0x01, 0x94, 0x04, 0x01, 0xC2, 0x02, 0xAB, 0x04,
+	0x02, 0x05, 0x0C, 0x01, 0x07, 0x20, 0x01, 0x30, 0x31, 0x02,
+	0x38, 0x03, 0x01, 0x0B, 0xA2, 0x01, 0x04, 0x36, 0x6F, 0x01,
+	0x5C, 0x23, 0x03, 0xCF, 0x04, 0xD8, 0x04, 0x01, 0x9A, 0x05,
+	0xE1, 0x04, 0x01, 0xFB, 0x0C, 0x8C, 0x0D, 0xCF, 0x04, 0x77,
+	0x68, 0x65, 0x6E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x5E, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E,
+	0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C,
+	0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+	0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xC4, 0x59, 0xCD, 0xDC, 0x5B,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x03, 0x01,
+	0x02, 0x08, 0xCE, 0x04, 0x77, 0x68, 0x65, 0x6E, 0xDA, 0x10,
+	0xDA, 0x5F, 0xDA, 0x5E, 0x26, 0x02, 0x00, 0x00, 0x2B, 0x02,
+	0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x02,
+	0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x08, 0xA4, 0x5B,
+	0x36, 0xCF, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x61,
+	0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02,
+	0xDA, 0x03, 0xD8, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+	0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA,
+	0x05, 0xCE, 0xCF, 0x01, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67,
+	0x2F, 0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x47,
+	0x65, 0x74, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x2E, 0x20, 0x4E, 0x6F, 0x72, 0x6D,
+	0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x69, 0x73,
+	0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65,
+	0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x75, 0x6E, 0x6C,
+	0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+	0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x75,
+	0x73, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75,
+	0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6D,
+	0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0xCF, 0x07, 0x70, 0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x42, 0x28, 0x70,
+	0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x53, 0x69, 0x6D, 0x69,
+	0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x6F, 0x73,
+	0x74, 0x77, 0x61, 0x6C, 0x6B, 0x2C, 0x20, 0x62, 0x75, 0x74,
+	0x20, 0x64, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x72,
+	0x73, 0x61, 0x6C, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xBA, 0xCD, 0x03, 0xCD, 0xA6, 0xCF, 0x03, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B, 0x06, 0x02, 0x01, 0x07,
+	0x01, 0xCE, 0x07, 0x70, 0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B,
+	0xDA, 0x10, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x04, 0x02,
+	0x09, 0x23, 0xCE, 0x04, 0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x10,
+	0xDA, 0x1D, 0xDA, 0x57, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x06, 0x02, 0x01, 0x19, 0xCE, 0x09, 0x77, 0x61, 0x6C, 0x6B,
+	0x2D, 0x64, 0x69, 0x63, 0x74, 0xDA, 0x10, 0xD8, 0x04, 0x6E,
+	0x65, 0x78, 0x74, 0x3C, 0x02, 0x00, 0x00, 0x22, 0x03, 0x00,
+	0x00, 0x2C, 0x01, 0x03, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F,
+	0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x03, 0x00,
+	0x00, 0x1F, 0x03, 0x03, 0x04, 0x19, 0x03, 0x03, 0x00, 0x23,
+	0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x03, 0x00,
+	0x00, 0x1A, 0x03, 0x0C, 0x00, 0x17, 0x03, 0x04, 0x00, 0x2B,
+	0x03, 0x00, 0x00, 0x2F, 0x05, 0x00, 0x00, 0x33, 0x03, 0x01,
+	0x03, 0x2B, 0x03, 0x00, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x34,
+	0x02, 0x05, 0x03, 0x2C, 0x01, 0x04, 0x00, 0x26, 0x05, 0x00,
+	0x00, 0x2F, 0x04, 0x05, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0x03,
+	0x02, 0x00, 0x00, 0x1A, 0x01, 0x8A, 0xC3, 0x03, 0x18, 0x0D,
+	0x20, 0x5A, 0x02, 0x44, 0x69, 0x01, 0x12, 0x0E, 0x02, 0x05,
+	0x08, 0x01, 0x1D, 0x20, 0x04, 0x31, 0x34, 0x01, 0x55, 0x64,
+	0xDA, 0x56, 0xD8, 0x0F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0xDA,
+	0x55, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06, 0x02, 0x02,
+	0x12, 0xCE, 0x08, 0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E,
+	0x64, 0xDA, 0x10, 0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x6E, 0x65, 0x77, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x37, 0x02, 0x01, 0x00,
+	0x2B, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x02,
+	0x02, 0x00, 0x37, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05,
+	0x09, 0x00, 0x33, 0x05, 0x01, 0x03, 0x2B, 0x05, 0x00, 0x00,
+	0x2F, 0x05, 0x00, 0x00, 0x2C, 0x02, 0x05, 0x00, 0x26, 0x05,
+	0x01, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x49, 0x03, 0x04, 0x01,
+	0x18, 0xF9, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x19, 0x01,
+	0xA0, 0xC1, 0x03, 0x18, 0x03, 0x34, 0x04, 0x06, 0x26, 0x2A,
+	0x02, 0x3A, 0x3D, 0x03, 0x1F, 0x22, 0x02, 0x19, 0x1C, 0x01,
+	0x9F, 0x01, 0xAE, 0x01, 0xDA, 0x58, 0xDA, 0x89, 0x01, 0x2B,
+	0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03,
+	0x00, 0x17, 0x03, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x48,
+	0x02, 0x03, 0x02, 0x1A, 0x02, 0x04, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x26, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26,
+	0x02, 0x03, 0x00, 0x48, 0x02, 0x03, 0x02, 0x1A, 0x02, 0x07,
+	0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x02, 0x02, 0x00, 0x2F,
+	0x02, 0x02, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x02, 0x04,
+	0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00, 0x48,
+	0x02, 0x03, 0x02, 0x1A, 0x02, 0x04, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x26, 0x02, 0x06, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26,
+	0x02, 0x07, 0x00, 0x48, 0x02, 0x03, 0x02, 0x1A, 0x02, 0x07,
+	0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x06, 0x00, 0x2F,
+	0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x00, 0x08,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x34,
+	0x03, 0xB8, 0xC7, 0x03, 0x14, 0x04, 0x0B, 0xCE, 0x02, 0x03,
+	0x3A, 0xBF, 0x02, 0x03, 0x39, 0xC0, 0x02, 0x03, 0x9A, 0x01,
+	0xBF, 0x02, 0x03, 0x21, 0x24, 0x03, 0x77, 0x9C, 0x02, 0x03,
+	0xD8, 0x01, 0xC1, 0x02, 0x03, 0xD7, 0x01, 0xC2, 0x02, 0x03,
+	0xAC, 0x02, 0xC1, 0x02, 0x03, 0x19, 0x1C, 0x01, 0x91, 0x02,
+	0xA6, 0x02, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00,
+	0x2B, 0x01, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x2C, 0x03,
+	0x04, 0x00, 0x26, 0x05, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00,
+	0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x02, 0x01, 0x00, 0x04, 0x01,
+	0xDA, 0x10, 0x27, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00,
+	0x27, 0x01, 0x00, 0x02, 0x30, 0x01, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x05, 0x04, 0xF6, 0xCE, 0x03, 0x18, 0x11,
+	0x01, 0xBA, 0xCD, 0x03, 0xEC, 0x01, 0x01, 0xAC, 0x01, 0xC1,
+	0x01, 0x02, 0x2E, 0x1B, 0x03, 0x39, 0x3C, 0xCF, 0x08, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61,
+	0x6E, 0xDA, 0x05, 0xCE, 0x27, 0x28, 0x6D, 0x61, 0x74, 0x68,
+	0x2F, 0x74, 0x61, 0x6E, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x74, 0x61, 0x6E, 0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x2E, 0xCF, 0x03, 0x6D, 0x69, 0x6E, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x3B, 0x28, 0x6D, 0x69,
+	0x6E, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63,
+	0x20, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75,
+	0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xBC, 0xBD, 0x02, 0xCD, 0xEA, 0xBE, 0x02,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x09, 0x02, 0x00,
+	0x02, 0x04, 0xCE, 0x03, 0x6D, 0x69, 0x6E, 0xDA, 0x10, 0xD7,
+	0xCD, 0xB6, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x10, 0xCE,
+	0x01, 0x3C, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+	0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x3E, 0x02, 0x03, 0x04,
+	0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+	0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+	0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x07, 0x02, 0x00, 0x14, 0xCE, 0x07, 0x65, 0x78,
+	0x74, 0x72, 0x65, 0x6D, 0x65, 0xDA, 0x10, 0x37, 0x02, 0x01,
+	0x00, 0x17, 0x03, 0x02, 0x00, 0x25, 0x04, 0x00, 0x00, 0x45,
+	0x03, 0x03, 0x04, 0x1A, 0x03, 0x0F, 0x00, 0x35, 0x03, 0x01,
+	0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43,
+	0x05, 0x03, 0x02, 0x1A, 0x05, 0x09, 0x00, 0x33, 0x05, 0x01,
+	0x03, 0x17, 0x06, 0x05, 0x00, 0x2C, 0x06, 0x04, 0x00, 0x2F,
+	0x05, 0x00, 0x00, 0x1A, 0x05, 0x02, 0x00, 0x17, 0x04, 0x06,
+	0x00, 0x49, 0x03, 0x02, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x03,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2C, 0x01, 0xC8,
+	0xB9, 0x02, 0x18, 0x03, 0x2E, 0x05, 0x01, 0x0B, 0x84, 0x02,
+	0x02, 0x2A, 0xF7, 0x01, 0x03, 0x2A, 0x92, 0x01, 0x01, 0x4C,
+	0x99, 0x01, 0x01, 0x0D, 0x10, 0x02, 0x3E, 0x0D, 0x01, 0x07,
+	0x22, 0x01, 0x24, 0x25, 0x02, 0x97, 0x01, 0x9C, 0x01, 0x02,
+	0x53, 0x66, 0x26, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00,
+	0x26, 0x01, 0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x05, 0x04,
+	0xCA, 0xBE, 0x02, 0x1E, 0xCF, 0x07, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x72, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x73, 0x79, 0x6D, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x0A,
+	0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20,
+	0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x61,
+	0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x20,
+	0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6D, 0x20,
+	0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20, 0x6E, 0x69, 0x6C,
+	0x20, 0x73, 0x79, 0x6D, 0x29, 0x20, 0x76, 0x61, 0x6C, 0x20,
+	0x73, 0x79, 0x6D, 0x29, 0x29, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8A, 0x54, 0xCD, 0xE2, 0x56,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x04, 0x02,
+	0x03, 0x0C, 0xCE, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+	0x74, 0xDA, 0x10, 0xCF, 0x01, 0x3D, 0xDA, 0x5E, 0xDA, 0x5C,
+	0x26, 0x02, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x2D, 0x02,
+	0x03, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00,
+	0x2D, 0x03, 0x02, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x3D, 0x02,
+	0x00, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2D, 0x03, 0x00, 0x02,
+	0x3D, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x0C,
+	0x94, 0x56, 0x4C, 0xCF, 0x02, 0x2F, 0x3D, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0x28, 0x28, 0x2F, 0x3D, 0x20, 0x78,
+	0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74,
+	0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x78, 0x20, 0x28, 0x2F, 0x20, 0x78,
+	0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xE0, 0x51, 0xCD, 0xF0, 0x52,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x03, 0x02,
+	0x02, 0x07, 0xCE, 0x02, 0x2F, 0x3D, 0xDA, 0x10, 0xD7, 0xCD,
+	0x98, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x01,
+	0x2F, 0x17, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A,
+	0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00,
+	0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25,
+	0x03, 0x01, 0x00, 0x4B, 0x04, 0x00, 0x00, 0x0B, 0x03, 0x03,
+	0x04, 0x03, 0x03, 0x00, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25,
+	0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x0B, 0x03, 0x03,
+	0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+	0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x2C, 0x26,
+	0x02, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D, 0x01, 0x00,
+	0x00, 0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D,
+	0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x07, 0xC8,
+	0x52, 0x26, 0xCF, 0x04, 0x6E, 0x6F, 0x74, 0x3D, 0xD3, 0x02,
+	0xDA, 0x03, 0xD7, 0xCD, 0xB2, 0x80, 0xC8, 0x20, 0x06, 0x00,
+	0x00, 0x10, 0xCE, 0x04, 0x6E, 0x6F, 0x74, 0x3D, 0x17, 0x01,
+	0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00,
+	0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04,
+	0x00, 0x05, 0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00,
+	0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02,
+	0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0xDA, 0x05, 0xCE, 0x4C, 0x28, 0x6E, 0x6F, 0x74,
+	0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x20, 0x69, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65,
+	0x71, 0x75, 0x61, 0x6C, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65,
+	0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x2E, 0xCF, 0x07, 0x62, 0x72, 0x73, 0x68, 0x69, 0x66,
+	0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0xA2, 0x80, 0xC8,
+	0x20, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x07, 0x62, 0x72, 0x73,
+	0x68, 0x69, 0x66, 0x74, 0x17, 0x01, 0x00, 0x00, 0x20, 0x02,
+	0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02,
+	0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x4B, 0x04, 0x00, 0x00,
+	0x12, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x4B, 0x03,
+	0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05,
+	0x12, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02,
+	0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00,
+	0xDA, 0x05, 0xCE, 0x92, 0x01, 0x28, 0x62, 0x72, 0x73, 0x68,
+	0x69, 0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68,
+	0x69, 0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20,
+	0x62, 0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65,
+	0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+	0x74, 0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+	0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x2E, 0xCF, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x65,
+	0x65, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x73, 0x65, 0x65, 0x6B, 0xDA, 0x05, 0xCE,
+	0xC1, 0x03, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x65,
+	0x65, 0x6B, 0x20, 0x66, 0x20, 0x5B, 0x2C, 0x77, 0x68, 0x65,
+	0x6E, 0x63, 0x65, 0x20, 0x5B, 0x2C, 0x6E, 0x5D, 0x5D, 0x29,
+	0x0A, 0x0A, 0x4A, 0x75, 0x6D, 0x70, 0x20, 0x74, 0x6F, 0x20,
+	0x61, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x2E, 0x20, 0x27, 0x77, 0x68, 0x65, 0x6E, 0x63, 0x65,
+	0x27, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x0A, 0x0A, 0x09, 0x3A,
+	0x63, 0x75, 0x72, 0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D, 0x70,
+	0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09,
+	0x3A, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D,
+	0x70, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x65,
+	0x67, 0x69, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A,
+	0x09, 0x3A, 0x65, 0x6E, 0x64, 0x20, 0x2D, 0x20, 0x6A, 0x75,
+	0x6D, 0x70, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+	0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x0A, 0x0A, 0x42, 0x79, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x27, 0x77,
+	0x68, 0x65, 0x6E, 0x63, 0x65, 0x27, 0x20, 0x69, 0x73, 0x20,
+	0x3A, 0x63, 0x75, 0x72, 0x2E, 0x20, 0x4F, 0x70, 0x74, 0x69,
+	0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E, 0x20, 0x6D, 0x61, 0x79,
+	0x20, 0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+	0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x65,
+	0x6B, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x2E, 0x20, 0x6E, 0x20, 0x6D, 0x61, 0x79,
+	0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C,
+	0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x74, 0x6F,
+	0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x6C, 0x61,
+	0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+	0x6F, 0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x34, 0x47, 0x42, 0x2E, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+	0x2E, 0xCF, 0x04, 0x64, 0x65, 0x66, 0x6E, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0x54, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72,
+	0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65,
+	0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x2E, 0x20, 0x45, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C,
+	0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x28, 0x66, 0x6E,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x5B, 0x61, 0x72, 0x67,
+	0x73, 0x5D, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x29, 0x2E, 0xDA,
+	0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0x99, 0xCD,
+	0xBA, 0x11, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B,
+	0x17, 0x01, 0x0C, 0x38, 0x01, 0xCE, 0x04, 0x64, 0x65, 0x66,
+	0x6E, 0xDA, 0x10, 0xCE, 0x00, 0xCE, 0x01, 0x28, 0xD8, 0x06,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xCE, 0x01, 0x20, 0xDA,
+	0xDF, 0x01, 0xD8, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x70, 0x72, 0x65, 0x74, 0x74, 0x79, 0xCE, 0x03, 0x29,
+	0x0A, 0x0A, 0xD8, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0xDA, 0xFE, 0x01, 0xDA, 0x89, 0x01, 0xDA, 0x99, 0x01, 0xDA,
+	0x5C, 0x28, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x17,
+	0x04, 0x03, 0x00, 0x38, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05,
+	0x00, 0x26, 0x07, 0x00, 0x00, 0x2A, 0x08, 0x00, 0x00, 0x17,
+	0x09, 0x08, 0x00, 0x25, 0x0A, 0x00, 0x00, 0x2B, 0x0A, 0x00,
+	0x00, 0x2F, 0x0A, 0x09, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x33,
+	0x0C, 0x01, 0x0B, 0x17, 0x0D, 0x0C, 0x00, 0x25, 0x0E, 0x00,
+	0x00, 0x37, 0x0F, 0x0D, 0x00, 0x17, 0x10, 0x0F, 0x00, 0x26,
+	0x11, 0x01, 0x00, 0x2C, 0x11, 0x00, 0x00, 0x26, 0x12, 0x02,
+	0x00, 0x2F, 0x11, 0x12, 0x00, 0x17, 0x12, 0x11, 0x00, 0x43,
+	0x13, 0x0E, 0x10, 0x1A, 0x13, 0x0D, 0x00, 0x26, 0x14, 0x03,
+	0x00, 0x2C, 0x12, 0x14, 0x00, 0x26, 0x15, 0x04, 0x00, 0x2F,
+	0x14, 0x15, 0x00, 0x33, 0x14, 0x0D, 0x0E, 0x25, 0x15, 0x04,
+	0x00, 0x2D, 0x14, 0x15, 0x12, 0x26, 0x16, 0x05, 0x00, 0x2F,
+	0x15, 0x16, 0x00, 0x25, 0x14, 0x01, 0x00, 0x06, 0x0E, 0x0E,
+	0x14, 0x18, 0xF3, 0xFF, 0xFF, 0x26, 0x13, 0x06, 0x00, 0x2D,
+	0x12, 0x13, 0x07, 0x26, 0x14, 0x07, 0x00, 0x2F, 0x13, 0x14,
+	0x00, 0x2C, 0x06, 0x13, 0x00, 0x26, 0x15, 0x08, 0x00, 0x2F,
+	0x14, 0x15, 0x00, 0x2C, 0x01, 0x0B, 0x00, 0x26, 0x15, 0x09,
+	0x00, 0x2F, 0x13, 0x15, 0x00, 0x26, 0x16, 0x0A, 0x00, 0x2C,
+	0x16, 0x00, 0x00, 0x2E, 0x13, 0x00, 0x00, 0x3D, 0x15, 0x00,
+	0x00, 0x26, 0x16, 0x0B, 0x00, 0x2C, 0x16, 0x00, 0x00, 0x2E,
+	0x06, 0x00, 0x00, 0x2B, 0x15, 0x00, 0x00, 0x3D, 0x13, 0x00,
+	0x00, 0x03, 0x13, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D,
+	0x05, 0x01, 0x04, 0x1B, 0x01, 0xCE, 0x05, 0x72, 0x65, 0x63,
+	0x75, 0x72, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x58, 0xDA, 0x1E,
+	0xDA, 0xFE, 0x01, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00,
+	0x01, 0x33, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x2B,
+	0x03, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x02,
+	0x00, 0x26, 0x04, 0x01, 0x00, 0x48, 0x04, 0x02, 0x04, 0x1A,
+	0x04, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x26, 0x04, 0x02,
+	0x00, 0x48, 0x04, 0x02, 0x04, 0x1A, 0x04, 0x03, 0x00, 0x29,
+	0x03, 0x00, 0x07, 0x18, 0x05, 0x00, 0x00, 0x27, 0x04, 0x00,
+	0x06, 0x2C, 0x04, 0x03, 0x00, 0x26, 0x02, 0x03, 0x00, 0x2F,
+	0x04, 0x02, 0x00, 0x27, 0x04, 0x00, 0x04, 0x43, 0x04, 0x00,
+	0x04, 0x1A, 0x04, 0x04, 0x00, 0x05, 0x04, 0x00, 0x01, 0x2B,
+	0x04, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x35, 0x01, 0xF8, 0x05,
+	0x94, 0x04, 0x03, 0x2C, 0xF1, 0x03, 0x03, 0x44, 0x0F, 0x02,
+	0x30, 0x04, 0x02, 0x07, 0xE4, 0x02, 0x02, 0x76, 0xE1, 0x02,
+	0x01, 0x07, 0x9A, 0x01, 0x01, 0x40, 0x93, 0x01, 0x01, 0x3F,
+	0x94, 0x01, 0x04, 0x7E, 0x7F, 0x02, 0x58, 0x21, 0x01, 0x07,
+	0x2A, 0x01, 0x2A, 0x2D, 0x02, 0x0D, 0x10, 0x01, 0x1B, 0x1E,
+	0x5F, 0x01, 0x8E, 0x04, 0xAA, 0x0D, 0x01, 0x48, 0x91, 0x0D,
+	0x01, 0x11, 0x14, 0x02, 0x38, 0x07, 0x01, 0x30, 0x07, 0x01,
+	0x4C, 0xF8, 0x03, 0x01, 0x23, 0x26, 0x03, 0xDC, 0x04, 0xA7,
+	0x04, 0x01, 0x15, 0x18, 0x01, 0x4A, 0x0B, 0x01, 0x13, 0x16,
+	0x01, 0x94, 0x01, 0x1B, 0x01, 0x3C, 0x00, 0x01, 0x17, 0x1A,
+	0x04, 0x50, 0x11, 0x01, 0x11, 0x14, 0x01, 0x4E, 0x15, 0x01,
+	0x0D, 0xEC, 0x01, 0x04, 0x3C, 0xD3, 0x01, 0x01, 0x64, 0x17,
+	0x04, 0x1D, 0x2C, 0x02, 0x70, 0x35, 0x01, 0xF1, 0x01, 0xF6,
+	0x01, 0x04, 0xC2, 0x02, 0xD5, 0x01, 0x03, 0x2B, 0x2E, 0x03,
+	0xE6, 0x01, 0x31, 0x0A, 0x45, 0x4A, 0xCF, 0x0E, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72,
+	0x73, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72,
+	0x73, 0x65, 0xDA, 0x05, 0xCE, 0x4B, 0x28, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+	0x65, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x76,
+	0x65, 0x72, 0x73, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73,
+	0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x2E, 0xCF, 0x06, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x9F, 0x01, 0x28, 0x75,
+	0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x64, 0x73, 0x20, 0x6B,
+	0x65, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x26, 0x20,
+	0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x41, 0x63, 0x63,
+	0x65, 0x70, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73,
+	0x20, 0x69, 0x74, 0x73, 0x27, 0x20, 0x61, 0x73, 0x73, 0x6F,
+	0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x54,
+	0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x74, 0x68, 0x65,
+	0x6E, 0x2C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6F,
+	0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x27, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0x88, 0xED, 0x03, 0xCD, 0xD4, 0xF0,
+	0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x05,
+	0x03, 0x00, 0x06, 0xCE, 0x06, 0x75, 0x70, 0x64, 0x61, 0x74,
+	0x65, 0xDA, 0x10, 0x33, 0x04, 0x00, 0x01, 0x2B, 0x04, 0x00,
+	0x00, 0x4C, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x34,
+	0x00, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x0B, 0x01, 0xF6,
+	0xEF, 0x03, 0x16, 0x03, 0x3C, 0x08, 0x02, 0x1B, 0x1E, 0xCF,
+	0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73,
+	0x63, 0x69, 0x69, 0x2D, 0x75, 0x70, 0x70, 0x65, 0x72, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x75, 0x70,
+	0x70, 0x65, 0x72, 0xDA, 0x05, 0xCE, 0xBE, 0x01, 0x28, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69,
+	0x69, 0x2D, 0x75, 0x70, 0x70, 0x65, 0x72, 0x20, 0x73, 0x74,
+	0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x63, 0x61,
+	0x73, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x73, 0x65,
+	0x6C, 0x76, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x41, 0x53,
+	0x43, 0x49, 0x49, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73, 0x20,
+	0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72,
+	0x79, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x63,
+	0x61, 0x73, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2C,
+	0x20, 0x6D, 0x65, 0x61, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6E,
+	0x6F, 0x20, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x20,
+	0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0xCF, 0x04,
+	0x65, 0x76, 0x61, 0x6C, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x81, 0x01, 0x28, 0x65, 0x76, 0x61, 0x6C, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x29,
+	0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+	0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x49, 0x66, 0x20,
+	0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+	0x6F, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65,
+	0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20,
+	0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78,
+	0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD2,
+	0xE4, 0x05, 0xCD, 0xEA, 0xE8, 0x05, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xC0, 0x09, 0x04, 0x02, 0x06, 0x15, 0xCE, 0x04,
+	0x65, 0x76, 0x61, 0x6C, 0xDA, 0x10, 0xDA, 0x13, 0xCE, 0x04,
+	0x65, 0x76, 0x61, 0x6C, 0xDA, 0x63, 0xDA, 0x1D, 0xD0, 0x08,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0xD0, 0x05,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x22, 0x03, 0x00, 0x00, 0x48,
+	0x02, 0x03, 0x01, 0x1A, 0x02, 0x03, 0x00, 0x26, 0x01, 0x00,
+	0x00, 0x35, 0x01, 0x01, 0x00, 0x17, 0x02, 0x01, 0x00, 0x26,
+	0x03, 0x01, 0x00, 0x2D, 0x00, 0x02, 0x03, 0x26, 0x03, 0x02,
+	0x00, 0x2F, 0x03, 0x03, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26,
+	0x00, 0x03, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x04,
+	0x00, 0x48, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x02, 0x00, 0x30,
+	0x03, 0x00, 0x00, 0x26, 0x00, 0x05, 0x00, 0x2B, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A,
+	0x06, 0xF2, 0xE6, 0x05, 0x24, 0x04, 0x3E, 0x0C, 0x03, 0x48,
+	0x1D, 0x02, 0x05, 0x1C, 0x01, 0x07, 0x50, 0x01, 0x42, 0x75,
+	0x03, 0x22, 0x0E, 0x01, 0x0D, 0x10, 0xCF, 0x0F, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xFB, 0x01,
+	0xDA, 0x05, 0xCE, 0x84, 0x01, 0x28, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x43, 0x6F,
+	0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x20, 0x54,
+	0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F,
+	0x74, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20,
+	0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2E, 0xCF, 0x0C, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x73, 0xDA,
+	0x05, 0xCE, 0x58, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x73, 0x74, 0x72,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+	0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2E, 0xCF, 0x0C, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D,
+	0x73, 0x74, 0x61, 0x6D, 0x70, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+	0xB6, 0x01, 0xCB, 0xDA, 0x05, 0xCE, 0x1C, 0x28, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64, 0x65,
+	0x70, 0x73, 0x29, 0x0A, 0x0A, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xC6, 0x8F, 0x06, 0xCD, 0xE8, 0x92, 0x06, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x0B, 0x05, 0x02, 0x07,
+	0x13, 0x01, 0xCE, 0x0C, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0xDA, 0x10, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x04, 0x01, 0x04, 0x10, 0xCE, 0x0D,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x69, 0x67,
+	0x65, 0x73, 0x74, 0xDA, 0x10, 0xD8, 0x04, 0x68, 0x61, 0x73,
+	0x68, 0xDA, 0xC1, 0x02, 0xCE, 0x01, 0x3A, 0xDA, 0xBC, 0x02,
+	0x37, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x01, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x26, 0x03, 0x02, 0x00, 0x2D, 0x01, 0x03, 0x02, 0x26, 0x03,
+	0x02, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x26, 0x03, 0x03, 0x00,
+	0x30, 0x03, 0x00, 0x00, 0x11, 0x01, 0xC8, 0x8E, 0x06, 0x16,
+	0x03, 0x22, 0x03, 0x03, 0x2A, 0x14, 0x03, 0x0B, 0x0E, 0x06,
+	0x4F, 0x52, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x0F, 0x01,
+	0x02, 0x74, 0xCE, 0x03, 0x6D, 0x61, 0x70, 0xDA, 0x10, 0xCE,
+	0x26, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+	0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x31,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x63,
+	0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0xDA,
+	0xFD, 0x01, 0x17, 0x02, 0x01, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x47, 0x03, 0x03, 0x02, 0x1A, 0x03, 0x03, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x4A, 0x03, 0x01, 0x03, 0x37, 0x03, 0x03, 0x00, 0x25, 0x04,
+	0x00, 0x00, 0x17, 0x05, 0x02, 0x00, 0x43, 0x06, 0x04, 0x05,
+	0x1A, 0x06, 0x09, 0x00, 0x4A, 0x08, 0x01, 0x04, 0x37, 0x09,
+	0x08, 0x00, 0x17, 0x08, 0x09, 0x00, 0x43, 0x09, 0x08, 0x03,
+	0x1A, 0x09, 0x02, 0x00, 0x17, 0x03, 0x08, 0x00, 0x49, 0x04,
+	0x05, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x4B, 0x04, 0x01, 0x00,
+	0x17, 0x05, 0x04, 0x00, 0x4B, 0x04, 0x01, 0x01, 0x17, 0x06,
+	0x04, 0x00, 0x4B, 0x04, 0x01, 0x02, 0x17, 0x07, 0x04, 0x00,
+	0x4B, 0x04, 0x01, 0x03, 0x17, 0x08, 0x04, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2F, 0x04, 0x09, 0x00,
+	0x17, 0x09, 0x04, 0x00, 0x25, 0x04, 0x01, 0x00, 0x47, 0x04,
+	0x02, 0x04, 0x1A, 0x04, 0x0B, 0x00, 0x25, 0x04, 0x00, 0x00,
+	0x17, 0x0A, 0x03, 0x00, 0x43, 0x0B, 0x04, 0x0A, 0x1A, 0x0B,
+	0x4C, 0x00, 0x33, 0x03, 0x05, 0x04, 0x2B, 0x03, 0x00, 0x00,
+	0x2F, 0x0C, 0x00, 0x00, 0x34, 0x09, 0x04, 0x0C, 0x05, 0x04,
+	0x04, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x25, 0x0A, 0x02, 0x00,
+	0x47, 0x04, 0x02, 0x0A, 0x1A, 0x04, 0x0D, 0x00, 0x25, 0x0A,
+	0x00, 0x00, 0x17, 0x0B, 0x03, 0x00, 0x43, 0x04, 0x0A, 0x0B,
+	0x1A, 0x04, 0x3F, 0x00, 0x17, 0x03, 0x0A, 0x00, 0x33, 0x0C,
+	0x05, 0x03, 0x33, 0x0D, 0x06, 0x03, 0x2C, 0x0C, 0x0D, 0x00,
+	0x2F, 0x0E, 0x00, 0x00, 0x34, 0x09, 0x03, 0x0E, 0x05, 0x0A,
+	0x0A, 0x01, 0x18, 0xF7, 0xFF, 0xFF, 0x25, 0x0B, 0x03, 0x00,
+	0x47, 0x0A, 0x02, 0x0B, 0x1A, 0x0A, 0x0E, 0x00, 0x25, 0x0B,
+	0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x43, 0x03, 0x0B, 0x04,
+	0x1A, 0x03, 0x30, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x33, 0x0D,
+	0x05, 0x0C, 0x33, 0x0E, 0x06, 0x0C, 0x33, 0x0A, 0x07, 0x0C,
+	0x2D, 0x0D, 0x0E, 0x0A, 0x2F, 0x02, 0x00, 0x00, 0x34, 0x09,
+	0x0C, 0x02, 0x05, 0x0B, 0x0B, 0x01, 0x18, 0xF6, 0xFF, 0xFF,
+	0x25, 0x04, 0x04, 0x00, 0x47, 0x0B, 0x02, 0x04, 0x1A, 0x0B,
+	0x0F, 0x00, 0x25, 0x04, 0x00, 0x00, 0x43, 0x0C, 0x04, 0x03,
+	0x1A, 0x0C, 0x21, 0x00, 0x17, 0x0D, 0x04, 0x00, 0x33, 0x0E,
+	0x05, 0x0D, 0x33, 0x0A, 0x06, 0x0D, 0x33, 0x02, 0x07, 0x0D,
+	0x33, 0x0B, 0x08, 0x0D, 0x2D, 0x0E, 0x0A, 0x02, 0x2B, 0x0B,
+	0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00, 0x34, 0x09, 0x0D, 0x0E,
+	0x05, 0x04, 0x04, 0x01, 0x18, 0xF4, 0xFF, 0xFF, 0x25, 0x04,
+	0x00, 0x00, 0x43, 0x0C, 0x04, 0x03, 0x1A, 0x0C, 0x13, 0x00,
+	0x17, 0x0D, 0x04, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x0A,
+	0x01, 0x00, 0x2F, 0x0E, 0x0A, 0x00, 0x17, 0x0A, 0x0E, 0x00,
+	0x25, 0x0E, 0x00, 0x00, 0x43, 0x0B, 0x0E, 0x02, 0x1A, 0x0B,
+	0x06, 0x00, 0x4A, 0x05, 0x01, 0x0E, 0x33, 0x05, 0x05, 0x0D,
+	0x34, 0x0A, 0x0E, 0x05, 0x49, 0x0E, 0x02, 0x01, 0x18, 0xFC,
+	0xFF, 0xFF, 0x2E, 0x0A, 0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00,
+	0x34, 0x09, 0x0D, 0x0E, 0x49, 0x04, 0x03, 0x01, 0x18, 0xEF,
+	0xFF, 0xFF, 0x03, 0x09, 0x00, 0x00, 0xD1, 0x01, 0x01, 0xD4,
+	0xD9, 0x02, 0x18, 0x02, 0x2A, 0x03, 0x01, 0x07, 0x6C, 0x02,
+	0x20, 0x21, 0x02, 0x8E, 0x01, 0x47, 0x01, 0x0F, 0x12, 0x04,
+	0x32, 0x96, 0x01, 0x01, 0x5C, 0xA7, 0x01, 0x01, 0x0F, 0x12,
+	0x01, 0x0D, 0x10, 0x01, 0x4C, 0x23, 0x01, 0x07, 0x26, 0x01,
+	0x20, 0x21, 0x02, 0xA1, 0x01, 0xA6, 0x01, 0x08, 0xC6, 0x01,
+	0x8F, 0x01, 0x03, 0x48, 0x0D, 0x01, 0x11, 0x14, 0x03, 0x3C,
+	0xAC, 0x07, 0x04, 0x24, 0xF1, 0x06, 0x01, 0x56, 0x5B, 0x02,
+	0x05, 0x08, 0x01, 0x19, 0x1C, 0x02, 0x35, 0x38, 0x03, 0x23,
+	0xF2, 0x06, 0x05, 0xA2, 0x01, 0xDB, 0x06, 0x01, 0x56, 0x71,
+	0x01, 0x16, 0x00, 0x02, 0x1B, 0x1E, 0x01, 0x19, 0x1C, 0x02,
+	0x35, 0x38, 0x03, 0xA1, 0x01, 0xDC, 0x06, 0x05, 0xB6, 0x02,
+	0xC5, 0x06, 0x01, 0x56, 0x87, 0x01, 0x01, 0x16, 0x00, 0x01,
+	0x16, 0x00, 0x02, 0x31, 0x34, 0x01, 0x19, 0x1C, 0x02, 0x35,
+	0x38, 0x03, 0xB5, 0x02, 0xC6, 0x06, 0x04, 0xE0, 0x03, 0xAF,
+	0x06, 0x01, 0x56, 0x9D, 0x01, 0x01, 0x16, 0x00, 0x01, 0x16,
+	0x00, 0x01, 0x16, 0x00, 0x03, 0x47, 0x4A, 0x01, 0x19, 0x1C,
+	0x02, 0x35, 0x38, 0x04, 0xBC, 0x01, 0x92, 0x01, 0x03, 0x56,
+	0xA1, 0x02, 0x01, 0x13, 0x16, 0x03, 0x46, 0x46, 0x01, 0x5C,
+	0x65, 0x01, 0x09, 0x10, 0x01, 0x1B, 0x1E, 0x02, 0x35, 0x38,
+	0x02, 0xA6, 0x01, 0x6B, 0x01, 0x19, 0x1C, 0x02, 0x93, 0x02,
+	0x96, 0x02, 0x01, 0xDF, 0x0B, 0xF0, 0x0B, 0xCE, 0x05, 0x30,
+	0x2E, 0x34, 0x2E, 0x30, 0xCE, 0x01, 0x2D, 0xCE, 0x07, 0x31,
+	0x65, 0x61, 0x35, 0x34, 0x34, 0x30, 0xCE, 0x01, 0x20, 0xDA,
+	0xBC, 0x02, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+	0x2F, 0x00, 0x02, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x2C, 0x02,
+	0x01, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x01, 0x03, 0x00,
+	0x26, 0x02, 0x02, 0x00, 0x26, 0x03, 0x03, 0x00, 0x26, 0x04,
+	0x04, 0x00, 0x2D, 0x02, 0x03, 0x04, 0x26, 0x02, 0x05, 0x00,
+	0x25, 0x03, 0x03, 0x00, 0x26, 0x04, 0x05, 0x00, 0x2D, 0x02,
+	0x03, 0x04, 0x2B, 0x00, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x06, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x80,
+	0x80, 0xA0, 0x09, 0x02, 0x01, 0x04, 0x09, 0xDA, 0x10, 0xD3,
+	0x00, 0xDA, 0xE8, 0x02, 0xCE, 0x01, 0x20, 0xDA, 0xBC, 0x02,
+	0x26, 0x01, 0x00, 0x00, 0x33, 0x00, 0x01, 0x00, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x00,
+	0x26, 0x00, 0x02, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00,
+	0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xA6, 0x92,
+	0x06, 0x2C, 0x03, 0x1D, 0x20, 0x04, 0x17, 0x1A, 0x10, 0x03,
+	0x8E, 0x91, 0x06, 0x2A, 0x01, 0x4E, 0x52, 0x03, 0x0B, 0x18,
+	0x0C, 0xBD, 0x01, 0xC0, 0x01, 0xCF, 0x07, 0x72, 0x65, 0x76,
+	0x65, 0x72, 0x73, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x62, 0x28, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
+	0x20, 0x74, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x76, 0x65, 0x72,
+	0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xBC, 0xE0, 0x03,
+	0xCD, 0xC8, 0xE4, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x04, 0x01, 0x02, 0x0F, 0xCE, 0x07, 0x72, 0x65,
+	0x76, 0x65, 0x72, 0x73, 0x65, 0xDA, 0x10, 0xDA, 0xFD, 0x01,
+	0xDA, 0xFE, 0x01, 0x37, 0x01, 0x00, 0x00, 0x05, 0x02, 0x01,
+	0xFF, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x2F,
+	0x01, 0x01, 0x00, 0x25, 0x03, 0x00, 0x00, 0x46, 0x03, 0x02,
+	0x03, 0x1A, 0x03, 0x07, 0x00, 0x33, 0x03, 0x00, 0x02, 0x2C,
+	0x01, 0x03, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x03, 0x03,
+	0x00, 0x05, 0x02, 0x02, 0xFF, 0x18, 0xF8, 0xFF, 0xFF, 0x03,
+	0x01, 0x00, 0x00, 0x22, 0x01, 0xAE, 0xE2, 0x03, 0x12, 0x01,
+	0x2A, 0x01, 0x03, 0x36, 0x0C, 0x02, 0x34, 0x0D, 0x01, 0x0D,
+	0x6E, 0x01, 0x52, 0x6B, 0x03, 0x29, 0x2C, 0x01, 0x48, 0x31,
+	0x01, 0x6F, 0x72, 0x01, 0xF7, 0x02, 0x90, 0x03, 0xCF, 0x0E,
+	0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6,
+	0x01, 0xCB, 0xDA, 0x05, 0xCE, 0x99, 0x01, 0x28, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x70, 0x61, 0x74, 0x68,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x65, 0x78,
+	0x69, 0x74, 0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+	0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x68, 0x65,
+	0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x6C, 0x6F,
+	0x61, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F,
+	0x75, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xDE, 0xB6, 0x06,
+	0xCD, 0x9A, 0xC7, 0x06, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xF0, 0x0B, 0x0F, 0x03, 0x0A, 0x1F, 0x04, 0xCE, 0x0E, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0xDA, 0x10, 0xD7, 0xCD, 0x80, 0x80, 0xC0,
+	0x09, 0x02, 0x01, 0x02, 0x08, 0xCE, 0x08, 0x6D, 0x61, 0x6B,
+	0x65, 0x2D, 0x65, 0x6E, 0x76, 0xDA, 0x10, 0xDA, 0x00, 0xD8,
+	0x0E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74,
+	0x70, 0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x00, 0x02, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x00,
+	0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x00, 0x01, 0x00, 0x2F,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x03, 0xE8,
+	0x9D, 0x05, 0x2C, 0x04, 0x4E, 0x08, 0x01, 0xF3, 0x03, 0x8A,
+	0x04, 0xD0, 0x0E, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xD0, 0x06, 0x63,
+	0x68, 0x75, 0x6E, 0x6B, 0x73, 0xD0, 0x09, 0x6F, 0x6E, 0x2D,
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0xD0, 0x06, 0x73, 0x6F,
+	0x75, 0x72, 0x63, 0x65, 0xD0, 0x05, 0x62, 0x61, 0x74, 0x63,
+	0x68, 0xD0, 0x03, 0x65, 0x6E, 0x76, 0xD0, 0x10, 0x6F, 0x6E,
+	0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B,
+	0x28, 0x01, 0x17, 0x90, 0x01, 0x01, 0xCE, 0x0B, 0x72, 0x75,
+	0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0xDA,
+	0x10, 0xDA, 0x83, 0x03, 0xDA, 0x84, 0x03, 0xDA, 0x85, 0x03,
+	0xDA, 0x86, 0x03, 0xDA, 0x87, 0x03, 0xDA, 0x88, 0x03, 0xDA,
+	0x89, 0x03, 0xDA, 0x13, 0xD7, 0xCD, 0x80, 0x80, 0xC0, 0x09,
+	0x04, 0x02, 0x06, 0x13, 0xCE, 0x07, 0x67, 0x65, 0x74, 0x6C,
+	0x69, 0x6E, 0x65, 0xDA, 0x10, 0xCE, 0x00, 0xD8, 0x06, 0x73,
+	0x74, 0x64, 0x6F, 0x75, 0x74, 0xD8, 0x0A, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0xD8, 0x05, 0x73,
+	0x74, 0x64, 0x69, 0x6E, 0xD0, 0x04, 0x6C, 0x69, 0x6E, 0x65,
+	0xD8, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61,
+	0x64, 0x22, 0x03, 0x00, 0x00, 0x48, 0x02, 0x03, 0x00, 0x1A,
+	0x02, 0x05, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00,
+	0x00, 0x39, 0x03, 0x00, 0x00, 0x17, 0x00, 0x03, 0x00, 0x17,
+	0x02, 0x00, 0x00, 0x1A, 0x01, 0x05, 0x00, 0x26, 0x03, 0x01,
+	0x00, 0x2C, 0x03, 0x01, 0x00, 0x26, 0x00, 0x02, 0x00, 0x2F,
+	0x03, 0x00, 0x00, 0x26, 0x03, 0x03, 0x00, 0x26, 0x00, 0x04,
+	0x00, 0x2D, 0x03, 0x00, 0x02, 0x26, 0x00, 0x05, 0x00, 0x2F,
+	0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x13, 0x08, 0x8A,
+	0xA8, 0x05, 0x20, 0x01, 0x28, 0x1A, 0x04, 0x10, 0x11, 0x05,
+	0x32, 0x0C, 0x01, 0xF5, 0x01, 0x84, 0x02, 0xD8, 0x10, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x74, 0x72, 0x61, 0x63, 0x65, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x05, 0x03, 0x06, 0x0D, 0xCE, 0x0B, 0x62, 0x61, 0x64,
+	0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xDA, 0x10,
+	0xD8, 0x06, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0xCE, 0x0F,
+	0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x3A, 0x20, 0xCE, 0x11, 0x20, 0x77, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x69, 0x6E, 0x67, 0x20, 0xCE, 0x01, 0x0A, 0xDA, 0x8E, 0x03,
+	0xDA, 0x93, 0x03, 0x26, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01,
+	0x00, 0x2D, 0x03, 0x04, 0x00, 0x26, 0x03, 0x02, 0x00, 0x26,
+	0x04, 0x03, 0x00, 0x2D, 0x03, 0x02, 0x04, 0x26, 0x04, 0x04,
+	0x00, 0x2F, 0x03, 0x04, 0x00, 0x1A, 0x01, 0x04, 0x00, 0x2B,
+	0x01, 0x00, 0x00, 0x26, 0x04, 0x05, 0x00, 0x30, 0x04, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x08, 0x94, 0xA5, 0x05,
+	0x8E, 0x01, 0x01, 0x96, 0x01, 0x41, 0x03, 0x1A, 0x1B, 0x01,
+	0x19, 0x1C, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x05, 0x02,
+	0x0A, 0x19, 0xCE, 0x09, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0xDA, 0x10, 0xD8, 0x0C, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65, 0x72, 0x65, 0xDA,
+	0xBC, 0x02, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xCE, 0x13, 0x75, 0x6E,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x64, 0x65,
+	0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72, 0xDA, 0x95, 0x03,
+	0xCE, 0x0F, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0xCE, 0x0D, 0x20,
+	0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x62, 0x79, 0x74,
+	0x65, 0x20, 0xCE, 0x02, 0x3A, 0x20, 0xCE, 0x01, 0x0A, 0xDA,
+	0x8E, 0x03, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+	0x2F, 0x02, 0x03, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x04,
+	0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x04, 0x02, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x17, 0x04,
+	0x02, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17, 0x02, 0x04, 0x00,
+	0x18, 0x03, 0x00, 0x00, 0x26, 0x00, 0x03, 0x00, 0x17, 0x02,
+	0x00, 0x00, 0x26, 0x04, 0x04, 0x00, 0x26, 0x00, 0x05, 0x00,
+	0x2D, 0x04, 0x00, 0x01, 0x26, 0x04, 0x06, 0x00, 0x26, 0x00,
+	0x07, 0x00, 0x2D, 0x04, 0x03, 0x00, 0x26, 0x04, 0x08, 0x00,
+	0x2C, 0x02, 0x04, 0x00, 0x26, 0x04, 0x09, 0x00, 0x30, 0x04,
+	0x00, 0x00, 0x13, 0x03, 0x86, 0xA2, 0x05, 0x1E, 0x03, 0x0F,
+	0x12, 0x03, 0x7E, 0x11, 0x06, 0x07, 0x36, 0x0A, 0xDB, 0x02,
+	0x84, 0x03, 0xCE, 0x0B, 0x3C, 0x61, 0x6E, 0x6F, 0x6E, 0x79,
+	0x6D, 0x6F, 0x75, 0x73, 0x3E, 0xD8, 0x0A, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xCE, 0x00, 0xDA,
+	0xE4, 0x01, 0xD8, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0xD8, 0x0F,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68, 0x61, 0x73,
+	0x2D, 0x6D, 0x6F, 0x72, 0x65, 0xD8, 0x0E, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+	0x65, 0xDA, 0xFE, 0x01, 0xD8, 0x0D, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0xDA,
+	0xD6, 0x02, 0xD0, 0x07, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x28, 0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x33,
+	0x02, 0x00, 0x03, 0x17, 0x03, 0x02, 0x00, 0x26, 0x04, 0x01,
+	0x00, 0x33, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x26,
+	0x05, 0x02, 0x00, 0x33, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02,
+	0x00, 0x26, 0x06, 0x03, 0x00, 0x33, 0x02, 0x00, 0x06, 0x17,
+	0x06, 0x02, 0x00, 0x26, 0x07, 0x04, 0x00, 0x33, 0x02, 0x00,
+	0x07, 0x17, 0x07, 0x02, 0x00, 0x26, 0x08, 0x05, 0x00, 0x33,
+	0x02, 0x00, 0x08, 0x17, 0x08, 0x02, 0x00, 0x26, 0x09, 0x06,
+	0x00, 0x33, 0x02, 0x00, 0x09, 0x17, 0x09, 0x02, 0x00, 0x22,
+	0x0B, 0x00, 0x00, 0x48, 0x0A, 0x0B, 0x08, 0x1A, 0x0A, 0x04,
+	0x00, 0x26, 0x02, 0x07, 0x00, 0x35, 0x02, 0x02, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x17, 0x02, 0x08, 0x00, 0x17, 0x0A, 0x02,
+	0x00, 0x22, 0x0D, 0x00, 0x00, 0x48, 0x0C, 0x0D, 0x04, 0x1A,
+	0x0C, 0x03, 0x00, 0x26, 0x0B, 0x08, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x17, 0x0B, 0x04, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x22,
+	0x0F, 0x00, 0x00, 0x48, 0x0E, 0x0F, 0x05, 0x1A, 0x0E, 0x03,
+	0x00, 0x26, 0x0D, 0x09, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17,
+	0x0D, 0x05, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x22, 0x11, 0x00,
+	0x00, 0x48, 0x10, 0x11, 0x09, 0x1A, 0x10, 0x03, 0x00, 0x26,
+	0x0F, 0x0A, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x0F, 0x09,
+	0x00, 0x17, 0x10, 0x0F, 0x00, 0x22, 0x13, 0x00, 0x00, 0x48,
+	0x12, 0x13, 0x03, 0x1A, 0x12, 0x03, 0x00, 0x26, 0x11, 0x0B,
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x11, 0x03, 0x00, 0x17,
+	0x12, 0x11, 0x00, 0x22, 0x15, 0x00, 0x00, 0x48, 0x14, 0x15,
+	0x06, 0x1A, 0x14, 0x03, 0x00, 0x26, 0x13, 0x0C, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x17, 0x13, 0x06, 0x00, 0x17, 0x14, 0x13,
+	0x00, 0x23, 0x15, 0x00, 0x00, 0x26, 0x17, 0x0D, 0x00, 0x2F,
+	0x16, 0x17, 0x00, 0x17, 0x17, 0x16, 0x00, 0x25, 0x18, 0x00,
+	0x00, 0x2B, 0x18, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x17,
+	0x19, 0x18, 0x00, 0x2A, 0x1A, 0x00, 0x00, 0x17, 0x1B, 0x1A,
+	0x00, 0x26, 0x1C, 0x07, 0x00, 0x35, 0x1C, 0x1C, 0x00, 0x26,
+	0x1D, 0x07, 0x00, 0x36, 0x1D, 0x0A, 0x00, 0x26, 0x1D, 0x0E,
+	0x00, 0x2B, 0x1D, 0x00, 0x00, 0x39, 0x1D, 0x00, 0x00, 0x17,
+	0x1E, 0x1D, 0x00, 0x1A, 0x15, 0x32, 0x00, 0x2B, 0x1E, 0x00,
+	0x00, 0x26, 0x20, 0x0F, 0x00, 0x2F, 0x1F, 0x20, 0x00, 0x2C,
+	0x1E, 0x17, 0x00, 0x2F, 0x1F, 0x0C, 0x00, 0x25, 0x1F, 0x00,
+	0x00, 0x22, 0x20, 0x00, 0x00, 0x37, 0x21, 0x1E, 0x00, 0x17,
+	0x22, 0x21, 0x00, 0x25, 0x23, 0x00, 0x00, 0x47, 0x21, 0x22,
+	0x23, 0x1A, 0x21, 0x02, 0x00, 0x24, 0x15, 0x00, 0x00, 0x45,
+	0x21, 0x22, 0x1F, 0x1A, 0x21, 0xF1, 0xFF, 0x2D, 0x17, 0x1E,
+	0x1F, 0x26, 0x24, 0x10, 0x00, 0x2F, 0x23, 0x24, 0x00, 0x06,
+	0x1F, 0x1F, 0x23, 0x38, 0x23, 0x00, 0x00, 0x17, 0x24, 0x23,
+	0x00, 0x2B, 0x17, 0x00, 0x00, 0x26, 0x25, 0x11, 0x00, 0x2F,
+	0x23, 0x25, 0x00, 0x1A, 0x23, 0x08, 0x00, 0x2B, 0x17, 0x00,
+	0x00, 0x26, 0x26, 0x12, 0x00, 0x2F, 0x25, 0x26, 0x00, 0x2C,
+	0x24, 0x25, 0x00, 0x26, 0x27, 0x13, 0x00, 0x2F, 0x26, 0x27,
+	0x00, 0x18, 0xF6, 0xFF, 0xFF, 0x25, 0x23, 0x00, 0x00, 0x37,
+	0x25, 0x24, 0x00, 0x43, 0x26, 0x23, 0x25, 0x1A, 0x26, 0x05,
+	0x00, 0x2C, 0x24, 0x23, 0x00, 0x2F, 0x25, 0x1B, 0x00, 0x06,
+	0x23, 0x23, 0x25, 0x18, 0xFA, 0xFF, 0xFF, 0x2B, 0x17, 0x00,
+	0x00, 0x26, 0x26, 0x14, 0x00, 0x2F, 0x25, 0x26, 0x00, 0x26,
+	0x27, 0x15, 0x00, 0x48, 0x26, 0x25, 0x27, 0x1A, 0x26, 0xE0,
+	0xFF, 0x2C, 0x17, 0x14, 0x00, 0x2F, 0x25, 0x12, 0x00, 0x18,
+	0xDD, 0xFF, 0xFF, 0x2B, 0x17, 0x00, 0x00, 0x26, 0x20, 0x14,
+	0x00, 0x2F, 0x1F, 0x20, 0x00, 0x26, 0x21, 0x16, 0x00, 0x48,
+	0x20, 0x1F, 0x21, 0x1A, 0x20, 0x03, 0x00, 0x2C, 0x17, 0x14,
+	0x00, 0x2F, 0x1F, 0x12, 0x00, 0x26, 0x1F, 0x07, 0x00, 0x36,
+	0x1F, 0x1C, 0x00, 0x03, 0x0A, 0x00, 0x00, 0xCD, 0x80, 0x80,
+	0xF0, 0x0F, 0x0D, 0x02, 0x04, 0x23, 0x01, 0x01, 0xCE, 0x05,
+	0x65, 0x76, 0x61, 0x6C, 0x6E, 0xDA, 0x10, 0xD0, 0x01, 0x61,
+	0xDA, 0x9C, 0x01, 0xD8, 0x0C, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0xD0, 0x04, 0x64,
+	0x65, 0x61, 0x64, 0x28, 0x02, 0x00, 0x00, 0x23, 0x03, 0x00,
+	0x00, 0x25, 0x04, 0x01, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x26,
+	0x06, 0x00, 0x00, 0x2C, 0x05, 0x06, 0x00, 0x26, 0x07, 0x01,
+	0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x05, 0x06, 0x00, 0x27,
+	0x07, 0x00, 0x19, 0x25, 0x08, 0x00, 0x00, 0x25, 0x09, 0x00,
+	0x00, 0x34, 0x07, 0x08, 0x09, 0x22, 0x08, 0x00, 0x00, 0x31,
+	0x07, 0x05, 0x08, 0x17, 0x08, 0x07, 0x00, 0x1A, 0x03, 0x06,
+	0x00, 0x27, 0x09, 0x00, 0x15, 0x1A, 0x09, 0x04, 0x00, 0x2C,
+	0x05, 0x08, 0x00, 0x27, 0x0A, 0x00, 0x0E, 0x2F, 0x09, 0x0A,
+	0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x2F,
+	0x09, 0x0A, 0x00, 0x26, 0x0B, 0x03, 0x00, 0x48, 0x0A, 0x09,
+	0x0B, 0x1A, 0x0A, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00, 0x27,
+	0x0B, 0x00, 0x19, 0x25, 0x0C, 0x00, 0x00, 0x33, 0x09, 0x0B,
+	0x0C, 0x25, 0x0C, 0x01, 0x00, 0x06, 0x0B, 0x0C, 0x09, 0x03,
+	0x0B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xCD, 0x80,
+	0x80, 0xA0, 0x0D, 0x06, 0x00, 0x0E, 0x44, 0x02, 0xDA, 0x10,
+	0xDA, 0x87, 0x01, 0xD8, 0x0D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x2D, 0x62, 0x61, 0x74, 0x63, 0x68, 0xDA, 0x63,
+	0xDA, 0x1D, 0xDA, 0xD5, 0x02, 0xD0, 0x05, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0xD0, 0x03, 0x65, 0x6E, 0x64, 0xD0, 0x05, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0xDA, 0xD6, 0x02, 0xCE, 0x0F, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x3A, 0x20, 0xCE, 0x05, 0x20, 0x61, 0x74, 0x20,
+	0x28, 0xCE, 0x01, 0x3A, 0xCE, 0x01, 0x29, 0xDA, 0xBC, 0x02,
+	0x27, 0x00, 0x00, 0x07, 0x1A, 0x00, 0x14, 0x00, 0x27, 0x00,
+	0x01, 0x00, 0x27, 0x01, 0x01, 0x01, 0x2C, 0x00, 0x01, 0x00,
+	0x26, 0x01, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x27, 0x01,
+	0x00, 0x0A, 0x27, 0x02, 0x00, 0x14, 0x2D, 0x00, 0x01, 0x02,
+	0x27, 0x01, 0x00, 0x19, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x02,
+	0x01, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x35, 0x00, 0x01, 0x00,
+	0x17, 0x02, 0x00, 0x00, 0x35, 0x00, 0x01, 0x01, 0x17, 0x03,
+	0x00, 0x00, 0x29, 0x02, 0x01, 0x04, 0x17, 0x00, 0x03, 0x00,
+	0x18, 0x0A, 0x00, 0x00, 0x27, 0x01, 0x01, 0x00, 0x27, 0x02,
+	0x01, 0x01, 0x33, 0x00, 0x01, 0x02, 0x27, 0x01, 0x00, 0x0A,
+	0x27, 0x02, 0x00, 0x14, 0x2D, 0x00, 0x01, 0x02, 0x26, 0x02,
+	0x02, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x17, 0x00, 0x01, 0x00,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x03, 0x00, 0x2F, 0x01,
+	0x02, 0x00, 0x26, 0x03, 0x04, 0x00, 0x48, 0x02, 0x01, 0x03,
+	0x1A, 0x02, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x24, 0x01,
+	0x00, 0x00, 0x29, 0x01, 0x01, 0x03, 0x26, 0x03, 0x05, 0x00,
+	0x33, 0x01, 0x00, 0x03, 0x17, 0x03, 0x01, 0x00, 0x26, 0x02,
+	0x06, 0x00, 0x33, 0x01, 0x00, 0x02, 0x17, 0x02, 0x01, 0x00,
+	0x26, 0x04, 0x07, 0x00, 0x33, 0x01, 0x00, 0x04, 0x17, 0x04,
+	0x01, 0x00, 0x26, 0x01, 0x08, 0x00, 0x33, 0x01, 0x00, 0x01,
+	0x25, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x03, 0x1A, 0x00,
+	0x0B, 0x00, 0x26, 0x00, 0x09, 0x00, 0x26, 0x05, 0x0A, 0x00,
+	0x2D, 0x00, 0x01, 0x05, 0x26, 0x00, 0x0B, 0x00, 0x2D, 0x03,
+	0x00, 0x02, 0x26, 0x00, 0x0C, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x05, 0x0D, 0x00, 0x2F, 0x00, 0x05, 0x00, 0x17, 0x01,
+	0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x27, 0x01, 0x00, 0x14,
+	0x2D, 0x00, 0x04, 0x01, 0x27, 0x01, 0x00, 0x10, 0x30, 0x01,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x54, 0x02,
+	0xE4, 0xC1, 0x05, 0x8C, 0x03, 0x05, 0x72, 0xE3, 0x02, 0x07,
+	0x1D, 0x46, 0x04, 0x23, 0x8C, 0x01, 0x01, 0xB8, 0x01, 0xE1,
+	0x01, 0x02, 0xE7, 0x01, 0xF4, 0x02, 0x03, 0xDC, 0x02, 0xF3,
+	0x02, 0x05, 0x11, 0x28, 0x01, 0xC9, 0x02, 0xCC, 0x02, 0x03,
+	0xB4, 0x03, 0xF9, 0x02, 0x02, 0x05, 0x1C, 0x01, 0x07, 0xB2,
+	0x05, 0x01, 0x52, 0xD7, 0x05, 0x02, 0x48, 0x16, 0x0B, 0x3E,
+	0x50, 0x02, 0xC8, 0x01, 0x57, 0x01, 0x07, 0xCC, 0x01, 0x09,
+	0x46, 0x73, 0x01, 0x45, 0x74, 0x01, 0x31, 0x34, 0x04, 0xB6,
+	0x02, 0xD5, 0x01, 0x3B, 0x01, 0xE0, 0xBF, 0x05, 0xEA, 0x0E,
+	0x01, 0x34, 0xCD, 0x0E, 0x01, 0x28, 0x0B, 0x01, 0x5C, 0xC4,
+	0x09, 0x04, 0x25, 0x3E, 0x01, 0x19, 0x1C, 0x04, 0xBA, 0x0A,
+	0x8B, 0x0A, 0x02, 0x40, 0x07, 0x01, 0x11, 0x14, 0x01, 0x3A,
+	0x1E, 0x02, 0x16, 0x17, 0x03, 0x14, 0x15, 0x03, 0xC4, 0x01,
+	0x00, 0x02, 0x05, 0x14, 0x02, 0x07, 0x3C, 0x03, 0x4C, 0x4F,
+	0x03, 0x09, 0x0C, 0xB6, 0x01, 0x01, 0xBC, 0xA9, 0x05, 0xC8,
+	0x2F, 0x15, 0xF0, 0x0C, 0xBF, 0x2C, 0x08, 0x90, 0x03, 0xE3,
+	0x02, 0x07, 0x2C, 0x0A, 0x07, 0x36, 0x16, 0x07, 0x4C, 0x06,
+	0x07, 0x52, 0x07, 0x07, 0x4A, 0x09, 0x01, 0x6C, 0x19, 0x02,
+	0x62, 0x07, 0x01, 0x0D, 0x10, 0x04, 0xEE, 0x01, 0x01, 0x02,
+	0x2C, 0xC6, 0x0E, 0x02, 0xF4, 0x0E, 0xC7, 0x0E, 0x02, 0x2A,
+	0x05, 0x04, 0x40, 0x03, 0x01, 0x20, 0xC2, 0x07, 0x03, 0x22,
+	0xB7, 0x07, 0x02, 0x2E, 0x07, 0x01, 0x26, 0x00, 0x01, 0x26,
+	0x06, 0x01, 0x3E, 0x09, 0x01, 0x11, 0x14, 0x02, 0x3E, 0x19,
+	0x01, 0x07, 0x2E, 0x01, 0x1C, 0x1D, 0x01, 0x3C, 0x05, 0x01,
+	0x0D, 0xF6, 0x04, 0x03, 0x4E, 0xD7, 0x04, 0x01, 0x15, 0x18,
+	0x02, 0x60, 0x33, 0x03, 0x3A, 0x08, 0x01, 0x0D, 0x6C, 0x03,
+	0x6A, 0x6D, 0x03, 0x23, 0x26, 0x01, 0x45, 0x48, 0x01, 0xA0,
+	0x01, 0x7F, 0x01, 0x38, 0x0A, 0x01, 0x09, 0x0C, 0x01, 0x0D,
+	0x4E, 0x02, 0x54, 0x57, 0x01, 0x0B, 0x0E, 0x01, 0x47, 0x4A,
+	0x03, 0x96, 0x01, 0x53, 0x02, 0x05, 0x16, 0x01, 0x0B, 0x50,
+	0x02, 0x56, 0x57, 0x01, 0x55, 0x58, 0x03, 0xA2, 0x01, 0x65,
+	0x02, 0x05, 0x1A, 0x01, 0x07, 0x4C, 0x02, 0x56, 0x57, 0x02,
+	0x3A, 0x0B, 0x01, 0x95, 0x2F, 0xA6, 0x2F, 0xDA, 0x5D, 0x28,
+	0x03, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05,
+	0x00, 0x17, 0x05, 0x04, 0x00, 0x23, 0x06, 0x00, 0x00, 0x17,
+	0x07, 0x01, 0x00, 0x2A, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08,
+	0x00, 0x2A, 0x0A, 0x01, 0x00, 0x2A, 0x0B, 0x02, 0x00, 0x2A,
+	0x0C, 0x03, 0x00, 0x26, 0x0D, 0x01, 0x00, 0x26, 0x0E, 0x02,
+	0x00, 0x2D, 0x0D, 0x0A, 0x0E, 0x26, 0x0D, 0x03, 0x00, 0x2D,
+	0x09, 0x0D, 0x0B, 0x26, 0x0D, 0x04, 0x00, 0x26, 0x0E, 0x05,
+	0x00, 0x2D, 0x0D, 0x00, 0x0E, 0x23, 0x0D, 0x00, 0x00, 0x26,
+	0x0E, 0x06, 0x00, 0x2D, 0x0D, 0x0E, 0x05, 0x26, 0x0D, 0x07,
+	0x00, 0x2C, 0x0D, 0x0C, 0x00, 0x3B, 0x0A, 0x00, 0x00, 0x2B,
+	0x0A, 0x00, 0x00, 0x26, 0x0C, 0x08, 0x00, 0x2F, 0x0B, 0x0C,
+	0x00, 0x2C, 0x05, 0x06, 0x00, 0x26, 0x0A, 0x09, 0x00, 0x30,
+	0x0A, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x02, 0x02,
+	0x01, 0x0A, 0x01, 0xCE, 0x06, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+	0x73, 0xDA, 0x10, 0xDA, 0xDF, 0x01, 0x27, 0x01, 0x00, 0x07,
+	0x1A, 0x01, 0x05, 0x00, 0x27, 0x01, 0x00, 0x07, 0x2C, 0x00,
+	0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x00, 0x00,
+	0x22, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x07, 0x27, 0x01,
+	0x00, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x0B, 0x02, 0xE4, 0xBA, 0x06, 0x54, 0x04, 0x18, 0x19,
+	0x04, 0x48, 0x1D, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x03, 0x02,
+	0x01, 0x05, 0x01, 0xDA, 0x10, 0xDA, 0xA2, 0x03, 0x24, 0x02,
+	0x00, 0x00, 0x29, 0x02, 0x00, 0x06, 0x2C, 0x00, 0x01, 0x00,
+	0x26, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x08, 0x02, 0xE4, 0xC4, 0x06, 0x1E, 0x03,
+	0x66, 0x06, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x04, 0x02, 0x04,
+	0x17, 0x01, 0xDA, 0x10, 0xDA, 0xAD, 0x03, 0xDA, 0xAE, 0x03,
+	0xDA, 0x93, 0x03, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x65, 0x78,
+	0x69, 0x74, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+	0x2F, 0x02, 0x02, 0x00, 0x26, 0x03, 0x01, 0x00, 0x1F, 0x02,
+	0x02, 0x03, 0x19, 0x02, 0x03, 0x00, 0x23, 0x02, 0x00, 0x00,
+	0x18, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x1A, 0x02,
+	0x0D, 0x00, 0x24, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x06,
+	0x2C, 0x00, 0x01, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x02,
+	0x03, 0x00, 0x27, 0x02, 0x00, 0x02, 0x1A, 0x02, 0x05, 0x00,
+	0x25, 0x02, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x02,
+	0x03, 0x00, 0x30, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x22,
+	0x03, 0xF8, 0xBD, 0x06, 0x1E, 0x06, 0x0B, 0x1A, 0x01, 0x0B,
+	0xD6, 0x02, 0x02, 0x86, 0x01, 0xEF, 0x02, 0x03, 0x60, 0x0C,
+	0x02, 0x6C, 0x10, 0x04, 0x24, 0x25, 0x01, 0x23, 0x26, 0x01,
+	0xD1, 0x02, 0xD4, 0x02, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x04,
+	0x03, 0x01, 0x05, 0x01, 0xDA, 0x10, 0xDA, 0x99, 0x03, 0x24,
+	0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x06, 0x2D, 0x00, 0x01,
+	0x02, 0x26, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0x08, 0x02, 0xA4, 0xC2, 0x06, 0x1E,
+	0x03, 0x6A, 0x12, 0x30, 0x01, 0xDE, 0xB6, 0x06, 0xBC, 0x10,
+	0x02, 0xEA, 0x02, 0xA9, 0x10, 0x01, 0x17, 0x1A, 0x01, 0x34,
+	0x0F, 0x01, 0x24, 0x06, 0x02, 0x2A, 0x8E, 0x01, 0x01, 0xD2,
+	0x09, 0x3C, 0x01, 0xF1, 0x06, 0xF2, 0x01, 0x01, 0xA6, 0x04,
+	0xD5, 0x01, 0x11, 0xCD, 0x05, 0xFA, 0x08, 0x03, 0x8A, 0x0B,
+	0xDD, 0x0A, 0xCF, 0x0F, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F,
+	0x73, 0x65, 0x74, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x2F, 0x73, 0x65, 0x74, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74,
+	0xDA, 0x05, 0xCE, 0xE3, 0x03, 0x28, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x73, 0x65, 0x74, 0x62, 0x75, 0x64, 0x67, 0x65,
+	0x74, 0x20, 0x66, 0x69, 0x62, 0x20, 0x62, 0x75, 0x64, 0x67,
+	0x65, 0x74, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x65,
+	0x64, 0x67, 0x65, 0x73, 0x20, 0x28, 0x62, 0x61, 0x63, 0x6B,
+	0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x6A, 0x75, 0x6D, 0x70,
+	0x73, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+	0x73, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x6D, 0x61, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x65, 0x61,
+	0x63, 0x68, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x69, 0x74,
+	0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65,
+	0x64, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x20, 0x72,
+	0x75, 0x6E, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x2C, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69,
+	0x73, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65,
+	0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74,
+	0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x73,
+	0x20, 0x3A, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70,
+	0x74, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x75, 0x6D,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x20, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x6C,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x64, 0x67,
+	0x65, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x69, 0x6E, 0x75, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65,
+	0x72, 0x65, 0x20, 0x69, 0x74, 0x20, 0x6C, 0x65, 0x66, 0x74,
+	0x20, 0x6F, 0x66, 0x66, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61,
+	0x20, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72,
+	0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x6C, 0x6F, 0x6E, 0x67,
+	0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x49, 0x6E, 0x74,
+	0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x73, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x20,
+	0x62, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+	0x2C, 0x20, 0x73, 0x65, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x6E, 0x65, 0x77, 0x2E, 0x20, 0x41, 0x20, 0x62,
+	0x75, 0x64, 0x67, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x30,
+	0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x2C, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62,
+	0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72,
+	0x75, 0x70, 0x74, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x66, 0x69, 0x62, 0x2E, 0xCF, 0x11,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x6D,
+	0x61, 0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x11, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73,
+	0x65, 0x74, 0x6D, 0x61, 0x78, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0xDA, 0x05, 0xCE, 0x8E, 0x01, 0x28, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2F, 0x73, 0x65, 0x74, 0x6D, 0x61, 0x78, 0x73, 0x74,
+	0x61, 0x63, 0x6B, 0x20, 0x66, 0x69, 0x62, 0x20, 0x6D, 0x61,
+	0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x29, 0x0A, 0x0A, 0x53,
+	0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61,
+	0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x63,
+	0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20,
+	0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C,
+	0x79, 0x20, 0x38, 0x31, 0x39, 0x32, 0x2E, 0xCF, 0x05, 0x74,
+	0x72, 0x75, 0x65, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x1E, 0x28, 0x74, 0x72, 0x75, 0x65, 0x3F, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xAA,
+	0x38, 0xCD, 0x8A, 0x39, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x02, 0x01, 0x00, 0x03, 0xCE, 0x05, 0x74, 0x72,
+	0x75, 0x65, 0x3F, 0xDA, 0x10, 0x23, 0x01, 0x00, 0x00, 0x1F,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x03, 0xF6,
+	0x38, 0x12, 0xCF, 0x08, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6E,
+	0x63, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x41,
+	0x28, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x63, 0x74, 0x20,
+	0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+	0x65, 0x64, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x78, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xB0, 0x8C, 0x04, 0xCD, 0xBE, 0x8F, 0x04, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x07, 0x01, 0x01,
+	0x14, 0xCE, 0x08, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x63,
+	0x74, 0xDA, 0x10, 0xDA, 0xFE, 0x01, 0x38, 0x01, 0x00, 0x00,
+	0x3C, 0x02, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x17, 0x04,
+	0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04,
+	0x1A, 0x05, 0x0D, 0x00, 0x33, 0x05, 0x00, 0x03, 0x17, 0x06,
+	0x05, 0x00, 0x33, 0x05, 0x02, 0x06, 0x1A, 0x05, 0x02, 0x00,
+	0x18, 0x06, 0x00, 0x00, 0x23, 0x05, 0x00, 0x00, 0x34, 0x02,
+	0x06, 0x05, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x05, 0x00, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x49, 0x03, 0x04, 0x01, 0x18, 0xF5,
+	0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x21, 0x01, 0xCE, 0x8D,
+	0x04, 0x18, 0x01, 0x20, 0x02, 0x07, 0x22, 0x86, 0x01, 0x01,
+	0x2A, 0x89, 0x01, 0x02, 0x07, 0x66, 0x02, 0x32, 0x5B, 0x03,
+	0x24, 0x02, 0x02, 0x77, 0x7E, 0x01, 0xDF, 0x01, 0xEE, 0x01,
+	0xCF, 0x04, 0x2D, 0x3F, 0x3E, 0x3E, 0xD4, 0x02, 0xD3, 0x02,
+	0xDA, 0x05, 0xCE, 0x9D, 0x02, 0x28, 0x2D, 0x3F, 0x3E, 0x3E,
+	0x20, 0x78, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20,
+	0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x78, 0x20,
+	0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+	0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E,
+	0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73,
+	0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+	0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x20, 0x6E, 0x69, 0x6C, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61,
+	0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65, 0x64,
+	0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x20,
+	0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E,
+	0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xA6, 0xB7, 0x03, 0xCD, 0xD4, 0xC0, 0x03, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x2B, 0x06, 0x01, 0x00, 0x0C, 0x01,
+	0xCE, 0x04, 0x2D, 0x3F, 0x3E, 0x3E, 0xDA, 0x10, 0x2A, 0x02,
+	0x00, 0x00, 0x17, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05,
+	0x06, 0x00, 0x4A, 0x05, 0x01, 0x03, 0x2C, 0x00, 0x05, 0x00,
+	0x2F, 0x00, 0x02, 0x00, 0x49, 0x03, 0x04, 0x01, 0x18, 0xFC,
+	0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x05, 0x02, 0x09, 0x30, 0xDA, 0x86, 0x01, 0xDA, 0x10,
+	0xDA, 0x1D, 0xDA, 0x58, 0xDA, 0x87, 0x01, 0xDA, 0x5D, 0xDA,
+	0x5B, 0xDA, 0x88, 0x01, 0xDA, 0x89, 0x01, 0xDA, 0x5E, 0xCF,
+	0x03, 0x6C, 0x65, 0x74, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00,
+	0x48, 0x03, 0x04, 0x02, 0x1A, 0x03, 0x0B, 0x00, 0x25, 0x04,
+	0x00, 0x00, 0x33, 0x02, 0x01, 0x04, 0x25, 0x04, 0x01, 0x00,
+	0x2C, 0x01, 0x04, 0x00, 0x26, 0x01, 0x02, 0x00, 0x2F, 0x04,
+	0x01, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26, 0x02, 0x03, 0x00,
+	0x2F, 0x01, 0x02, 0x00, 0x18, 0x06, 0x00, 0x00, 0x38, 0x02,
+	0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x01, 0x03, 0x00,
+	0x2F, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04, 0x00, 0x35, 0x02,
+	0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x35, 0x02, 0x01, 0x01,
+	0x17, 0x04, 0x02, 0x00, 0x26, 0x01, 0x04, 0x00, 0x2F, 0x02,
+	0x01, 0x00, 0x17, 0x01, 0x02, 0x00, 0x2B, 0x03, 0x00, 0x00,
+	0x38, 0x02, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x38, 0x03,
+	0x00, 0x00, 0x2D, 0x02, 0x04, 0x03, 0x26, 0x04, 0x05, 0x00,
+	0x2F, 0x02, 0x04, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x3D, 0x03,
+	0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x2C, 0x02, 0x04, 0x00,
+	0x26, 0x00, 0x06, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x26, 0x02,
+	0x07, 0x00, 0x2D, 0x02, 0x01, 0x04, 0x3D, 0x00, 0x00, 0x00,
+	0x26, 0x02, 0x08, 0x00, 0x2D, 0x02, 0x03, 0x00, 0x3D, 0x04,
+	0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x35, 0x03, 0xEC, 0xBC,
+	0x03, 0x0E, 0x02, 0x13, 0x16, 0x01, 0x07, 0xB2, 0x01, 0x02,
+	0x60, 0xC5, 0x01, 0x04, 0x14, 0x10, 0x03, 0x21, 0x24, 0x01,
+	0x51, 0x92, 0x01, 0x04, 0xBC, 0x01, 0xBD, 0x01, 0x01, 0xBB,
+	0x01, 0xBE, 0x01, 0x04, 0x15, 0x18, 0x02, 0x8C, 0x02, 0xDF,
+	0x01, 0x01, 0x11, 0x14, 0x07, 0x44, 0x14, 0x0D, 0x44, 0x30,
+	0x0B, 0x01, 0x8C, 0xBC, 0x03, 0x98, 0x04, 0x0B, 0xA0, 0x04,
+	0xF1, 0x03, 0xCF, 0x0D, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2D, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x73, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0xB6, 0x01, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xD0, 0x8C, 0x06, 0xCD, 0xFE, 0x8C, 0x06, 0xDA,
+	0x03, 0xDA, 0xF0, 0x02, 0xCF, 0x07, 0x62, 0x6C, 0x73, 0x68,
+	0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0xA0,
+	0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x07, 0x62,
+	0x6C, 0x73, 0x68, 0x69, 0x66, 0x74, 0x17, 0x01, 0x00, 0x00,
+	0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03,
+	0x01, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01,
+	0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x4B, 0x04,
+	0x00, 0x00, 0x10, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00,
+	0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04,
+	0x00, 0x05, 0x10, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01,
+	0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03,
+	0x00, 0x00, 0xDA, 0x05, 0xCE, 0x91, 0x01, 0x28, 0x62, 0x6C,
+	0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20,
+	0x73, 0x68, 0x69, 0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x78, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66,
+	0x74, 0x65, 0x64, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x62,
+	0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20,
+	0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69,
+	0x66, 0x74, 0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69,
+	0x66, 0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+	0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x2E, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70,
+	0x6F, 0x70, 0x65, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A,
+	0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x6F, 0x70, 0x65, 0x6E,
+	0xDA, 0x05, 0xCE, 0x9A, 0x02, 0x28, 0x66, 0x69, 0x6C, 0x65,
+	0x2F, 0x70, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x20, 0x5B, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x29,
+	0x0A, 0x0A, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x62,
+	0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73,
+	0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x6F, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20,
+	0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x3A, 0x72, 0x20, 0x28, 0x72, 0x65, 0x61, 0x64, 0x29,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3A, 0x77,
+	0x20, 0x28, 0x77, 0x72, 0x69, 0x74, 0x65, 0x29, 0x20, 0x6D,
+	0x6F, 0x64, 0x65, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x3A, 0x72,
+	0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+	0x73, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+	0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20,
+	0x49, 0x6E, 0x20, 0x3A, 0x77, 0x20, 0x6D, 0x6F, 0x64, 0x65,
+	0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x64, 0x69,
+	0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x61, 0x6E,
+	0x20, 0x62, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
+	0x6E, 0x20, 0x74, 0x6F, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x0E, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73,
+	0x75, 0x6D, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xA6, 0x03,
+	0xDA, 0x05, 0xCE, 0xD0, 0x01, 0x28, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65,
+	0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x20, 0x5B, 0x2C, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x5D, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x70, 0x75,
+	0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20,
+	0x57, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74,
+	0x68, 0x72, 0x6F, 0x77, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x20, 0x53,
+	0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x62, 0x79, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+	0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x72, 0x65,
+	0x61, 0x64, 0x2E, 0xCF, 0x05, 0x79, 0x69, 0x65, 0x6C, 0x64,
+	0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x88, 0x80, 0x40, 0x02,
+	0x01, 0x00, 0x02, 0xCE, 0x05, 0x79, 0x69, 0x65, 0x6C, 0x64,
+	0x32, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x05,
+	0xCE, 0xDE, 0x01, 0x28, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x59, 0x69, 0x65, 0x6C, 0x64, 0x20,
+	0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x65,
+	0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x69, 0x74,
+	0x73, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65,
+	0x64, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x61, 0x6E,
+	0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65,
+	0x61, 0x64, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x73,
+	0x20, 0x69, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x74, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D,
+	0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C,
+	0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61,
+	0x73, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65,
+	0x73, 0x75, 0x6D, 0x65, 0x2E, 0xCF, 0x0A, 0x6D, 0x61, 0x74,
+	0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x66, 0x6C,
+	0x6F, 0x6F, 0x72, 0xDA, 0x05, 0xCE, 0x54, 0x28, 0x6D, 0x61,
+	0x74, 0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65,
+	0x73, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x67, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x78,
+	0x2E, 0xCF, 0x04, 0x63, 0x61, 0x73, 0x65, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0xBB, 0x01, 0x28, 0x63, 0x61, 0x73,
+	0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
+	0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x0A,
+	0x0A, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
+	0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x57,
+	0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+	0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64,
+	0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x78, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20,
+	0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+	0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x6E, 0x69, 0x6C, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xC6, 0x65, 0xCD, 0x84, 0x6F, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x0C, 0x01, 0x07, 0x23,
+	0x01, 0xCE, 0x04, 0x63, 0x61, 0x73, 0x65, 0xDA, 0x10, 0xDA,
+	0x1D, 0xDA, 0x59, 0xDA, 0x5A, 0xDA, 0x5B, 0xDA, 0x5C, 0xDA,
+	0x5D, 0xDA, 0x5F, 0x28, 0x02, 0x00, 0x00, 0x17, 0x03, 0x00,
+	0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+	0x03, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x33, 0x03, 0x04,
+	0x03, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F,
+	0x05, 0x03, 0x00, 0x17, 0x03, 0x05, 0x00, 0x1A, 0x03, 0x03,
+	0x00, 0x17, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26,
+	0x07, 0x03, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x04, 0x06,
+	0x00, 0x17, 0x06, 0x04, 0x00, 0x2A, 0x07, 0x00, 0x00, 0x17,
+	0x08, 0x07, 0x00, 0x1A, 0x03, 0x04, 0x00, 0x25, 0x09, 0x00,
+	0x00, 0x2B, 0x09, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0x26,
+	0x09, 0x04, 0x00, 0x2D, 0x09, 0x06, 0x00, 0x26, 0x0A, 0x05,
+	0x00, 0x2F, 0x09, 0x0A, 0x00, 0x25, 0x0A, 0x00, 0x00, 0x2B,
+	0x0A, 0x00, 0x00, 0x2F, 0x0A, 0x08, 0x00, 0x26, 0x0B, 0x06,
+	0x00, 0x2D, 0x0B, 0x09, 0x0A, 0x26, 0x0B, 0x05, 0x00, 0x30,
+	0x0B, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x06, 0x01,
+	0x03, 0x20, 0x01, 0xDA, 0x54, 0xDA, 0x10, 0xD7, 0xCD, 0xB0,
+	0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x01, 0x3D,
+	0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02,
+	0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+	0x4A, 0x04, 0x00, 0x05, 0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02,
+	0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00,
+	0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0xDA, 0x5D, 0xDA, 0x5E, 0x28, 0x01,
+	0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x37, 0x02, 0x02, 0x00,
+	0x07, 0x02, 0x02, 0x00, 0x25, 0x03, 0x00, 0x00, 0x47, 0x03,
+	0x02, 0x03, 0x1A, 0x03, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x25, 0x03, 0x01, 0x00, 0x47, 0x03, 0x02, 0x03, 0x1A, 0x03,
+	0x04, 0x00, 0x27, 0x02, 0x00, 0x01, 0x33, 0x03, 0x02, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x33, 0x03,
+	0x02, 0x00, 0x26, 0x02, 0x00, 0x00, 0x27, 0x04, 0x00, 0x06,
+	0x2D, 0x02, 0x04, 0x03, 0x26, 0x04, 0x01, 0x00, 0x2F, 0x02,
+	0x04, 0x00, 0x05, 0x03, 0x00, 0x01, 0x27, 0x05, 0x00, 0x01,
+	0x33, 0x04, 0x05, 0x03, 0x05, 0x03, 0x00, 0x02, 0x2B, 0x03,
+	0x00, 0x00, 0x2F, 0x05, 0x01, 0x00, 0x26, 0x03, 0x02, 0x00,
+	0x2D, 0x03, 0x02, 0x04, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x03,
+	0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x36, 0x01, 0xF8, 0x69, 0xCC, 0x03, 0x02, 0x44, 0xB1,
+	0x03, 0x01, 0x05, 0x0C, 0x02, 0x3C, 0x0D, 0x02, 0x07, 0xC0,
+	0x02, 0x02, 0x40, 0xBF, 0x02, 0x01, 0x07, 0x86, 0x02, 0x03,
+	0x24, 0x85, 0x02, 0x02, 0x5C, 0x00, 0x05, 0x19, 0x1C, 0x01,
+	0x6C, 0x27, 0x02, 0x15, 0x18, 0x01, 0x50, 0x17, 0x02, 0x09,
+	0x0C, 0x05, 0xB1, 0x01, 0xB4, 0x01, 0x2F, 0x01, 0xC6, 0x65,
+	0xBE, 0x09, 0x09, 0xB0, 0x03, 0x93, 0x09, 0x01, 0x11, 0x14,
+	0x03, 0x58, 0x0B, 0x02, 0x22, 0x23, 0x01, 0x21, 0x24, 0x01,
+	0x11, 0x14, 0x02, 0x4E, 0x86, 0x03, 0x01, 0xD4, 0x03, 0x95,
+	0x02, 0x03, 0x18, 0xA9, 0x01, 0x04, 0x44, 0x24, 0x03, 0x4A,
+	0x23, 0x04, 0x75, 0x78, 0xCF, 0x07, 0x6D, 0x61, 0x72, 0x73,
+	0x68, 0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6D,
+	0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0xDA, 0x05, 0xCE, 0xFB,
+	0x04, 0x28, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20,
+	0x78, 0x20, 0x5B, 0x2C, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+	0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x5B,
+	0x2C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x5B, 0x2C,
+	0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x5D, 0x5D,
+	0x5D, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x72, 0x73, 0x68, 0x61,
+	0x6C, 0x20, 0x61, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x62, 0x65,
+	0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+	0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63,
+	0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x4F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20,
+	0x6F, 0x6E, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x70, 0x61,
+	0x73, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65,
+	0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B,
+	0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74,
+	0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x61, 0x72, 0x73,
+	0x68, 0x61, 0x6C, 0x20, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x65,
+	0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6F,
+	0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x77, 0x61,
+	0x72, 0x64, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C,
+	0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x75, 0x6E,
+	0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x69, 0x6E,
+	0x67, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x77, 0x72, 0x69,
+	0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20,
+	0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x61, 0x73, 0x20,
+	0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x72, 0x73,
+	0x68, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65,
+	0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72,
+	0x75, 0x74, 0x68, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x75, 0x6E,
+	0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x64, 0x65,
+	0x74, 0x65, 0x63, 0x74, 0x73, 0x2E, 0x20, 0x43, 0x6F, 0x6D,
+	0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+	0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0xCF, 0x0A, 0x64, 0x72,
+	0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x9C, 0x01, 0x28, 0x64, 0x72,
+	0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+	0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72,
+	0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72,
+	0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x79, 0x20, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63,
+	0x61, 0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+	0x62, 0x6F, 0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72,
+	0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xB6, 0x91, 0x03, 0xCD, 0xF2, 0x94, 0x03, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x02, 0x02, 0x06, 0xCE,
+	0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69,
+	0x6C, 0xDA, 0x10, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06,
+	0x02, 0x00, 0x14, 0xCE, 0x0A, 0x66, 0x69, 0x6E, 0x64, 0x2D,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0xDA, 0x10, 0x37, 0x02, 0x01,
+	0x00, 0x25, 0x03, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x43,
+	0x05, 0x03, 0x02, 0x1A, 0x05, 0x03, 0x00, 0x17, 0x05, 0x04,
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x1A,
+	0x05, 0x09, 0x00, 0x33, 0x05, 0x01, 0x03, 0x2B, 0x05, 0x00,
+	0x00, 0x2F, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x03, 0x00, 0x24,
+	0x04, 0x00, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0x05, 0x03, 0x03,
+	0x01, 0x18, 0xF3, 0xFF, 0xFF, 0x1A, 0x04, 0x02, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x32, 0x01, 0xF4,
+	0x83, 0x03, 0x16, 0x01, 0x20, 0x05, 0x01, 0x18, 0x0E, 0x01,
+	0x3C, 0x0D, 0x04, 0x07, 0x16, 0x01, 0x0D, 0xA2, 0x01, 0x01,
+	0x54, 0xB3, 0x01, 0x02, 0x2A, 0x00, 0x01, 0x07, 0x3C, 0x01,
+	0x20, 0x2F, 0x01, 0x1F, 0x30, 0x01, 0x44, 0x45, 0x01, 0xB9,
+	0x01, 0xBE, 0x01, 0x03, 0xD0, 0x01, 0xA9, 0x01, 0xDA, 0x87,
+	0x01, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F,
+	0x00, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x00, 0x01,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x03, 0x9A, 0x94, 0x03,
+	0x28, 0x03, 0x32, 0x03, 0xCF, 0x0B, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x62, 0x6C, 0x69, 0x74, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+	0x62, 0x6C, 0x69, 0x74, 0xDA, 0x05, 0xCE, 0x96, 0x02, 0x28,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x6C, 0x69,
+	0x74, 0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x73, 0x72, 0x63,
+	0x20, 0x5B, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2D, 0x73,
+	0x74, 0x61, 0x72, 0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x20,
+	0x73, 0x72, 0x63, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D,
+	0x30, 0x20, 0x5B, 0x2C, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x65,
+	0x6E, 0x64, 0x3D, 0x2D, 0x31, 0x5D, 0x5D, 0x5D, 0x29, 0x0A,
+	0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73,
+	0x20, 0x6F, 0x66, 0x20, 0x73, 0x72, 0x63, 0x20, 0x69, 0x6E,
+	0x74, 0x6F, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x43,
+	0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x6C, 0x6C, 0x79, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x69,
+	0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x72, 0x63, 0x20, 0x74,
+	0x6F, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x61,
+	0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x65, 0x73, 0x74,
+	0x2E, 0x20, 0x49, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20,
+	0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+	0x20, 0x73, 0x72, 0x63, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x65,
+	0x73, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0xCF, 0x10, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73, 0x79, 0x73,
+	0x70, 0x61, 0x74, 0x68, 0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0xE1, 0x01, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x67,
+	0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x69, 0x6E,
+	0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x6C, 0x69,
+	0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x2E,
+	0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76,
+	0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x4A, 0x41,
+	0x4E, 0x45, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x2C, 0x20,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x73, 0x65, 0x74, 0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C,
+	0x6F, 0x63, 0x61, 0x6C, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69,
+	0x6E, 0x75, 0x78, 0x2F, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x57,
+	0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6D, 0x70, 0x74,
+	0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xE2, 0xF2, 0x05, 0xCD,
+	0x98, 0xF8, 0x05, 0xD0, 0x03, 0x72, 0x65, 0x66, 0xD1, 0x01,
+	0xCE, 0x14, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x6F, 0x63,
+	0x61, 0x6C, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A, 0x61, 0x6E,
+	0x65, 0x74, 0xCF, 0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F,
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0xD3, 0x02, 0xDA, 0x03,
+	0xDA, 0xAD, 0x03, 0xDA, 0x05, 0xCE, 0xD3, 0x03, 0x28, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+	0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66,
+	0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x20,
+	0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x69, 0x6E, 0x69,
+	0x73, 0x68, 0x65, 0x64, 0x0A, 0x09, 0x3A, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x6F, 0x75, 0x74,
+	0x0A, 0x09, 0x3A, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x2D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E,
+	0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x0A, 0x09, 0x3A,
+	0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2D, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x79,
+	0x69, 0x65, 0x6C, 0x64, 0x65, 0x64, 0x0A, 0x09, 0x3A, 0x69,
+	0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64,
+	0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x75, 0x70,
+	0x20, 0x69, 0x74, 0x73, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65,
+	0x74, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x62, 0x75, 0x64, 0x67,
+	0x65, 0x74, 0x0A, 0x09, 0x3A, 0x75, 0x73, 0x65, 0x72, 0x28,
+	0x30, 0x2D, 0x39, 0x29, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+	0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20,
+	0x62, 0x79, 0x20, 0x61, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20,
+	0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x0A, 0x09, 0x3A, 0x61,
+	0x6C, 0x69, 0x76, 0x65, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+	0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20,
+	0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62,
+	0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x0A,
+	0x09, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x2D, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x68, 0x61,
+	0x73, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x65,
+	0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x79, 0x65,
+	0x74, 0x20, 0x72, 0x75, 0x6E, 0xCF, 0x09, 0x6D, 0x61, 0x74,
+	0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61,
+	0x6E, 0xDA, 0x05, 0xCE, 0x2B, 0x28, 0x6D, 0x61, 0x74, 0x68,
+	0x2F, 0x61, 0x74, 0x61, 0x6E, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x61, 0x72, 0x63, 0x74, 0x61, 0x6E, 0x67, 0x65,
+	0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x06,
+	0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x4A, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78,
+	0x31, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x70, 0x61,
+	0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C,
+	0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F,
+	0x74, 0x20, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76,
+	0x65, 0x6C, 0x79, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+	0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x90, 0xE0, 0x04, 0xCD, 0xAC,
+	0x82, 0x05, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B,
+	0x1C, 0x01, 0x11, 0x4B, 0x07, 0xCE, 0x06, 0x6D, 0x61, 0x63,
+	0x65, 0x78, 0x31, 0xDA, 0x10, 0xCF, 0x03, 0x76, 0x61, 0x72,
+	0xDA, 0x2C, 0xCF, 0x05, 0x71, 0x75, 0x6F, 0x74, 0x65, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00, 0x01, 0xCE,
+	0x08, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0xDA,
+	0x10, 0x03, 0x00, 0x00, 0x00, 0x06, 0x01, 0xA4, 0xB3, 0x02,
+	0x90, 0x01, 0xDA, 0x5C, 0xDA, 0x5E, 0xCF, 0x0A, 0x71, 0x75,
+	0x61, 0x73, 0x69, 0x71, 0x75, 0x6F, 0x74, 0x65, 0xDA, 0x5F,
+	0xDA, 0x99, 0x01, 0xCF, 0x05, 0x77, 0x68, 0x69, 0x6C, 0x65,
+	0xDA, 0x1D, 0xDA, 0x58, 0xDA, 0x55, 0xDA, 0xEB, 0x02, 0xDA,
+	0x56, 0xDA, 0xFB, 0x01, 0xDA, 0x57, 0x28, 0x01, 0x00, 0x00,
+	0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x2A, 0x04,
+	0x01, 0x00, 0x17, 0x05, 0x04, 0x00, 0x2A, 0x06, 0x02, 0x00,
+	0x17, 0x07, 0x06, 0x00, 0x2A, 0x08, 0x03, 0x00, 0x17, 0x09,
+	0x08, 0x00, 0x2A, 0x0A, 0x04, 0x00, 0x17, 0x0B, 0x0A, 0x00,
+	0x2A, 0x0C, 0x05, 0x00, 0x17, 0x0D, 0x0C, 0x00, 0x26, 0x0E,
+	0x00, 0x00, 0x26, 0x0F, 0x01, 0x00, 0x2D, 0x0E, 0x07, 0x0F,
+	0x26, 0x0E, 0x02, 0x00, 0x26, 0x0F, 0x03, 0x00, 0x2D, 0x07,
+	0x0E, 0x0F, 0x26, 0x0E, 0x04, 0x00, 0x26, 0x0F, 0x05, 0x00,
+	0x2D, 0x0E, 0x07, 0x0F, 0x26, 0x0E, 0x06, 0x00, 0x2D, 0x09,
+	0x0E, 0x0D, 0x26, 0x0E, 0x07, 0x00, 0x26, 0x0F, 0x08, 0x00,
+	0x2D, 0x0E, 0x09, 0x0F, 0x26, 0x0E, 0x09, 0x00, 0x2D, 0x0B,
+	0x0E, 0x09, 0x3B, 0x0E, 0x00, 0x00, 0x17, 0x0F, 0x0E, 0x00,
+	0x2A, 0x10, 0x06, 0x00, 0x17, 0x11, 0x10, 0x00, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x13, 0x0A, 0x00, 0x2F, 0x12, 0x13, 0x00,
+	0x17, 0x13, 0x12, 0x00, 0x26, 0x15, 0x0B, 0x00, 0x48, 0x14,
+	0x13, 0x15, 0x1A, 0x14, 0x05, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x2F, 0x15, 0x11, 0x00, 0x17, 0x12, 0x15, 0x00, 0x18, 0x1E,
+	0x00, 0x00, 0x26, 0x17, 0x0C, 0x00, 0x48, 0x16, 0x13, 0x17,
+	0x1A, 0x16, 0x06, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x18,
+	0x0D, 0x00, 0x2F, 0x17, 0x18, 0x00, 0x17, 0x15, 0x17, 0x00,
+	0x18, 0x15, 0x00, 0x00, 0x26, 0x19, 0x0E, 0x00, 0x48, 0x18,
+	0x13, 0x19, 0x1A, 0x18, 0x08, 0x00, 0x2C, 0x00, 0x01, 0x00,
+	0x2F, 0x19, 0x03, 0x00, 0x2B, 0x19, 0x00, 0x00, 0x26, 0x1B,
+	0x0F, 0x00, 0x2F, 0x1A, 0x1B, 0x00, 0x17, 0x17, 0x1A, 0x00,
+	0x18, 0x0A, 0x00, 0x00, 0x26, 0x1B, 0x10, 0x00, 0x48, 0x1A,
+	0x13, 0x1B, 0x1A, 0x1A, 0x05, 0x00, 0x2C, 0x00, 0x01, 0x00,
+	0x2F, 0x1B, 0x03, 0x00, 0x17, 0x19, 0x1B, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x17, 0x19, 0x00, 0x00, 0x17, 0x17, 0x19, 0x00,
+	0x17, 0x15, 0x17, 0x00, 0x17, 0x12, 0x15, 0x00, 0x17, 0x13,
+	0x12, 0x00, 0x03, 0x13, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0,
+	0x0D, 0x06, 0x02, 0x01, 0x18, 0x01, 0xCE, 0x07, 0x64, 0x6F,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0xDA, 0x10, 0xDA, 0xF9, 0x01,
+	0x3C, 0x02, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x2C, 0x00,
+	0x03, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x03, 0x03, 0x00,
+	0x22, 0x04, 0x00, 0x00, 0x1F, 0x04, 0x04, 0x03, 0x19, 0x04,
+	0x03, 0x00, 0x23, 0x04, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x24, 0x04, 0x00, 0x00, 0x1A, 0x04, 0x0C, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x27, 0x05, 0x00, 0x01, 0x2F, 0x04, 0x05, 0x00,
+	0x33, 0x05, 0x00, 0x03, 0x2B, 0x05, 0x00, 0x00, 0x2F, 0x05,
+	0x01, 0x00, 0x34, 0x02, 0x04, 0x05, 0x2C, 0x00, 0x03, 0x00,
+	0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x18, 0xEF,
+	0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x29, 0x01, 0x80, 0xE2, 0x04, 0x1A, 0x04, 0x38, 0x03,
+	0x06, 0x32, 0x04, 0x01, 0x0D, 0xB4, 0x01, 0x03, 0x4C, 0xB7,
+	0x01, 0x01, 0x2E, 0x01, 0x02, 0x13, 0x16, 0x01, 0x2D, 0x30,
+	0x03, 0x7C, 0x43, 0x01, 0xB3, 0x01, 0xB8, 0x01, 0x01, 0x99,
+	0x01, 0xAE, 0x01, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x04, 0x01,
+	0x08, 0x26, 0x01, 0xCE, 0x0F, 0x65, 0x78, 0x70, 0x61, 0x6E,
+	0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73,
+	0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x55, 0xDA, 0xEB, 0x02, 0xDA,
+	0x58, 0xDA, 0x89, 0x01, 0xDA, 0x57, 0xDA, 0x56, 0xDA, 0xFB,
+	0x01, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+	0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02,
+	0x00, 0x26, 0x02, 0x01, 0x00, 0x48, 0x02, 0x03, 0x02, 0x1A,
+	0x02, 0x04, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x02, 0x02,
+	0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x02, 0x03, 0x00, 0x48,
+	0x02, 0x03, 0x02, 0x1A, 0x02, 0x07, 0x00, 0x2C, 0x01, 0x00,
+	0x00, 0x26, 0x02, 0x02, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x2B,
+	0x02, 0x00, 0x00, 0x26, 0x02, 0x04, 0x00, 0x30, 0x02, 0x00,
+	0x00, 0x26, 0x02, 0x05, 0x00, 0x48, 0x02, 0x03, 0x02, 0x1A,
+	0x02, 0x04, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x27, 0x02, 0x00,
+	0x03, 0x30, 0x02, 0x00, 0x00, 0x26, 0x02, 0x06, 0x00, 0x48,
+	0x02, 0x03, 0x02, 0x1A, 0x02, 0x07, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x27, 0x00, 0x00, 0x03, 0x2F, 0x02, 0x00, 0x00, 0x2B,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x30,
+	0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x38, 0x01,
+	0xC8, 0xE4, 0x04, 0xF6, 0x03, 0x03, 0x48, 0xE7, 0x03, 0x04,
+	0x0B, 0xAA, 0x03, 0x03, 0x38, 0x8B, 0x03, 0x03, 0x37, 0x8C,
+	0x03, 0x03, 0x9C, 0x01, 0x8B, 0x03, 0x03, 0x19, 0x1C, 0x03,
+	0x81, 0x01, 0xF0, 0x02, 0x03, 0xE8, 0x01, 0x83, 0x03, 0x03,
+	0xE7, 0x01, 0x84, 0x03, 0x03, 0xDE, 0x02, 0x83, 0x03, 0x03,
+	0x21, 0x24, 0x03, 0x68, 0x45, 0xCD, 0x80, 0x80, 0xE0, 0x0D,
+	0x05, 0x01, 0x02, 0x1C, 0x01, 0xCE, 0x09, 0x65, 0x78, 0x70,
+	0x61, 0x6E, 0x64, 0x64, 0x65, 0x66, 0xDA, 0x10, 0xDA, 0x89,
+	0x01, 0xDA, 0x88, 0x01, 0x37, 0x01, 0x00, 0x00, 0x05, 0x01,
+	0x01, 0xFF, 0x33, 0x01, 0x00, 0x01, 0x25, 0x02, 0x01, 0x00,
+	0x33, 0x02, 0x00, 0x02, 0x25, 0x04, 0x00, 0x00, 0x33, 0x03,
+	0x00, 0x04, 0x2B, 0x02, 0x00, 0x00, 0x27, 0x02, 0x00, 0x05,
+	0x2F, 0x04, 0x02, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x38, 0x03,
+	0x00, 0x00, 0x25, 0x04, 0x02, 0x00, 0x25, 0x02, 0xFE, 0xFF,
+	0x2D, 0x00, 0x04, 0x02, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x04,
+	0x02, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01,
+	0x2F, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x38, 0x02,
+	0x00, 0x00, 0x2D, 0x03, 0x04, 0x02, 0x26, 0x00, 0x01, 0x00,
+	0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x28, 0x01, 0xA0, 0xE9, 0x04, 0x12, 0x01, 0x05, 0x0C,
+	0x01, 0x0D, 0x10, 0x02, 0x52, 0x1D, 0x02, 0x74, 0x00, 0x03,
+	0x14, 0x1C, 0x02, 0x43, 0xB4, 0x01, 0x05, 0x86, 0x01, 0xB9,
+	0x01, 0x03, 0x3E, 0x0D, 0x05, 0xC3, 0x01, 0xC8, 0x01, 0x03,
+	0x25, 0x28, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x03, 0x01, 0x03,
+	0x0F, 0x01, 0xCE, 0x09, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+	0x61, 0x6C, 0x6C, 0xDA, 0x10, 0xDA, 0x89, 0x01, 0xDA, 0xEB,
+	0x02, 0xDA, 0x5D, 0x25, 0x01, 0x01, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x27,
+	0x02, 0x00, 0x01, 0x2C, 0x02, 0x01, 0x00, 0x26, 0x02, 0x01,
+	0x00, 0x2F, 0x02, 0x02, 0x00, 0x17, 0x01, 0x02, 0x00, 0x25,
+	0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x02, 0x2B, 0x02, 0x00,
+	0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x02, 0x02, 0x00, 0x30,
+	0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x11, 0x04,
+	0xEC, 0xEC, 0x04, 0x20, 0x04, 0x17, 0x1A, 0x01, 0x13, 0x16,
+	0x02, 0x6A, 0x3F, 0x04, 0x0D, 0x1C, 0xCD, 0x80, 0x80, 0xE0,
+	0x0D, 0x05, 0x01, 0x06, 0x26, 0x01, 0xCE, 0x08, 0x65, 0x78,
+	0x70, 0x61, 0x6E, 0x64, 0x66, 0x6E, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0x1F, 0xDA, 0x89, 0x01, 0xDA, 0xEB, 0x02, 0xDA, 0x99,
+	0x01, 0xDA, 0x5D, 0x25, 0x01, 0x01, 0x00, 0x33, 0x01, 0x00,
+	0x01, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F,
+	0x02, 0x02, 0x00, 0x26, 0x03, 0x01, 0x00, 0x48, 0x02, 0x02,
+	0x03, 0x1A, 0x02, 0x11, 0x00, 0x25, 0x02, 0x03, 0x00, 0x2C,
+	0x00, 0x02, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x02, 0x03,
+	0x00, 0x27, 0x03, 0x00, 0x01, 0x2C, 0x03, 0x02, 0x00, 0x26,
+	0x04, 0x03, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x02, 0x03,
+	0x00, 0x25, 0x04, 0x02, 0x00, 0x33, 0x03, 0x00, 0x04, 0x26,
+	0x04, 0x04, 0x00, 0x2D, 0x04, 0x01, 0x03, 0x2E, 0x02, 0x00,
+	0x00, 0x26, 0x04, 0x05, 0x00, 0x30, 0x04, 0x00, 0x00, 0x25,
+	0x02, 0x02, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x03, 0x02,
+	0x00, 0x2F, 0x02, 0x03, 0x00, 0x27, 0x03, 0x00, 0x01, 0x2C,
+	0x03, 0x02, 0x00, 0x26, 0x04, 0x03, 0x00, 0x2F, 0x03, 0x04,
+	0x00, 0x17, 0x02, 0x03, 0x00, 0x26, 0x03, 0x04, 0x00, 0x2C,
+	0x03, 0x01, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x26, 0x03, 0x05,
+	0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x2A, 0x02, 0x92, 0xEE, 0x04, 0x10, 0x05, 0x26, 0x06, 0x01,
+	0x07, 0x86, 0x03, 0x04, 0x72, 0xFB, 0x02, 0x04, 0x17, 0x1A,
+	0x01, 0x13, 0x16, 0x02, 0x80, 0x01, 0x3F, 0x05, 0x1B, 0x2A,
+	0x04, 0x90, 0x01, 0x19, 0x04, 0x17, 0x1A, 0x01, 0x13, 0x16,
+	0x05, 0x64, 0x29, 0xCD, 0x80, 0x80, 0xE0, 0x0F, 0x04, 0x01,
+	0x01, 0x0A, 0x01, 0x01, 0xCE, 0x08, 0x65, 0x78, 0x70, 0x61,
+	0x6E, 0x64, 0x71, 0x71, 0xDA, 0x10, 0xDA, 0x5D, 0x2A, 0x01,
+	0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x33, 0x02, 0x00, 0x03,
+	0x25, 0x03, 0x01, 0x00, 0x33, 0x03, 0x00, 0x03, 0x2B, 0x03,
+	0x00, 0x00, 0x2F, 0x03, 0x01, 0x00, 0x2C, 0x02, 0x03, 0x00,
+	0x26, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x05, 0x01,
+	0x0D, 0x42, 0x01, 0xCE, 0x02, 0x71, 0x71, 0xDA, 0x10, 0xDA,
+	0x1D, 0xDA, 0x58, 0xCF, 0x07, 0x75, 0x6E, 0x71, 0x75, 0x6F,
+	0x74, 0x65, 0xCF, 0x10, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74,
+	0x65, 0x2D, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x6E, 0x67,
+	0xDA, 0x5D, 0xDA, 0xEB, 0x02, 0xDA, 0x89, 0x01, 0xDA, 0x55,
+	0xDA, 0x57, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06, 0x01,
+	0x03, 0x1C, 0xCE, 0x03, 0x6B, 0x76, 0x73, 0xDA, 0x10, 0xDA,
+	0xFD, 0x01, 0xDA, 0xF9, 0x01, 0xDA, 0xFE, 0x01, 0x37, 0x01,
+	0x00, 0x00, 0x08, 0x01, 0x01, 0x02, 0x2B, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x17, 0x02,
+	0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x2C, 0x02, 0x03, 0x00,
+	0x26, 0x04, 0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04,
+	0x03, 0x00, 0x22, 0x03, 0x00, 0x00, 0x1F, 0x03, 0x03, 0x04,
+	0x19, 0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x0A, 0x00,
+	0x17, 0x03, 0x04, 0x00, 0x33, 0x05, 0x00, 0x03, 0x2D, 0x01,
+	0x03, 0x05, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x03, 0x03, 0x00,
+	0x2C, 0x02, 0x04, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2F, 0x04,
+	0x05, 0x00, 0x18, 0xF1, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00,
+	0x1C, 0x01, 0xC8, 0x98, 0x04, 0x18, 0x01, 0x09, 0x0C, 0x03,
+	0x15, 0x18, 0x0E, 0x46, 0x2C, 0x01, 0x4E, 0x51, 0x03, 0x23,
+	0x26, 0x04, 0x29, 0x2C, 0x01, 0xE3, 0x02, 0xF2, 0x02, 0xD8,
+	0x05, 0x74, 0x61, 0x62, 0x6C, 0x65, 0xDA, 0x56, 0xD8, 0x06,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x28, 0x01, 0x00, 0x00,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02,
+	0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00,
+	0x48, 0x02, 0x03, 0x02, 0x1A, 0x02, 0x1C, 0x00, 0x25, 0x04,
+	0x00, 0x00, 0x33, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00,
+	0x26, 0x02, 0x02, 0x00, 0x48, 0x02, 0x02, 0x04, 0x1A, 0x02,
+	0x02, 0x00, 0x18, 0x06, 0x00, 0x00, 0x26, 0x02, 0x03, 0x00,
+	0x48, 0x02, 0x02, 0x04, 0x1A, 0x02, 0x02, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x09, 0x00,
+	0x25, 0x02, 0x01, 0x00, 0x33, 0x02, 0x00, 0x02, 0x2B, 0x02,
+	0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x2F, 0x02, 0x02, 0x00,
+	0x2C, 0x04, 0x02, 0x00, 0x26, 0x02, 0x04, 0x00, 0x30, 0x02,
+	0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00,
+	0x2F, 0x02, 0x02, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x02,
+	0x06, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x04, 0x07, 0x00,
+	0x48, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x04, 0x00, 0x2C, 0x01,
+	0x00, 0x00, 0x26, 0x04, 0x05, 0x00, 0x30, 0x04, 0x00, 0x00,
+	0x26, 0x02, 0x08, 0x00, 0x48, 0x04, 0x03, 0x02, 0x1A, 0x04,
+	0x0A, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x09, 0x00,
+	0x2F, 0x02, 0x02, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x02,
+	0x05, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x2B, 0x02, 0x00, 0x00,
+	0x26, 0x02, 0x0A, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x02,
+	0x0B, 0x00, 0x48, 0x02, 0x03, 0x02, 0x1A, 0x02, 0x0A, 0x00,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x09, 0x00, 0x2F, 0x02,
+	0x02, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x00, 0x05, 0x00,
+	0x2F, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x02,
+	0x0C, 0x00, 0x30, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x65, 0x01, 0x86, 0xF2, 0x04, 0xE2, 0x05, 0x03, 0x32,
+	0xD3, 0x05, 0x04, 0x0B, 0xAC, 0x05, 0x02, 0x76, 0xA9, 0x05,
+	0x01, 0x0F, 0x12, 0x02, 0x58, 0x05, 0x02, 0x07, 0x3C, 0x02,
+	0x28, 0x29, 0x03, 0x27, 0x2A, 0x01, 0x07, 0xC4, 0x01, 0x02,
+	0xAE, 0x01, 0x8B, 0x02, 0x03, 0x0F, 0x12, 0x03, 0x13, 0x16,
+	0x03, 0x7C, 0x25, 0x03, 0x19, 0x1C, 0x03, 0x99, 0x03, 0x8C,
+	0x05, 0x03, 0xEE, 0x03, 0xA7, 0x05, 0x03, 0xED, 0x03, 0xA8,
+	0x05, 0x03, 0xC0, 0x04, 0xAD, 0x05, 0x03, 0x0F, 0x12, 0x03,
+	0x0D, 0x10, 0x03, 0xA1, 0x04, 0x8C, 0x05, 0x03, 0x94, 0x05,
+	0xAD, 0x05, 0x03, 0x0F, 0x12, 0x03, 0x0F, 0x12, 0x01, 0xF3,
+	0x04, 0x8A, 0x05, 0x14, 0x01, 0x86, 0xF2, 0x04, 0xE2, 0x05,
+	0x02, 0xFC, 0x05, 0xD1, 0x05, 0x02, 0x1C, 0x00, 0x02, 0x07,
+	0x0A, 0x03, 0x21, 0x24, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x05,
+	0x01, 0x06, 0x24, 0x01, 0xCE, 0x05, 0x64, 0x6F, 0x74, 0x75,
+	0x70, 0xDA, 0x10, 0xDA, 0x13, 0xD5, 0x00, 0xDA, 0x03, 0xDA,
+	0x27, 0xDA, 0x89, 0x01, 0xDA, 0xEB, 0x02, 0x25, 0x01, 0x00,
+	0x00, 0x33, 0x01, 0x00, 0x01, 0x27, 0x02, 0x00, 0x0F, 0x33,
+	0x02, 0x02, 0x01, 0x26, 0x03, 0x00, 0x00, 0x35, 0x03, 0x03,
+	0x00, 0x33, 0x01, 0x03, 0x01, 0x17, 0x03, 0x01, 0x00, 0x1A,
+	0x03, 0x03, 0x00, 0x17, 0x01, 0x03, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x26, 0x01, 0x01, 0x00, 0x17, 0x03, 0x01, 0x00, 0x26,
+	0x01, 0x02, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2F, 0x01, 0x03,
+	0x00, 0x26, 0x04, 0x03, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2F,
+	0x04, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x2B, 0x00, 0x00,
+	0x00, 0x30, 0x02, 0x00, 0x00, 0x1A, 0x04, 0x07, 0x00, 0x25,
+	0x02, 0x01, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x00, 0x04,
+	0x00, 0x2F, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x30,
+	0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x2C, 0x02, 0x00,
+	0x00, 0x26, 0x00, 0x05, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x2B,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0x02, 0x86, 0xFC,
+	0x04, 0x10, 0x02, 0x2C, 0x08, 0x03, 0x44, 0x00, 0x05, 0x07,
+	0x10, 0x01, 0x15, 0x18, 0x03, 0x5A, 0x25, 0x03, 0x38, 0x00,
+	0x01, 0x28, 0x92, 0x01, 0x02, 0x1C, 0xA3, 0x01, 0x01, 0x1B,
+	0xA4, 0x01, 0x04, 0x40, 0x89, 0x01, 0x02, 0x05, 0x08, 0x04,
+	0x54, 0x0F, 0x03, 0x19, 0x1C, 0x63, 0x01, 0x90, 0xE0, 0x04,
+	0x9C, 0x22, 0x02, 0xB2, 0x01, 0x9F, 0x1F, 0x02, 0x86, 0x03,
+	0x7A, 0x02, 0x80, 0x04, 0x37, 0x02, 0xC8, 0x03, 0x83, 0x02,
+	0x02, 0xC4, 0x01, 0xC0, 0x02, 0x02, 0x84, 0x04, 0xE2, 0x02,
+	0x12, 0xE6, 0x06, 0xD3, 0x03, 0x02, 0x92, 0x03, 0x68, 0x03,
+	0xA0, 0x04, 0xE1, 0x03, 0x04, 0x0B, 0xAA, 0x02, 0x02, 0x38,
+	0xA7, 0x02, 0x05, 0x37, 0xA8, 0x02, 0x03, 0x66, 0x9D, 0x02,
+	0x05, 0x65, 0x9E, 0x02, 0x02, 0xC2, 0x01, 0x95, 0x02, 0x03,
+	0x21, 0x24, 0x05, 0x9F, 0x01, 0xF2, 0x01, 0x02, 0x84, 0x02,
+	0x95, 0x02, 0x06, 0x83, 0x02, 0x96, 0x02, 0x01, 0x19, 0x1C,
+	0x01, 0xB9, 0x1F, 0xC8, 0x1F, 0xCF, 0x02, 0x6F, 0x72, 0xD4,
+	0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x6F, 0x28, 0x6F, 0x72,
+	0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A,
+	0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+	0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70,
+	0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x20, 0x6F,
+	0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0xDA, 0x27,
+	0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFE, 0x87,
+	0x01, 0xCD, 0xD4, 0x8E, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xC8, 0x29, 0x06, 0x00, 0x08, 0x29, 0xCE, 0x02, 0x6F,
+	0x72, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x59, 0xDA, 0x5A, 0xDA,
+	0x5E, 0xDA, 0x5D, 0xDA, 0x5B, 0xDA, 0x5C, 0xDA, 0x5F, 0x22,
+	0x01, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00,
+	0x00, 0x45, 0x03, 0x02, 0x03, 0x1A, 0x03, 0x24, 0x00, 0x05,
+	0x02, 0x02, 0xFF, 0x4A, 0x03, 0x00, 0x02, 0x17, 0x04, 0x03,
+	0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+	0x03, 0x03, 0x00, 0x26, 0x05, 0x01, 0x00, 0x33, 0x03, 0x05,
+	0x03, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F,
+	0x03, 0x03, 0x00, 0x1A, 0x03, 0x07, 0x00, 0x26, 0x03, 0x03,
+	0x00, 0x2D, 0x03, 0x04, 0x04, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x03, 0x04, 0x00, 0x2F, 0x01, 0x03, 0x00, 0x18, 0xEC, 0xFF,
+	0xFF, 0x26, 0x05, 0x05, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x17,
+	0x05, 0x03, 0x00, 0x26, 0x03, 0x06, 0x00, 0x2D, 0x03, 0x05,
+	0x04, 0x26, 0x04, 0x04, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x26,
+	0x04, 0x03, 0x00, 0x2D, 0x04, 0x05, 0x05, 0x2B, 0x01, 0x00,
+	0x00, 0x26, 0x01, 0x04, 0x00, 0x2F, 0x04, 0x01, 0x00, 0x26,
+	0x01, 0x07, 0x00, 0x2D, 0x01, 0x03, 0x04, 0x26, 0x01, 0x04,
+	0x00, 0x2F, 0x01, 0x01, 0x00, 0x18, 0xDB, 0xFF, 0xFF, 0x03,
+	0x01, 0x00, 0x00, 0x43, 0x01, 0x82, 0x8A, 0x01, 0x18, 0x01,
+	0x32, 0x02, 0x02, 0x4E, 0x0D, 0x01, 0x0D, 0xC6, 0x03, 0x01,
+	0x26, 0xC7, 0x03, 0x01, 0x26, 0x0E, 0x01, 0x0F, 0x12, 0x08,
+	0x50, 0x0B, 0x01, 0x07, 0xAC, 0x02, 0x05, 0x36, 0xA1, 0x02,
+	0x01, 0x35, 0xA2, 0x02, 0x02, 0x98, 0x01, 0xBB, 0x02, 0x01,
+	0x11, 0x14, 0x04, 0x4C, 0x02, 0x05, 0x46, 0x08, 0x04, 0x5B,
+	0x5E, 0x01, 0xBF, 0x02, 0xC8, 0x02, 0x01, 0xF5, 0x02, 0x84,
+	0x03, 0xCF, 0x04, 0x74, 0x79, 0x70, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0x1D, 0xDA, 0x05, 0xCE, 0xE7, 0x01, 0x28, 0x74,
+	0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20,
+	0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+	0x72, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20,
+	0x6F, 0x66, 0x0A, 0x09, 0x3A, 0x6E, 0x69, 0x6C, 0x0A, 0x09,
+	0x3A, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x0A, 0x09,
+	0x3A, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x0A, 0x09,
+	0x3A, 0x72, 0x65, 0x61, 0x6C, 0x0A, 0x09, 0x3A, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x0A, 0x09, 0x3A, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x0A, 0x09, 0x3A, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A,
+	0x09, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x0A, 0x09,
+	0x3A, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x0A, 0x09, 0x3A,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0A, 0x09, 0x3A, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x09, 0x3A, 0x6B, 0x65,
+	0x79, 0x77, 0x6F, 0x72, 0x64, 0x0A, 0x09, 0x3A, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x63,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x0A,
+	0x6F, 0x72, 0x20, 0x61, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72,
+	0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72,
+	0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF,
+	0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xDA,
+	0x05, 0xCE, 0xA6, 0x02, 0x28, 0x6E, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x5B, 0x2C, 0x65,
+	0x6E, 0x76, 0x5D, 0x29, 0x0A, 0x0A, 0x4C, 0x6F, 0x61, 0x64,
+	0x20, 0x61, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6D, 0x75, 0x73,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62,
+	0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74,
+	0x65, 0x6D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73,
+	0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61,
+	0x20, 0x2E, 0x73, 0x6F, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+	0x6F, 0x6E, 0x20, 0x55, 0x6E, 0x69, 0x78, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x61, 0x20, 0x2E, 0x64, 0x6C, 0x6C, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x69, 0x6E, 0x64,
+	0x6F, 0x77, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69,
+	0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+	0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0xCF, 0x0B,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E,
+	0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0xDA, 0x05,
+	0xCE, 0xA8, 0x01, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x74, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x61,
+	0x72, 0x63, 0x68, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+	0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72,
+	0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69,
+	0x66, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F,
+	0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+	0x2E, 0xCF, 0x05, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x49, 0x28, 0x64, 0x65, 0x66,
+	0x6E, 0x2D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20,
+	0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66,
+	0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76,
+	0x61, 0x74, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0xDA,
+	0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x82,
+	0x15, 0xCD, 0xF6, 0x16, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xC8, 0x29, 0x03, 0x01, 0x02, 0x05, 0xCE, 0x05, 0x64, 0x65,
+	0x66, 0x6E, 0x2D, 0xDA, 0x10, 0xDA, 0xB6, 0x01, 0xDA, 0xBE,
+	0x02, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x4C,
+	0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00,
+	0x00, 0x04, 0x05, 0xB8, 0x16, 0x3C, 0xCF, 0x05, 0x70, 0x72,
+	0x69, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05, 0x70,
+	0x72, 0x69, 0x6E, 0x74, 0xDA, 0x05, 0xCE, 0xB9, 0x01, 0x28,
+	0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65,
+	0x20, 0x28, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64,
+	0x20, 0x6F, 0x75, 0x74, 0x29, 0x2E, 0x20, 0x56, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+	0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64,
+	0x79, 0x2E, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x70,
+	0x72, 0x69, 0x6E, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20,
+	0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x64,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x6E, 0x69, 0x6C, 0x2E, 0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x77, 0x68, 0x65, 0x72, 0x65, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0x9B, 0x03, 0xDA, 0x05, 0xCE, 0x82, 0x02,
+	0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68,
+	0x65, 0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63,
+	0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x27, 0x73, 0x20, 0x6C,
+	0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x20, 0x61, 0x73, 0x20,
+	0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x6C,
+	0x69, 0x6E, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D,
+	0x6E, 0x29, 0x2E, 0x20, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x75, 0x6E,
+	0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x31,
+	0x2C, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+	0x73, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x73,
+	0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x31, 0x2C, 0x20, 0x63,
+	0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x31, 0x29, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69,
+	0x6E, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+	0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x41, 0x53, 0x43,
+	0x49, 0x49, 0x20, 0x30, 0x78, 0x30, 0x41, 0x2E, 0xCF, 0x0D,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0xDA, 0x05, 0xCE, 0x35, 0x28, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+	0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF,
+	0x05, 0x64, 0x65, 0x65, 0x70, 0x3D, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x8C, 0x01, 0x28, 0x64, 0x65, 0x65, 0x70,
+	0x3D, 0x20, 0x78, 0x20, 0x79, 0x29, 0x0A, 0x0A, 0x4C, 0x69,
+	0x6B, 0x65, 0x20, 0x3D, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+	0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x73, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x29, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64,
+	0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x65, 0x71, 0x75, 0x61,
+	0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+	0x68, 0x61, 0x76, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74,
+	0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x4D, 0x75, 0x63, 0x68,
+	0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x61, 0x6E, 0x20, 0x3D, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0x96, 0x91, 0x05, 0xCD, 0xF6, 0x93, 0x05, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x02, 0x02,
+	0x06, 0xCE, 0x05, 0x64, 0x65, 0x65, 0x70, 0x3D, 0xDA, 0x10,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06, 0x02, 0x0C, 0x76,
+	0xCE, 0x09, 0x64, 0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74,
+	0x3D, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x58, 0xDA, 0xEB, 0x02,
+	0xDA, 0xA4, 0x04, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06,
+	0x02, 0x01, 0x14, 0xCE, 0x04, 0x73, 0x6F, 0x6D, 0x65, 0xDA,
+	0x10, 0xDA, 0x5A, 0x22, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01,
+	0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43,
+	0x05, 0x03, 0x04, 0x1A, 0x05, 0x05, 0x00, 0x2B, 0x02, 0x00,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x08,
+	0x00, 0x33, 0x05, 0x01, 0x03, 0x2B, 0x05, 0x00, 0x00, 0x2F,
+	0x05, 0x00, 0x00, 0x1A, 0x05, 0x02, 0x00, 0x17, 0x02, 0x05,
+	0x00, 0x05, 0x03, 0x03, 0x01, 0x18, 0xF2, 0xFF, 0xFF, 0x03,
+	0x02, 0x00, 0x00, 0x1F, 0x01, 0xF0, 0x86, 0x05, 0x18, 0x05,
+	0x20, 0x6E, 0x03, 0x2E, 0x75, 0x04, 0x2D, 0x76, 0x02, 0x5A,
+	0x77, 0x01, 0x15, 0x32, 0x01, 0x2A, 0x2B, 0x02, 0x6D, 0x72,
+	0x01, 0xFD, 0x01, 0x8C, 0x02, 0xDA, 0x55, 0xDA, 0x56, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x04, 0x01, 0x04, 0x1B, 0xCE,
+	0x05, 0x70, 0x61, 0x69, 0x72, 0x73, 0xDA, 0x10, 0xDA, 0xFD,
+	0x01, 0xDA, 0xF9, 0x01, 0xDA, 0x5D, 0xDA, 0xFE, 0x01, 0x37,
+	0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00,
+	0x00, 0x2F, 0x01, 0x02, 0x00, 0x22, 0x02, 0x00, 0x00, 0x2C,
+	0x00, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2F, 0x02, 0x02,
+	0x00, 0x22, 0x03, 0x00, 0x00, 0x1F, 0x03, 0x03, 0x02, 0x19,
+	0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x24, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x0C, 0x00, 0x33,
+	0x03, 0x00, 0x02, 0x2C, 0x02, 0x03, 0x00, 0x26, 0x03, 0x02,
+	0x00, 0x2F, 0x03, 0x03, 0x00, 0x2C, 0x01, 0x03, 0x00, 0x26,
+	0x03, 0x03, 0x00, 0x2F, 0x03, 0x03, 0x00, 0x2C, 0x00, 0x02,
+	0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x18,
+	0xEF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x29, 0x01, 0xF4,
+	0x81, 0x04, 0x12, 0x03, 0x15, 0x18, 0x04, 0x42, 0x13, 0x06,
+	0x2E, 0x00, 0x01, 0x0D, 0x90, 0x01, 0x01, 0x62, 0x95, 0x01,
+	0x03, 0x11, 0x14, 0x03, 0x1F, 0x22, 0x03, 0x60, 0x33, 0x01,
+	0x8F, 0x01, 0x94, 0x01, 0x01, 0x85, 0x02, 0x94, 0x02, 0xDA,
+	0x57, 0xDA, 0xFB, 0x01, 0xDA, 0x21, 0xDA, 0xBC, 0x02, 0x28,
+	0x02, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00,
+	0x00, 0x2F, 0x03, 0x03, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x04, 0x00, 0x00, 0x2F, 0x04, 0x04, 0x00, 0x1F, 0x04, 0x03,
+	0x04, 0x19, 0x04, 0x03, 0x00, 0x23, 0x04, 0x00, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x1A, 0x04, 0x02,
+	0x00, 0x03, 0x04, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x48,
+	0x04, 0x03, 0x04, 0x1A, 0x04, 0x19, 0x00, 0x37, 0x04, 0x00,
+	0x00, 0x37, 0x05, 0x01, 0x00, 0x42, 0x04, 0x04, 0x05, 0x19,
+	0x04, 0x03, 0x00, 0x23, 0x04, 0x00, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x24, 0x04, 0x00, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17,
+	0x05, 0x04, 0x00, 0x18, 0x0D, 0x00, 0x00, 0x2D, 0x02, 0x00,
+	0x01, 0x26, 0x05, 0x02, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x26,
+	0x05, 0x03, 0x00, 0x2C, 0x05, 0x04, 0x00, 0x26, 0x04, 0x04,
+	0x00, 0x2F, 0x05, 0x04, 0x00, 0x17, 0x04, 0x05, 0x00, 0x1A,
+	0x04, 0x03, 0x00, 0x17, 0x05, 0x04, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x22, 0x05, 0x00, 0x00, 0x17, 0x04, 0x05, 0x00, 0x18,
+	0x4B, 0x00, 0x00, 0x26, 0x04, 0x05, 0x00, 0x48, 0x05, 0x03,
+	0x04, 0x1A, 0x05, 0x19, 0x00, 0x37, 0x04, 0x00, 0x00, 0x37,
+	0x05, 0x01, 0x00, 0x42, 0x04, 0x04, 0x05, 0x19, 0x04, 0x03,
+	0x00, 0x23, 0x04, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+	0x04, 0x00, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17, 0x05, 0x04,
+	0x00, 0x18, 0x0D, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x26,
+	0x05, 0x02, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x26, 0x05, 0x03,
+	0x00, 0x2C, 0x05, 0x04, 0x00, 0x26, 0x05, 0x04, 0x00, 0x2F,
+	0x05, 0x05, 0x00, 0x17, 0x04, 0x05, 0x00, 0x1A, 0x04, 0x03,
+	0x00, 0x17, 0x05, 0x04, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+	0x05, 0x00, 0x00, 0x17, 0x04, 0x05, 0x00, 0x18, 0x30, 0x00,
+	0x00, 0x26, 0x04, 0x06, 0x00, 0x48, 0x05, 0x03, 0x04, 0x1A,
+	0x05, 0x0B, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x05, 0x07,
+	0x00, 0x2F, 0x04, 0x05, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x05, 0x07, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x2C, 0x04, 0x05,
+	0x00, 0x2F, 0x05, 0x02, 0x00, 0x17, 0x04, 0x05, 0x00, 0x18,
+	0x23, 0x00, 0x00, 0x26, 0x05, 0x08, 0x00, 0x48, 0x05, 0x03,
+	0x05, 0x1A, 0x05, 0x0A, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+	0x03, 0x09, 0x00, 0x2F, 0x05, 0x03, 0x00, 0x2B, 0x01, 0x00,
+	0x00, 0x26, 0x04, 0x09, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x2C,
+	0x05, 0x03, 0x00, 0x2F, 0x04, 0x02, 0x00, 0x18, 0x17, 0x00,
+	0x00, 0x26, 0x04, 0x0A, 0x00, 0x48, 0x03, 0x03, 0x04, 0x1A,
+	0x03, 0x0D, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x0B,
+	0x00, 0x2F, 0x04, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x05, 0x0B, 0x00, 0x2F, 0x00, 0x05, 0x00, 0x1F, 0x05, 0x04,
+	0x00, 0x19, 0x05, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x18,
+	0x09, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x18, 0x07, 0x00,
+	0x00, 0x1F, 0x04, 0x00, 0x01, 0x19, 0x04, 0x03, 0x00, 0x23,
+	0x04, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x04, 0x00,
+	0x00, 0x17, 0x05, 0x04, 0x00, 0x17, 0x04, 0x05, 0x00, 0x1A,
+	0x04, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x8B, 0x01, 0x01, 0xAA, 0x88, 0x05, 0xE6, 0x08, 0x03,
+	0xDA, 0x02, 0xD7, 0x08, 0x03, 0x3A, 0x00, 0x05, 0x11, 0x14,
+	0x02, 0x0F, 0xD0, 0x05, 0x03, 0x3E, 0x3F, 0x01, 0x40, 0x9F,
+	0x05, 0x01, 0x16, 0x00, 0x05, 0x21, 0x24, 0x03, 0x07, 0x52,
+	0x03, 0x60, 0x63, 0x04, 0x1D, 0x20, 0x05, 0x41, 0x44, 0x05,
+	0x2B, 0xAA, 0x04, 0x01, 0xE6, 0x01, 0x9F, 0x05, 0x01, 0x16,
+	0x00, 0x05, 0x21, 0x24, 0x03, 0x07, 0x52, 0x03, 0x60, 0x63,
+	0x04, 0x1D, 0x20, 0x05, 0x41, 0x44, 0x05, 0xD1, 0x01, 0xAA,
+	0x04, 0x03, 0x90, 0x03, 0xA1, 0x05, 0x03, 0x14, 0x00, 0x02,
+	0x29, 0x2C, 0x05, 0xF9, 0x02, 0xF6, 0x04, 0x03, 0xEA, 0x03,
+	0x8D, 0x05, 0x03, 0x28, 0x00, 0x02, 0x3D, 0x40, 0x04, 0xD3,
+	0x03, 0xCE, 0x04, 0x03, 0xE4, 0x04, 0x9F, 0x05, 0x03, 0x16,
+	0x00, 0x05, 0x21, 0x24, 0x01, 0xD7, 0x04, 0xFC, 0x04, 0x05,
+	0x9E, 0x05, 0x9F, 0x05, 0x02, 0x9D, 0x05, 0xA0, 0x05, 0x03,
+	0x3D, 0x40, 0xDA, 0x5A, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x03,
+	0xD6, 0x93, 0x05, 0x1C, 0x03, 0x09, 0x0C, 0xCF, 0x09, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0xD3, 0x02,
+	0xDA, 0x03, 0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+	0x70, 0x6F, 0x70, 0xDA, 0x05, 0xCE, 0x86, 0x01, 0x28, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0x20, 0x61,
+	0x72, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x49, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x4D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2E, 0xCF, 0x02, 0x70, 0x70, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x1F, 0x28, 0x70, 0x70, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x50, 0x72, 0x65, 0x74, 0x74, 0x79, 0x20, 0x70,
+	0x72, 0x69, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74,
+	0x64, 0x6F, 0x75, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xD0, 0x98, 0x05, 0xCD, 0xDC, 0x99, 0x05, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x01, 0x01, 0x02,
+	0x06, 0xCE, 0x02, 0x70, 0x70, 0xDA, 0x10, 0xDA, 0xBA, 0x02,
+	0xDA, 0xD2, 0x04, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x03, 0xB8,
+	0x99, 0x05, 0x20, 0x03, 0x0D, 0x10, 0xCF, 0x06, 0x73, 0x74,
+	0x64, 0x6F, 0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x8D,
+	0x03, 0xDA, 0x05, 0xCE, 0x19, 0x54, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x6F, 0x75,
+	0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+	0xCF, 0x0B, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x74, 0x79,
+	0x70, 0x65, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0xB6, 0x01,
+	0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF6, 0x93,
+	0x06, 0xCD, 0xE4, 0x95, 0x06, 0xDA, 0x03, 0xD5, 0x07, 0xDA,
+	0x21, 0xCB, 0xDA, 0x55, 0xCB, 0xD0, 0x08, 0x61, 0x62, 0x73,
+	0x74, 0x72, 0x61, 0x63, 0x74, 0xCB, 0xDA, 0xD5, 0x02, 0xCB,
+	0xDA, 0x57, 0xCB, 0xDA, 0xB2, 0x03, 0xCB, 0xD0, 0x09, 0x63,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0xCB, 0xCF,
+	0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0xD3, 0x02, 0xDA, 0x03,
+	0xD7, 0xCD, 0x88, 0x80, 0x40, 0x01, 0x00, 0x00, 0x02, 0xCE,
+	0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x32, 0x00, 0x00, 0x02,
+	0x04, 0x00, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x8C, 0x01, 0x28,
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+	0x72, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x63, 0x61, 0x75, 0x67, 0x68, 0x74, 0x20, 0x62,
+	0x79, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69,
+	0x6E, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73,
+	0x74, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xCF,
+	0x0B, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69,
+	0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x89, 0x01, 0xDA,
+	0x05, 0xCE, 0x84, 0x02, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x72,
+	0x74, 0x75, 0x70, 0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x65, 0x6E, 0x64, 0x3D,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72,
+	0x72, 0x74, 0x75, 0x70, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A,
+	0x54, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62,
+	0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20,
+	0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65,
+	0x78, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E,
+	0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x65, 0x6E, 0x64,
+	0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65,
+	0x2E, 0x20, 0x49, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+	0x20, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x76,
+	0x69, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x79,
+	0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74,
+	0x6F, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70, 0x20, 0x72,
+	0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C,
+	0x79, 0x2E, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x08, 0x6F, 0x73, 0x2F, 0x73,
+	0x68, 0x65, 0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08,
+	0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0xDA, 0x05,
+	0xCE, 0x47, 0x28, 0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65, 0x6C,
+	0x6C, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x61,
+	0x73, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
+	0x6E, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x73, 0x74, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+	0x6C, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x68, 0x65,
+	0x6C, 0x6C, 0x2E, 0xCF, 0x06, 0x66, 0x61, 0x6C, 0x73, 0x65,
+	0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x20, 0x28,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x69, 0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8E, 0x39,
+	0xCD, 0xF4, 0x39, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x02, 0x01, 0x00, 0x03, 0xCE, 0x06, 0x66, 0x61, 0x6C,
+	0x73, 0x65, 0x3F, 0xDA, 0x10, 0x24, 0x01, 0x00, 0x00, 0x1F,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x03, 0xDE,
+	0x39, 0x14, 0xCF, 0x0B, 0x65, 0x76, 0x61, 0x6C, 0x2D, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x89, 0x01, 0x28, 0x65, 0x76, 0x61, 0x6C, 0x2D,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72,
+	0x20, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x45,
+	0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+	0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6D,
+	0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
+	0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65,
+	0x64, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x72,
+	0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8A, 0xD9,
+	0x05, 0xCD, 0xCC, 0xE4, 0x05, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xD0, 0x0B, 0x0C, 0x02, 0x0A, 0x1B, 0x02, 0xCE, 0x0B,
+	0x65, 0x76, 0x61, 0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0xDA, 0x10, 0xDA, 0xBC, 0x02, 0xDA, 0x83, 0x03, 0xD7,
+	0xCD, 0x84, 0x80, 0x40, 0x01, 0x01, 0x00, 0x01, 0xCE, 0x05,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x01, 0x00, 0x00, 0x00, 0xDA,
+	0x84, 0x03, 0xDA, 0x85, 0x03, 0xDA, 0x86, 0x03, 0xCE, 0x04,
+	0x65, 0x76, 0x61, 0x6C, 0xDA, 0x88, 0x03, 0xDA, 0x89, 0x03,
+	0xDA, 0xB7, 0x03, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17,
+	0x04, 0x03, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05,
+	0x00, 0x22, 0x07, 0x00, 0x00, 0x2A, 0x08, 0x01, 0x00, 0x26,
+	0x09, 0x01, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x26, 0x0B, 0x03,
+	0x00, 0x2D, 0x09, 0x0A, 0x0B, 0x26, 0x09, 0x04, 0x00, 0x2D,
+	0x06, 0x09, 0x08, 0x26, 0x09, 0x05, 0x00, 0x26, 0x0A, 0x06,
+	0x00, 0x26, 0x0B, 0x07, 0x00, 0x2D, 0x09, 0x0A, 0x0B, 0x26,
+	0x09, 0x08, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x2D, 0x01, 0x09,
+	0x0A, 0x3B, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26,
+	0x0A, 0x09, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x03, 0x07, 0x00,
+	0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x03, 0x02, 0x02, 0x0D,
+	0x01, 0xDA, 0xB8, 0x03, 0xDA, 0x10, 0xDA, 0xDF, 0x01, 0xCE,
+	0x01, 0x0A, 0x27, 0x01, 0x00, 0x04, 0x22, 0x02, 0x00, 0x00,
+	0x29, 0x02, 0x00, 0x04, 0x1A, 0x01, 0x09, 0x00, 0x27, 0x02,
+	0x00, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x01, 0x00, 0x00,
+	0x2F, 0x02, 0x01, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2C, 0x00,
+	0x02, 0x00, 0x26, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x15,
+	0x01, 0xA2, 0xDC, 0x05, 0x1C, 0x02, 0x28, 0x00, 0x01, 0x28,
+	0x84, 0x01, 0x04, 0x20, 0x69, 0x04, 0x46, 0x02, 0x01, 0x65,
+	0x68, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x04, 0x02, 0x03, 0x0B,
+	0x01, 0xDA, 0x10, 0xDA, 0xAD, 0x03, 0xDA, 0xAE, 0x03, 0xDA,
+	0x93, 0x03, 0x29, 0x01, 0x00, 0x07, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x26, 0x03,
+	0x01, 0x00, 0x48, 0x02, 0x02, 0x03, 0x1A, 0x02, 0x02, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x02,
+	0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x14, 0x01, 0xD8, 0xE1, 0x05, 0x24, 0x03, 0x78, 0x05,
+	0x02, 0x05, 0x14, 0x02, 0x0F, 0x82, 0x01, 0x03, 0x84, 0x01,
+	0x85, 0x01, 0x26, 0x01, 0x8A, 0xD9, 0x05, 0xC2, 0x0B, 0x03,
+	0xC6, 0x02, 0xAB, 0x0B, 0x01, 0x15, 0x18, 0x02, 0x36, 0xF6,
+	0x01, 0x01, 0xAC, 0x02, 0xFF, 0x01, 0x01, 0xEA, 0x02, 0xC6,
+	0x02, 0x11, 0xBD, 0x02, 0x80, 0x03, 0x01, 0xBD, 0x05, 0xD8,
+	0x05, 0xCF, 0x11, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+	0x66, 0x72, 0x6F, 0x6D, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2F, 0x66, 0x72, 0x6F, 0x6D, 0x2D, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0xDA, 0x05, 0xCE, 0x97, 0x01, 0x28, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x72, 0x6F, 0x6D,
+	0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x62, 0x79, 0x74,
+	0x65, 0x2D, 0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x0A, 0x0A,
+	0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E,
+	0x20, 0x41, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+	0x65, 0x20, 0x63, 0x6F, 0x65, 0x72, 0x63, 0x65, 0x64, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E,
+	0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x31, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x20, 0x30, 0x2D, 0x32, 0x35, 0x35, 0x2E, 0xCF,
+	0x0B, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x62, 0x75, 0x69,
+	0x6C, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xEE, 0x02, 0xDA,
+	0x05, 0xCE, 0x32, 0x54, 0x68, 0x65, 0x20, 0x62, 0x75, 0x69,
+	0x6C, 0x64, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66,
+	0x69, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+	0x61, 0x6D, 0x2E, 0xCF, 0x07, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+	0x70, 0x69, 0xD3, 0x02, 0xDA, 0x03, 0xC8, 0x18, 0x2D, 0x44,
+	0x54, 0xFB, 0x21, 0x09, 0x40, 0xDA, 0x05, 0xCE, 0x0D, 0x54,
+	0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70,
+	0x69, 0x2E, 0xCF, 0x04, 0x70, 0x6F, 0x73, 0x3F, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x27, 0x28, 0x70, 0x6F, 0x73,
+	0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x61, 0x6E, 0x20, 0x30, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xF4, 0x1F, 0xCD, 0xE0, 0x20, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00, 0x03, 0xCE,
+	0x04, 0x70, 0x6F, 0x73, 0x3F, 0xDA, 0x10, 0x25, 0x01, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04,
+	0x03, 0xD2, 0x20, 0x0C, 0xCF, 0x0F, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0xDA, 0x05, 0xCE, 0xB4, 0x01, 0x28, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x5B, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5D,
+	0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+	0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x61, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20,
+	0x4C, 0x5A, 0x37, 0x37, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x6F, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20,
+	0x74, 0x6F, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+	0x69, 0x66, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x20, 0x69, 0x73,
+	0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0C, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+	0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA,
+	0x05, 0xCE, 0x92, 0x02, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x65, 0x6E, 0x64, 0x3D,
+	0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x73, 0x74,
+	0x72, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+	0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x2E, 0x20, 0x54,
+	0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x73, 0x69,
+	0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x65,
+	0x78, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x63, 0x6C,
+	0x75, 0x73, 0x69, 0x76, 0x65, 0x2E, 0x20, 0x41, 0x6C, 0x6C,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20,
+	0x69, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x30, 0x2E,
+	0x20, 0x27, 0x73, 0x74, 0x61, 0x72, 0x74, 0x27, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x27, 0x65, 0x6E, 0x64, 0x27, 0x20, 0x63,
+	0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65,
+	0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+	0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xCF, 0x11,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+	0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+	0x62, 0x69, 0x74, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65,
+	0xDA, 0x05, 0xCE, 0x67, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x74, 0x6F, 0x67, 0x67,
+	0x6C, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x54, 0x6F,
+	0x67, 0x67, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69, 0x74,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6E, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0A, 0x64,
+	0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x42, 0x28, 0x64, 0x72,
+	0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70,
+	0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+	0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x64,
+	0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20,
+	0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29, 0x20, 0x69, 0x6E,
+	0x64, 0x29, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xF8, 0x94, 0x03, 0xCD, 0xDC, 0x96, 0x03, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x02, 0x03, 0x09, 0xCE,
+	0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0xDA, 0x10, 0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B, 0x03,
+	0x01, 0x00, 0x03, 0x01, 0xCE, 0x0A, 0x63, 0x6F, 0x6D, 0x70,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0xDA, 0x10, 0x28, 0x01,
+	0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,
+	0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x01, 0x01, 0x01, 0x06, 0x01,
+	0xDA, 0x10, 0xDA, 0x5A, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x08, 0x03, 0x84, 0xB6, 0x02, 0x08, 0x03,
+	0x09, 0x0C, 0x0B, 0x01, 0xBA, 0xB4, 0x02, 0xD8, 0x01, 0x02,
+	0xB0, 0x01, 0xB1, 0x01, 0xDA, 0x86, 0x04, 0xDA, 0x87, 0x01,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00,
+	0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x01, 0x00,
+	0x2F, 0x00, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x00,
+	0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x03, 0xB0, 0x96,
+	0x03, 0x20, 0x06, 0x17, 0x22, 0xCF, 0x08, 0x6D, 0x61, 0x74,
+	0x68, 0x2F, 0x73, 0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0xDA,
+	0x05, 0xCE, 0x24, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73,
+	0x69, 0x6E, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+	0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x71, 0x72, 0x74,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68,
+	0x2F, 0x73, 0x71, 0x72, 0x74, 0xDA, 0x05, 0xCE, 0x2C, 0x28,
+	0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x71, 0x72, 0x74, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x71, 0x75, 0x61,
+	0x72, 0x65, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x78, 0x2E, 0xCF, 0x08, 0x62, 0x72, 0x75, 0x73, 0x68,
+	0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0xA4,
+	0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x08, 0x62,
+	0x72, 0x75, 0x73, 0x68, 0x69, 0x66, 0x74, 0x17, 0x01, 0x00,
+	0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25,
+	0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01,
+	0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x4B,
+	0x04, 0x00, 0x00, 0x14, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00,
+	0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A,
+	0x04, 0x00, 0x05, 0x14, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05,
+	0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03,
+	0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0xF4, 0x01, 0x28, 0x62,
+	0x72, 0x75, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x78, 0x20,
+	0x26, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x68,
+	0x69, 0x66, 0x74, 0x65, 0x64, 0x20, 0x72, 0x69, 0x67, 0x68,
+	0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x73, 0x68, 0x69, 0x66, 0x74, 0x73, 0x2E, 0x20, 0x78, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20,
+	0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x6D, 0x75, 0x73, 0x74,
+	0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74,
+	0x65, 0x67, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+	0x73, 0x69, 0x67, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x65,
+	0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74,
+	0x69, 0x76, 0x65, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20,
+	0x62, 0x65, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76,
+	0x65, 0x2E, 0xCF, 0x04, 0x6A, 0x75, 0x78, 0x74, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x45, 0x28, 0x6A, 0x75, 0x78,
+	0x74, 0x20, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A,
+	0x0A, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x75, 0x78, 0x74, 0x2A,
+	0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x65, 0x68,
+	0x61, 0x76, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x74, 0x20,
+	0x6D, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x69, 0x63,
+	0x69, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xDE, 0x9A, 0x03, 0xCD, 0xD4,
+	0x9E, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29,
+	0x07, 0x00, 0x08, 0x21, 0xCE, 0x04, 0x6A, 0x75, 0x78, 0x74,
+	0xDA, 0x10, 0xCF, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xDA,
+	0x5B, 0xD7, 0xCD, 0x86, 0x80, 0xC8, 0x20, 0x06, 0x01, 0x00,
+	0x0C, 0xCE, 0x05, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x17, 0x02,
+	0x01, 0x00, 0x20, 0x03, 0x02, 0x00, 0x19, 0x03, 0x09, 0x00,
+	0x25, 0x04, 0x00, 0x00, 0x4A, 0x05, 0x01, 0x04, 0x05, 0x04,
+	0x04, 0x01, 0x1F, 0x03, 0x04, 0x02, 0x19, 0x03, 0x03, 0x00,
+	0x2B, 0x05, 0x00, 0x00, 0x18, 0xFB, 0xFF, 0xFF, 0x2E, 0x05,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xDA, 0x5D, 0xDA, 0xFE,
+	0x01, 0xDA, 0x9A, 0x01, 0xDA, 0x89, 0x01, 0xDA, 0x99, 0x01,
+	0x26, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x38, 0x01,
+	0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2F, 0x02, 0x02, 0x00,
+	0x17, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03,
+	0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x0C, 0x00,
+	0x4A, 0x05, 0x00, 0x03, 0x17, 0x06, 0x05, 0x00, 0x26, 0x05,
+	0x02, 0x00, 0x2D, 0x05, 0x06, 0x02, 0x26, 0x05, 0x03, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x2C, 0x01, 0x05, 0x00, 0x26, 0x05,
+	0x04, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x49, 0x03, 0x04, 0x01,
+	0x18, 0xF6, 0xFF, 0xFF, 0x26, 0x00, 0x05, 0x00, 0x2C, 0x00,
+	0x02, 0x00, 0x26, 0x03, 0x03, 0x00, 0x2F, 0x00, 0x03, 0x00,
+	0x25, 0x03, 0x00, 0x00, 0x2C, 0x01, 0x03, 0x00, 0x26, 0x04,
+	0x06, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x26, 0x04, 0x07, 0x00,
+	0x2D, 0x04, 0x00, 0x03, 0x26, 0x04, 0x03, 0x00, 0x30, 0x04,
+	0x00, 0x00, 0x1E, 0x03, 0x8C, 0x9C, 0x03, 0x28, 0x02, 0x46,
+	0x19, 0x07, 0x18, 0x70, 0x04, 0x52, 0x55, 0x03, 0x23, 0x26,
+	0x02, 0x2D, 0x30, 0x04, 0x9C, 0x01, 0x5F, 0x04, 0x22, 0x0A,
+	0x04, 0x37, 0x3A, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+	0x70, 0x6F, 0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x70, 0x6F, 0x77, 0xDA, 0x05, 0xCE,
+	0x2B, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70, 0x6F, 0x77,
+	0x20, 0x61, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x70, 0x65, 0x67, 0x2F,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x09, 0x70, 0x65, 0x67, 0x2F, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0xDA, 0x05, 0xCE, 0x99, 0x02, 0x28, 0x70, 0x65, 0x67, 0x2F,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x65, 0x67, 0x20,
+	0x74, 0x65, 0x78, 0x74, 0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x3D, 0x30, 0x5D, 0x29, 0x0A, 0x0A, 0x4D, 0x61,
+	0x74, 0x63, 0x68, 0x20, 0x61, 0x20, 0x50, 0x61, 0x72, 0x73,
+	0x69, 0x6E, 0x67, 0x20, 0x45, 0x78, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x69, 0x6F, 0x6E, 0x20, 0x47, 0x72, 0x61, 0x6D, 0x6D,
+	0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+	0x6F, 0x66, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
+	0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+	0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+	0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x64, 0x65,
+	0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70,
+	0x65, 0x67, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x79,
+	0x6E, 0x74, 0x61, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x45,
+	0x47, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72,
+	0x79, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x64,
+	0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+	0x4C, 0x50, 0x65, 0x67, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x68, 0x61, 0x76, 0x65, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C,
+	0x61, 0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6C,
+	0x69, 0x74, 0x69, 0x65, 0x73, 0x2E, 0xCF, 0x0B, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xD3,
+	0x02, 0xDA, 0x03, 0xDA, 0x87, 0x01, 0xDA, 0x05, 0xCE, 0xBA,
+	0x02, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C,
+	0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70,
+	0x20, 0x5B, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D,
+	0x30, 0x20, 0x5B, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x3D, 0x28,
+	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x72,
+	0x74, 0x75, 0x70, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54,
+	0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69,
+	0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20,
+	0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70,
+	0x65, 0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74,
+	0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E,
+	0x64, 0x65, 0x78, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65,
+	0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E,
+	0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+	0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64,
+	0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74,
+	0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x08, 0x62, 0x6F, 0x6F,
+	0x6C, 0x65, 0x61, 0x6E, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x26, 0x28, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+	0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8C, 0x2F,
+	0xCD, 0x92, 0x30, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x08, 0x62, 0x6F, 0x6F,
+	0x6C, 0x65, 0x61, 0x6E, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xD0,
+	0x07, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x26, 0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x00,
+	0x00, 0x00, 0x07, 0x03, 0xEE, 0x2F, 0x0E, 0x03, 0x05, 0x1A,
+	0xCF, 0x05, 0x73, 0x74, 0x64, 0x69, 0x6E, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0x8F, 0x03, 0xDA, 0x05, 0xCE, 0x18, 0x54, 0x68,
+	0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64,
+	0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x2E, 0xCF, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D, 0x61,
+	0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0xDA, 0x05, 0xCE, 0xA4,
+	0x01, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72,
+	0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D, 0x61, 0x6C, 0x6C,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x73, 0x75, 0x62, 0x73,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+	0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x20,
+	0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x69,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20, 0x57, 0x69,
+	0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61,
+	0x74, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+	0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+	0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF, 0x0C, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xB5, 0x02, 0x54, 0x68,
+	0x65, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C,
+	0x6F, 0x6F, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67,
+	0x20, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75,
+	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x70, 0x72, 0x65, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20,
+	0x6F, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x2E, 0x20, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x20,
+	0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x73, 0x20, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73, 0x79, 0x73,
+	0x70, 0x61, 0x74, 0x68, 0x2A, 0x2C, 0x20, 0x3A, 0x6E, 0x61,
+	0x6D, 0x65, 0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+	0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x66, 0x74, 0x65,
+	0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+	0x20, 0x2F, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x61,
+	0x6C, 0x6C, 0x3A, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x6E, 0x61,
+	0x6D, 0x65, 0x20, 0x6C, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6C,
+	0x6C, 0x79, 0x2E, 0x20, 0x20, 0x3A, 0x6E, 0x61, 0x74, 0x69,
+	0x76, 0x65, 0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x79, 0x6E, 0x61,
+	0x6D, 0x69, 0x63, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72,
+	0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x74,
+	0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x75, 0x73,
+	0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x64, 0x6C, 0x6C, 0x20,
+	0x20, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xF0, 0xE8, 0x05, 0xCD, 0xEE, 0xEF,
+	0x05, 0xDA, 0x03, 0xD1, 0x05, 0xCE, 0x0D, 0x2E, 0x2F, 0x3A,
+	0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0xCE, 0x12, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F,
+	0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0xCE, 0x11, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61,
+	0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0xCE,
+	0x16, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C,
+	0x6C, 0x3A, 0x2F, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0xCE, 0x05, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0xCF, 0x0F, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68,
+	0x61, 0x73, 0x2D, 0x6D, 0x6F, 0x72, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0xA7, 0x03, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68, 0x61, 0x73, 0x2D,
+	0x6D, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x72, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6D, 0x6F,
+	0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0xCF,
+	0x10, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+	0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0x93, 0x03, 0xDA, 0x05, 0xCE, 0xD4, 0x01, 0x28,
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63,
+	0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x50,
+	0x72, 0x69, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x69,
+	0x63, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x69, 0x6E, 0x67,
+	0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61,
+	0x67, 0x65, 0x20, 0x65, 0x72, 0x72, 0x20, 0x6D, 0x75, 0x73,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
+	0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x73,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x64,
+	0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x65, 0x70,
+	0x20, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+	0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+	0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x2E, 0xCF, 0x04, 0x73, 0x70, 0x69, 0x74, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x62, 0x28, 0x73, 0x70, 0x69, 0x74,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20,
+	0x26, 0x29, 0x0A, 0x0A, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61,
+	0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x20, 0x43,
+	0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+	0x6C, 0x6C, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xDE, 0x8E, 0x07, 0xCD, 0x9E, 0x93, 0x07, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC0, 0x09, 0x05, 0x03, 0x07, 0x18, 0xCE,
+	0x04, 0x73, 0x70, 0x69, 0x74, 0xDA, 0x10, 0xD0, 0x01, 0x77,
+	0xD8, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65,
+	0x6E, 0xCE, 0x14, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x20, 0xCE, 0x0B, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0xDA, 0xBC, 0x02, 0xDA,
+	0x8E, 0x03, 0xD8, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63,
+	0x6C, 0x6F, 0x73, 0x65, 0x22, 0x04, 0x00, 0x00, 0x48, 0x03,
+	0x04, 0x02, 0x1A, 0x03, 0x02, 0x00, 0x26, 0x02, 0x00, 0x00,
+	0x17, 0x03, 0x02, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x26, 0x04,
+	0x01, 0x00, 0x2F, 0x04, 0x04, 0x00, 0x1A, 0x04, 0x02, 0x00,
+	0x18, 0x08, 0x00, 0x00, 0x26, 0x01, 0x02, 0x00, 0x26, 0x02,
+	0x03, 0x00, 0x2D, 0x01, 0x00, 0x02, 0x2B, 0x03, 0x00, 0x00,
+	0x26, 0x02, 0x04, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x2C, 0x04, 0x01, 0x00, 0x26, 0x02, 0x05, 0x00,
+	0x2F, 0x01, 0x02, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26, 0x00,
+	0x06, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x1D, 0x05, 0xC0, 0x90, 0x07, 0x20, 0x03, 0x36, 0x08, 0x02,
+	0x32, 0x6A, 0x06, 0x22, 0x25, 0x01, 0x0D, 0x10, 0x03, 0x86,
+	0x01, 0x4F, 0x03, 0x34, 0x11, 0x01, 0x97, 0x04, 0xA6, 0x04,
+	0xCF, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61,
+	0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C,
+	0x6F, 0x77, 0x65, 0x72, 0xDA, 0x05, 0xCE, 0xBE, 0x01, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63,
+	0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x73,
+	0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C,
+	0x61, 0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x63,
+	0x61, 0x73, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F,
+	0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x73,
+	0x65, 0x6C, 0x76, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x41,
+	0x53, 0x43, 0x49, 0x49, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73,
+	0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65,
+	0x72, 0x79, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+	0x63, 0x61, 0x73, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B,
+	0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x69, 0x6E, 0x67, 0x20,
+	0x6E, 0x6F, 0x20, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+	0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0xCF,
+	0x03, 0x73, 0x65, 0x71, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x78, 0x28, 0x73, 0x65, 0x71, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+	0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+	0x6F, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x62, 0x75,
+	0x74, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x75, 0x6C, 0x61,
+	0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x6E,
+	0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2E, 0x20,
+	0x20, 0x53, 0x65, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C,
+	0x73, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xBC, 0x87, 0x02, 0xCD, 0x9C, 0x8B, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x06, 0x01, 0x05,
+	0x15, 0xCE, 0x03, 0x73, 0x65, 0x71, 0xDA, 0x10, 0xDA, 0x5B,
+	0xDA, 0x5C, 0xDA, 0x5F, 0xCF, 0x0A, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0xCF, 0x04, 0x6C, 0x6F,
+	0x6F, 0x70, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x02, 0x00,
+	0x38, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05,
+	0x02, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00,
+	0x2B, 0x05, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D, 0x03,
+	0x00, 0x00, 0x26, 0x01, 0x03, 0x00, 0x2D, 0x01, 0x02, 0x03,
+	0x3D, 0x05, 0x00, 0x00, 0x26, 0x01, 0x04, 0x00, 0x2D, 0x01,
+	0x00, 0x05, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x01, 0x02, 0x00,
+	0x2D, 0x01, 0x04, 0x03, 0x2B, 0x02, 0x00, 0x00, 0x3D, 0x05,
+	0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x09, 0x02, 0xEA, 0x89,
+	0x02, 0x0E, 0x13, 0x18, 0x8A, 0x01, 0xCF, 0x09, 0x6D, 0x69,
+	0x6E, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x6D, 0x69, 0x6E, 0x2D,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x26, 0x20, 0x61, 0x72,
+	0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x69, 0x6E,
+	0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E,
+	0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74,
+	0x61, 0x6C, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+	0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0x84, 0xC1, 0x02, 0xCD, 0x92, 0xC3, 0x02,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x09, 0x02, 0x00,
+	0x02, 0x04, 0xCE, 0x09, 0x6D, 0x69, 0x6E, 0x2D, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0xDA, 0x10, 0xD7, 0xCD, 0xAA, 0x80, 0xC8,
+	0x20, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x06, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0x3C, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01,
+	0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25,
+	0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x1D, 0x02, 0x03,
+	0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17,
+	0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA,
+	0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24,
+	0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x8F, 0x02,
+	0x26, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x01,
+	0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x05, 0x04, 0xE8, 0xC2,
+	0x02, 0x28, 0xCF, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+	0xDA, 0xE4, 0x01, 0xDA, 0x05, 0xCE, 0xA3, 0x01, 0x28, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x65, 0x61,
+	0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x0A,
+	0x0A, 0x53, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20,
+	0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6D, 0x70, 0x74,
+	0x69, 0x65, 0x73, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x72,
+	0x65, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73,
+	0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x6F,
+	0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+	0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74,
+	0x6C, 0x79, 0x20, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x6C, 0x65,
+	0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0xCF, 0x03, 0x6E, 0x6F, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+	0xDA, 0x5A, 0xDA, 0x05, 0xCE, 0x2A, 0x28, 0x6E, 0x6F, 0x74,
+	0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x6F,
+	0x6C, 0x65, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72,
+	0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x10,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73,
+	0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70,
+	0x75, 0x73, 0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64, 0xDA, 0x05,
+	0xCE, 0xE1, 0x01, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x61,
+	0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x20, 0x77,
+	0x6F, 0x72, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x67, 0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x70,
+	0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x77, 0x6F, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+	0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x62, 0x69, 0x67,
+	0x20, 0x65, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x20, 0x6F, 0x72,
+	0x64, 0x65, 0x72, 0x2C, 0x20, 0x75, 0x6E, 0x73, 0x69, 0x67,
+	0x6E, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+	0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x76,
+	0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0B,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E,
+	0x64, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x58, 0x28,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E,
+	0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x72, 0x79, 0x20, 0x74,
+	0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0x9E, 0xF8, 0x05, 0xCD, 0xC8, 0xFF,
+	0x05, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B, 0x0C,
+	0x02, 0x07, 0x19, 0x01, 0xCE, 0x0B, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0xDA, 0x10, 0xCE,
+	0x01, 0x2F, 0xDA, 0x8D, 0x01, 0xD8, 0x08, 0x6F, 0x73, 0x2F,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0xD0, 0x07, 0x77, 0x69, 0x6E,
+	0x64, 0x6F, 0x77, 0x73, 0xCE, 0x03, 0x64, 0x6C, 0x6C, 0xCE,
+	0x02, 0x73, 0x6F, 0xDA, 0xEB, 0x02, 0x28, 0x02, 0x00, 0x00,
+	0x26, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x26, 0x04,
+	0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x37, 0x05, 0x04, 0x00, 0x25, 0x07, 0x01, 0x00, 0x07, 0x06,
+	0x05, 0x07, 0x33, 0x05, 0x04, 0x06, 0x17, 0x06, 0x05, 0x00,
+	0x26, 0x09, 0x02, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x26, 0x0A,
+	0x03, 0x00, 0x48, 0x09, 0x0A, 0x08, 0x1A, 0x09, 0x03, 0x00,
+	0x26, 0x07, 0x04, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x07,
+	0x05, 0x00, 0x17, 0x08, 0x07, 0x00, 0x2A, 0x09, 0x00, 0x00,
+	0x17, 0x0A, 0x09, 0x00, 0x2C, 0x0A, 0x01, 0x00, 0x26, 0x0B,
+	0x06, 0x00, 0x30, 0x0B, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0,
+	0x0D, 0x03, 0x01, 0x06, 0x15, 0x01, 0xCE, 0x08, 0x73, 0x75,
+	0x62, 0x2D, 0x70, 0x61, 0x74, 0x68, 0xDA, 0x10, 0xCE, 0x06,
+	0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0xD8, 0x0E, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x65, 0xCE, 0x05, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0xDA,
+	0x92, 0x04, 0xCE, 0x08, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x3A, 0xCE, 0x05, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x26,
+	0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x06, 0x2D, 0x01, 0x02,
+	0x00, 0x26, 0x02, 0x01, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x26,
+	0x02, 0x02, 0x00, 0x26, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00,
+	0x00, 0x2D, 0x02, 0x00, 0x01, 0x26, 0x00, 0x01, 0x00, 0x2F,
+	0x02, 0x00, 0x00, 0x26, 0x01, 0x04, 0x00, 0x27, 0x00, 0x00,
+	0x08, 0x2D, 0x01, 0x00, 0x02, 0x26, 0x00, 0x01, 0x00, 0x2F,
+	0x01, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00, 0x27, 0x00, 0x00,
+	0x00, 0x2D, 0x02, 0x00, 0x01, 0x26, 0x02, 0x01, 0x00, 0x30,
+	0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x15,
+	0xB2, 0xFC, 0x05, 0xE4, 0x02, 0x30, 0x01, 0x9E, 0xF8, 0x05,
+	0xAA, 0x07, 0x04, 0xE2, 0x01, 0xFD, 0x06, 0x01, 0x15, 0x18,
+	0x01, 0x7C, 0x29, 0x02, 0x05, 0x0C, 0x01, 0x15, 0x18, 0x01,
+	0x13, 0x16, 0x02, 0x90, 0x01, 0x41, 0x02, 0x17, 0x1A, 0x04,
+	0x07, 0x20, 0x01, 0x13, 0x16, 0x02, 0x6A, 0xBA, 0x02, 0x03,
+	0xA4, 0x03, 0xF5, 0x02, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65,
+	0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+	0xDA, 0x8E, 0x03, 0xDA, 0x05, 0xCE, 0x64, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x66,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x57,
+	0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x27, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x27, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20,
+	0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x6F,
+	0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x0D, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xA9, 0x03, 0xDA,
+	0x05, 0xCE, 0xFD, 0x01, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+	0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+	0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+	0x65, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x2E,
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+	0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A, 0x09,
+	0x3A, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2D,
+	0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+	0x73, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x64, 0x2E, 0x0A, 0x09, 0x3A, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x20, 0x70, 0x61,
+	0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F,
+	0x75, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x0A, 0x09,
+	0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x2D, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x63,
+	0x61, 0x6E, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20,
+	0x72, 0x65, 0x61, 0x64, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20,
+	0x73, 0x61, 0x66, 0x65, 0x6C, 0x79, 0x20, 0x74, 0x65, 0x72,
+	0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x2E, 0xCF, 0x06, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+	0xB3, 0x04, 0xDA, 0x05, 0xCE, 0xCC, 0x01, 0x28, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x26, 0x20, 0x6B, 0x76, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x2E, 0x20, 0x6B,
+	0x76, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
+	0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6B, 0x31, 0x2C,
+	0x20, 0x76, 0x31, 0x2C, 0x20, 0x6B, 0x32, 0x2C, 0x20, 0x76,
+	0x32, 0x2C, 0x20, 0x6B, 0x33, 0x2C, 0x20, 0x76, 0x33, 0x2C,
+	0x20, 0x2E, 0x2E, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B, 0x76,
+	0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F,
+	0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+	0x6F, 0x66, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+	0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x2E, 0xCF, 0x06, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x89, 0x01, 0x28, 0x66,
+	0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x47, 0x69, 0x76,
+	0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+	0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65,
+	0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+	0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x74, 0x68, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xE8, 0xEB, 0x02, 0xCD, 0xD0, 0xEF, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x07, 0x02, 0x01,
+	0x11, 0xCE, 0x06, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0xDA,
+	0x10, 0xDA, 0xFE, 0x01, 0x38, 0x02, 0x00, 0x00, 0x37, 0x03,
+	0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x0B, 0x00, 0x33, 0x05,
+	0x01, 0x03, 0x17, 0x06, 0x05, 0x00, 0x2B, 0x06, 0x00, 0x00,
+	0x2F, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x04, 0x00, 0x2C, 0x02,
+	0x06, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00,
+	0x49, 0x03, 0x04, 0x01, 0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x02,
+	0x00, 0x00, 0x19, 0x01, 0x98, 0xEE, 0x02, 0x18, 0x07, 0x20,
+	0x72, 0x02, 0x3A, 0x75, 0x01, 0x07, 0x42, 0x03, 0x2C, 0x2D,
+	0x02, 0x5D, 0x62, 0x01, 0xCF, 0x02, 0xDE, 0x02, 0xCF, 0x0A,
+	0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x67, 0x28, 0x66,
+	0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+	0x0A, 0x46, 0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63,
+	0x68, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF8, 0x81,
+	0x03, 0xCD, 0xC2, 0x86, 0x03, 0xDA, 0x03, 0xDA, 0x86, 0x04,
+	0xDA, 0xD4, 0x05, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x5D, 0xDA,
+	0x05, 0xCE, 0x50, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x26, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x29, 0x0A, 0x0A,
+	0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61,
+	0x69, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2E, 0xCF, 0x03, 0x64, 0x65, 0x63, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x17, 0x28, 0x64, 0x65, 0x63,
+	0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x78, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD4, 0x4B, 0xCD, 0xA0,
+	0x4C, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x01,
+	0x01, 0x00, 0x02, 0xCE, 0x03, 0x64, 0x65, 0x63, 0xDA, 0x10,
+	0x05, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x04, 0x02,
+	0x92, 0x4C, 0x0C, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+	0x66, 0x6C, 0x75, 0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73,
+	0x68, 0xDA, 0x05, 0xCE, 0x90, 0x01, 0x28, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x66, 0x29,
+	0x0A, 0x0A, 0x46, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x61, 0x6E,
+	0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73,
+	0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+	0x6D, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+	0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x65,
+	0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x66, 0x66, 0x69,
+	0x63, 0x69, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x72, 0x65, 0x61,
+	0x73, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E,
+	0xCF, 0x03, 0x6B, 0x76, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x77, 0x28, 0x6B, 0x76, 0x73, 0x20, 0x64, 0x69,
+	0x63, 0x74, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73,
+	0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F,
+	0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+	0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x40, 0x5B, 0x6B, 0x20,
+	0x76, 0x20, 0x6B, 0x20, 0x76, 0x20, 0x2E, 0x2E, 0x2E, 0x5D,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8A,
+	0x96, 0x04, 0xCD, 0xE4, 0x99, 0x04, 0xDA, 0x03, 0xDA, 0xB1,
+	0x04, 0xCF, 0x04, 0x73, 0x6F, 0x6D, 0x65, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x61, 0x28, 0x73, 0x6F, 0x6D, 0x65,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69,
+	0x6C, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+	0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x92,
+	0x85, 0x05, 0xCD, 0xA4, 0x88, 0x05, 0xDA, 0x03, 0xDA, 0xE3,
+	0x04, 0xCF, 0x0E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73,
+	0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0x81, 0x03, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70, 0x72,
+	0x6F, 0x74, 0x6F, 0x20, 0x74, 0x61, 0x62, 0x20, 0x70, 0x72,
+	0x6F, 0x74, 0x6F, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+	0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72,
+	0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x2E, 0xCF, 0x04, 0x6B,
+	0x65, 0x79, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x38, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B,
+	0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76,
+	0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xF6, 0xF9, 0x03, 0xCD, 0x86, 0xFD,
+	0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x04,
+	0x01, 0x03, 0x17, 0xCE, 0x04, 0x6B, 0x65, 0x79, 0x73, 0xDA,
+	0x10, 0xDA, 0xFD, 0x01, 0xDA, 0xF9, 0x01, 0xDA, 0xFE, 0x01,
+	0x37, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x02,
+	0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x22, 0x02, 0x00, 0x00,
+	0x2C, 0x00, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2F, 0x02,
+	0x02, 0x00, 0x22, 0x03, 0x00, 0x00, 0x1F, 0x03, 0x03, 0x02,
+	0x19, 0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x08, 0x00,
+	0x2C, 0x01, 0x02, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x03,
+	0x03, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x03, 0x01, 0x00,
+	0x2F, 0x02, 0x03, 0x00, 0x18, 0xF3, 0xFF, 0xFF, 0x03, 0x01,
+	0x00, 0x00, 0x1F, 0x01, 0xAA, 0xFB, 0x03, 0x12, 0x03, 0x15,
+	0x18, 0x04, 0x42, 0x13, 0x06, 0x2E, 0x00, 0x01, 0x0D, 0x6C,
+	0x03, 0x30, 0x5F, 0x03, 0x3C, 0x0F, 0x01, 0x6B, 0x70, 0x01,
+	0xFF, 0x01, 0x8E, 0x02, 0xCF, 0x0E, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74,
+	0xDA, 0x05, 0xCE, 0x57, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x20, 0x62, 0x69, 0x74, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0xCF, 0x0B, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x71,
+	0x75, 0x6F, 0x74, 0x61, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x71, 0x75, 0x6F, 0x74,
+	0x61, 0xDA, 0x05, 0xCE, 0x98, 0x01, 0x28, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x6F, 0x74, 0x61, 0x73,
+	0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x6F, 0x77, 0x20,
+	0x6D, 0x75, 0x63, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x6D, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20,
+	0x75, 0x73, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+	0x73, 0x20, 0x3A, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C,
+	0x20, 0x3A, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2D, 0x75,
+	0x73, 0x65, 0x64, 0x2C, 0x20, 0x3A, 0x74, 0x69, 0x63, 0x6B,
+	0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x74, 0x69, 0x63,
+	0x6B, 0x73, 0x2D, 0x75, 0x73, 0x65, 0x64, 0x2E, 0xCF, 0x09,
+	0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+	0x61, 0x73, 0x69, 0x6E, 0xDA, 0x05, 0xCE, 0x28, 0x28, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x73, 0x69,
+	0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x01,
+	0x25, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x3C, 0xDA, 0x05, 0xCE,
+	0x42, 0x28, 0x25, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65,
+	0x6E, 0x64, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x6F, 0x72,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69,
+	0x6E, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x69,
+	0x76, 0x69, 0x64, 0x65, 0x6E, 0x64, 0x20, 0x2F, 0x20, 0x64,
+	0x69, 0x76, 0x69, 0x73, 0x6F, 0x72, 0x2E, 0xCF, 0x04, 0x6D,
+	0x65, 0x74, 0x61, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x37, 0x28, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x26, 0x20, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x41, 0x64, 0x64, 0x20,
+	0x6D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x27, 0xCB, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFE, 0x82, 0x07, 0xCD,
+	0xA2, 0x85, 0x07, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8,
+	0x29, 0x05, 0x00, 0x03, 0x1A, 0xCE, 0x04, 0x6D, 0x65, 0x74,
+	0x61, 0xDA, 0x10, 0xDA, 0xB2, 0x04, 0xDA, 0xF9, 0x01, 0xDA,
+	0x13, 0x4C, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F,
+	0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x26, 0x02, 0x01, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x17,
+	0x02, 0x01, 0x00, 0x22, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x01,
+	0x02, 0x19, 0x01, 0x03, 0x00, 0x23, 0x01, 0x00, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x0B,
+	0x00, 0x17, 0x01, 0x02, 0x00, 0x33, 0x03, 0x00, 0x02, 0x17,
+	0x04, 0x03, 0x00, 0x26, 0x03, 0x02, 0x00, 0x35, 0x03, 0x03,
+	0x00, 0x34, 0x03, 0x01, 0x04, 0x2C, 0x00, 0x02, 0x00, 0x26,
+	0x03, 0x01, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x18, 0xF0, 0xFF,
+	0xFF, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xA4, 0x84, 0x07,
+	0x18, 0x0F, 0x22, 0x42, 0x03, 0x3C, 0x3D, 0x05, 0x3B, 0x3E,
+	0xCF, 0x01, 0x2A, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x96,
+	0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x01, 0x2A,
+	0x17, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02,
+	0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x00,
+	0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03,
+	0x01, 0x00, 0x4B, 0x04, 0x00, 0x00, 0x09, 0x03, 0x03, 0x04,
+	0x03, 0x03, 0x00, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x09, 0x03, 0x03, 0x04,
+	0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+	0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x4F,
+	0x28, 0x2A, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20,
+	0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78,
+	0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+	0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x31, 0x2E, 0xCF,
+	0x01, 0x2B, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x2B, 0xDA, 0x05,
+	0xCE, 0x68, 0x28, 0x2B, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x78,
+	0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x6F,
+	0x72, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20,
+	0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x20, 0x30, 0x2E, 0xCF, 0x08, 0x6F, 0x73,
+	0x2F, 0x73, 0x6C, 0x65, 0x65, 0x70, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x73, 0x6C, 0x65, 0x65, 0x70,
+	0xDA, 0x05, 0xCE, 0x60, 0x28, 0x6F, 0x73, 0x2F, 0x73, 0x6C,
+	0x65, 0x65, 0x70, 0x20, 0x6E, 0x73, 0x65, 0x63, 0x29, 0x0A,
+	0x0A, 0x53, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x6E, 0x73, 0x65, 0x63, 0x20,
+	0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x2E, 0x20, 0x27,
+	0x6E, 0x73, 0x65, 0x63, 0x27, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x62, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+	0xCF, 0x01, 0x2D, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x6C, 0xDA,
+	0x05, 0xCE, 0xDB, 0x01, 0x28, 0x2D, 0x20, 0x26, 0x20, 0x78,
+	0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x66, 0x66,
+	0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x30, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x68, 0x61, 0x73,
+	0x20, 0x6F, 0x6E, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61,
+	0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x4F, 0x74,
+	0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73,
+	0x20, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x2E, 0xCF, 0x01, 0x2F, 0xD3, 0x02, 0xDA, 0x03,
+	0xDA, 0xA0, 0x02, 0xDA, 0x05, 0xCE, 0xFA, 0x01, 0x28, 0x2F,
+	0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x71, 0x75, 0x6F, 0x74, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78,
+	0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79,
+	0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x31, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x68,
+	0x61, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+	0x63, 0x69, 0x70, 0x72, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72,
+	0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x78, 0x73, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+	0x65, 0x64, 0x6C, 0x79, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64,
+	0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x44, 0x69,
+	0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x79, 0x20,
+	0x74, 0x77, 0x6F, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x73, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x74, 0x72,
+	0x75, 0x6E, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x64,
+	0x69, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0xCF, 0x0A,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x65, 0x65, 0x6B,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x70, 0x65, 0x65, 0x6B, 0xDA, 0x05, 0xCE, 0x53,
+	0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x65, 0x65,
+	0x6B, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+	0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x44, 0x6F, 0x65,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69,
+	0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0xCF, 0x0B, 0x70, 0x65, 0x67, 0x2F, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0B, 0x70, 0x65, 0x67, 0x2F, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x65, 0xDA, 0x05, 0xCE, 0x93, 0x01, 0x28, 0x70,
+	0x65, 0x67, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+	0x20, 0x70, 0x65, 0x67, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D,
+	0x70, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x20, 0x70, 0x65,
+	0x67, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x75, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61,
+	0x20, 0x3C, 0x63, 0x6F, 0x72, 0x65, 0x2F, 0x70, 0x65, 0x67,
+	0x3E, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x75,
+	0x70, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67,
+	0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+	0x6D, 0x65, 0x20, 0x70, 0x65, 0x67, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+	0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74,
+	0x69, 0x6D, 0x65, 0x73, 0x2E, 0xCF, 0x03, 0x61, 0x6C, 0x6C,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x61,
+	0x6C, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20, 0x6F, 0x74,
+	0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61,
+	0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xB2, 0x82, 0x05, 0xCD, 0x8C, 0x85,
+	0x05, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06,
+	0x02, 0x00, 0x10, 0xCE, 0x03, 0x61, 0x6C, 0x6C, 0xDA, 0x10,
+	0x23, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x17, 0x04,
+	0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04,
+	0x1A, 0x05, 0x03, 0x00, 0x17, 0x05, 0x02, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x06, 0x00,
+	0x33, 0x05, 0x01, 0x03, 0x2B, 0x05, 0x00, 0x00, 0x2F, 0x02,
+	0x00, 0x00, 0x05, 0x03, 0x03, 0x01, 0x18, 0xF6, 0xFF, 0xFF,
+	0x03, 0x02, 0x00, 0x00, 0x13, 0x01, 0x80, 0x84, 0x05, 0x1A,
+	0x0A, 0x22, 0x42, 0x02, 0x4A, 0x4D, 0x02, 0x49, 0x4E, 0x01,
+	0xEF, 0x01, 0xFE, 0x01, 0xCF, 0x04, 0x62, 0x78, 0x6F, 0x72,
+	0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x9E, 0x80, 0xC8, 0x20,
+	0x06, 0x00, 0x00, 0x13, 0xCE, 0x04, 0x62, 0x78, 0x6F, 0x72,
+	0x17, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02,
+	0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+	0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03,
+	0x00, 0x00, 0x4B, 0x04, 0x00, 0x00, 0x0E, 0x03, 0x03, 0x04,
+	0x03, 0x03, 0x00, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x0E, 0x03, 0x03, 0x04,
+	0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+	0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x59,
+	0x28, 0x62, 0x78, 0x6F, 0x72, 0x20, 0x26, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77,
+	0x69, 0x73, 0x65, 0x20, 0x78, 0x6F, 0x72, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x45,
+	0x61, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20,
+	0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF,
+	0x01, 0x3C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x8D, 0x02, 0xDA,
+	0x05, 0xCE, 0x4B, 0x28, 0x3C, 0x20, 0x26, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x97,
+	0x02, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xF9, 0x03, 0xDA, 0x05,
+	0xCE, 0x49, 0x28, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x66,
+	0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+	0x77, 0x69, 0x73, 0x65, 0x2E, 0xCF, 0x01, 0x3E, 0xD3, 0x02,
+	0xDA, 0x03, 0xD7, 0xCD, 0xB4, 0x80, 0xC8, 0x20, 0x06, 0x00,
+	0x00, 0x10, 0xCE, 0x01, 0x3E, 0x17, 0x01, 0x00, 0x00, 0x1E,
+	0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00,
+	0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x40,
+	0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05,
+	0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+	0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+	0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA,
+	0x05, 0xCE, 0x4C, 0x28, 0x3E, 0x20, 0x26, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF,
+	0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xCE, 0x02, 0x28, 0x72, 0x65,
+	0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68,
+	0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A,
+	0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x61, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x57, 0x69,
+	0x6C, 0x6C, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61,
+	0x74, 0x68, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61,
+	0x73, 0x20, 0x61, 0x20, 0x72, 0x61, 0x77, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E,
+	0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2E, 0x20, 0x53, 0x65, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x2D, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2A, 0x20, 0x20,
+	0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x3A, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x6F, 0x66, 0x66, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x6F, 0x6E, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xA0, 0xC7,
+	0x06, 0xCD, 0x96, 0xE8, 0x06, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xC8, 0x29, 0x0D, 0x01, 0x20, 0xC2, 0x01, 0xCE, 0x07,
+	0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0xDA, 0x10, 0xDA,
+	0xB2, 0x04, 0xD0, 0x05, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xD0,
+	0x04, 0x65, 0x78, 0x69, 0x74, 0xD1, 0x01, 0xCA, 0xD1, 0x01,
+	0xC9, 0xDA, 0xFE, 0x01, 0xD3, 0x00, 0xDA, 0xF7, 0x05, 0xDA,
+	0xC0, 0x06, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01,
+	0x02, 0x09, 0xCE, 0x07, 0x66, 0x65, 0x78, 0x69, 0x73, 0x74,
+	0x73, 0xDA, 0x10, 0xDA, 0x8A, 0x06, 0xDA, 0x8D, 0x06, 0x2B,
+	0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x2F, 0x01, 0x01,
+	0x00, 0x1A, 0x01, 0x05, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x2F, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x03, 0xF0, 0x88, 0x06,
+	0x1E, 0x01, 0x28, 0x1E, 0x03, 0x14, 0x21, 0x01, 0x07, 0x14,
+	0x01, 0x0B, 0x0E, 0xDA, 0x86, 0x04, 0xD3, 0x00, 0xCE, 0x1A,
+	0x63, 0x69, 0x72, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x64,
+	0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x3A,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xCE, 0x0B, 0x20, 0x69,
+	0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0xDA,
+	0xBC, 0x02, 0xDA, 0x8A, 0x06, 0xD0, 0x03, 0x61, 0x6C, 0x6C,
+	0xDA, 0x91, 0x03, 0xDA, 0x8D, 0x06, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x19, 0x04, 0x01, 0x0E, 0x34, 0x01, 0xCE, 0x0A, 0x72,
+	0x65, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA,
+	0x10, 0xCE, 0x07, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65,
+	0xDA, 0xBC, 0x02, 0xD0, 0x02, 0x72, 0x62, 0xDA, 0x8A, 0x06,
+	0xDA, 0xCD, 0x07, 0xDA, 0x91, 0x03, 0xDA, 0x15, 0xDA, 0x8D,
+	0x06, 0xDA, 0x1D, 0xDA, 0x57, 0xDA, 0x56, 0xD0, 0x04, 0x64,
+	0x65, 0x70, 0x73, 0xDA, 0x55, 0xDA, 0x58, 0x26, 0x01, 0x00,
+	0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x01, 0x00, 0x2F,
+	0x01, 0x00, 0x00, 0x26, 0x00, 0x02, 0x00, 0x2C, 0x01, 0x00,
+	0x00, 0x26, 0x00, 0x03, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x17,
+	0x01, 0x00, 0x00, 0x1A, 0x01, 0x2A, 0x00, 0x26, 0x02, 0x04,
+	0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x00, 0x05, 0x00, 0x2F,
+	0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x03, 0x06,
+	0x00, 0x2F, 0x00, 0x03, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x2B, 0x01, 0x00,
+	0x00, 0x26, 0x00, 0x07, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2B,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x2F, 0x00, 0x00,
+	0x00, 0x26, 0x03, 0x09, 0x00, 0x48, 0x03, 0x00, 0x03, 0x1A,
+	0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00,
+	0x00, 0x26, 0x03, 0x0A, 0x00, 0x48, 0x03, 0x00, 0x03, 0x1A,
+	0x03, 0x0E, 0x00, 0x26, 0x03, 0x0B, 0x00, 0x33, 0x00, 0x02,
+	0x03, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x08, 0x00, 0x2F,
+	0x03, 0x03, 0x00, 0x26, 0x00, 0x0C, 0x00, 0x48, 0x00, 0x03,
+	0x00, 0x1A, 0x00, 0x03, 0x00, 0x23, 0x00, 0x00, 0x00, 0x18,
+	0x05, 0x00, 0x00, 0x26, 0x00, 0x0D, 0x00, 0x1F, 0x00, 0x03,
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1A,
+	0x00, 0x02, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x37, 0x04, 0x96, 0xAB, 0x06,
+	0x32, 0x04, 0x15, 0x20, 0x01, 0x0D, 0x10, 0x01, 0x6A, 0xF0,
+	0x01, 0x04, 0x50, 0xAF, 0x02, 0x03, 0x15, 0x18, 0x02, 0x09,
+	0x20, 0x01, 0x17, 0x1A, 0x03, 0x80, 0x01, 0x59, 0x0A, 0x38,
+	0x0C, 0x01, 0x09, 0x48, 0x02, 0x48, 0x4B, 0x0A, 0x13, 0x16,
+	0x02, 0x33, 0x36, 0x03, 0x07, 0x24, 0x01, 0xBD, 0x01, 0xC0,
+	0x01, 0x0A, 0x11, 0x12, 0x02, 0xDA, 0xD1, 0x07, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x19, 0x06, 0x02, 0x0B, 0x3B, 0x01, 0xCE,
+	0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0xDA, 0x10, 0xDA, 0xD1, 0x07, 0xDA, 0x86, 0x03, 0xD0,
+	0x05, 0x73, 0x74, 0x61, 0x6D, 0x70, 0xDA, 0xF2, 0x02, 0xDA,
+	0x82, 0x03, 0xDA, 0xC3, 0x07, 0xD7, 0xCD, 0x80, 0x80, 0xF0,
+	0x0B, 0x12, 0x02, 0x07, 0x24, 0x01, 0xCE, 0x0C, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70,
+	0xDA, 0x10, 0xD8, 0x0E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+	0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0xCF, 0x04,
+	0x63, 0x6F, 0x72, 0x65, 0xCF, 0x03, 0x65, 0x6E, 0x76, 0xCE,
+	0x04, 0x63, 0x6F, 0x72, 0x65, 0xCE, 0x07, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x20, 0xDA, 0xBC, 0x02, 0xDA, 0xC7, 0x07,
+	0x28, 0x02, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04,
+	0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x26, 0x05, 0x01, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x05,
+	0x04, 0x06, 0x2B, 0x00, 0x00, 0x00, 0x3C, 0x05, 0x00, 0x00,
+	0x17, 0x06, 0x05, 0x00, 0x2A, 0x07, 0x00, 0x00, 0x17, 0x08,
+	0x07, 0x00, 0x26, 0x09, 0x03, 0x00, 0x2C, 0x09, 0x04, 0x00,
+	0x2F, 0x09, 0x08, 0x00, 0x17, 0x0A, 0x01, 0x00, 0x37, 0x0B,
+	0x0A, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x25, 0x0B, 0x00, 0x00,
+	0x43, 0x0D, 0x0B, 0x0C, 0x1A, 0x0D, 0x0E, 0x00, 0x33, 0x0E,
+	0x0A, 0x0B, 0x17, 0x0F, 0x0E, 0x00, 0x26, 0x0E, 0x04, 0x00,
+	0x2C, 0x0E, 0x0F, 0x00, 0x26, 0x10, 0x05, 0x00, 0x2F, 0x0E,
+	0x10, 0x00, 0x26, 0x11, 0x06, 0x00, 0x33, 0x10, 0x11, 0x0F,
+	0x2C, 0x0E, 0x10, 0x00, 0x2F, 0x11, 0x08, 0x00, 0x25, 0x0E,
+	0x01, 0x00, 0x06, 0x0B, 0x0E, 0x0B, 0x18, 0xF2, 0xFF, 0xFF,
+	0x03, 0x06, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x09,
+	0x02, 0x0C, 0x3E, 0x01, 0xCE, 0x03, 0x61, 0x64, 0x64, 0xDA,
+	0x10, 0xDA, 0xF9, 0x01, 0xDA, 0x1D, 0xDA, 0x57, 0xCE, 0x01,
+	0x20, 0xDA, 0xBC, 0x02, 0xCE, 0x06, 0x65, 0x6E, 0x74, 0x72,
+	0x79, 0x20, 0xD8, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+	0xDA, 0x03, 0xDA, 0xFC, 0x04, 0xCE, 0x06, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0xDA, 0x91, 0x04, 0xCE, 0x04, 0x72, 0x65,
+	0x66, 0x20, 0x22, 0x02, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00,
+	0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x22, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x02, 0x03,
+	0x19, 0x02, 0x03, 0x00, 0x23, 0x02, 0x00, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x32, 0x00,
+	0x17, 0x02, 0x03, 0x00, 0x33, 0x04, 0x01, 0x03, 0x17, 0x05,
+	0x04, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+	0x2F, 0x04, 0x04, 0x00, 0x26, 0x06, 0x02, 0x00, 0x48, 0x04,
+	0x04, 0x06, 0x1A, 0x04, 0x25, 0x00, 0x26, 0x04, 0x03, 0x00,
+	0x2D, 0x00, 0x04, 0x02, 0x26, 0x06, 0x04, 0x00, 0x2F, 0x04,
+	0x06, 0x00, 0x17, 0x06, 0x04, 0x00, 0x26, 0x04, 0x05, 0x00,
+	0x2C, 0x04, 0x06, 0x00, 0x26, 0x02, 0x06, 0x00, 0x2F, 0x04,
+	0x02, 0x00, 0x27, 0x02, 0x00, 0x06, 0x34, 0x02, 0x04, 0x05,
+	0x26, 0x02, 0x07, 0x00, 0x33, 0x04, 0x05, 0x02, 0x17, 0x02,
+	0x04, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00,
+	0x2F, 0x04, 0x07, 0x00, 0x26, 0x08, 0x08, 0x00, 0x33, 0x07,
+	0x08, 0x04, 0x1A, 0x07, 0x07, 0x00, 0x26, 0x04, 0x09, 0x00,
+	0x2C, 0x04, 0x06, 0x00, 0x26, 0x08, 0x06, 0x00, 0x2F, 0x04,
+	0x08, 0x00, 0x27, 0x08, 0x00, 0x06, 0x34, 0x08, 0x04, 0x02,
+	0x26, 0x07, 0x0A, 0x00, 0x33, 0x04, 0x05, 0x07, 0x17, 0x07,
+	0x04, 0x00, 0x1A, 0x07, 0x07, 0x00, 0x26, 0x04, 0x0B, 0x00,
+	0x2C, 0x04, 0x06, 0x00, 0x26, 0x08, 0x06, 0x00, 0x2F, 0x04,
+	0x08, 0x00, 0x27, 0x08, 0x00, 0x06, 0x34, 0x08, 0x04, 0x07,
+	0x2C, 0x01, 0x03, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03,
+	0x04, 0x00, 0x18, 0xC9, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x42, 0x0F, 0x88, 0x9A, 0x06,
+	0xF6, 0x04, 0x05, 0x40, 0xDB, 0x04, 0x01, 0x3F, 0xDC, 0x04,
+	0x04, 0x80, 0x01, 0xCD, 0x04, 0x01, 0x13, 0x16, 0x04, 0x66,
+	0x13, 0x02, 0x17, 0x26, 0x02, 0x6E, 0x2D, 0x01, 0x0D, 0x10,
+	0x03, 0x6C, 0x23, 0x02, 0x21, 0x24, 0x01, 0x07, 0x56, 0x04,
+	0x56, 0x5D, 0x02, 0x17, 0x1E, 0x02, 0x70, 0x29, 0x02, 0x15,
+	0x62, 0x04, 0x52, 0x59, 0x02, 0x17, 0x1E, 0x05, 0xAD, 0x04,
+	0xB2, 0x04, 0x2E, 0x01, 0xEA, 0x95, 0x06, 0xDE, 0x0A, 0x03,
+	0xF0, 0x02, 0xB7, 0x0A, 0x01, 0x13, 0x16, 0x06, 0x44, 0x08,
+	0x02, 0x4C, 0xE6, 0x04, 0x03, 0xB2, 0x05, 0x89, 0x05, 0x08,
+	0x28, 0x64, 0x04, 0x28, 0x59, 0x02, 0x2E, 0x00, 0x02, 0x37,
+	0x3A, 0x03, 0x1D, 0x20, 0x01, 0xC5, 0x09, 0xDA, 0x09, 0xDA,
+	0x15, 0xDA, 0x1D, 0xDA, 0x57, 0xDA, 0xF9, 0x01, 0x26, 0x02,
+	0x00, 0x00, 0x33, 0x02, 0x00, 0x02, 0x26, 0x04, 0x01, 0x00,
+	0x33, 0x03, 0x00, 0x04, 0x48, 0x04, 0x03, 0x01, 0x1A, 0x04,
+	0x08, 0x00, 0x26, 0x05, 0x02, 0x00, 0x33, 0x03, 0x00, 0x05,
+	0x2C, 0x01, 0x02, 0x00, 0x26, 0x01, 0x03, 0x00, 0x2F, 0x05,
+	0x01, 0x00, 0x1F, 0x01, 0x03, 0x05, 0x18, 0x02, 0x00, 0x00,
+	0x22, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x2C, 0x00, 0x26, 0x04,
+	0x04, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x26, 0x01, 0x05, 0x00, 0x33, 0x05, 0x00, 0x01, 0x2C, 0x04,
+	0x02, 0x00, 0x26, 0x03, 0x06, 0x00, 0x2F, 0x01, 0x03, 0x00,
+	0x23, 0x03, 0x00, 0x00, 0x2D, 0x05, 0x01, 0x03, 0x26, 0x00,
+	0x07, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x22, 0x03, 0x00, 0x00, 0x17, 0x05, 0x03, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x26, 0x03, 0x08, 0x00, 0x2F, 0x03, 0x03, 0x00,
+	0x26, 0x01, 0x09, 0x00, 0x48, 0x03, 0x03, 0x01, 0x1A, 0x03,
+	0x16, 0x00, 0x17, 0x03, 0x05, 0x00, 0x22, 0x01, 0x00, 0x00,
+	0x2C, 0x03, 0x01, 0x00, 0x26, 0x00, 0x0A, 0x00, 0x2F, 0x01,
+	0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x22, 0x01, 0x00, 0x00,
+	0x1F, 0x01, 0x01, 0x00, 0x19, 0x01, 0x03, 0x00, 0x23, 0x01,
+	0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+	0x1A, 0x01, 0x08, 0x00, 0x17, 0x01, 0x00, 0x00, 0x33, 0x02,
+	0x03, 0x00, 0x34, 0x04, 0x01, 0x02, 0x2C, 0x03, 0x00, 0x00,
+	0x26, 0x02, 0x0A, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x18, 0xF3,
+	0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x51, 0x02, 0x80, 0xB1, 0x06, 0x22,
+	0x02, 0x48, 0x04, 0x01, 0x05, 0x16, 0x01, 0x09, 0x8C, 0x01,
+	0x02, 0x6A, 0xA3, 0x01, 0x03, 0x28, 0x0E, 0x01, 0x2D, 0x30,
+	0x02, 0x63, 0x66, 0x01, 0x0B, 0xE2, 0x03, 0x02, 0xF2, 0x01,
+	0x97, 0x05, 0x01, 0x11, 0x14, 0x02, 0x6E, 0x01, 0x03, 0x28,
+	0x08, 0x04, 0x3D, 0x4A, 0x02, 0x09, 0x4E, 0x01, 0x1B, 0x1E,
+	0x05, 0xFA, 0x01, 0xC1, 0x01, 0x01, 0x0B, 0x88, 0x01, 0x0F,
+	0x3C, 0x51, 0x01, 0x3C, 0x3D, 0x04, 0x3B, 0x3E, 0x02, 0x3B,
+	0x52, 0x01, 0xFF, 0x03, 0x82, 0x04, 0x12, 0x1B, 0x1C, 0x05,
+	0xDA, 0xBA, 0x03, 0xDA, 0xD0, 0x03, 0xDA, 0xF2, 0x02, 0xDA,
+	0xF0, 0x02, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x19, 0x0A, 0x05,
+	0x0E, 0x48, 0x01, 0xCE, 0x0A, 0x73, 0x61, 0x76, 0x65, 0x2D,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x10, 0xDA, 0xF9, 0x01,
+	0xDA, 0xE1, 0x07, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x05,
+	0x01, 0x01, 0x15, 0xCE, 0x06, 0x69, 0x6E, 0x76, 0x65, 0x72,
+	0x74, 0xDA, 0x10, 0xDA, 0xF9, 0x01, 0x3C, 0x01, 0x00, 0x00,
+	0x22, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00,
+	0x22, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x02, 0x03, 0x19, 0x02,
+	0x03, 0x00, 0x23, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x24, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x08, 0x00, 0x17, 0x02,
+	0x03, 0x00, 0x33, 0x04, 0x00, 0x02, 0x34, 0x01, 0x04, 0x02,
+	0x2C, 0x00, 0x03, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03,
+	0x04, 0x00, 0x18, 0xF3, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00,
+	0x16, 0x01, 0xDE, 0xE7, 0x03, 0x18, 0x0D, 0x20, 0x42, 0x01,
+	0x40, 0x47, 0x01, 0x11, 0x18, 0x04, 0x2D, 0x30, 0x01, 0xAF,
+	0x03, 0xBE, 0x03, 0xDA, 0xFD, 0x03, 0xCE, 0x07, 0x2E, 0x6A,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0xBC, 0x02, 0xD0, 0x02,
+	0x77, 0x62, 0xDA, 0x8A, 0x06, 0xDA, 0xD1, 0x07, 0xDA, 0x86,
+	0x03, 0xDA, 0xC3, 0x07, 0xDA, 0xD4, 0x07, 0xDA, 0x8E, 0x03,
+	0xDA, 0x8D, 0x06, 0x3C, 0x05, 0x00, 0x00, 0x22, 0x06, 0x00,
+	0x00, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F,
+	0x06, 0x07, 0x00, 0x17, 0x07, 0x06, 0x00, 0x22, 0x08, 0x00,
+	0x00, 0x1F, 0x06, 0x08, 0x07, 0x19, 0x06, 0x03, 0x00, 0x23,
+	0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x06, 0x00,
+	0x00, 0x1A, 0x06, 0x08, 0x00, 0x17, 0x08, 0x07, 0x00, 0x33,
+	0x09, 0x01, 0x07, 0x34, 0x05, 0x08, 0x09, 0x2C, 0x01, 0x07,
+	0x00, 0x26, 0x09, 0x00, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x18,
+	0xF3, 0xFF, 0xFF, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x07, 0x01,
+	0x00, 0x2F, 0x06, 0x07, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26,
+	0x08, 0x02, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x2C, 0x05, 0x07,
+	0x00, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x06, 0x08, 0x00, 0x17,
+	0x01, 0x06, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x01, 0x00,
+	0x00, 0x17, 0x06, 0x01, 0x00, 0x1A, 0x06, 0x0B, 0x00, 0x26,
+	0x08, 0x04, 0x00, 0x2C, 0x00, 0x08, 0x00, 0x26, 0x09, 0x05,
+	0x00, 0x2F, 0x08, 0x09, 0x00, 0x26, 0x09, 0x06, 0x00, 0x2C,
+	0x08, 0x09, 0x00, 0x26, 0x00, 0x07, 0x00, 0x2F, 0x09, 0x00,
+	0x00, 0x17, 0x07, 0x09, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+	0x07, 0x00, 0x00, 0x17, 0x08, 0x07, 0x00, 0x1A, 0x08, 0x19,
+	0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x00, 0x05, 0x00, 0x2F,
+	0x09, 0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x26, 0x01, 0x09,
+	0x00, 0x2D, 0x00, 0x02, 0x01, 0x26, 0x00, 0x0A, 0x00, 0x2D,
+	0x03, 0x00, 0x09, 0x26, 0x00, 0x0B, 0x00, 0x2C, 0x00, 0x04,
+	0x00, 0x3B, 0x09, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22,
+	0x01, 0x00, 0x00, 0x2D, 0x09, 0x00, 0x01, 0x23, 0x00, 0x00,
+	0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x01, 0x03, 0x00, 0x2F,
+	0x00, 0x01, 0x00, 0x2C, 0x08, 0x00, 0x00, 0x26, 0x01, 0x0C,
+	0x00, 0x2F, 0x09, 0x01, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26,
+	0x09, 0x0D, 0x00, 0x30, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x49, 0x01, 0x82, 0xA3, 0x06, 0x22, 0x0E, 0x2A, 0x34,
+	0x01, 0x32, 0x33, 0x04, 0x31, 0x34, 0x03, 0xB2, 0x01, 0x29,
+	0x03, 0x0F, 0x12, 0x03, 0x23, 0x26, 0x03, 0x09, 0x44, 0x01,
+	0x15, 0x18, 0x01, 0xD6, 0x01, 0x57, 0x04, 0x2A, 0x35, 0x04,
+	0x15, 0x20, 0x03, 0x13, 0x16, 0x01, 0x0D, 0x10, 0x01, 0x80,
+	0x01, 0xC4, 0x01, 0x03, 0xA4, 0x01, 0xA1, 0x02, 0x0F, 0x6F,
+	0xC4, 0x01, 0x03, 0x1B, 0x1E, 0x03, 0x88, 0x02, 0xE1, 0x01,
+	0x01, 0x9F, 0x02, 0xA2, 0x02, 0x14, 0x1E, 0x1F, 0x06, 0xD1,
+	0x05, 0xCE, 0x10, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+	0x2E, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0xCE,
+	0x17, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F, 0x3A,
+	0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x74,
+	0x69, 0x76, 0x65, 0x3A, 0xCE, 0x14, 0x3A, 0x73, 0x79, 0x73,
+	0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x3A, 0x6E,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0xCE, 0x1B, 0x3A, 0x73,
+	0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F,
+	0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x2E, 0x3A, 0x6E, 0x61,
+	0x74, 0x69, 0x76, 0x65, 0x3A, 0xDA, 0xFC, 0x05, 0xDA, 0x5A,
+	0xCE, 0x1F, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F,
+	0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x20, 0xDA, 0x82, 0x03, 0xDA, 0xC3, 0x04, 0x28,
+	0x02, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x26, 0x03, 0x00,
+	0x00, 0x2F, 0x01, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x33,
+	0x03, 0x01, 0x04, 0x17, 0x04, 0x03, 0x00, 0x26, 0x05, 0x02,
+	0x00, 0x33, 0x03, 0x01, 0x05, 0x17, 0x05, 0x03, 0x00, 0x26,
+	0x03, 0x03, 0x00, 0x35, 0x03, 0x03, 0x00, 0x1A, 0x03, 0x08,
+	0x00, 0x24, 0x01, 0x00, 0x00, 0x1F, 0x03, 0x04, 0x01, 0x19,
+	0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x04, 0x00,
+	0x00, 0x24, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+	0x03, 0x00, 0x00, 0x26, 0x01, 0x04, 0x00, 0x35, 0x01, 0x01,
+	0x00, 0x1A, 0x01, 0x06, 0x00, 0x26, 0x01, 0x04, 0x00, 0x35,
+	0x01, 0x01, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x01, 0x05,
+	0x00, 0x2F, 0x01, 0x01, 0x00, 0x26, 0x01, 0x06, 0x00, 0x33,
+	0x01, 0x01, 0x00, 0x1A, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00,
+	0x00, 0x26, 0x01, 0x07, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26,
+	0x04, 0x08, 0x00, 0x2F, 0x01, 0x04, 0x00, 0x26, 0x04, 0x09,
+	0x00, 0x17, 0x06, 0x01, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x26,
+	0x04, 0x0A, 0x00, 0x2F, 0x04, 0x04, 0x00, 0x22, 0x07, 0x00,
+	0x00, 0x48, 0x07, 0x04, 0x07, 0x1A, 0x07, 0x03, 0x00, 0x22,
+	0x08, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x33, 0x07, 0x06,
+	0x04, 0x17, 0x08, 0x07, 0x00, 0x17, 0x01, 0x08, 0x00, 0x1A,
+	0x01, 0x6B, 0x00, 0x26, 0x06, 0x0B, 0x00, 0x33, 0x04, 0x06,
+	0x01, 0x1A, 0x04, 0x07, 0x00, 0x26, 0x06, 0x0C, 0x00, 0x26,
+	0x07, 0x0D, 0x00, 0x2D, 0x06, 0x01, 0x07, 0x26, 0x07, 0x0E,
+	0x00, 0x2F, 0x06, 0x07, 0x00, 0x01, 0x06, 0x00, 0x00, 0x2B,
+	0x01, 0x00, 0x00, 0x26, 0x06, 0x0F, 0x00, 0x2F, 0x04, 0x06,
+	0x00, 0x17, 0x06, 0x04, 0x00, 0x26, 0x04, 0x10, 0x00, 0x2C,
+	0x06, 0x04, 0x00, 0x26, 0x07, 0x11, 0x00, 0x2F, 0x04, 0x07,
+	0x00, 0x2B, 0x04, 0x00, 0x00, 0x26, 0x08, 0x0E, 0x00, 0x2F,
+	0x07, 0x08, 0x00, 0x17, 0x04, 0x07, 0x00, 0x2B, 0x06, 0x00,
+	0x00, 0x26, 0x08, 0x12, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x26,
+	0x07, 0x0B, 0x00, 0x23, 0x08, 0x00, 0x00, 0x34, 0x07, 0x01,
+	0x08, 0x26, 0x07, 0x04, 0x00, 0x35, 0x07, 0x07, 0x00, 0x38,
+	0x08, 0x00, 0x00, 0x26, 0x06, 0x04, 0x00, 0x36, 0x06, 0x08,
+	0x00, 0x1A, 0x03, 0x06, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x09, 0x13, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x17, 0x06, 0x08,
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x17,
+	0x08, 0x06, 0x00, 0x1A, 0x08, 0x14, 0x00, 0x26, 0x09, 0x14,
+	0x00, 0x33, 0x06, 0x08, 0x09, 0x17, 0x09, 0x06, 0x00, 0x37,
+	0x06, 0x09, 0x00, 0x17, 0x0A, 0x06, 0x00, 0x25, 0x06, 0x00,
+	0x00, 0x43, 0x0B, 0x06, 0x0A, 0x1A, 0x0B, 0x06, 0x00, 0x33,
+	0x0C, 0x09, 0x06, 0x2B, 0x0C, 0x00, 0x00, 0x2F, 0x0C, 0x02,
+	0x00, 0x49, 0x06, 0x0A, 0x01, 0x18, 0xFC, 0xFF, 0xFF, 0x1A,
+	0x08, 0x06, 0x00, 0x2C, 0x08, 0x04, 0x00, 0x26, 0x0A, 0x15,
+	0x00, 0x2F, 0x09, 0x0A, 0x00, 0x17, 0x06, 0x09, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x17, 0x09, 0x06,
+	0x00, 0x24, 0x06, 0x00, 0x00, 0x1A, 0x09, 0x02, 0x00, 0x18,
+	0x0F, 0x00, 0x00, 0x38, 0x0A, 0x00, 0x00, 0x26, 0x0B, 0x04,
+	0x00, 0x36, 0x0B, 0x0A, 0x00, 0x2D, 0x01, 0x04, 0x05, 0x26,
+	0x0C, 0x16, 0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x35, 0x0C, 0x0B,
+	0x00, 0x17, 0x02, 0x0C, 0x00, 0x35, 0x0C, 0x0B, 0x01, 0x17,
+	0x09, 0x02, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17, 0x06, 0x03,
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x26,
+	0x0A, 0x04, 0x00, 0x35, 0x0A, 0x0A, 0x00, 0x2B, 0x0A, 0x00,
+	0x00, 0x26, 0x0B, 0x17, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x17,
+	0x0B, 0x0A, 0x00, 0x2C, 0x04, 0x0B, 0x00, 0x26, 0x0C, 0x18,
+	0x00, 0x2F, 0x0A, 0x0C, 0x00, 0x17, 0x0C, 0x0A, 0x00, 0x26,
+	0x0A, 0x19, 0x00, 0x34, 0x0A, 0x00, 0x0C, 0x1A, 0x06, 0x05,
+	0x00, 0x2D, 0x01, 0x09, 0x0B, 0x2C, 0x04, 0x0C, 0x00, 0x26,
+	0x02, 0x1A, 0x00, 0x2F, 0x0A, 0x02, 0x00, 0x26, 0x0A, 0x04,
+	0x00, 0x36, 0x0A, 0x07, 0x00, 0x26, 0x0A, 0x0B, 0x00, 0x24,
+	0x02, 0x00, 0x00, 0x34, 0x0A, 0x01, 0x02, 0x26, 0x0A, 0x06,
+	0x00, 0x34, 0x0A, 0x01, 0x09, 0x26, 0x0A, 0x06, 0x00, 0x34,
+	0x0A, 0x00, 0x09, 0x03, 0x09, 0x00, 0x00, 0x26, 0x04, 0x1B,
+	0x00, 0x2C, 0x00, 0x04, 0x00, 0x26, 0x06, 0x08, 0x00, 0x2F,
+	0x04, 0x06, 0x00, 0x26, 0x06, 0x09, 0x00, 0x17, 0x07, 0x04,
+	0x00, 0x2C, 0x06, 0x07, 0x00, 0x26, 0x06, 0x0A, 0x00, 0x2F,
+	0x06, 0x06, 0x00, 0x22, 0x08, 0x00, 0x00, 0x48, 0x08, 0x06,
+	0x08, 0x1A, 0x08, 0x03, 0x00, 0x22, 0x06, 0x00, 0x00, 0x18,
+	0x03, 0x00, 0x00, 0x33, 0x08, 0x07, 0x06, 0x17, 0x06, 0x08,
+	0x00, 0x17, 0x04, 0x06, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26,
+	0x07, 0x1C, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x1A, 0x06, 0x06,
+	0x00, 0x26, 0x07, 0x1D, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x26,
+	0x08, 0x0E, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x01, 0x07, 0x00,
+	0x00, 0x26, 0x07, 0x1E, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17,
+	0x07, 0x06, 0x00, 0x2C, 0x04, 0x07, 0x00, 0x26, 0x08, 0x1F,
+	0x00, 0x2F, 0x06, 0x08, 0x00, 0x26, 0x06, 0x06, 0x00, 0x34,
+	0x06, 0x04, 0x07, 0x26, 0x06, 0x06, 0x00, 0x34, 0x06, 0x00,
+	0x07, 0x03, 0x07, 0x00, 0x00, 0xF0, 0x01, 0x01, 0xA0, 0xC7,
+	0x06, 0xF6, 0x20, 0x03, 0x90, 0x06, 0xDD, 0x20, 0x06, 0x4F,
+	0x52, 0x03, 0x90, 0x01, 0x11, 0x06, 0x34, 0x35, 0x02, 0x33,
+	0x36, 0x03, 0x62, 0x02, 0x05, 0x20, 0x21, 0x02, 0x60, 0x0B,
+	0x02, 0x1D, 0xB4, 0x18, 0x04, 0xAA, 0x01, 0xA3, 0x18, 0x0C,
+	0x1B, 0x1E, 0x02, 0x21, 0x98, 0x17, 0x02, 0xB2, 0x01, 0xBB,
+	0x17, 0x01, 0x0B, 0xAA, 0x01, 0x05, 0x68, 0x6B, 0x01, 0x0D,
+	0x10, 0x03, 0xE4, 0x01, 0x5F, 0x01, 0x0D, 0x10, 0x04, 0x70,
+	0x11, 0x03, 0x0F, 0x12, 0x01, 0x17, 0x1A, 0x03, 0x62, 0x33,
+	0x03, 0x2E, 0x26, 0x02, 0x54, 0x0F, 0x03, 0x44, 0x07, 0x01,
+	0x54, 0x1C, 0x03, 0x1C, 0x1D, 0x03, 0x1B, 0x1E, 0x01, 0x17,
+	0x1A, 0x01, 0x72, 0x0E, 0x02, 0x2A, 0x49, 0x07, 0x13, 0x32,
+	0x02, 0x3A, 0x3B, 0x02, 0x39, 0x3C, 0x01, 0x82, 0x01, 0x09,
+	0x03, 0x16, 0x17, 0x03, 0x15, 0x18, 0x01, 0x17, 0x1A, 0x01,
+	0x78, 0x45, 0x02, 0x32, 0xDA, 0x02, 0x03, 0x32, 0xCF, 0x02,
+	0x03, 0x60, 0x30, 0x03, 0x1F, 0x22, 0x01, 0x92, 0x01, 0x5B,
+	0x04, 0x4A, 0x08, 0x05, 0x52, 0x04, 0x01, 0x13, 0x16, 0x03,
+	0x6A, 0x0D, 0x01, 0x15, 0x18, 0x02, 0x5E, 0x0F, 0x01, 0x4E,
+	0x32, 0x04, 0x12, 0x13, 0x02, 0x6E, 0x27, 0x03, 0x44, 0x12,
+	0x02, 0x56, 0x01, 0x02, 0x54, 0x05, 0x01, 0x89, 0x11, 0xAA,
+	0x11, 0x04, 0xEE, 0x12, 0x99, 0x11, 0x0C, 0x1B, 0x1E, 0x01,
+	0x0D, 0x10, 0x03, 0x94, 0x01, 0x6B, 0x01, 0x07, 0x8E, 0x01,
+	0x04, 0x3A, 0x3D, 0x01, 0x0D, 0x10, 0x02, 0x90, 0x01, 0x59,
+	0x01, 0x0D, 0x10, 0x03, 0x36, 0x0B, 0x02, 0x2A, 0x14, 0x02,
+	0x3E, 0x06, 0x01, 0xA7, 0x04, 0xBE, 0x04, 0xCF, 0x09, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0x8A, 0x06, 0xDA, 0x05, 0xCE, 0xED, 0x03,
+	0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x5B, 0x2C, 0x6D, 0x6F,
+	0x64, 0x65, 0x5D, 0x29, 0x0A, 0x0A, 0x4F, 0x70, 0x65, 0x6E,
+	0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x6F,
+	0x72, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61,
+	0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6C,
+	0x61, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61,
+	0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+	0x6F, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x70, 0x65,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x69, 0x6E, 0x2E, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+	0x72, 0x64, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x65,
+	0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+	0x74, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6C, 0x61,
+	0x67, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x65,
+	0x64, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65,
+	0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x6E,
+	0x64, 0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20,
+	0x66, 0x6C, 0x61, 0x67, 0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x72,
+	0x20, 0x2D, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x72,
+	0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x0A, 0x09, 0x77, 0x20, 0x2D, 0x20, 0x61, 0x6C, 0x6C, 0x6F,
+	0x77, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x0A, 0x09, 0x61, 0x20, 0x2D, 0x20, 0x61, 0x70, 0x70,
+	0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x62, 0x20, 0x2D,
+	0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x69,
+	0x6E, 0x61, 0x72, 0x79, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20,
+	0x28, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x61, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6D, 0x6F,
+	0x64, 0x65, 0x29, 0x0A, 0x09, 0x2B, 0x20, 0x2D, 0x20, 0x61,
+	0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E,
+	0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x6F,
+	0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67,
+	0x20, 0x69, 0x74, 0xCF, 0x0E, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0xD3,
+	0x02, 0xDA, 0x03, 0xDA, 0xBC, 0x06, 0xDA, 0x05, 0xCE, 0xA7,
+	0x01, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72,
+	0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x70, 0x61, 0x74,
+	0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x63,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+	0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x75, 0x62, 0x73,
+	0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E,
+	0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66,
+	0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65,
+	0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF, 0x08,
+	0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x41, 0x28, 0x77, 0x68, 0x65,
+	0x6E, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x29, 0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61,
+	0x73, 0x20, 0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x28,
+	0x64, 0x6F, 0x20, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29,
+	0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xEC, 0xA9, 0x02, 0xCD, 0xD0, 0xAB, 0x02, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x03, 0x01, 0x02, 0x08,
+	0xCE, 0x08, 0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74,
+	0xDA, 0x10, 0xDA, 0x5F, 0xDA, 0x4C, 0x26, 0x02, 0x00, 0x00,
+	0x2B, 0x02, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D, 0x01,
+	0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00, 0x01,
+	0x3D, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x08,
+	0x92, 0xAB, 0x02, 0x3C, 0xCF, 0x09, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x3A, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20,
+	0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD0, 0x28,
+	0xCD, 0x84, 0x2A, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x09, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0xD5, 0x02, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x1F,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0xDE,
+	0x29, 0x0E, 0x03, 0x05, 0x1C, 0xCF, 0x0A, 0x63, 0x68, 0x65,
+	0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0xFC, 0x03, 0x28, 0x63, 0x68, 0x65,
+	0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x78, 0x20,
+	0x65, 0x6E, 0x76, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x26,
+	0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+	0x20, 0x78, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20,
+	0x6D, 0x61, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+	0x6E, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65,
+	0x64, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x73, 0x2C, 0x20,
+	0x73, 0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65,
+	0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x20, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x69,
+	0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x6F, 0x74, 0x68,
+	0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73,
+	0x2E, 0x20, 0x46, 0x69, 0x62, 0x65, 0x72, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+	0x73, 0x74, 0x61, 0x63, 0x6B, 0x73, 0x2C, 0x20, 0x20, 0x63,
+	0x6C, 0x6F, 0x73, 0x75, 0x72, 0x65, 0x73, 0x2C, 0x20, 0x73,
+	0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x73, 0x6B,
+	0x73, 0x2C, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x73,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x71, 0x75, 0x6F, 0x74, 0x61,
+	0x73, 0x2E, 0x20, 0x43, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x62,
+	0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+	0x61, 0x76, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x72, 0x65,
+	0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x65, 0x6E, 0x76, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x79, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x20, 0x68,
+	0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+	0x6D, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+	0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74,
+	0x6F, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E,
+	0x20, 0x41, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x75,
+	0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x6F, 0x72, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x77, 0x61,
+	0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x61,
+	0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2C, 0x20, 0x63, 0x61, 0x6E, 0x6E,
+	0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x20, 0x73, 0x61, 0x76,
+	0x65, 0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6F,
+	0x20, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61,
+	0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xA4, 0x93, 0x07, 0xCD, 0xE4, 0x9E, 0x07, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xC0, 0x09, 0x09, 0x03, 0x07, 0x36,
+	0xCE, 0x0A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x70, 0x6F, 0x69,
+	0x6E, 0x74, 0xDA, 0x10, 0xDA, 0x13, 0xDA, 0x14, 0xDA, 0xF9,
+	0x01, 0xDA, 0x1D, 0xDA, 0xFB, 0x04, 0xDA, 0x91, 0x01, 0xDA,
+	0xFD, 0x03, 0x22, 0x04, 0x00, 0x00, 0x48, 0x03, 0x04, 0x01,
+	0x1A, 0x03, 0x03, 0x00, 0x26, 0x01, 0x00, 0x00, 0x35, 0x01,
+	0x01, 0x00, 0x17, 0x03, 0x01, 0x00, 0x3C, 0x04, 0x00, 0x00,
+	0x2B, 0x03, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x01,
+	0x03, 0x00, 0x17, 0x03, 0x01, 0x00, 0x22, 0x01, 0x00, 0x00,
+	0x2C, 0x03, 0x01, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2F, 0x01,
+	0x05, 0x00, 0x17, 0x05, 0x01, 0x00, 0x22, 0x01, 0x00, 0x00,
+	0x1F, 0x01, 0x01, 0x05, 0x19, 0x01, 0x03, 0x00, 0x23, 0x01,
+	0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+	0x1A, 0x01, 0x19, 0x00, 0x17, 0x01, 0x05, 0x00, 0x33, 0x06,
+	0x03, 0x05, 0x17, 0x07, 0x06, 0x00, 0x2B, 0x06, 0x00, 0x00,
+	0x26, 0x06, 0x03, 0x00, 0x2F, 0x06, 0x06, 0x00, 0x26, 0x08,
+	0x04, 0x00, 0x48, 0x06, 0x06, 0x08, 0x1A, 0x06, 0x03, 0x00,
+	0x17, 0x08, 0x06, 0x00, 0x18, 0x08, 0x00, 0x00, 0x2B, 0x07,
+	0x00, 0x00, 0x26, 0x06, 0x05, 0x00, 0x2F, 0x06, 0x06, 0x00,
+	0x1A, 0x06, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x06,
+	0x00, 0x00, 0x17, 0x08, 0x06, 0x00, 0x1A, 0x08, 0x02, 0x00,
+	0x34, 0x04, 0x07, 0x01, 0x2C, 0x03, 0x05, 0x00, 0x26, 0x06,
+	0x02, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x18, 0xE2, 0xFF, 0xFF,
+	0x1A, 0x02, 0x04, 0x00, 0x2D, 0x00, 0x04, 0x02, 0x26, 0x01,
+	0x06, 0x00, 0x30, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x04, 0x00,
+	0x26, 0x01, 0x06, 0x00, 0x30, 0x01, 0x00, 0x00, 0x34, 0x06,
+	0xC4, 0x9B, 0x07, 0x24, 0x01, 0x2C, 0x03, 0x03, 0x50, 0x01,
+	0x10, 0x27, 0xBA, 0x01, 0x05, 0x70, 0xBD, 0x01, 0x03, 0x07,
+	0x26, 0x03, 0x26, 0x27, 0x04, 0x25, 0x28, 0x01, 0x67, 0x98,
+	0x01, 0x01, 0xB6, 0x01, 0xB7, 0x01, 0x04, 0xB5, 0x01, 0xB8,
+	0x01, 0x01, 0xE0, 0x01, 0x6D, 0x03, 0x12, 0x3B, 0x03, 0x32,
+	0x09, 0xCF, 0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0x97, 0x05, 0xDA, 0x05, 0xCE, 0x4E, 0x28,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x65, 0x29, 0x0A, 0x0A,
+	0x54, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x6E, 0x20,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x65, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+	0x63, 0x61, 0x75, 0x67, 0x68, 0x74, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20, 0x62,
+	0x79, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF, 0x0D, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E, 0x65, 0x61,
+	0x67, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x64, 0x65,
+	0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x67,
+	0x65, 0xDA, 0x05, 0xCE, 0xAE, 0x02, 0x28, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x67, 0x65,
+	0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C,
+	0x20, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+	0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+	0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x77, 0x68, 0x65,
+	0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x6F, 0x72,
+	0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x61, 0x6E, 0x20, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x74,
+	0x6F, 0x72, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20,
+	0x55, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x69, 0x6E, 0x67, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x63, 0x61, 0x6E, 0x20, 0x73, 0x65, 0x65, 0x20, 0x77, 0x68,
+	0x69, 0x63, 0x68, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x72, 0x61, 0x69, 0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x2E, 0x20, 0x54,
+	0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+	0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6D, 0x6F,
+	0x73, 0x74, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x20, 0x70,
+	0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x73, 0x2E, 0xCF, 0x06,
+	0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74, 0xD4, 0x02, 0xD3, 0x02,
+	0xDA, 0x05, 0xCE, 0x3D, 0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F,
+	0x74, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x65, 0x78, 0x70, 0x2D, 0x31, 0x20, 0x65, 0x78,
+	0x70, 0x2D, 0x32, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x53, 0x68,
+	0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x6F, 0x74,
+	0x20, 0x2E, 0x2E, 0x2E, 0x20, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xE4, 0x57, 0xCD, 0xBE, 0x59,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC0, 0x09, 0x04, 0x03,
+	0x01, 0x05, 0xCE, 0x06, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74,
+	0xDA, 0x10, 0xDA, 0x5E, 0x26, 0x03, 0x00, 0x00, 0x2D, 0x03,
+	0x00, 0x02, 0x2B, 0x01, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x05, 0x82, 0x59, 0x3A, 0xCF,
+	0x07, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x75, 0x28, 0x66, 0x6C, 0x61,
+	0x74, 0x74, 0x65, 0x6E, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+	0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+	0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x29, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72, 0x61,
+	0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66, 0x20,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xD2, 0x93, 0x04, 0xCD, 0x84, 0x96, 0x04, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x01, 0x04, 0xCE,
+	0x07, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0xDA, 0x10,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x08, 0x02, 0x04, 0x1C,
+	0xCE, 0x0C, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x2D,
+	0x69, 0x6E, 0x74, 0x6F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x55,
+	0xDA, 0x58, 0xDA, 0xFE, 0x01, 0x28, 0x02, 0x00, 0x00, 0x37,
+	0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00,
+	0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x16, 0x00, 0x33,
+	0x05, 0x01, 0x03, 0x17, 0x06, 0x05, 0x00, 0x2B, 0x05, 0x00,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x26,
+	0x07, 0x01, 0x00, 0x48, 0x07, 0x05, 0x07, 0x1A, 0x07, 0x03,
+	0x00, 0x23, 0x07, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x26,
+	0x07, 0x02, 0x00, 0x48, 0x07, 0x05, 0x07, 0x1A, 0x07, 0x04,
+	0x00, 0x2C, 0x00, 0x06, 0x00, 0x2F, 0x05, 0x02, 0x00, 0x18,
+	0x04, 0x00, 0x00, 0x2C, 0x00, 0x06, 0x00, 0x26, 0x07, 0x03,
+	0x00, 0x2F, 0x05, 0x07, 0x00, 0x49, 0x03, 0x04, 0x01, 0x18,
+	0xEC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x25, 0x01, 0xC4,
+	0x8F, 0x04, 0x88, 0x04, 0x07, 0xC0, 0x02, 0xCF, 0x02, 0x0A,
+	0x32, 0xA1, 0x01, 0x01, 0x07, 0x76, 0x02, 0x2E, 0x63, 0x01,
+	0x2D, 0x64, 0x03, 0x66, 0x67, 0x02, 0x8F, 0x01, 0x94, 0x01,
+	0x01, 0xBF, 0x02, 0xD0, 0x02, 0x38, 0x01, 0x00, 0x00, 0x2C,
+	0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0x05, 0x04, 0xDA, 0x95, 0x04, 0x28, 0xCF, 0x10, 0x75,
+	0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x2D, 0x6D,
+	0x61, 0x70, 0x70, 0x65, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x10, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+	0x2D, 0x6D, 0x61, 0x70, 0x70, 0x65, 0x64, 0xDA, 0x05, 0xCE,
+	0x8B, 0x03, 0x28, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68,
+	0x61, 0x6C, 0x2D, 0x6D, 0x61, 0x70, 0x70, 0x65, 0x64, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x5B, 0x2C, 0x6C, 0x6F, 0x6F,
+	0x6B, 0x75, 0x70, 0x5D, 0x29, 0x0A, 0x0A, 0x55, 0x6E, 0x6D,
+	0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x61, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x61, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x72, 0x65, 0x61,
+	0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6E,
+	0x74, 0x6F, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+	0x66, 0x69, 0x72, 0x73, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6D,
+	0x61, 0x70, 0x70, 0x65, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64,
+	0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x63,
+	0x6F, 0x64, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x73, 0x20,
+	0x6C, 0x65, 0x66, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20,
+	0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x79,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x73,
+	0x6F, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+	0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x69,
+	0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65,
+	0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x75, 0x63,
+	0x68, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x75,
+	0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x65,
+	0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0xCF, 0x0A, 0x65,
+	0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0xD3,
+	0x02, 0xDA, 0x03, 0xDA, 0x14, 0xDA, 0x05, 0xCE, 0xC0, 0x01,
+	0x28, 0x65, 0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75,
+	0x70, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+	0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6F,
+	0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x6B,
+	0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68,
+	0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x54, 0x6F,
+	0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+	0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x6C, 0x6F,
+	0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73,
+	0x77, 0x61, 0x70, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2E, 0xCF, 0x0B, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65,
+	0x6E, 0x63, 0x69, 0x65, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x56, 0x28, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65,
+	0x6E, 0x63, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x29,
+	0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+	0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x65,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFA, 0x83, 0x04, 0xCD,
+	0xA0, 0x87, 0x04, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x06, 0x01, 0x00, 0x11, 0xCE, 0x0B, 0x66, 0x72, 0x65,
+	0x71, 0x75, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0xDA, 0x10,
+	0x3C, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04, 0x02, 0x03,
+	0x1A, 0x04, 0x0B, 0x00, 0x33, 0x04, 0x00, 0x02, 0x17, 0x05,
+	0x04, 0x00, 0x33, 0x04, 0x01, 0x05, 0x1A, 0x04, 0x03, 0x00,
+	0x05, 0x04, 0x04, 0x01, 0x18, 0x02, 0x00, 0x00, 0x25, 0x04,
+	0x01, 0x00, 0x34, 0x01, 0x05, 0x04, 0x49, 0x02, 0x03, 0x01,
+	0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x21, 0x01,
+	0xC2, 0x85, 0x04, 0x1C, 0x07, 0x24, 0x8C, 0x01, 0x01, 0x42,
+	0x8F, 0x01, 0x01, 0x44, 0x06, 0x01, 0x0C, 0x11, 0x02, 0x0B,
+	0x12, 0x01, 0x1D, 0x20, 0x02, 0x67, 0x6A, 0x01, 0xEB, 0x01,
+	0xFE, 0x01, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63,
+	0x6F, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61,
+	0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0xDA, 0x05, 0xCE, 0x26,
+	0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x73, 0x69,
+	0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x04,
+	0x6E, 0x69, 0x6C, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x1C, 0x28, 0x6E, 0x69, 0x6C, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF8, 0x39, 0xCD,
+	0xD2, 0x3A, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x02, 0x01, 0x00, 0x03, 0xCE, 0x04, 0x6E, 0x69, 0x6C, 0x3F,
+	0xDA, 0x10, 0x22, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x03, 0xC0, 0x3A, 0x10, 0xCF,
+	0x09, 0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6F, 0x73, 0x2F, 0x73,
+	0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x05, 0xCE, 0x38, 0x28,
+	0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x20,
+	0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+	0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69,
+	0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x13, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65,
+	0x2D, 0x70, 0x61, 0x74, 0x68, 0x73, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x18, 0x53, 0x65, 0x65, 0x20, 0x64, 0x6F,
+	0x63, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF4, 0xEF, 0x05, 0xCD, 0xDC,
+	0xF2, 0x05, 0xDA, 0x03, 0xDA, 0xE9, 0x07, 0xCF, 0x0E, 0x70,
+	0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x70, 0x72, 0x6F, 0x64,
+	0x75, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xA8, 0x03,
+	0xDA, 0x05, 0xCE, 0xA0, 0x01, 0x28, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65,
+	0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A,
+	0x44, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75,
+	0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69,
+	0x66, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x71, 0x75, 0x65, 0x75, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68,
+	0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x2E, 0xCF, 0x09, 0x6D, 0x61, 0x78,
+	0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x65, 0x28, 0x6D, 0x61, 0x78, 0x2D, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69,
+	0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+	0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61,
+	0x6C, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F,
+	0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xF0, 0xBE, 0x02, 0xCD, 0xFE, 0xC0, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x09, 0x02, 0x00, 0x02,
+	0x04, 0xCE, 0x09, 0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0xDA, 0x10, 0xD7, 0xCD, 0xA8, 0x80, 0xC8, 0x20,
+	0x06, 0x00, 0x00, 0x10, 0xCE, 0x06, 0x6F, 0x72, 0x64, 0x65,
+	0x72, 0x3E, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+	0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x1B, 0x02, 0x03, 0x04,
+	0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+	0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+	0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x8F, 0x02, 0x26,
+	0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x30, 0x01, 0x00, 0x00, 0x05, 0x04, 0xD4, 0xC0, 0x02,
+	0x28, 0xCF, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6, 0x01,
+	0xCB, 0xDA, 0x05, 0xCE, 0x8B, 0x01, 0x28, 0x6C, 0x6F, 0x61,
+	0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x29, 0x0A, 0x0A, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6D, 0x61,
+	0x67, 0x65, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20,
+	0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6C, 0x6F, 0x61, 0x64,
+	0x65, 0x64, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x64, 0x61, 0x74, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xB6, 0xAE, 0x06, 0xCD, 0xD8, 0xB6, 0x06, 0xDA,
+	0x03, 0xDA, 0xE2, 0x07, 0xCF, 0x0A, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E,
+	0x65, 0x77, 0xDA, 0x05, 0xCE, 0x6F, 0x28, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63, 0x61,
+	0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43,
+	0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x77, 0x2C, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x6D,
+	0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x03, 0x61,
+	0x6E, 0x64, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x70,
+	0x28, 0x61, 0x6E, 0x64, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67,
+	0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x66, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+	0x65, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+	0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xEE, 0x82, 0x01, 0xCD, 0xF8, 0x87, 0x01, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x05, 0x00, 0x02,
+	0x12, 0xCE, 0x03, 0x61, 0x6E, 0x64, 0xDA, 0x10, 0xDA, 0x5E,
+	0xDA, 0x5D, 0x23, 0x01, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00,
+	0x25, 0x03, 0x00, 0x00, 0x45, 0x03, 0x02, 0x03, 0x1A, 0x03,
+	0x0D, 0x00, 0x05, 0x02, 0x02, 0xFF, 0x23, 0x03, 0x00, 0x00,
+	0x48, 0x03, 0x01, 0x03, 0x1A, 0x03, 0x03, 0x00, 0x4A, 0x01,
+	0x00, 0x02, 0x18, 0xF8, 0xFF, 0xFF, 0x4A, 0x03, 0x00, 0x02,
+	0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x03, 0x01, 0x26, 0x04,
+	0x01, 0x00, 0x2F, 0x01, 0x04, 0x00, 0x18, 0xF2, 0xFF, 0xFF,
+	0x03, 0x01, 0x00, 0x00, 0x34, 0x01, 0xF4, 0x84, 0x01, 0x1A,
+	0x01, 0x34, 0x00, 0x02, 0x4E, 0x0D, 0x01, 0x0D, 0xF6, 0x01,
+	0x01, 0x26, 0xF7, 0x01, 0x02, 0x30, 0x0C, 0x01, 0x07, 0x9A,
+	0x01, 0x01, 0x3E, 0x97, 0x01, 0x01, 0x3D, 0x98, 0x01, 0x01,
+	0x8C, 0x01, 0x97, 0x01, 0x04, 0x15, 0x20, 0x01, 0xC3, 0x01,
+	0xCA, 0x01, 0x01, 0xF9, 0x02, 0x88, 0x03, 0xCF, 0x09, 0x64,
+	0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x96, 0x01, 0x28, 0x64, 0x65,
+	0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78, 0x20,
+	0x79, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x6E,
+	0x6F, 0x74, 0x3D, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6D,
+	0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x79, 0x70,
+	0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+	0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x29, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65,
+	0x72, 0x65, 0x64, 0x20, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+	0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68,
+	0x61, 0x76, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69,
+	0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x75, 0x72, 0x65, 0x2E, 0x20, 0x4D, 0x75, 0x63, 0x68, 0x20,
+	0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+	0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x3D, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xAA, 0x88, 0x05, 0xCD, 0x90, 0x91,
+	0x05, 0xDA, 0x03, 0xDA, 0xE6, 0x04, 0xCF, 0x0F, 0x6D, 0x61,
+	0x74, 0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61, 0x6E,
+	0x64, 0x6F, 0x6D, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61,
+	0x6E, 0x64, 0x6F, 0x6D, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61,
+	0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29,
+	0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x65, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x67, 0x65, 0x6E,
+	0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x20, 0x27, 0x73,
+	0x65, 0x65, 0x64, 0x27, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C,
+	0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x6E,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF,
+	0x0F, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x2F, 0x76,
+	0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0xD3, 0x02, 0xDA, 0x03,
+	0x03, 0xDA, 0x05, 0xCE, 0x2D, 0x54, 0x68, 0x65, 0x20, 0x76,
+	0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+	0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x62,
+	0x79, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x2E,
+	0xCF, 0x0A, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74,
+	0x69, 0x6C, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x9F,
+	0x01, 0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74,
+	0x69, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+	0x64, 0x29, 0x0A, 0x0A, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E,
+	0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x61,
+	0x74, 0x69, 0x73, 0x66, 0x79, 0x20, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x62, 0x6F, 0x72,
+	0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xDA, 0x8B, 0x03,
+	0xCD, 0xC6, 0x8F, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x03, 0x02, 0x02, 0x09, 0xCE, 0x0A, 0x74, 0x61,
+	0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0xDA, 0x10,
+	0xDA, 0x86, 0x04, 0xDA, 0x87, 0x01, 0x2C, 0x00, 0x01, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1A, 0x00,
+	0x05, 0x00, 0x25, 0x02, 0x00, 0x00, 0x2D, 0x01, 0x02, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0x03, 0x01,
+	0x00, 0x00, 0x0E, 0x03, 0xC4, 0x8E, 0x03, 0x28, 0x01, 0x32,
+	0x26, 0x04, 0x14, 0x25, 0x01, 0x13, 0x26, 0xCF, 0x05, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0xDA, 0x05, 0xCE, 0x4F, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x26, 0x20, 0x69, 0x74,
+	0x65, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69,
+	0x74, 0x65, 0x6D, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x07,
+	0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65,
+	0xDA, 0x05, 0xCE, 0x80, 0x01, 0x28, 0x6F, 0x73, 0x2F, 0x74,
+	0x69, 0x6D, 0x65, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+	0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x65, 0x78, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+	0x73, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x4A, 0x61,
+	0x6E, 0x75, 0x61, 0x72, 0x79, 0x20, 0x31, 0x2C, 0x20, 0x31,
+	0x39, 0x37, 0x30, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55,
+	0x6E, 0x69, 0x78, 0x20, 0x65, 0x70, 0x6F, 0x63, 0x68, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x2E, 0xCF, 0x08, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x27, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F,
+	0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E,
+	0x65, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xC0, 0x11, 0xCD, 0xF2, 0x12, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xC8, 0x29, 0x03, 0x01, 0x02, 0x05, 0xCE, 0x08, 0x64,
+	0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0xDA, 0x10, 0xDA,
+	0x27, 0xDA, 0xBE, 0x02, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x00,
+	0x02, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+	0x30, 0x02, 0x00, 0x00, 0x04, 0x05, 0xB8, 0x12, 0x38, 0xCF,
+	0x0A, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x6E, 0x65,
+	0x77, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xA4, 0x03, 0xDA, 0x05,
+	0xCE, 0x91, 0x01, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x6E, 0x65, 0x77, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x77, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+	0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x20, 0x50, 0x61,
+	0x72, 0x73, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x68,
+	0x69, 0x6E, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x63, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
+	0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
+	0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
+	0x20, 0x6F, 0x66, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0xCF, 0x0C,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B,
+	0x75, 0x70, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6, 0x01, 0xCB,
+	0xDA, 0x05, 0xCE, 0x9E, 0x01, 0x28, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x65,
+	0x6E, 0x76, 0x20, 0x64, 0x65, 0x70, 0x73, 0x29, 0x0A, 0x0A,
+	0x46, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x6C, 0x6F,
+	0x6F, 0x6B, 0x75, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x2E, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+	0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+	0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72,
+	0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73,
+	0x20, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+	0x65, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xEA, 0x95, 0x06, 0xCD, 0xC8, 0xA0, 0x06, 0xDA, 0x03, 0xDA,
+	0xE1, 0x07, 0xCF, 0x06, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72,
+	0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x95, 0x03, 0xDA, 0x05, 0xCE,
+	0x18, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64,
+	0x61, 0x72, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x02, 0x3C, 0x3D, 0xD3,
+	0x02, 0xDA, 0x03, 0xD7, 0xCD, 0xBA, 0x80, 0xC8, 0x20, 0x06,
+	0x00, 0x00, 0x10, 0xCE, 0x02, 0x3C, 0x3D, 0x17, 0x01, 0x00,
+	0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B,
+	0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00,
+	0x05, 0x3F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05,
+	0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05,
+	0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03,
+	0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+	0x00, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x3C, 0x3D, 0x20, 0x26,
+	0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69,
+	0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6E, 0x6F, 0x6E, 0x2D,
+	0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+	0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0C, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x72, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0xDA, 0x05,
+	0xCE, 0xE3, 0x01, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x65, 0x61,
+	0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20,
+	0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0x20, 0x43, 0x61, 0x6E,
+	0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+	0x6F, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x69,
+	0x66, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x75,
+	0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x44, 0x6F,
+	0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x73,
+	0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6E,
+	0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x75,
+	0x6D, 0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72,
+	0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65,
+	0x67, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E,
+	0x67, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2C, 0x20,
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x77, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E,
+	0xCF, 0x07, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x43, 0x28, 0x70, 0x72,
+	0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x78, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74,
+	0x20, 0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+	0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x31, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xEC, 0x97, 0x02, 0xCD, 0xFA, 0x99, 0x02, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x05, 0x01, 0x00, 0x0B,
+	0xCE, 0x07, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0xDA,
+	0x10, 0x25, 0x01, 0x01, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17,
+	0x03, 0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04, 0x02,
+	0x03, 0x1A, 0x04, 0x05, 0x00, 0x33, 0x04, 0x00, 0x02, 0x09,
+	0x01, 0x01, 0x04, 0x49, 0x02, 0x03, 0x01, 0x18, 0xFD, 0xFF,
+	0xFF, 0x03, 0x01, 0x00, 0x00, 0x13, 0x01, 0x8E, 0x99, 0x02,
+	0x18, 0x06, 0x20, 0x22, 0x01, 0x22, 0x23, 0x02, 0x21, 0x24,
+	0x01, 0xC1, 0x01, 0xD4, 0x01, 0xCF, 0x05, 0x61, 0x70, 0x70,
+	0x6C, 0x79, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xD6, 0x05, 0xDA,
+	0x05, 0xCE, 0xDD, 0x02, 0x28, 0x61, 0x70, 0x70, 0x6C, 0x79,
+	0x20, 0x66, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+	0x0A, 0x0A, 0x41, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x73, 0x20,
+	0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 0x69,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20,
+	0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x66, 0x2C, 0x20, 0x65, 0x78, 0x63, 0x65,
+	0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x2C, 0x20, 0x77,
+	0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x65, 0x78,
+	0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2D, 0x6C, 0x69, 0x6B, 0x65, 0x2E, 0x20, 0x45, 0x61,
+	0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6C,
+	0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+	0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E,
+	0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x70, 0x75, 0x73, 0x68,
+	0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F,
+	0x20, 0x66, 0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78,
+	0x61, 0x6D, 0x70, 0x6C, 0x65, 0x3A, 0x0A, 0x0A, 0x09, 0x28,
+	0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x2B, 0x20, 0x31, 0x30,
+	0x30, 0x30, 0x20, 0x28, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+	0x31, 0x30, 0x29, 0x29, 0x0A, 0x0A, 0x73, 0x75, 0x6D, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x31, 0x30, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x30, 0x30,
+	0x30, 0x2E, 0x29, 0xCF, 0x0B, 0x72, 0x75, 0x6E, 0x2D, 0x63,
+	0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x8E, 0x06, 0x28, 0x72, 0x75, 0x6E, 0x2D,
+	0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6F, 0x70,
+	0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x61,
+	0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x20,
+	0x54, 0x68, 0x69, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61,
+	0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+	0x65, 0x6E, 0x74, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x61, 0x70, 0x73, 0x75,
+	0x6C, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x75, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x6F,
+	0x70, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C,
+	0x6F, 0x77, 0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x20, 0x20, 0x3A,
+	0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x2D, 0x20, 0x63,
+	0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F,
+	0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+	0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65,
+	0x0A, 0x09, 0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B,
+	0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x69, 0x6E, 0x67, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20,
+	0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x65, 0x6E, 0x76,
+	0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+	0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20,
+	0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x2D, 0x20,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x0A, 0x09, 0x20, 0x20,
+	0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x2D, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x65, 0x74, 0x74,
+	0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20,
+	0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x22, 0x3C, 0x61, 0x6E, 0x6F, 0x6E, 0x79,
+	0x6D, 0x6F, 0x75, 0x73, 0x3E, 0x22, 0x0A, 0x09, 0x20, 0x20,
+	0x3A, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20,
+	0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77,
+	0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x61, 0x69, 0x6C,
+	0x73, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x62, 0x61, 0x64, 0x2D, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x20, 0x20,
+	0x3A, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63,
+	0x6B, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x76,
+	0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x64, 0x20, 0x2D, 0x20,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+	0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x0A, 0x09, 0x20,
+	0x20, 0x3A, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x2D, 0x20,
+	0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x75,
+	0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69,
+	0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x6F,
+	0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D,
+	0x62, 0x61, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x63, 0x61, 0x6C,
+	0x6C, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x6F, 0x6E, 0x2D, 0x73,
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x63, 0x65,
+	0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x2D,
+	0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xBC, 0xA9, 0x05, 0xCD, 0x84, 0xD9,
+	0x05, 0xDA, 0x03, 0xDA, 0xB7, 0x03, 0xCF, 0x0A, 0x63, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x27, 0x28, 0x63, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x61, 0x20, 0x63, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0x88, 0x2A, 0xCD, 0x94, 0x2B, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x02, 0x06, 0xCE,
+	0x0A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0xFB, 0x04, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x26, 0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x00,
+	0x00, 0x00, 0x07, 0x03, 0xEC, 0x2A, 0x0E, 0x03, 0x05, 0x1E,
+	0xCF, 0x0C, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x61, 0x70,
+	0x70, 0x65, 0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x61, 0x70, 0x70, 0x65,
+	0x6E, 0x64, 0xDA, 0x05, 0xCE, 0x6D, 0x28, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2F, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20,
+	0x74, 0x75, 0x70, 0x20, 0x26, 0x20, 0x69, 0x74, 0x65, 0x6D,
+	0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75,
+	0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x70, 0x70, 0x65,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69,
+	0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x74, 0x6F,
+	0x20, 0x74, 0x75, 0x70, 0x2E, 0xCF, 0x07, 0x63, 0x6F, 0x6D,
+	0x6D, 0x65, 0x6E, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x2B, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74,
+	0x29, 0x0A, 0x0A, 0x49, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20,
+	0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+	0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xE8, 0x56, 0xCD, 0xDE, 0x57,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x01, 0x00,
+	0x00, 0x01, 0xCE, 0x07, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E,
+	0x74, 0xDA, 0x10, 0x04, 0x00, 0x00, 0x00, 0x04, 0x01, 0xE8,
+	0x56, 0x76, 0xCF, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C,
+	0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0xAE, 0x80, 0xC8,
+	0x20, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x07, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0x3C, 0x3D, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02,
+	0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00,
+	0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x1B, 0x02,
+	0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01,
+	0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+	0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+	0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05,
+	0xCE, 0x6C, 0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0x3D,
+	0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x63,
+	0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x63,
+	0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E,
+	0xCF, 0x02, 0x3D, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+	0xBC, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x02,
+	0x3D, 0x3D, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+	0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x42, 0x02, 0x03, 0x04,
+	0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+	0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+	0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x59,
+	0x28, 0x3D, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x28,
+	0x34, 0x2E, 0x30, 0x20, 0x3D, 0x3D, 0x20, 0x34, 0x29, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF,
+	0x0C, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72,
+	0x65, 0x61, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61,
+	0x6B, 0xDA, 0x05, 0xCE, 0xD3, 0x01, 0x28, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20,
+	0x66, 0x75, 0x6E, 0x20, 0x5B, 0x2C, 0x70, 0x63, 0x3D, 0x30,
+	0x5D, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x61, 0x20,
+	0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+	0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x2E, 0x20, 0x70, 0x63, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E,
+	0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20,
+	0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x77, 0x68,
+	0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69,
+	0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x73, 0x2E, 0x20, 0x66, 0x75, 0x6E, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x57, 0x69,
+	0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61,
+	0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C,
+	0x61, 0x72, 0x67, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x65,
+	0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2E, 0xCF, 0x0A, 0x6F,
+	0x73, 0x2F, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x6F, 0x73, 0x2F, 0x65, 0x78,
+	0x65, 0x63, 0x75, 0x74, 0x65, 0xDA, 0x05, 0xCE, 0x82, 0x01,
+	0x28, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20,
+	0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x45,
+	0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x70,
+	0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x6F, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20,
+	0x69, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x73, 0x74,
+	0x61, 0x74, 0x75, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2E,
+	0xCF, 0x04, 0x73, 0x6F, 0x72, 0x74, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x53, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x20,
+	0x78, 0x73, 0x20, 0x5B, 0x2C, 0x20, 0x62, 0x79, 0x5D, 0x29,
+	0x0A, 0x0A, 0x53, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x6E, 0x2D, 0x70,
+	0x6C, 0x61, 0x63, 0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x73,
+	0x20, 0x71, 0x75, 0x69, 0x63, 0x6B, 0x2D, 0x73, 0x6F, 0x72,
+	0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xF6, 0xC6, 0x02, 0xCD, 0xF8, 0xD1,
+	0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC0, 0x0D, 0x04,
+	0x02, 0x01, 0x0C, 0x01, 0xCE, 0x04, 0x73, 0x6F, 0x72, 0x74,
+	0xDA, 0x10, 0xDA, 0xA3, 0x06, 0x37, 0x02, 0x00, 0x00, 0x05,
+	0x03, 0x02, 0xFF, 0x1A, 0x01, 0x03, 0x00, 0x17, 0x02, 0x01,
+	0x00, 0x18, 0x03, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x17,
+	0x02, 0x01, 0x00, 0x25, 0x01, 0x00, 0x00, 0x2D, 0x00, 0x01,
+	0x03, 0x2B, 0x02, 0x00, 0x00, 0x27, 0x01, 0x00, 0x02, 0x30,
+	0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0E, 0x01,
+	0xBA, 0xD1, 0x02, 0x12, 0x01, 0x05, 0x0C, 0x05, 0x22, 0x03,
+	0x05, 0x3F, 0x42, 0x00, 0x05, 0xDA, 0xCF, 0x09, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x08, 0x04, 0x00, 0x13, 0xCE, 0x09,
+	0x70, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0xDA,
+	0x10, 0x33, 0x04, 0x00, 0x02, 0x17, 0x05, 0x01, 0x00, 0x43,
+	0x06, 0x05, 0x02, 0x1A, 0x06, 0x0C, 0x00, 0x33, 0x06, 0x00,
+	0x05, 0x17, 0x07, 0x06, 0x00, 0x2C, 0x07, 0x04, 0x00, 0x2F,
+	0x06, 0x03, 0x00, 0x1A, 0x06, 0x05, 0x00, 0x33, 0x06, 0x00,
+	0x01, 0x34, 0x00, 0x01, 0x07, 0x34, 0x00, 0x05, 0x06, 0x05,
+	0x01, 0x01, 0x01, 0x49, 0x05, 0x02, 0x01, 0x18, 0xF6, 0xFF,
+	0xFF, 0x33, 0x05, 0x00, 0x01, 0x34, 0x00, 0x02, 0x05, 0x34,
+	0x00, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x39, 0x01, 0xBC,
+	0xC9, 0x02, 0x12, 0x03, 0x46, 0xCE, 0x02, 0x01, 0x52, 0xCF,
+	0x02, 0x01, 0x0F, 0x12, 0x02, 0x42, 0x09, 0x01, 0x0B, 0xCE,
+	0x01, 0x01, 0x4C, 0xD5, 0x01, 0x01, 0x2A, 0x0A, 0x01, 0x32,
+	0x00, 0x01, 0x32, 0x0F, 0x02, 0xD1, 0x02, 0xD6, 0x02, 0x01,
+	0x88, 0x03, 0xCF, 0x02, 0x01, 0x17, 0x1A, 0x01, 0x3A, 0x09,
+	0x01, 0xD7, 0x04, 0xEA, 0x04, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x0D, 0x07, 0x04, 0x00, 0x12, 0x01, 0xCE, 0x09, 0x73, 0x6F,
+	0x72, 0x74, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0xDA, 0x10, 0x28,
+	0x04, 0x00, 0x00, 0x45, 0x05, 0x02, 0x01, 0x1A, 0x05, 0x0F,
+	0x00, 0x2D, 0x00, 0x01, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x27,
+	0x06, 0x00, 0x01, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05,
+	0x00, 0x05, 0x05, 0x06, 0xFF, 0x2D, 0x00, 0x01, 0x05, 0x2B,
+	0x03, 0x00, 0x00, 0x2F, 0x01, 0x04, 0x00, 0x05, 0x05, 0x06,
+	0x01, 0x2D, 0x00, 0x05, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x2F,
+	0x01, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x29, 0x01, 0xEC, 0xCD,
+	0x02, 0xEC, 0x02, 0x01, 0x5E, 0xDB, 0x02, 0x01, 0x0B, 0xF8,
+	0x01, 0x04, 0x42, 0xDD, 0x01, 0x01, 0x11, 0x14, 0x01, 0x72,
+	0x2D, 0x03, 0x1F, 0x28, 0x01, 0x66, 0x27, 0x03, 0x19, 0x28,
+	0x01, 0xCD, 0x01, 0xD0, 0x01, 0x01, 0x51, 0x64, 0xDB, 0x00,
+	0xDA, 0xCF, 0x09, 0xDA, 0x03, 0xCF, 0x0A, 0x74, 0x61, 0x6B,
+	0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x42, 0x28, 0x74, 0x61, 0x6B, 0x65,
+	0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x53, 0x61,
+	0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x74, 0x61, 0x6B,
+	0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x28, 0x63,
+	0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x29, 0x20, 0x69, 0x6E, 0x64, 0x29,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xCC, 0x8F,
+	0x03, 0xCD, 0xB0, 0x91, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xE0, 0x09, 0x03, 0x02, 0x03, 0x0C, 0xCE, 0x0A, 0x74,
+	0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA,
+	0x10, 0xDA, 0xBF, 0x05, 0xDA, 0x86, 0x04, 0xDA, 0x87, 0x01,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00,
+	0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x01, 0x00,
+	0x2F, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x05, 0x00, 0x25, 0x02,
+	0x00, 0x00, 0x2D, 0x01, 0x02, 0x00, 0x26, 0x02, 0x02, 0x00,
+	0x30, 0x02, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x08, 0x03,
+	0x84, 0x91, 0x03, 0x20, 0x09, 0x17, 0x22, 0xCF, 0x0E, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x71, 0x75,
+	0x6F, 0x74, 0x61, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x71, 0x75,
+	0x6F, 0x74, 0x61, 0xDA, 0x05, 0xCE, 0x96, 0x03, 0x28, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x71, 0x75,
+	0x6F, 0x74, 0x61, 0x20, 0x66, 0x69, 0x62, 0x20, 0x6D, 0x65,
+	0x6D, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x69, 0x63, 0x6B, 0x73,
+	0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6D,
+	0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x6F,
+	0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20,
+	0x62, 0x61, 0x63, 0x6B, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20,
+	0x72, 0x75, 0x6E, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65,
+	0x76, 0x65, 0x72, 0x79, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65,
+	0x73, 0x2C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E,
+	0x20, 0x41, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x67, 0x6F, 0x65, 0x73, 0x20, 0x6F,
+	0x76, 0x65, 0x72, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72,
+	0x20, 0x71, 0x75, 0x6F, 0x74, 0x61, 0x20, 0x72, 0x61, 0x69,
+	0x73, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74,
+	0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65,
+	0x63, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x2C, 0x20, 0x73, 0x6F, 0x20, 0x75, 0x6E, 0x74, 0x72, 0x75,
+	0x73, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+	0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6E,
+	0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x61, 0x6E, 0x64,
+	0x62, 0x6F, 0x78, 0x2E, 0x20, 0x41, 0x20, 0x71, 0x75, 0x6F,
+	0x74, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x6D, 0x65,
+	0x61, 0x6E, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x6C, 0x69, 0x6D,
+	0x69, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75,
+	0x6F, 0x74, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x72,
+	0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20,
+	0x62, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x66, 0x69, 0x62, 0x2E, 0xCF, 0x05, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x83, 0x05,
+	0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x78, 0x20, 0x26,
+	0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x50,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74,
+	0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x4D, 0x61, 0x74,
+	0x63, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x78, 0x20, 0x61,
+	0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x20, 0x61, 0x6E,
+	0x79, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+	0x66, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x2E, 0x20, 0x45,
+	0x61, 0x73, 0x79, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x2C, 0x20,
+	0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x20, 0x20,
+	0x62, 0x79, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x74,
+	0x6F, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x63, 0x61, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6D, 0x61,
+	0x74, 0x63, 0x68, 0x65, 0x64, 0x2E, 0x20, 0x41, 0x20, 0x70,
+	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x20, 0x61, 0x20, 0x73, 0x79,
+	0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x79, 0x74,
+	0x68, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x78, 0x27, 0x73, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x20,
+	0x41, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x69, 0x66, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x27, 0x73,
+	0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+	0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x20, 0x78, 0x2E, 0x20,
+	0x41, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69,
+	0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F,
+	0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x78, 0x2E, 0x20, 0x41, 0x20, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74,
+	0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x27, 0x73,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E,
+	0x67, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x70, 0x72, 0x65,
+	0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x2E, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x6F, 0x74, 0x68, 0x65,
+	0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61,
+	0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x20, 0x6D, 0x61, 0x74,
+	0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F,
+	0x20, 0x78, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xC4, 0xB2, 0x04, 0xCD, 0xFA, 0xC2, 0x04,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x0A, 0x01,
+	0x07, 0x26, 0x01, 0xCE, 0x05, 0x6D, 0x61, 0x74, 0x63, 0x68,
+	0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x59, 0xDA, 0x5A, 0xDA, 0x5B,
+	0xDA, 0x5C, 0xDA, 0x5D, 0xDA, 0x5F, 0x28, 0x02, 0x00, 0x00,
+	0x17, 0x03, 0x00, 0x00, 0x17, 0x05, 0x03, 0x00, 0x2B, 0x05,
+	0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00,
+	0x26, 0x06, 0x01, 0x00, 0x33, 0x05, 0x06, 0x05, 0x2B, 0x05,
+	0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2F, 0x07, 0x05, 0x00,
+	0x1A, 0x07, 0x03, 0x00, 0x17, 0x04, 0x03, 0x00, 0x18, 0x04,
+	0x00, 0x00, 0x26, 0x06, 0x03, 0x00, 0x2F, 0x05, 0x06, 0x00,
+	0x17, 0x04, 0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x37, 0x04,
+	0x01, 0x00, 0x17, 0x06, 0x04, 0x00, 0x05, 0x04, 0x04, 0xFF,
+	0x17, 0x07, 0x04, 0x00, 0x2A, 0x07, 0x00, 0x00, 0x25, 0x08,
+	0x00, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x2F, 0x08, 0x07, 0x00,
+	0x17, 0x06, 0x08, 0x00, 0x48, 0x07, 0x03, 0x05, 0x1A, 0x07,
+	0x02, 0x00, 0x03, 0x06, 0x00, 0x00, 0x26, 0x08, 0x04, 0x00,
+	0x2D, 0x08, 0x05, 0x03, 0x26, 0x09, 0x05, 0x00, 0x2F, 0x08,
+	0x09, 0x00, 0x26, 0x09, 0x06, 0x00, 0x2D, 0x09, 0x08, 0x06,
+	0x26, 0x09, 0x05, 0x00, 0x30, 0x09, 0x00, 0x00, 0xCD, 0x80,
+	0x80, 0xF0, 0x0F, 0x0A, 0x01, 0x06, 0x27, 0x01, 0x01, 0xDA,
+	0x54, 0xDA, 0x10, 0xDA, 0x5B, 0xD7, 0xCD, 0x80, 0x80, 0xF0,
+	0x0B, 0x13, 0x04, 0x11, 0xA5, 0x01, 0x03, 0xCE, 0x07, 0x6D,
+	0x61, 0x74, 0x63, 0x68, 0x2D, 0x31, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0x1F, 0xDA, 0x97, 0x02, 0xDA, 0x5E, 0xD2, 0x02, 0xDA,
+	0xA2, 0x04, 0xCF, 0x07, 0x5F, 0x30, 0x30, 0x30, 0x30, 0x31,
+	0x78, 0xDA, 0x5C, 0xDA, 0x58, 0xDA, 0x55, 0xDA, 0x59, 0xDA,
+	0x5A, 0xDA, 0x5B, 0xCF, 0x08, 0x69, 0x6E, 0x64, 0x65, 0x78,
+	0x65, 0x64, 0x3F, 0xDA, 0x5D, 0xDA, 0x5F, 0xDA, 0x57, 0xDA,
+	0x56, 0xCF, 0x0B, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x61, 0x72, 0x79, 0x3F, 0x28, 0x04, 0x00, 0x00, 0x17, 0x05,
+	0x00, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x26, 0x06, 0x01, 0x00, 0x1F, 0x05,
+	0x05, 0x06, 0x17, 0x07, 0x05, 0x00, 0x1A, 0x07, 0x1D, 0x00,
+	0x33, 0x05, 0x03, 0x00, 0x1A, 0x05, 0x0B, 0x00, 0x26, 0x08,
+	0x02, 0x00, 0x2D, 0x08, 0x00, 0x01, 0x3D, 0x06, 0x00, 0x00,
+	0x2F, 0x08, 0x02, 0x00, 0x26, 0x0A, 0x03, 0x00, 0x2D, 0x0A,
+	0x06, 0x08, 0x26, 0x0A, 0x04, 0x00, 0x2B, 0x0A, 0x00, 0x00,
+	0x3D, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x23, 0x06,
+	0x00, 0x00, 0x34, 0x03, 0x00, 0x06, 0x26, 0x08, 0x05, 0x00,
+	0x2D, 0x08, 0x00, 0x01, 0x3D, 0x06, 0x00, 0x00, 0x26, 0x09,
+	0x02, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x2D, 0x09, 0x0A, 0x06,
+	0x3D, 0x08, 0x00, 0x00, 0x2F, 0x06, 0x02, 0x00, 0x26, 0x0A,
+	0x03, 0x00, 0x26, 0x0B, 0x04, 0x00, 0x2D, 0x0A, 0x08, 0x0B,
+	0x2B, 0x06, 0x00, 0x00, 0x3D, 0x09, 0x00, 0x00, 0x03, 0x09,
+	0x00, 0x00, 0x17, 0x05, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00,
+	0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x26, 0x06,
+	0x06, 0x00, 0x1F, 0x05, 0x05, 0x06, 0x17, 0x08, 0x05, 0x00,
+	0x1A, 0x08, 0x07, 0x00, 0x25, 0x06, 0x00, 0x00, 0x33, 0x05,
+	0x00, 0x06, 0x2A, 0x06, 0x00, 0x00, 0x2D, 0x05, 0x01, 0x06,
+	0x2B, 0x03, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x17, 0x05,
+	0x00, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x26, 0x06, 0x07, 0x00, 0x1F, 0x05,
+	0x05, 0x06, 0x17, 0x09, 0x05, 0x00, 0x1A, 0x09, 0x2B, 0x00,
+	0x37, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05, 0x00, 0x25, 0x05,
+	0xFF, 0xFF, 0x17, 0x0A, 0x01, 0x00, 0x17, 0x0C, 0x0A, 0x00,
+	0x2B, 0x0C, 0x00, 0x00, 0x26, 0x0C, 0x00, 0x00, 0x2F, 0x0C,
+	0x0C, 0x00, 0x26, 0x0D, 0x08, 0x00, 0x33, 0x0C, 0x0D, 0x0C,
+	0x2B, 0x0C, 0x00, 0x00, 0x26, 0x0C, 0x09, 0x00, 0x2F, 0x0E,
+	0x0C, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x17, 0x0B, 0x0A, 0x00,
+	0x18, 0x04, 0x00, 0x00, 0x26, 0x0D, 0x0A, 0x00, 0x2F, 0x0C,
+	0x0D, 0x00, 0x17, 0x0B, 0x0C, 0x00, 0x17, 0x0C, 0x0B, 0x00,
+	0x26, 0x0D, 0x0B, 0x00, 0x2C, 0x0D, 0x0C, 0x00, 0x3D, 0x0B,
+	0x00, 0x00, 0x2A, 0x0D, 0x01, 0x00, 0x2F, 0x0E, 0x0D, 0x00,
+	0x26, 0x0F, 0x03, 0x00, 0x2D, 0x0F, 0x0B, 0x0E, 0x26, 0x0F,
+	0x04, 0x00, 0x2B, 0x0F, 0x00, 0x00, 0x3D, 0x0D, 0x00, 0x00,
+	0x17, 0x0B, 0x0D, 0x00, 0x48, 0x0D, 0x0A, 0x0C, 0x1A, 0x0D,
+	0x02, 0x00, 0x03, 0x0B, 0x00, 0x00, 0x26, 0x0E, 0x05, 0x00,
+	0x2D, 0x0E, 0x0C, 0x0A, 0x26, 0x0F, 0x0C, 0x00, 0x2F, 0x0E,
+	0x0F, 0x00, 0x26, 0x0F, 0x0D, 0x00, 0x2D, 0x0F, 0x0E, 0x0B,
+	0x26, 0x0F, 0x0C, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x17, 0x0A,
+	0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x26, 0x0A, 0x00, 0x00,
+	0x2F, 0x0A, 0x0A, 0x00, 0x26, 0x0B, 0x0E, 0x00, 0x48, 0x0B,
+	0x0A, 0x0B, 0x1A, 0x0B, 0x04, 0x00, 0x23, 0x0B, 0x00, 0x00,
+	0x17, 0x0D, 0x0B, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x0B,
+	0x0F, 0x00, 0x1F, 0x0B, 0x0A, 0x0B, 0x17, 0x0D, 0x0B, 0x00,
+	0x1A, 0x0D, 0x29, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x17, 0x0B,
+	0x01, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x2B, 0x0F, 0x00, 0x00,
+	0x26, 0x0F, 0x00, 0x00, 0x2F, 0x0F, 0x0F, 0x00, 0x26, 0x10,
+	0x08, 0x00, 0x33, 0x0F, 0x10, 0x0F, 0x2B, 0x0F, 0x00, 0x00,
+	0x26, 0x0F, 0x09, 0x00, 0x2F, 0x11, 0x0F, 0x00, 0x1A, 0x11,
+	0x03, 0x00, 0x17, 0x0E, 0x0B, 0x00, 0x18, 0x04, 0x00, 0x00,
+	0x26, 0x10, 0x0A, 0x00, 0x2F, 0x0F, 0x10, 0x00, 0x17, 0x0E,
+	0x0F, 0x00, 0x17, 0x0F, 0x0E, 0x00, 0x26, 0x10, 0x10, 0x00,
+	0x2C, 0x10, 0x0F, 0x00, 0x3D, 0x0E, 0x00, 0x00, 0x2A, 0x10,
+	0x02, 0x00, 0x2F, 0x11, 0x10, 0x00, 0x26, 0x12, 0x03, 0x00,
+	0x2D, 0x12, 0x0E, 0x11, 0x26, 0x12, 0x04, 0x00, 0x2B, 0x12,
+	0x00, 0x00, 0x3D, 0x10, 0x00, 0x00, 0x17, 0x0E, 0x10, 0x00,
+	0x48, 0x10, 0x0B, 0x0F, 0x1A, 0x10, 0x02, 0x00, 0x03, 0x0E,
+	0x00, 0x00, 0x26, 0x11, 0x05, 0x00, 0x2D, 0x11, 0x0F, 0x0B,
+	0x26, 0x12, 0x0C, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x26, 0x12,
+	0x0D, 0x00, 0x2D, 0x12, 0x11, 0x0E, 0x26, 0x12, 0x0C, 0x00,
+	0x30, 0x12, 0x00, 0x00, 0x26, 0x0E, 0x02, 0x00, 0x2D, 0x0E,
+	0x00, 0x01, 0x3D, 0x0B, 0x00, 0x00, 0x2F, 0x0E, 0x02, 0x00,
+	0x26, 0x11, 0x03, 0x00, 0x2D, 0x11, 0x0B, 0x0E, 0x26, 0x11,
+	0x04, 0x00, 0x2B, 0x11, 0x00, 0x00, 0x3D, 0x10, 0x00, 0x00,
+	0x03, 0x10, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x03,
+	0x00, 0x04, 0x11, 0x01, 0xDA, 0x10, 0xDA, 0x89, 0x01, 0xDA,
+	0xD9, 0x08, 0xDA, 0x5E, 0xDA, 0xE7, 0x09, 0x27, 0x00, 0x00,
+	0x00, 0x25, 0x01, 0x01, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26,
+	0x01, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x26, 0x02, 0x01,
+	0x00, 0x2B, 0x02, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D,
+	0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x02, 0x2F, 0x00, 0x02,
+	0x00, 0x26, 0x02, 0x02, 0x00, 0x2D, 0x02, 0x01, 0x00, 0x26,
+	0x02, 0x03, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x3D, 0x02, 0x00,
+	0x00, 0x03, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x08, 0x05, 0xE4, 0xA5, 0x04, 0x2E, 0x0C, 0x15, 0x44, 0xCD,
+	0x80, 0x80, 0xE0, 0x0D, 0x05, 0x00, 0x02, 0x18, 0x01, 0xDA,
+	0x54, 0xDA, 0x10, 0xD7, 0xCD, 0x8C, 0x80, 0x40, 0x02, 0x02,
+	0x00, 0x02, 0xCE, 0x03, 0x67, 0x65, 0x74, 0x33, 0x00, 0x00,
+	0x01, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x5D, 0x28, 0x00, 0x00,
+	0x00, 0x27, 0x01, 0x00, 0x05, 0x05, 0x01, 0x01, 0x01, 0x29,
+	0x01, 0x00, 0x05, 0x27, 0x01, 0x00, 0x05, 0x27, 0x02, 0x00,
+	0x06, 0x48, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x03, 0x00, 0x27,
+	0x01, 0x00, 0x02, 0x30, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00,
+	0x00, 0x27, 0x03, 0x00, 0x05, 0x33, 0x01, 0x02, 0x03, 0x26,
+	0x02, 0x00, 0x00, 0x27, 0x03, 0x00, 0x0C, 0x27, 0x04, 0x00,
+	0x05, 0x2D, 0x02, 0x03, 0x04, 0x26, 0x03, 0x01, 0x00, 0x2F,
+	0x02, 0x03, 0x00, 0x2D, 0x01, 0x02, 0x00, 0x27, 0x03, 0x00,
+	0x03, 0x2B, 0x03, 0x00, 0x00, 0x27, 0x03, 0x00, 0x04, 0x30,
+	0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1E, 0x01,
+	0x90, 0xA9, 0x04, 0xC0, 0x02, 0x03, 0x34, 0xB5, 0x02, 0x03,
+	0x34, 0x06, 0x01, 0x07, 0xCE, 0x01, 0x02, 0x3E, 0xCD, 0x01,
+	0x03, 0x48, 0x0C, 0x06, 0x20, 0x06, 0x05, 0x31, 0x46, 0xCD,
+	0x80, 0x80, 0xE0, 0x0D, 0x05, 0x00, 0x03, 0x1B, 0x01, 0xDA,
+	0x54, 0xDA, 0x10, 0xDA, 0xF9, 0x01, 0xDA, 0xEB, 0x09, 0xDA,
+	0x5D, 0x28, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x27,
+	0x02, 0x00, 0x0A, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x02, 0x00,
+	0x00, 0x2F, 0x01, 0x02, 0x00, 0x29, 0x01, 0x00, 0x0A, 0x27,
+	0x01, 0x00, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x48, 0x02, 0x01,
+	0x02, 0x1A, 0x02, 0x03, 0x00, 0x27, 0x01, 0x00, 0x02, 0x30,
+	0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x27, 0x03, 0x00,
+	0x0A, 0x33, 0x01, 0x02, 0x03, 0x26, 0x02, 0x01, 0x00, 0x27,
+	0x03, 0x00, 0x0F, 0x27, 0x04, 0x00, 0x0A, 0x2D, 0x02, 0x03,
+	0x04, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x2D,
+	0x01, 0x02, 0x00, 0x27, 0x03, 0x00, 0x03, 0x2B, 0x03, 0x00,
+	0x00, 0x27, 0x03, 0x00, 0x04, 0x30, 0x03, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0x1E, 0x01, 0x9C, 0xAE, 0x04, 0xFA,
+	0x02, 0x06, 0x46, 0xD7, 0x02, 0x03, 0x4E, 0x0D, 0x01, 0x07,
+	0xD8, 0x01, 0x02, 0x42, 0xDB, 0x01, 0x03, 0x48, 0x10, 0x06,
+	0x24, 0x08, 0x05, 0x35, 0x4A, 0x7D, 0x01, 0x9A, 0xA0, 0x04,
+	0xA4, 0x12, 0x07, 0x74, 0x83, 0x12, 0x01, 0x15, 0xA4, 0x11,
+	0x01, 0x4A, 0xA1, 0x11, 0x01, 0x07, 0xC8, 0x02, 0x0A, 0x3A,
+	0x91, 0x02, 0x02, 0x80, 0x01, 0x2B, 0x0E, 0x40, 0x40, 0x07,
+	0x7E, 0x4D, 0x01, 0xB9, 0x03, 0xA6, 0x11, 0x02, 0x82, 0x04,
+	0xA7, 0x11, 0x01, 0x36, 0x76, 0x03, 0x53, 0x60, 0x07, 0x80,
+	0x02, 0xD3, 0x01, 0x01, 0xE3, 0x05, 0xA6, 0x11, 0x01, 0xB4,
+	0x06, 0xA5, 0x11, 0x01, 0x11, 0x14, 0x01, 0x42, 0x1F, 0x11,
+	0x22, 0xF0, 0x03, 0x03, 0x4C, 0x4D, 0x01, 0x46, 0x73, 0x06,
+	0x45, 0x74, 0x0C, 0x4B, 0x4E, 0x0D, 0x92, 0x04, 0xD9, 0x03,
+	0x01, 0x97, 0x0B, 0x9C, 0x11, 0x01, 0xE0, 0x0B, 0xAB, 0x11,
+	0x11, 0x28, 0xAE, 0x04, 0x03, 0x4E, 0x4F, 0x01, 0x4E, 0x7B,
+	0x06, 0x4D, 0x7C, 0x0C, 0x4D, 0x50, 0x0A, 0xE2, 0x04, 0xED,
+	0x03, 0xDA, 0x5C, 0xDA, 0x97, 0x02, 0xDA, 0xE7, 0x09, 0xDA,
+	0x5E, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00, 0x04, 0x48,
+	0x02, 0x00, 0x03, 0x1A, 0x02, 0x04, 0x00, 0x27, 0x04, 0x00,
+	0x01, 0x33, 0x03, 0x04, 0x00, 0x03, 0x03, 0x00, 0x00, 0x27,
+	0x04, 0x00, 0x04, 0x43, 0x03, 0x00, 0x04, 0x1A, 0x03, 0x1D,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17,
+	0x05, 0x04, 0x00, 0x27, 0x06, 0x00, 0x01, 0x33, 0x04, 0x06,
+	0x00, 0x2A, 0x06, 0x00, 0x00, 0x3C, 0x07, 0x00, 0x00, 0x27,
+	0x08, 0x00, 0x05, 0x2D, 0x04, 0x08, 0x06, 0x2B, 0x07, 0x00,
+	0x00, 0x26, 0x09, 0x01, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x26,
+	0x06, 0x02, 0x00, 0x2D, 0x06, 0x05, 0x08, 0x3D, 0x04, 0x00,
+	0x00, 0x26, 0x07, 0x03, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2D,
+	0x07, 0x08, 0x04, 0x3D, 0x06, 0x00, 0x00, 0x25, 0x07, 0x02,
+	0x00, 0x06, 0x04, 0x07, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2F,
+	0x07, 0x01, 0x00, 0x26, 0x08, 0x05, 0x00, 0x2D, 0x08, 0x06,
+	0x07, 0x2B, 0x05, 0x00, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x03,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0F, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x02, 0x00, 0x00,
+	0x05, 0x02, 0xDA, 0x10, 0x27, 0x00, 0x01, 0x00, 0x05, 0x00,
+	0x00, 0x01, 0x27, 0x01, 0x00, 0x01, 0x33, 0x00, 0x01, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x08, 0x02, 0xB4, 0xC1, 0x04, 0x0C, 0x03, 0x15, 0x18, 0x39,
+	0x01, 0xA4, 0xBE, 0x04, 0xCC, 0x04, 0x02, 0x48, 0xB7, 0x04,
+	0x01, 0x1F, 0x8E, 0x04, 0x03, 0x38, 0x89, 0x04, 0x02, 0x30,
+	0x03, 0x01, 0x67, 0x8E, 0x04, 0x03, 0x80, 0x01, 0x81, 0x01,
+	0x02, 0xA2, 0x01, 0x87, 0x03, 0x01, 0x22, 0x1C, 0x0D, 0x6F,
+	0x96, 0x02, 0x02, 0xF8, 0x01, 0xBD, 0x02, 0x07, 0xF7, 0x01,
+	0xBE, 0x02, 0x01, 0xD3, 0x01, 0xD8, 0x01, 0x21, 0x01, 0xC4,
+	0xB2, 0x04, 0xB6, 0x10, 0x11, 0xBA, 0x0A, 0xBB, 0x0A, 0x01,
+	0x40, 0xDF, 0x05, 0x01, 0x11, 0x14, 0x02, 0x54, 0x1D, 0x01,
+	0x24, 0xBC, 0x04, 0x03, 0x01, 0x08, 0x0C, 0xA3, 0x01, 0xA6,
+	0x01, 0xCF, 0x05, 0x6D, 0x61, 0x63, 0x65, 0x78, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x6D, 0x61, 0x63,
+	0x65, 0x78, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x70,
+	0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73,
+	0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x6C,
+	0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFC,
+	0x93, 0x05, 0xCD, 0xCA, 0x98, 0x05, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x04, 0x01, 0x03, 0x14, 0xCE, 0x05,
+	0x6D, 0x61, 0x63, 0x65, 0x78, 0xDA, 0x10, 0xDA, 0xB6, 0x04,
+	0xDA, 0xE6, 0x04, 0xCE, 0x1A, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x73, 0x69, 0x6F, 0x6E,
+	0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65,
+	0x64, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x2F,
+	0x01, 0x01, 0x00, 0x25, 0x02, 0x00, 0x00, 0x2C, 0x01, 0x00,
+	0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x00, 0x03, 0x00, 0x1A,
+	0x00, 0x0C, 0x00, 0x05, 0x02, 0x02, 0x01, 0x25, 0x00, 0xC8,
+	0x00, 0x45, 0x03, 0x02, 0x00, 0x1A, 0x03, 0x03, 0x00, 0x26,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+	0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+	0x01, 0x03, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0x03, 0x01, 0x00,
+	0x00, 0x2C, 0x03, 0xA0, 0x95, 0x05, 0x12, 0x01, 0x1C, 0x0A,
+	0x03, 0x32, 0x1A, 0x01, 0x0D, 0x9E, 0x02, 0x01, 0x5E, 0xBD,
+	0x02, 0x02, 0x05, 0x10, 0x01, 0x07, 0x60, 0x02, 0x3E, 0x3F,
+	0x01, 0x54, 0x1B, 0x03, 0x50, 0x0B, 0x01, 0xB1, 0x02, 0xB6,
+	0x02, 0x01, 0xE3, 0x01, 0xFA, 0x01, 0xCF, 0x0D, 0x6D, 0x6F,
+	0x64, 0x75, 0x6C, 0x65, 0x2D, 0x64, 0x69, 0x67, 0x65, 0x73,
+	0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6, 0x01, 0xCB, 0xDA,
+	0x05, 0xCE, 0x4B, 0x28, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x2D, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x29, 0x0A, 0x0A, 0x44, 0x69, 0x67, 0x65, 0x73, 0x74,
+	0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x74, 0x77, 0x6F, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x65, 0x73, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x84, 0x8D, 0x06, 0xCD, 0xC0,
+	0x8F, 0x06, 0xDA, 0x03, 0xDA, 0xE8, 0x02, 0xCF, 0x08, 0x6D,
+	0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0xB7, 0x01, 0x28, 0x6D, 0x61, 0x6B,
+	0x65, 0x2D, 0x65, 0x6E, 0x76, 0x20, 0x70, 0x61, 0x72, 0x65,
+	0x6E, 0x74, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54,
+	0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x68, 0x65, 0x72,
+	0x69, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E,
+	0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2C,
+	0x20, 0x62, 0x75, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x20,
+	0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x6F,
+	0x6C, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76,
+	0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xC2, 0x9A, 0x05, 0xCD,
+	0x80, 0x9F, 0x05, 0xDA, 0x03, 0xDA, 0x82, 0x03, 0xCF, 0x0B,
+	0x2A, 0x64, 0x6F, 0x63, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68,
+	0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x28, 0x57,
+	0x69, 0x64, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x6F,
+	0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x70,
+	0x72, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xAA, 0xC4, 0x04, 0xCD,
+	0xAE, 0xC5, 0x04, 0xDA, 0x91, 0x04, 0xDA, 0xDB, 0x01, 0xCF,
+	0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0xA3, 0x06, 0xDA, 0x05, 0xCE, 0x70, 0x28, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x3C, 0x20, 0x26, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x63,
+	0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x63,
+	0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E,
+	0xCF, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0xCE, 0x08, 0xDA, 0x05, 0xCE, 0x70, 0x28,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x20, 0x26, 0x20, 0x78,
+	0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x64, 0x65,
+	0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61,
+	0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74,
+	0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+	0x2E, 0xCF, 0x02, 0x3E, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7,
+	0xCD, 0xB8, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x10, 0xCE,
+	0x02, 0x3E, 0x3D, 0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01,
+	0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25,
+	0x05, 0x01, 0x00, 0x4A, 0x04, 0x00, 0x05, 0x41, 0x02, 0x03,
+	0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17,
+	0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA,
+	0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24,
+	0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE,
+	0x50, 0x28, 0x3E, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C,
+	0x79, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x61, 0x73, 0x63, 0x65,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65,
+	0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+	0x2E, 0xCF, 0x09, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65,
+	0x6E, 0x76, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6F, 0x73,
+	0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x05, 0xCE,
+	0x46, 0x28, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E,
+	0x76, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65,
+	0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65,
+	0x2E, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63,
+	0x6F, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61,
+	0x74, 0x68, 0x2F, 0x61, 0x63, 0x6F, 0x73, 0xDA, 0x05, 0xCE,
+	0x2A, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63, 0x6F,
+	0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+	0x63, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x78, 0x2E, 0xCF, 0x03, 0x67, 0x65, 0x74, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0xEB, 0x09, 0xDA, 0x05, 0xCE, 0xB5, 0x03,
+	0x28, 0x67, 0x65, 0x74, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x65,
+	0x79, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x61, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63,
+	0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+	0x65, 0x2E, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2C,
+	0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x73, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x73, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+	0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x65, 0x74,
+	0x2E, 0x20, 0x4F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2C, 0x20,
+	0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x73, 0x2C, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+	0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6B, 0x65,
+	0x79, 0x73, 0x2E, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x61, 0x6B,
+	0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+	0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x69,
+	0x6C, 0x2E, 0x20, 0x42, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65,
+	0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x72, 0x65,
+	0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69,
+	0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74,
+	0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75,
+	0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x67, 0x65,
+	0x74, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x2E, 0xCF, 0x04, 0x64,
+	0x6F, 0x63, 0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x4A, 0x28, 0x64, 0x6F, 0x63, 0x2A, 0x20, 0x65, 0x6E, 0x76,
+	0x20, 0x73, 0x79, 0x6D, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76,
+	0x65, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+	0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xD8, 0xD2, 0x04, 0xCD, 0x86, 0xDE, 0x04, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x08, 0x02, 0x16,
+	0x6C, 0xCE, 0x04, 0x64, 0x6F, 0x63, 0x2A, 0xDA, 0x10, 0xDA,
+	0x5A, 0xCE, 0x07, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20,
+	0xCE, 0x0B, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75,
+	0x6E, 0x64, 0x2E, 0xDA, 0xD2, 0x04, 0xDA, 0x91, 0x04, 0xDA,
+	0x1D, 0xD0, 0x03, 0x76, 0x61, 0x72, 0xCE, 0x02, 0x20, 0x28,
+	0xCE, 0x01, 0x29, 0xDA, 0xBC, 0x02, 0xDA, 0x27, 0xDA, 0x03,
+	0xCE, 0x04, 0x20, 0x20, 0x20, 0x20, 0xCE, 0x01, 0x0A, 0xDA,
+	0x0F, 0xDA, 0x05, 0xCE, 0x00, 0xCE, 0x01, 0x3A, 0xCE, 0x02,
+	0x29, 0x0A, 0xDA, 0xE5, 0x01, 0xCE, 0x17, 0x6E, 0x6F, 0x20,
+	0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E,
+	0xCE, 0x02, 0x0A, 0x0A, 0x33, 0x00, 0x00, 0x01, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x02, 0x00,
+	0x1A, 0x02, 0x06, 0x00, 0x26, 0x02, 0x01, 0x00, 0x26, 0x03,
+	0x02, 0x00, 0x2D, 0x02, 0x01, 0x03, 0x26, 0x02, 0x03, 0x00,
+	0x30, 0x02, 0x00, 0x00, 0x26, 0x03, 0x04, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x12, 0x00,
+	0x26, 0x01, 0x04, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2F, 0x01,
+	0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x33, 0x04, 0x01, 0x02,
+	0x2B, 0x04, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00, 0x2F, 0x01,
+	0x02, 0x00, 0x26, 0x04, 0x06, 0x00, 0x26, 0x02, 0x07, 0x00,
+	0x2D, 0x04, 0x02, 0x01, 0x26, 0x04, 0x08, 0x00, 0x2B, 0x04,
+	0x00, 0x00, 0x26, 0x02, 0x09, 0x00, 0x2F, 0x04, 0x02, 0x00,
+	0x17, 0x02, 0x04, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x26, 0x04,
+	0x0A, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00,
+	0x1A, 0x04, 0x03, 0x00, 0x26, 0x01, 0x0A, 0x00, 0x18, 0x08,
+	0x00, 0x00, 0x26, 0x02, 0x0B, 0x00, 0x2B, 0x02, 0x00, 0x00,
+	0x2F, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x06,
+	0x05, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x01, 0x05, 0x00,
+	0x17, 0x02, 0x01, 0x00, 0x26, 0x03, 0x0C, 0x00, 0x26, 0x01,
+	0x0D, 0x00, 0x2D, 0x03, 0x02, 0x01, 0x26, 0x01, 0x09, 0x00,
+	0x2F, 0x03, 0x01, 0x00, 0x17, 0x02, 0x03, 0x00, 0x26, 0x03,
+	0x0E, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x2F, 0x03, 0x00, 0x00,
+	0x17, 0x01, 0x03, 0x00, 0x26, 0x03, 0x0F, 0x00, 0x2B, 0x03,
+	0x00, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x1A, 0x04, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x26, 0x03, 0x10, 0x00, 0x17, 0x02, 0x01, 0x00,
+	0x1A, 0x02, 0x12, 0x00, 0x35, 0x06, 0x02, 0x00, 0x17, 0x00,
+	0x06, 0x00, 0x35, 0x06, 0x02, 0x01, 0x17, 0x07, 0x06, 0x00,
+	0x35, 0x06, 0x02, 0x02, 0x17, 0x02, 0x06, 0x00, 0x26, 0x06,
+	0x0C, 0x00, 0x26, 0x05, 0x07, 0x00, 0x2D, 0x06, 0x00, 0x05,
+	0x26, 0x06, 0x11, 0x00, 0x2D, 0x07, 0x06, 0x02, 0x26, 0x06,
+	0x12, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x05, 0x09, 0x00,
+	0x2F, 0x06, 0x05, 0x00, 0x17, 0x05, 0x06, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x26, 0x05, 0x10, 0x00, 0x1A, 0x04, 0x03, 0x00,
+	0x17, 0x06, 0x04, 0x00, 0x18, 0x06, 0x00, 0x00, 0x1A, 0x01,
+	0x03, 0x00, 0x17, 0x00, 0x01, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 0x1A, 0x06,
+	0x03, 0x00, 0x26, 0x02, 0x0D, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x26, 0x02, 0x10, 0x00, 0x1A, 0x04, 0x06, 0x00, 0x2B, 0x04,
+	0x00, 0x00, 0x26, 0x07, 0x13, 0x00, 0x2F, 0x00, 0x07, 0x00,
+	0x17, 0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x06,
+	0x14, 0x00, 0x26, 0x00, 0x15, 0x00, 0x2D, 0x00, 0x03, 0x05,
+	0x26, 0x00, 0x15, 0x00, 0x2D, 0x02, 0x06, 0x00, 0x26, 0x00,
+	0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x76, 0x01, 0x96, 0xD4,
+	0x04, 0x18, 0x03, 0x2A, 0x0B, 0x01, 0x07, 0xC0, 0x09, 0x05,
+	0x20, 0x87, 0x09, 0x03, 0x80, 0x02, 0x35, 0x01, 0x2F, 0xA0,
+	0x02, 0x03, 0x7C, 0x9F, 0x02, 0x02, 0x09, 0x10, 0x03, 0x0B,
+	0x0E, 0x07, 0x23, 0x2E, 0x02, 0x41, 0xD4, 0x01, 0x03, 0xC4,
+	0x01, 0x9B, 0x02, 0x03, 0xC3, 0x01, 0x9C, 0x02, 0x03, 0x98,
+	0x02, 0x9B, 0x02, 0x03, 0x0B, 0x0E, 0x02, 0x8B, 0x02, 0x8E,
+	0x02, 0x05, 0x3D, 0x6A, 0x01, 0x2D, 0x30, 0x03, 0xE8, 0x03,
+	0xAB, 0x03, 0x01, 0x0F, 0x12, 0x03, 0x4C, 0x1F, 0x01, 0x0D,
+	0x10, 0x04, 0x64, 0x06, 0x08, 0x42, 0x78, 0x09, 0x3C, 0x43,
+	0x03, 0x3B, 0x44, 0x08, 0xC2, 0x01, 0x8B, 0x01, 0x04, 0x07,
+	0x1A, 0x01, 0x48, 0x32, 0x03, 0x0C, 0x41, 0x03, 0x0B, 0x42,
+	0x06, 0xF9, 0x02, 0xA4, 0x03, 0xCF, 0x03, 0x62, 0x6F, 0x72,
+	0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x9C, 0x80, 0xC8, 0x20,
+	0x06, 0x00, 0x00, 0x13, 0xCE, 0x03, 0x62, 0x6F, 0x72, 0x17,
+	0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03,
+	0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20,
+	0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x00,
+	0x00, 0x4B, 0x04, 0x00, 0x00, 0x0D, 0x03, 0x03, 0x04, 0x03,
+	0x03, 0x00, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+	0x00, 0x4A, 0x04, 0x00, 0x05, 0x0D, 0x03, 0x03, 0x04, 0x05,
+	0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC,
+	0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x59, 0x28,
+	0x62, 0x6F, 0x72, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73,
+	0x65, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68,
+	0x20, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x6D,
+	0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF, 0x05,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+	0xB2, 0x04, 0xDA, 0x05, 0xCE, 0xD1, 0x01, 0x28, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x26, 0x20, 0x6B, 0x76, 0x73, 0x29,
+	0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x76,
+	0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 0x63, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65,
+	0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x73, 0x2E, 0x20, 0x6B, 0x76, 0x73, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+	0x63, 0x65, 0x20, 0x6B, 0x31, 0x2C, 0x20, 0x76, 0x31, 0x2C,
+	0x20, 0x6B, 0x32, 0x2C, 0x20, 0x76, 0x32, 0x2C, 0x20, 0x6B,
+	0x33, 0x2C, 0x20, 0x76, 0x33, 0x2C, 0x20, 0x2E, 0x2E, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x6B, 0x76, 0x73, 0x20, 0x68, 0x61,
+	0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x6E,
+	0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x65,
+	0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x61,
+	0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x77, 0x69,
+	0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F,
+	0x77, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x07, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x24, 0x28, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+	0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xB8, 0x22, 0xCD, 0xB8,
+	0x23, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02,
+	0x01, 0x02, 0x06, 0xCE, 0x07, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xD0, 0x06, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00,
+	0x1F, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03,
+	0x96, 0x23, 0x0E, 0x03, 0x05, 0x18, 0xCF, 0x03, 0x2D, 0x3E,
+	0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0xDC, 0x01,
+	0x28, 0x2D, 0x3E, 0x3E, 0x20, 0x78, 0x20, 0x26, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72,
+	0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+	0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72,
+	0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F,
+	0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+	0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20,
+	0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E,
+	0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0x9A, 0xA6, 0x03, 0xCD, 0xD8, 0xAD, 0x03, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x2B, 0x06, 0x01, 0x00, 0x0C, 0x01,
+	0xCE, 0x03, 0x2D, 0x3E, 0x3E, 0xDA, 0x10, 0x2A, 0x02, 0x00,
+	0x00, 0x17, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25,
+	0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x06,
+	0x00, 0x4A, 0x05, 0x01, 0x03, 0x2C, 0x00, 0x05, 0x00, 0x2F,
+	0x00, 0x02, 0x00, 0x49, 0x03, 0x04, 0x01, 0x18, 0xFC, 0xFF,
+	0xFF, 0x03, 0x00, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x05, 0x02, 0x06, 0x24, 0xDA, 0x86, 0x01, 0xDA, 0x10, 0xDA,
+	0x1D, 0xDA, 0x58, 0xDA, 0x87, 0x01, 0xDA, 0x5D, 0xDA, 0x88,
+	0x01, 0xDA, 0x89, 0x01, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00,
+	0x48, 0x03, 0x04, 0x02, 0x1A, 0x03, 0x0B, 0x00, 0x25, 0x04,
+	0x00, 0x00, 0x33, 0x02, 0x01, 0x04, 0x25, 0x04, 0x01, 0x00,
+	0x2C, 0x01, 0x04, 0x00, 0x26, 0x01, 0x02, 0x00, 0x2F, 0x04,
+	0x01, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26, 0x02, 0x03, 0x00,
+	0x2F, 0x01, 0x02, 0x00, 0x18, 0x06, 0x00, 0x00, 0x38, 0x02,
+	0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x01, 0x03, 0x00,
+	0x2F, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04, 0x00, 0x35, 0x02,
+	0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x35, 0x02, 0x01, 0x01,
+	0x17, 0x04, 0x02, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x38, 0x02,
+	0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+	0x2D, 0x02, 0x04, 0x01, 0x26, 0x00, 0x04, 0x00, 0x2F, 0x02,
+	0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x2C, 0x02, 0x01, 0x00,
+	0x26, 0x01, 0x05, 0x00, 0x30, 0x01, 0x00, 0x00, 0x2F, 0x03,
+	0xDA, 0xAA, 0x03, 0x0E, 0x02, 0x13, 0x16, 0x01, 0x07, 0xB2,
+	0x01, 0x02, 0x60, 0xC5, 0x01, 0x04, 0x14, 0x10, 0x03, 0x21,
+	0x24, 0x01, 0x51, 0x92, 0x01, 0x04, 0xBC, 0x01, 0xBD, 0x01,
+	0x01, 0xBB, 0x01, 0xBE, 0x01, 0x04, 0x15, 0x18, 0x07, 0x90,
+	0x02, 0xB5, 0x01, 0x04, 0x46, 0x0F, 0x0B, 0x01, 0xFA, 0xA9,
+	0x03, 0xAE, 0x03, 0x0B, 0xB6, 0x03, 0x87, 0x03, 0xCF, 0x0C,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63,
+	0x68, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x3E,
+	0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70,
+	0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69, 0x64,
+	0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65,
+	0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xCE,
+	0xFF, 0x05, 0xCD, 0x82, 0x81, 0x06, 0xDA, 0x03, 0xDA, 0xC7,
+	0x07, 0xCF, 0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x62,
+	0x75, 0x64, 0x67, 0x65, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x62, 0x75, 0x64,
+	0x67, 0x65, 0x74, 0xDA, 0x05, 0xCE, 0xBA, 0x01, 0x28, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x2F, 0x62, 0x75, 0x64, 0x67, 0x65,
+	0x74, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+	0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x61, 0x63,
+	0x6B, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x72,
+	0x75, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x69,
+	0x6D, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72,
+	0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66,
+	0x6F, 0x72, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65,
+	0x64, 0x2E, 0x20, 0x41, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65,
+	0x74, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x6D, 0x65, 0x61,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x76, 0x65,
+	0x72, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70,
+	0x74, 0x65, 0x64, 0x2E, 0xCF, 0x07, 0x73, 0x79, 0x6D, 0x62,
+	0x6F, 0x6C, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x24, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xBE, 0x25, 0xCD, 0xBE, 0x26, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x02,
+	0x06, 0xCE, 0x07, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F,
+	0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x1F, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01,
+	0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+	0x07, 0x03, 0x9C, 0x26, 0x0E, 0x03, 0x05, 0x18, 0xCF, 0x07,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x3D, 0xD3, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0xAC, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00,
+	0x10, 0xCE, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x3D,
+	0x17, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02,
+	0x0A, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+	0x4A, 0x04, 0x00, 0x05, 0x1D, 0x02, 0x03, 0x04, 0x1A, 0x02,
+	0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00,
+	0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x6C, 0x28, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x3E, 0x3D, 0x20, 0x26, 0x20, 0x78,
+	0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+	0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74,
+	0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+	0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+	0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0A, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0xBC, 0x02, 0x28, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68,
+	0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x70, 0x72,
+	0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64,
+	0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x74, 0x6F, 0x6D, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x69, 0x64,
+	0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x28, 0x61, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C,
+	0x6C, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x29, 0x2C, 0x20,
+	0x6D, 0x61, 0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+	0x69, 0x6E, 0x67, 0x20, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+	0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x6F,
+	0x6E, 0x63, 0x65, 0x2C, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20,
+	0x69, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x63, 0x6F,
+	0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x6D, 0x75, 0x6C,
+	0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x70,
+	0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x62,
+	0x6F, 0x64, 0x79, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73,
+	0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xA6, 0x40, 0xCD, 0xEE, 0x49, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x0B, 0x02, 0x09, 0x37,
+	0xCE, 0x0A, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x69, 0x64, 0x65,
+	0x6D, 0x70, 0xDA, 0x10, 0xDA, 0x5B, 0xDA, 0x5C, 0xCF, 0x0B,
+	0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74,
+	0x3F, 0xCF, 0x06, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0xDA,
+	0x5E, 0xDA, 0x5F, 0xDA, 0x97, 0x02, 0xDA, 0xA2, 0x04, 0xDA,
+	0xD4, 0x05, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x03, 0x03, 0x00,
+	0x26, 0x04, 0x00, 0x00, 0x2F, 0x04, 0x04, 0x00, 0x26, 0x05,
+	0x01, 0x00, 0x2D, 0x05, 0x04, 0x01, 0x3D, 0x01, 0x00, 0x00,
+	0x26, 0x06, 0x02, 0x00, 0x2C, 0x06, 0x04, 0x00, 0x3D, 0x05,
+	0x00, 0x00, 0x26, 0x07, 0x03, 0x00, 0x2B, 0x07, 0x00, 0x00,
+	0x3D, 0x06, 0x00, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2D, 0x08,
+	0x05, 0x04, 0x2B, 0x06, 0x00, 0x00, 0x3D, 0x07, 0x00, 0x00,
+	0x26, 0x06, 0x01, 0x00, 0x2D, 0x06, 0x00, 0x07, 0x3D, 0x05,
+	0x00, 0x00, 0x26, 0x07, 0x05, 0x00, 0x2B, 0x07, 0x00, 0x00,
+	0x4C, 0x02, 0x00, 0x00, 0x3D, 0x06, 0x00, 0x00, 0x26, 0x08,
+	0x01, 0x00, 0x2D, 0x08, 0x03, 0x06, 0x3D, 0x07, 0x00, 0x00,
+	0x26, 0x08, 0x06, 0x00, 0x2D, 0x08, 0x04, 0x00, 0x3D, 0x06,
+	0x00, 0x00, 0x26, 0x02, 0x07, 0x00, 0x26, 0x09, 0x05, 0x00,
+	0x2C, 0x02, 0x09, 0x00, 0x3D, 0x08, 0x00, 0x00, 0x26, 0x09,
+	0x07, 0x00, 0x26, 0x0A, 0x01, 0x00, 0x2C, 0x09, 0x0A, 0x00,
+	0x3D, 0x02, 0x00, 0x00, 0x26, 0x0A, 0x08, 0x00, 0x2D, 0x0A,
+	0x02, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x3D, 0x09, 0x00, 0x00,
+	0x26, 0x0A, 0x08, 0x00, 0x2D, 0x0A, 0x08, 0x09, 0x2B, 0x03,
+	0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x09, 0x04, 0x00,
+	0x2D, 0x09, 0x06, 0x03, 0x2B, 0x02, 0x00, 0x00, 0x3D, 0x08,
+	0x00, 0x00, 0x26, 0x02, 0x05, 0x00, 0x2D, 0x02, 0x01, 0x05,
+	0x2C, 0x07, 0x08, 0x00, 0x3D, 0x06, 0x00, 0x00, 0x03, 0x06,
+	0x00, 0x00, 0x0B, 0x02, 0xE4, 0x45, 0x0E, 0x02, 0x2E, 0x00,
+	0x33, 0x18, 0xB4, 0x03, 0xCF, 0x05, 0x61, 0x73, 0x3F, 0x2D,
+	0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0xDE, 0x01,
+	0x28, 0x61, 0x73, 0x3F, 0x2D, 0x3E, 0x20, 0x78, 0x20, 0x61,
+	0x73, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29,
+	0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74,
+	0x68, 0x65, 0x72, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+	0x63, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x78, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E,
+	0x79, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65,
+	0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61, 0x6C,
+	0x73, 0x65, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x3B, 0x20, 0x6F, 0x74, 0x68,
+	0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xFC, 0xD4, 0x03, 0xCD, 0xCE, 0xDB, 0x03, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x09, 0x02, 0x03,
+	0x09, 0x02, 0xCE, 0x05, 0x61, 0x73, 0x3F, 0x2D, 0x3E, 0xDA,
+	0x10, 0xDA, 0x5B, 0xD7, 0xCD, 0x80, 0x80, 0xF0, 0x0B, 0x06,
+	0x02, 0x01, 0x07, 0x01, 0xCE, 0x08, 0x70, 0x6F, 0x73, 0x74,
+	0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x10, 0xDA, 0x80, 0x02, 0x28,
+	0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x01,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x2B,
+	0x04, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xCD, 0x80, 0x80,
+	0xA0, 0x0D, 0x02, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x10, 0x27,
+	0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00,
+	0x02, 0x30, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x05, 0x04, 0x88, 0xCD, 0x03, 0x1A, 0x11, 0x01, 0xFE, 0xCA,
+	0x03, 0xB6, 0x02, 0x01, 0xFA, 0x01, 0x89, 0x02, 0x03, 0x0B,
+	0x18, 0x02, 0x05, 0x08, 0xDA, 0x4C, 0x28, 0x03, 0x00, 0x00,
+	0x17, 0x04, 0x00, 0x00, 0x17, 0x05, 0x02, 0x00, 0x37, 0x06,
+	0x05, 0x00, 0x17, 0x07, 0x06, 0x00, 0x25, 0x06, 0x00, 0x00,
+	0x2A, 0x08, 0x01, 0x00, 0x2F, 0x08, 0x08, 0x00, 0x03, 0x04,
+	0x00, 0x00, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x02, 0x01, 0x00,
+	0x06, 0x01, 0xDA, 0x10, 0x27, 0x01, 0x00, 0x01, 0x48, 0x01,
+	0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x27, 0x01, 0x00, 0x0B,
+	0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x08, 0x02, 0xAE, 0xDA, 0x03, 0x0E, 0x04,
+	0x07, 0x16, 0xCD, 0x80, 0x80, 0xD0, 0x0F, 0x07, 0x00, 0x03,
+	0x1E, 0x01, 0x01, 0xCE, 0x06, 0x5F, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0xDA, 0x10, 0xDA, 0x5B, 0xDA, 0xEA, 0x0A, 0xDA, 0x4C,
+	0x27, 0x01, 0x00, 0x06, 0x27, 0x02, 0x00, 0x07, 0x3E, 0x00,
+	0x01, 0x02, 0x19, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x27, 0x02, 0x00, 0x05, 0x27, 0x03, 0x00, 0x06, 0x33, 0x01,
+	0x02, 0x03, 0x17, 0x02, 0x01, 0x00, 0x26, 0x03, 0x00, 0x00,
+	0x2F, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01, 0x00, 0x2A, 0x01,
+	0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x05, 0x01, 0x00,
+	0x2F, 0x04, 0x05, 0x00, 0x17, 0x01, 0x04, 0x00, 0x27, 0x05,
+	0x00, 0x04, 0x2C, 0x03, 0x05, 0x00, 0x3D, 0x04, 0x00, 0x00,
+	0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x04, 0x01, 0x3D, 0x05,
+	0x00, 0x00, 0x29, 0x05, 0x00, 0x04, 0x25, 0x04, 0x01, 0x00,
+	0x27, 0x05, 0x00, 0x06, 0x06, 0x01, 0x04, 0x05, 0x29, 0x01,
+	0x00, 0x06, 0x28, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xCD, 0x80, 0x80, 0xA0, 0x0D,
+	0x02, 0x01, 0x00, 0x06, 0x02, 0xDA, 0x10, 0x27, 0x01, 0x00,
+	0x01, 0x48, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x27,
+	0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x08, 0x02, 0xAE,
+	0xDA, 0x03, 0x0E, 0x04, 0x07, 0x16, 0x1F, 0x09, 0x80, 0xD9,
+	0x03, 0xBE, 0x02, 0x02, 0x48, 0xAF, 0x02, 0x01, 0x11, 0x14,
+	0x01, 0x60, 0x14, 0x03, 0x13, 0x20, 0x01, 0x1D, 0x20, 0x07,
+	0x96, 0x01, 0x35, 0x06, 0xF9, 0x01, 0xFE, 0x01, 0x14, 0x01,
+	0xFC, 0xD4, 0x03, 0xD2, 0x06, 0x01, 0xE6, 0x03, 0xBB, 0x06,
+	0x06, 0x1E, 0xA8, 0x02, 0x01, 0x83, 0x04, 0x94, 0x04, 0xCF,
+	0x0C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77,
+	0x67, 0x65, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77, 0x67, 0x65,
+	0x74, 0xDA, 0x05, 0xCE, 0xE2, 0x01, 0x28, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77, 0x67, 0x65, 0x74, 0x20,
+	0x74, 0x61, 0x62, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x0A,
+	0x47, 0x65, 0x74, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x6F, 0x75, 0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x69, 0x6E,
+	0x67, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61,
+	0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62,
+	0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x20,
+	0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x2C, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x68, 0x65,
+	0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2E, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63,
+	0x6C, 0x6F, 0x73, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x8D,
+	0x06, 0xDA, 0x05, 0xCE, 0xAC, 0x01, 0x28, 0x66, 0x69, 0x6C,
+	0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x29,
+	0x0A, 0x0A, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x61, 0x20,
+	0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+	0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x61, 0x6C, 0x6C,
+	0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x20, 0x72,
+	0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x2E, 0x20,
+	0x57, 0x68, 0x65, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x72, 0x65,
+	0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x6C, 0x65, 0x2C, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+	0x69, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x76,
+	0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x6F,
+	0x75, 0x72, 0x63, 0x65, 0x20, 0x6C, 0x65, 0x61, 0x6B, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6F, 0x74,
+	0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73,
+	0x73, 0x65, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x08,
+	0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x39, 0x28, 0x69, 0x64, 0x65,
+	0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+	0x41, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+	0x6E, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xA4, 0xB3, 0x02, 0xCD, 0xB4, 0xB4, 0x02, 0xDA, 0x03, 0xDA,
+	0xA4, 0x04, 0xCF, 0x03, 0x2D, 0x3F, 0x3E, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0xAA, 0x02, 0x28, 0x2D, 0x3F, 0x3E,
+	0x20, 0x78, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x63,
+	0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x20, 0x74, 0x68, 0x72,
+	0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63,
+	0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+	0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72,
+	0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F,
+	0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+	0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20,
+	0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69,
+	0x6E, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x20,
+	0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x2E, 0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65,
+	0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xDE, 0xAD, 0x03, 0xCD, 0xA0, 0xB7,
+	0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x2B, 0x06,
+	0x01, 0x00, 0x0C, 0x01, 0xCE, 0x03, 0x2D, 0x3F, 0x3E, 0xDA,
+	0x10, 0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x01, 0x00, 0x17,
+	0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03,
+	0x04, 0x1A, 0x05, 0x06, 0x00, 0x4A, 0x05, 0x01, 0x03, 0x2C,
+	0x00, 0x05, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x49, 0x03, 0x04,
+	0x01, 0x18, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x05, 0x02, 0x09, 0x2E, 0xDA, 0x86,
+	0x01, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x58, 0xDA, 0x87, 0x01,
+	0xDA, 0x5D, 0xDA, 0x5B, 0xDA, 0x88, 0x01, 0xDA, 0x89, 0x01,
+	0xDA, 0x5E, 0xDA, 0xD7, 0x03, 0x2B, 0x01, 0x00, 0x00, 0x26,
+	0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01,
+	0x00, 0x48, 0x03, 0x04, 0x02, 0x1A, 0x03, 0x0B, 0x00, 0x25,
+	0x04, 0x00, 0x00, 0x33, 0x02, 0x01, 0x04, 0x25, 0x04, 0x01,
+	0x00, 0x2C, 0x01, 0x04, 0x00, 0x26, 0x01, 0x02, 0x00, 0x2F,
+	0x04, 0x01, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26, 0x02, 0x03,
+	0x00, 0x2F, 0x01, 0x02, 0x00, 0x18, 0x06, 0x00, 0x00, 0x38,
+	0x02, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x01, 0x03,
+	0x00, 0x2F, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04, 0x00, 0x35,
+	0x02, 0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x35, 0x02, 0x01,
+	0x01, 0x17, 0x04, 0x02, 0x00, 0x26, 0x01, 0x04, 0x00, 0x2F,
+	0x02, 0x01, 0x00, 0x17, 0x01, 0x02, 0x00, 0x2C, 0x03, 0x01,
+	0x00, 0x38, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26,
+	0x03, 0x05, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x2C, 0x01, 0x00,
+	0x00, 0x3D, 0x03, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2C,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x06, 0x00, 0x2F, 0x00, 0x00,
+	0x00, 0x26, 0x02, 0x07, 0x00, 0x2D, 0x02, 0x01, 0x00, 0x3D,
+	0x00, 0x00, 0x00, 0x26, 0x02, 0x08, 0x00, 0x2D, 0x02, 0x03,
+	0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x35,
+	0x03, 0xBE, 0xB3, 0x03, 0x0E, 0x02, 0x13, 0x16, 0x01, 0x07,
+	0xB2, 0x01, 0x02, 0x60, 0xC5, 0x01, 0x04, 0x14, 0x10, 0x03,
+	0x21, 0x24, 0x01, 0x51, 0x92, 0x01, 0x04, 0xBC, 0x01, 0xBD,
+	0x01, 0x01, 0xBB, 0x01, 0xBE, 0x01, 0x04, 0x15, 0x18, 0x02,
+	0x8C, 0x02, 0xDF, 0x01, 0x01, 0x11, 0x14, 0x05, 0x44, 0x0E,
+	0x0D, 0x3E, 0x36, 0x0B, 0x01, 0xDE, 0xB2, 0x03, 0x92, 0x04,
+	0x0B, 0x9A, 0x04, 0xEB, 0x03, 0xCF, 0x0E, 0x6D, 0x6F, 0x64,
+	0x75, 0x6C, 0x65, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E,
+	0x67, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x58, 0x54,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69,
+	0x6E, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x6C, 0x79, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20, 0x55, 0x73,
+	0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x76,
+	0x65, 0x6E, 0x74, 0x20, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75,
+	0x6C, 0x61, 0x72, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64,
+	0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0x88, 0x81, 0x06, 0xCD, 0xF6, 0x82,
+	0x06, 0xDA, 0x03, 0xDA, 0xCA, 0x07, 0xCF, 0x09, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0xD4, 0x02, 0xD3,
+	0x02, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x77, 0x69, 0x74, 0x68,
+	0x2D, 0x73, 0x79, 0x6D, 0x73, 0x20, 0x73, 0x79, 0x6D, 0x73,
+	0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A,
+	0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x79, 0x6D, 0x73, 0x20,
+	0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+	0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+	0x2C, 0x20, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x82, 0xE9, 0x02, 0xCD,
+	0xE2, 0xEB, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8,
+	0x2B, 0x03, 0x01, 0x02, 0x09, 0x01, 0xCE, 0x09, 0x77, 0x69,
+	0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0xDA, 0x10, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x06, 0x02, 0x01, 0x0F, 0xCE,
+	0x06, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0xDA, 0x10, 0xDA,
+	0x88, 0x01, 0x38, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00,
+	0x17, 0x04, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05,
+	0x03, 0x04, 0x1A, 0x05, 0x09, 0x00, 0x33, 0x05, 0x01, 0x03,
+	0x2B, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x00, 0x00, 0x2C, 0x02,
+	0x05, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00,
+	0x49, 0x03, 0x04, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x03, 0x02,
+	0x00, 0x00, 0x16, 0x01, 0xF2, 0xE7, 0x02, 0x18, 0x06, 0x20,
+	0x44, 0x02, 0x50, 0x53, 0x03, 0x23, 0x26, 0x02, 0x2B, 0x2E,
+	0x01, 0x9F, 0x02, 0xAE, 0x02, 0xDA, 0xD7, 0x03, 0x2A, 0x02,
+	0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+	0x2F, 0x00, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2C, 0x02,
+	0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00,
+	0x03, 0x02, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xA0, 0x09, 0x02,
+	0x01, 0x02, 0x07, 0xDA, 0x10, 0xDA, 0x5B, 0xDA, 0x5D, 0x26,
+	0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x2F, 0x01, 0x01, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x38,
+	0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x08, 0x04, 0xA6,
+	0xEB, 0x02, 0x1A, 0x03, 0x17, 0x1C, 0x08, 0x01, 0x8E, 0xEB,
+	0x02, 0x36, 0x08, 0x1D, 0x3A, 0xCF, 0x06, 0x6D, 0x61, 0x70,
+	0x63, 0x61, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x71, 0x28, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0x20, 0x66,
+	0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x70,
+	0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x65, 0x76, 0x65,
+	0x72, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x20, 0x75, 0x73, 0x65,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x6F, 0x20,
+	0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75,
+	0x6C, 0x74, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xF2, 0xE5, 0x02, 0xCD, 0xFC, 0xE8, 0x02, 0xDA, 0x03,
+	0xDA, 0x8C, 0x0B, 0xCF, 0x07, 0x65, 0x78, 0x74, 0x72, 0x65,
+	0x6D, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xBF,
+	0x01, 0x28, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20,
+	0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x61, 0x72, 0x67, 0x73,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20,
+	0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E,
+	0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x73, 0x68,
+	0x6F, 0x75, 0x6C, 0x64, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20,
+	0x74, 0x77, 0x6F, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6F, 0x72, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x28, 0x61, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6F, 0x6E, 0x29,
+	0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x61, 0x72,
+	0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74,
+	0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x98,
+	0xB6, 0x02, 0xCD, 0x82, 0xBC, 0x02, 0xDA, 0x03, 0xDA, 0x8F,
+	0x02, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F,
+	0x67, 0x31, 0x30, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x31, 0x30, 0xDA,
+	0x05, 0xCE, 0x29, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C,
+	0x6F, 0x67, 0x31, 0x30, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6C, 0x6F, 0x67,
+	0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x31, 0x30, 0x20, 0x6F,
+	0x66, 0x20, 0x78, 0x2E, 0xCF, 0x04, 0x6E, 0x65, 0x78, 0x74,
+	0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xF9, 0x01, 0xDA, 0x05, 0xCE,
+	0xE8, 0x02, 0x28, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x64, 0x69,
+	0x63, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x0A, 0x47,
+	0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x78, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6F,
+	0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x43,
+	0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+	0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65,
+	0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6F, 0x72, 0x64,
+	0x65, 0x72, 0x2E, 0x20, 0x4B, 0x65, 0x79, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x67, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74,
+	0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20,
+	0x73, 0x65, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+	0x6F, 0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x69,
+	0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x64, 0x61, 0x74,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D,
+	0x75, 0x74, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x75, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+	0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B, 0x65,
+	0x79, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20,
+	0x6E, 0x65, 0x78, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+	0x73, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x74,
+	0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+	0x6F, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6B, 0x65, 0x79,
+	0x73, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68,
+	0x2E, 0x20, 0xCF, 0x03, 0x61, 0x73, 0x6D, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x03, 0x61, 0x73, 0x6D, 0xDA, 0x05, 0xCE, 0xB8,
+	0x01, 0x28, 0x61, 0x73, 0x6D, 0x20, 0x61, 0x73, 0x73, 0x65,
+	0x6D, 0x62, 0x6C, 0x79, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64,
+	0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65, 0x6D,
+	0x62, 0x6C, 0x79, 0x2E, 0x0A, 0x54, 0x68, 0x65, 0x20, 0x73,
+	0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62,
+	0x6C, 0x79, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+	0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x77,
+	0x69, 0x6B, 0x69, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20,
+	0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x0A, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x69, 0x6E,
+	0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x61, 0x73, 0x73, 0x65,
+	0x6D, 0x62, 0x6C, 0x79, 0x2E, 0xCF, 0x06, 0x6C, 0x65, 0x6E,
+	0x67, 0x74, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x90,
+	0x80, 0x40, 0x01, 0x01, 0x00, 0x02, 0xCE, 0x06, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x37, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0xDA, 0x05, 0xCE, 0xB1, 0x01, 0x28, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x64, 0x73, 0x29, 0x0A, 0x0A,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F,
+	0x72, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6E,
+	0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20,
+	0x74, 0x69, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0x20,
+	0x46, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x2D,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72,
+	0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x75, 0x72, 0x65, 0x2E, 0xCF, 0x04, 0x6F, 0x6E, 0x65, 0x3F,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x23, 0x28, 0x6F,
+	0x6E, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F,
+	0x20, 0x31, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xCE, 0x21, 0xCD, 0xB4, 0x22, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xE0, 0x09, 0x02, 0x01, 0x00, 0x03, 0xCE, 0x04, 0x6F,
+	0x6E, 0x65, 0x3F, 0xDA, 0x10, 0x25, 0x01, 0x01, 0x00, 0x42,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x03, 0xA4,
+	0x22, 0x0E, 0xCF, 0x04, 0x68, 0x61, 0x73, 0x68, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0xE6, 0x02, 0xDA, 0x05, 0xCE, 0xD2, 0x01,
+	0x28, 0x68, 0x61, 0x73, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x61,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x79, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73,
+	0x20, 0x61, 0x20, 0x63, 0x68, 0x65, 0x61, 0x70, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C,
+	0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x6F, 0x62, 0x6A,
+	0x65, 0x63, 0x74, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74,
+	0x77, 0x6F, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74,
+	0x6C, 0x79, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x2C, 0x20,
+	0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+	0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x9C,
+	0x03, 0xDA, 0x05, 0xCE, 0xFD, 0x01, 0x28, 0x70, 0x61, 0x72,
+	0x73, 0x65, 0x72, 0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x49,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73,
+	0x74, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65,
+	0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6F,
+	0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x72, 0x72,
+	0x6F, 0x72, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77,
+	0x69, 0x73, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x41, 0x6C,
+	0x73, 0x6F, 0x20, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x65, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x71,
+	0x75, 0x65, 0x75, 0x65, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x62,
+	0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20,
+	0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x65, 0x76, 0x65,
+	0x72, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+	0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x61,
+	0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xCF,
+	0x06, 0x65, 0x76, 0x65, 0x72, 0x79, 0x3F, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x65, 0x76, 0x65, 0x72,
+	0x79, 0x3F, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20,
+	0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+	0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xC8, 0xDD, 0x03, 0xCD, 0xB6, 0xE0, 0x03, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x05, 0x01, 0x00, 0x11,
+	0xCE, 0x06, 0x65, 0x76, 0x65, 0x72, 0x79, 0x3F, 0xDA, 0x10,
+	0x23, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04, 0x02, 0x03,
+	0x1A, 0x04, 0x03, 0x00, 0x17, 0x04, 0x01, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x1A, 0x04, 0x07, 0x00,
+	0x33, 0x04, 0x00, 0x02, 0x1A, 0x04, 0x02, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x17, 0x01, 0x04, 0x00, 0x05, 0x02, 0x02, 0x01,
+	0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x16, 0x01,
+	0x98, 0xDF, 0x03, 0x1A, 0x0A, 0x22, 0x54, 0x02, 0x42, 0x43,
+	0x01, 0x14, 0x15, 0x02, 0x55, 0x5A, 0x01, 0xF1, 0x01, 0x80,
+	0x02, 0xCF, 0x0A, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6, 0x01,
+	0xCB, 0xDA, 0x05, 0xCE, 0x5F, 0x28, 0x72, 0x65, 0x61, 0x64,
+	0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61,
+	0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2C, 0x20, 0x6F,
+	0x72, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x96, 0xA9, 0x06,
+	0xCD, 0xB0, 0xAE, 0x06, 0xDA, 0x03, 0xDA, 0xD2, 0x07, 0xCF,
+	0x0A, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E, 0x74,
+	0x6F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xBF, 0x01,
+	0x28, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x74, 0x61, 0x62, 0x20, 0x26, 0x20, 0x63, 0x6F,
+	0x6C, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x4D, 0x65, 0x72, 0x67,
+	0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C,
+	0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E,
+	0x20, 0x6F, 0x6E, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+	0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68,
+	0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6C,
+	0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72,
+	0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x65,
+	0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x69, 0x67,
+	0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xDA, 0xF0,
+	0x03, 0xCD, 0x96, 0xF5, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xC8, 0x29, 0x08, 0x01, 0x01, 0x1C, 0xCE, 0x0A, 0x6D,
+	0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0xDA,
+	0x10, 0xDA, 0xF9, 0x01, 0x17, 0x02, 0x01, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04, 0x02, 0x03,
+	0x1A, 0x04, 0x17, 0x00, 0x4A, 0x04, 0x01, 0x02, 0x22, 0x05,
+	0x00, 0x00, 0x2C, 0x04, 0x05, 0x00, 0x26, 0x06, 0x00, 0x00,
+	0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00, 0x22, 0x05,
+	0x00, 0x00, 0x1F, 0x05, 0x05, 0x06, 0x19, 0x05, 0x03, 0x00,
+	0x23, 0x05, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x05,
+	0x00, 0x00, 0x1A, 0x05, 0x08, 0x00, 0x17, 0x05, 0x06, 0x00,
+	0x33, 0x07, 0x04, 0x05, 0x34, 0x00, 0x05, 0x07, 0x2C, 0x04,
+	0x06, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x06, 0x07, 0x00,
+	0x18, 0xF3, 0xFF, 0xFF, 0x49, 0x02, 0x03, 0x01, 0x18, 0xEB,
+	0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x14, 0x13, 0xF8, 0xF3,
+	0x03, 0x90, 0x01, 0x01, 0x78, 0x7B, 0x01, 0x1D, 0x20, 0x06,
+	0x59, 0x5C, 0x01, 0x9D, 0x03, 0xAC, 0x03, 0xCF, 0x03, 0x70,
+	0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x8E, 0x80,
+	0x40, 0x03, 0x03, 0x00, 0x02, 0xCE, 0x03, 0x70, 0x75, 0x74,
+	0x34, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x05,
+	0xCE, 0xD7, 0x04, 0x28, 0x70, 0x75, 0x74, 0x20, 0x64, 0x73,
+	0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x29, 0x0A, 0x0A, 0x41, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61,
+	0x74, 0x65, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6D,
+	0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x73,
+	0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x75, 0x72, 0x65, 0x2E, 0x20, 0x49, 0x6E, 0x64, 0x65, 0x78,
+	0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x28,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x29, 0x20,
+	0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70,
+	0x74, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x6E, 0x65, 0x67, 0x61,
+	0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x65, 0x78,
+	0x70, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E,
+	0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x6F,
+	0x75, 0x6E, 0x64, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64,
+	0x65, 0x64, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x65, 0x78, 0x74,
+	0x72, 0x61, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6C,
+	0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E,
+	0x69, 0x6C, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2C, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x73, 0x70,
+	0x61, 0x63, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+	0x65, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x30, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x61, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x2C, 0x20, 0x70, 0x75, 0x74, 0x74, 0x69,
+	0x6E, 0x67, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x61, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+	0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68, 0x69, 0x64, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x69,
+	0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65,
+	0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x74,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74,
+	0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2E, 0x20, 0x50, 0x75, 0x74, 0x74, 0x69, 0x6E, 0x67,
+	0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E,
+	0x69, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+	0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x64,
+	0x73, 0x2E, 0xCF, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x73,
+	0x6C, 0x69, 0x63, 0x65, 0xDA, 0x05, 0xCE, 0xBC, 0x02, 0x28,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x73, 0x6C, 0x69,
+	0x63, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x5B,
+	0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x30, 0x20,
+	0x5B, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x3D, 0x28, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65,
+	0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20,
+	0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x66,
+	0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73,
+	0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+	0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20,
+	0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E, 0x64, 0x65,
+	0x78, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C,
+	0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61,
+	0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x69,
+	0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20,
+	0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66,
+	0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0B, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xD3, 0x02,
+	0xDA, 0x03, 0xD8, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+	0x62, 0x72, 0x65, 0x61, 0x6B, 0xDA, 0x05, 0xCE, 0xB8, 0x02,
+	0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x62, 0x72, 0x65,
+	0x61, 0x6B, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x2D, 0x6F, 0x66, 0x66, 0x73, 0x65,
+	0x74, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73, 0x20, 0x61,
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E,
+	0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x6F, 0x75,
+	0x72, 0x63, 0x65, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x61, 0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73,
+	0x65, 0x74, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x6F, 0x66, 0x66,
+	0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x57, 0x69,
+	0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61,
+	0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B,
+	0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+	0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D,
+	0x70, 0x6C, 0x65, 0x0A, 0x0A, 0x09, 0x28, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20, 0x22,
+	0x63, 0x6F, 0x72, 0x65, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0x22, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x0A, 0x77,
+	0x69, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62,
+	0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20,
+	0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x30, 0x30,
+	0x30, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x63, 0x6F, 0x72, 0x65, 0x2E, 0x6A, 0x61, 0x6E, 0x65,
+	0x74, 0x2E, 0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x73, 0x74, 0x61, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73,
+	0x74, 0x61, 0x74, 0x65, 0xDA, 0x05, 0xCE, 0xCB, 0x02, 0x28,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61,
+	0x74, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x72,
+	0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74,
+	0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20,
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E,
+	0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65,
+	0x73, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+	0x73, 0x74, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+	0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70,
+	0x6C, 0x65, 0x2C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74,
+	0x61, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x27, 0x28, 0x5B,
+	0x22, 0x27, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+	0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6D, 0x69, 0x64, 0x64, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73,
+	0x69, 0x64, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x71, 0x75,
+	0x61, 0x72, 0x65, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65,
+	0x74, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20,
+	0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x65,
+	0x73, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+	0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x75,
+	0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x52, 0x45,
+	0x50, 0x4C, 0x20, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x2E,
+	0xCF, 0x10, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63,
+	0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74, 0xD3, 0x02,
+	0xDA, 0x03, 0xD8, 0x10, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74,
+	0xDA, 0x05, 0xCE, 0xAC, 0x01, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73,
+	0x65, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x73, 0x74, 0x72,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x20,
+	0x69, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x70,
+	0x70, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73,
+	0x74, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20,
+	0x73, 0x6F, 0x6D, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x20, 0x64, 0x6F,
+	0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6E,
+	0x20, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x2E, 0xCF, 0x05, 0x2A,
+	0x65, 0x6E, 0x76, 0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x18, 0x54, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0x6C, 0x96, 0xDA, 0x91, 0x04, 0xDA, 0x13, 0xCF,
+	0x06, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3F, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x23, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8E, 0x2D, 0xCD,
+	0x8A, 0x2E, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x02, 0x01, 0x02, 0x06, 0xCE, 0x06, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x55, 0x2B, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x26, 0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x00,
+	0x00, 0x00, 0x07, 0x03, 0xEA, 0x2D, 0x0E, 0x03, 0x05, 0x16,
+	0xCF, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x69, 0x6E,
+	0x73, 0x65, 0x72, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x69, 0x6E, 0x73, 0x65,
+	0x72, 0x74, 0xDA, 0x05, 0xCE, 0x80, 0x02, 0x28, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74,
+	0x20, 0x61, 0x72, 0x72, 0x20, 0x61, 0x74, 0x20, 0x26, 0x20,
+	0x78, 0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72,
+	0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x78,
+	0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x61, 0x72, 0x72, 0x20, 0x61, 0x74, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x61, 0x74, 0x2E, 0x20,
+	0x61, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+	0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x67, 0x65, 0x72, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2E, 0x20, 0x41, 0x20, 0x6E, 0x65, 0x67,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+	0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x73, 0x75, 0x63,
+	0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x73,
+	0x65, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20,
+	0x2D, 0x31, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x73,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0xCF, 0x0E, 0x64, 0x65, 0x62, 0x75, 0x67,
+	0x2F, 0x75, 0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x64, 0x65, 0x62, 0x75, 0x67,
+	0x2F, 0x75, 0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xDA,
+	0x05, 0xCE, 0x47, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+	0x75, 0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20, 0x66,
+	0x75, 0x6E, 0x20, 0x5B, 0x2C, 0x70, 0x63, 0x3D, 0x30, 0x5D,
+	0x29, 0x0A, 0x0A, 0x55, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x61,
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E,
+	0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72,
+	0x65, 0x61, 0x6B, 0x2E, 0xCF, 0x07, 0x6B, 0x65, 0x79, 0x77,
+	0x6F, 0x72, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6B,
+	0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0xDA, 0x05, 0xCE, 0xA7,
+	0x01, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x20,
+	0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+	0x77, 0x6F, 0x72, 0x64, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6F,
+	0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E,
+	0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74,
+	0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x56,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+	0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20,
+	0x74, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x76,
+	0x69, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63,
+	0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0xCF, 0x0D,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x76, 0x65, 0x72, 0x73,
+	0x69, 0x6F, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xEC, 0x02,
+	0xDA, 0x05, 0xCE, 0x30, 0x54, 0x68, 0x65, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61,
+	0x6D, 0x2E, 0xCF, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x70, 0x72, 0x65, 0x74, 0x74, 0x79, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0xBA, 0x02, 0xDA, 0x05, 0xCE, 0xB1, 0x01, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x70, 0x72, 0x65,
+	0x74, 0x74, 0x79, 0x20, 0x78, 0x20, 0x5B, 0x2C, 0x64, 0x65,
+	0x70, 0x74, 0x68, 0x3D, 0x34, 0x20, 0x5B, 0x2C, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x3D, 0x40, 0x22, 0x22, 0x5D, 0x5D,
+	0x29, 0x0A, 0x0A, 0x50, 0x72, 0x65, 0x74, 0x74, 0x79, 0x20,
+	0x70, 0x72, 0x69, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x4F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61,
+	0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x73, 0x65, 0x74, 0x74,
+	0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x78, 0x20, 0x72, 0x65,
+	0x63, 0x75, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65,
+	0x70, 0x74, 0x68, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x77, 0x65,
+	0x6C, 0x6C, 0x20, 0x61, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x07, 0x6F, 0x73,
+	0x2F, 0x64, 0x61, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x07, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74, 0x65, 0xDA, 0x05,
+	0xCE, 0xFF, 0x03, 0x28, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74,
+	0x65, 0x20, 0x5B, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x5D, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x74, 0x69, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20,
+	0x64, 0x61, 0x74, 0x65, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x69,
+	0x6D, 0x65, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x74,
+	0x69, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76,
+	0x65, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x6F, 0x6C, 0x6C,
+	0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x4E, 0x6F,
+	0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6C,
+	0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x30, 0x2D, 0x69, 0x6E, 0x64, 0x65,
+	0x78, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x09, 0x3A, 0x73, 0x65,
+	0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65,
+	0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x5B, 0x30, 0x2D, 0x36,
+	0x31, 0x5D, 0x0A, 0x09, 0x3A, 0x6D, 0x69, 0x6E, 0x75, 0x74,
+	0x65, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x69, 0x6E, 0x75, 0x74,
+	0x65, 0x73, 0x20, 0x5B, 0x30, 0x2D, 0x35, 0x39, 0x5D, 0x0A,
+	0x09, 0x3A, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20,
+	0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+	0x66, 0x20, 0x68, 0x6F, 0x75, 0x72, 0x73, 0x20, 0x5B, 0x30,
+	0x2D, 0x32, 0x33, 0x5D, 0x0A, 0x09, 0x3A, 0x6D, 0x6F, 0x6E,
+	0x74, 0x68, 0x2D, 0x64, 0x61, 0x79, 0x20, 0x2D, 0x20, 0x64,
+	0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x6F, 0x6E, 0x74,
+	0x68, 0x20, 0x5B, 0x30, 0x2D, 0x33, 0x30, 0x5D, 0x0A, 0x09,
+	0x3A, 0x6D, 0x6F, 0x6E, 0x74, 0x68, 0x20, 0x2D, 0x20, 0x6D,
+	0x6F, 0x6E, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x79, 0x65,
+	0x61, 0x72, 0x20, 0x5B, 0x30, 0x2C, 0x20, 0x31, 0x31, 0x5D,
+	0x0A, 0x09, 0x3A, 0x79, 0x65, 0x61, 0x72, 0x20, 0x2D, 0x20,
+	0x79, 0x65, 0x61, 0x72, 0x73, 0x20, 0x73, 0x69, 0x6E, 0x63,
+	0x65, 0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x30, 0x20, 0x28,
+	0x65, 0x2E, 0x67, 0x2E, 0x20, 0x32, 0x30, 0x31, 0x39, 0x29,
+	0x0A, 0x09, 0x3A, 0x77, 0x65, 0x65, 0x6B, 0x2D, 0x64, 0x61,
+	0x79, 0x20, 0x2D, 0x20, 0x64, 0x61, 0x79, 0x20, 0x6F, 0x66,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x65, 0x65, 0x6B, 0x20,
+	0x5B, 0x30, 0x2D, 0x36, 0x5D, 0x0A, 0x09, 0x3A, 0x79, 0x65,
+	0x61, 0x72, 0x2D, 0x64, 0x61, 0x79, 0x20, 0x2D, 0x20, 0x64,
+	0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x79, 0x65, 0x61, 0x72, 0x20, 0x5B, 0x30, 0x2D, 0x33, 0x36,
+	0x35, 0x5D, 0x0A, 0x09, 0x3A, 0x64, 0x73, 0x74, 0x20, 0x2D,
+	0x20, 0x49, 0x66, 0x20, 0x44, 0x61, 0x79, 0x20, 0x4C, 0x69,
+	0x67, 0x68, 0x74, 0x20, 0x53, 0x61, 0x76, 0x69, 0x6E, 0x67,
+	0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x66,
+	0x66, 0x65, 0x63, 0x74, 0xCF, 0x06, 0x65, 0x6D, 0x70, 0x74,
+	0x79, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x22,
+	0x28, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x3F, 0x20, 0x78, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D,
+	0x70, 0x74, 0x79, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xD6, 0x3A, 0xCD, 0xCC, 0x3B, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00, 0x04, 0xCE, 0x06,
+	0x65, 0x6D, 0x70, 0x74, 0x79, 0x3F, 0xDA, 0x10, 0x37, 0x00,
+	0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x42, 0x00, 0x01, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x07, 0x01, 0xB4, 0x3B, 0x14, 0x03,
+	0x09, 0x0C, 0xCF, 0x0D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+	0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x0D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+	0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xDA, 0x05, 0xCE, 0xF2,
+	0x01, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x69,
+	0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A,
+	0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x65,
+	0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x62, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x69, 0x70, 0x75, 0x6C,
+	0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x65,
+	0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x63, 0x68, 0x75, 0x6E,
+	0x6B, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x6F,
+	0x75, 0x6C, 0x64, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20,
+	0x61, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20,
+	0x61, 0x64, 0x64, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20,
+	0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70,
+	0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x72, 0x2E, 0xCF, 0x0A, 0x69, 0x6E, 0x74, 0x65, 0x72,
+	0x6C, 0x65, 0x61, 0x76, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x5F, 0x28, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6C,
+	0x65, 0x61, 0x76, 0x65, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6C,
+	0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+	0x20, 0x63, 0x6F, 0x6C, 0x2C, 0x20, 0x20, 0x74, 0x68, 0x65,
+	0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F,
+	0x6E, 0x64, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xA6, 0x87, 0x04, 0xCD, 0xAA,
+	0x8C, 0x04, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x09,
+	0x07, 0x00, 0x04, 0x1D, 0xCE, 0x0A, 0x69, 0x6E, 0x74, 0x65,
+	0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0xDA, 0x10, 0xDA, 0xA6,
+	0x0B, 0xDA, 0xEB, 0x02, 0xDA, 0x90, 0x02, 0xDA, 0xFE, 0x01,
+	0x38, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x25, 0x03,
+	0x00, 0x00, 0x45, 0x03, 0x02, 0x03, 0x1A, 0x03, 0x18, 0x00,
+	0x26, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x26, 0x04,
+	0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x2E, 0x03, 0x00, 0x00,
+	0x26, 0x03, 0x02, 0x00, 0x2F, 0x04, 0x03, 0x00, 0x17, 0x03,
+	0x04, 0x00, 0x25, 0x04, 0x00, 0x00, 0x43, 0x05, 0x04, 0x03,
+	0x1A, 0x05, 0x0D, 0x00, 0x25, 0x05, 0x00, 0x00, 0x43, 0x06,
+	0x05, 0x02, 0x1A, 0x06, 0x08, 0x00, 0x33, 0x06, 0x00, 0x05,
+	0x33, 0x06, 0x06, 0x04, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x06,
+	0x03, 0x00, 0x2F, 0x06, 0x06, 0x00, 0x49, 0x05, 0x02, 0x01,
+	0x18, 0xFA, 0xFF, 0xFF, 0x49, 0x04, 0x03, 0x01, 0x18, 0xF5,
+	0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x31, 0x01, 0x82, 0x89,
+	0x04, 0x18, 0x01, 0x34, 0x00, 0x02, 0x2E, 0x05, 0x01, 0x0B,
+	0xB2, 0x02, 0x04, 0x46, 0xA1, 0x02, 0x03, 0x09, 0x0C, 0x01,
+	0x11, 0x14, 0x06, 0x4E, 0x88, 0x01, 0x01, 0xA8, 0x01, 0xB1,
+	0x01, 0x01, 0x09, 0x10, 0x03, 0x1F, 0x22, 0x04, 0x7D, 0x80,
+	0x01, 0x01, 0xA9, 0x03, 0xBA, 0x03, 0xCF, 0x08, 0x70, 0x6F,
+	0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x65, 0x28, 0x70, 0x6F, 0x73, 0x74, 0x77,
+	0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x29, 0x0A, 0x0A, 0x44, 0x6F, 0x20, 0x61, 0x20, 0x70, 0x6F,
+	0x73, 0x74, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74,
+	0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x28, 0x66,
+	0x20, 0x78, 0x29, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x76,
+	0x65, 0x72, 0x79, 0x20, 0x76, 0x69, 0x73, 0x69, 0x74, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xFE, 0xCA, 0x03, 0xCD, 0xB4, 0xCD, 0x03, 0xDA,
+	0x03, 0xDA, 0xEA, 0x0A, 0xCF, 0x06, 0x73, 0x79, 0x6D, 0x62,
+	0x6F, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xDE, 0x07, 0xDA,
+	0x05, 0xCE, 0xA4, 0x01, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+	0x6C, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+	0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x62, 0x79, 0x20, 0x63,
+	0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69,
+	0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20,
+	0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x76, 0x69, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+	0x62, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+	0x63, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xCF, 0x09,
+	0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+	0x63, 0x65, 0x69, 0x6C, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C,
+	0x65, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E, 0x75,
+	0x6D, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x65, 0x73,
+	0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x78, 0x2E, 0xCF,
+	0x03, 0x64, 0x6F, 0x63, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x34, 0x28, 0x64, 0x6F, 0x63, 0x20, 0x73, 0x79, 0x6D,
+	0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x77, 0x73, 0x20, 0x64,
+	0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x79, 0x6D,
+	0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0x8C, 0xDE, 0x04, 0xCD, 0xC0, 0xDF,
+	0x04, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x03,
+	0x01, 0x03, 0x08, 0xCE, 0x03, 0x64, 0x6F, 0x63, 0xDA, 0x10,
+	0xDA, 0xA2, 0x04, 0xDA, 0xAD, 0x0A, 0xDA, 0xDD, 0x0B, 0x26,
+	0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x3D, 0x00, 0x00,
+	0x00, 0x26, 0x01, 0x01, 0x00, 0x26, 0x02, 0x02, 0x00, 0x2D,
+	0x01, 0x02, 0x00, 0x3D, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00,
+	0x00, 0x05, 0x08, 0x98, 0xDF, 0x04, 0x26, 0xCF, 0x09, 0x69,
+	0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F, 0x73, 0x65, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x66, 0x28, 0x69, 0x6E, 0x74,
+	0x65, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x73, 0x65, 0x70,
+	0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71,
+	0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x73,
+	0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62,
+	0x79, 0x20, 0x20, 0x73, 0x65, 0x70, 0x2E, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xEA, 0x99, 0x04, 0xCD, 0xCE,
+	0x9E, 0x04, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x07, 0x02, 0x02, 0x17, 0xCE, 0x09, 0x69, 0x6E, 0x74, 0x65,
+	0x72, 0x70, 0x6F, 0x73, 0x65, 0xDA, 0x10, 0xDA, 0xFD, 0x01,
+	0xDA, 0xFE, 0x01, 0x37, 0x02, 0x01, 0x00, 0x08, 0x03, 0x02,
+	0x02, 0x05, 0x03, 0x03, 0xFF, 0x2B, 0x03, 0x00, 0x00, 0x26,
+	0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x25, 0x05, 0x00,
+	0x00, 0x45, 0x04, 0x02, 0x05, 0x1A, 0x04, 0x05, 0x00, 0x25,
+	0x06, 0x00, 0x00, 0x33, 0x05, 0x01, 0x06, 0x25, 0x06, 0x00,
+	0x00, 0x34, 0x03, 0x06, 0x05, 0x25, 0x04, 0x01, 0x00, 0x43,
+	0x05, 0x04, 0x02, 0x1A, 0x05, 0x07, 0x00, 0x33, 0x06, 0x01,
+	0x04, 0x2D, 0x03, 0x00, 0x06, 0x26, 0x05, 0x01, 0x00, 0x2F,
+	0x05, 0x05, 0x00, 0x49, 0x04, 0x02, 0x01, 0x18, 0xFB, 0xFF,
+	0xFF, 0x03, 0x03, 0x00, 0x00, 0x34, 0x01, 0xE6, 0x9B, 0x04,
+	0x16, 0x01, 0x4E, 0x05, 0x01, 0x05, 0x0C, 0x03, 0x15, 0x18,
+	0x02, 0x46, 0x23, 0x01, 0x07, 0x3A, 0x02, 0x32, 0x35, 0x02,
+	0x15, 0x18, 0x01, 0x36, 0x1B, 0x01, 0x26, 0x00, 0x01, 0x0D,
+	0x70, 0x01, 0x52, 0x6B, 0x03, 0x27, 0x2A, 0x01, 0x4A, 0x33,
+	0x01, 0x73, 0x76, 0x01, 0xD5, 0x03, 0xE4, 0x03, 0xCF, 0x10,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+	0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62,
+	0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xDA, 0x05,
+	0xCE, 0x5B, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+	0x62, 0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x65, 0x61, 0x72,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20,
+	0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76,
+	0x65, 0x6E, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2E, 0xCF, 0x0B, 0x62, 0x61, 0x64, 0x2D, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x44, 0x28, 0x62, 0x61, 0x64, 0x2D, 0x63,
+	0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x6D, 0x73, 0x67,
+	0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x66, 0x20, 0x77, 0x68,
+	0x65, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+	0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF0,
+	0xA3, 0x05, 0xCD, 0xF8, 0xA6, 0x05, 0xDA, 0x03, 0xDA, 0x99,
+	0x03, 0xCF, 0x06, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0xD3,
+	0x02, 0xDA, 0x03, 0xC8, 0x69, 0x57, 0x14, 0x8B, 0x0A, 0xBF,
+	0x05, 0x40, 0xDA, 0x05, 0xCE, 0x1C, 0x54, 0x68, 0x65, 0x20,
+	0x62, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x61, 0x6C, 0x20,
+	0x6C, 0x6F, 0x67, 0x2E, 0xCF, 0x11, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x64, 0x65, 0x63, 0x6F,
+	0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0xDA, 0x05, 0xCE, 0xE5,
+	0x01, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x64,
+	0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x5B, 0x2C, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x5D, 0x29, 0x0A, 0x0A, 0x44,
+	0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6D, 0x61, 0x64, 0x65,
+	0x20, 0x62, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2E,
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E,
+	0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x6E,
+	0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72,
+	0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x69, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x76, 0x61,
+	0x6C, 0x69, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E,
+	0xCF, 0x0D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E,
+	0x62, 0x72, 0x65, 0x61, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x0D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E, 0x62,
+	0x72, 0x65, 0x61, 0x6B, 0xDA, 0x05, 0xCE, 0xC4, 0x01, 0x28,
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72,
+	0x65, 0x61, 0x6B, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x2D, 0x6F, 0x66, 0x66, 0x73,
+	0x65, 0x74, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76,
+	0x65, 0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70,
+	0x6F, 0x69, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x61, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6B,
+	0x65, 0x79, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x67, 0x69,
+	0x76, 0x65, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6F,
+	0x66, 0x66, 0x73, 0x65, 0x74, 0x2E, 0x20, 0x41, 0x6E, 0x20,
+	0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x30, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+	0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F,
+	0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x72,
+	0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x63,
+	0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x66,
+	0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xCF, 0x08, 0x6F, 0x73, 0x2F,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+	0xB6, 0x06, 0xDA, 0x05, 0xCE, 0xA2, 0x01, 0x28, 0x6F, 0x73,
+	0x2F, 0x77, 0x68, 0x69, 0x63, 0x68, 0x29, 0x0A, 0x0A, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x70, 0x65,
+	0x72, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x79, 0x73,
+	0x74, 0x65, 0x6D, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A,
+	0x0A, 0x0A, 0x09, 0x3A, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77,
+	0x73, 0x20, 0x2D, 0x20, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73,
+	0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77,
+	0x73, 0x0A, 0x09, 0x3A, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x20,
+	0x2D, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x6D, 0x61,
+	0x63, 0x6F, 0x73, 0x0A, 0x09, 0x3A, 0x70, 0x6F, 0x73, 0x69,
+	0x78, 0x20, 0x2D, 0x20, 0x41, 0x20, 0x50, 0x4F, 0x53, 0x49,
+	0x58, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62,
+	0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0xCF,
+	0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E,
+	0x63, 0x61, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x88, 0x01,
+	0xDA, 0x05, 0xCE, 0xB7, 0x02, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x61,
+	0x72, 0x72, 0x20, 0x26, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65,
+	0x6E, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61,
+	0x72, 0x69, 0x61, 0x64, 0x69, 0x63, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x73, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x73, 0x29, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+	0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6D, 0x75, 0x73,
+	0x74, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74,
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+	0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x73,
+	0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+	0x65, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61,
+	0x72, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74,
+	0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+	0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74,
+	0x6F, 0x20, 0x61, 0x72, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x61, 0x72, 0x72, 0x2E, 0xCF, 0x0F, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0x2D,
+	0x61, 0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+	0x2D, 0x61, 0x6C, 0x6C, 0xDA, 0x05, 0xCE, 0xCE, 0x02, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E,
+	0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x73, 0x74, 0x72,
+	0x29, 0x0A, 0x0A, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65,
+	0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+	0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x20,
+	0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+	0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+	0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x73,
+	0x2E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x70,
+	0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E,
+	0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x75,
+	0x6E, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+	0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+	0x65, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+	0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61,
+	0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20,
+	0x6E, 0x6F, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x63, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+	0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E,
+	0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x2E, 0xCF, 0x09, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x2D, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x4A, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x2D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20,
+	0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66,
+	0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76,
+	0x61, 0x74, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70,
+	0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0xDA, 0x27, 0xCB, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF8, 0x12, 0xCD, 0xFC,
+	0x14, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x04,
+	0x01, 0x03, 0x06, 0xCE, 0x09, 0x64, 0x65, 0x66, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x2D, 0xDA, 0x10, 0xDA, 0x27, 0xDA, 0xB6,
+	0x01, 0xDA, 0xBE, 0x02, 0x26, 0x02, 0x00, 0x00, 0x26, 0x03,
+	0x01, 0x00, 0x2D, 0x00, 0x02, 0x03, 0x4C, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0x04, 0x06,
+	0xB0, 0x14, 0x4A, 0xCF, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6D,
+	0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x8A, 0x80, 0x40,
+	0x02, 0x02, 0x00, 0x02, 0xCE, 0x06, 0x72, 0x65, 0x73, 0x75,
+	0x6D, 0x65, 0x31, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+	0xDA, 0x05, 0xCE, 0xE0, 0x02, 0x28, 0x72, 0x65, 0x73, 0x75,
+	0x6D, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x5B,
+	0x2C, 0x78, 0x5D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x73, 0x75,
+	0x6D, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6F,
+	0x72, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65,
+	0x64, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C,
+	0x6C, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C,
+	0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x61, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x70,
+	0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73,
+	0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72,
+	0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73,
+	0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+	0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x79, 0x69, 0x65,
+	0x6C, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF, 0x06, 0x73,
+	0x6F, 0x72, 0x74, 0x65, 0x64, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+	0x05, 0xCE, 0x4A, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64,
+	0x20, 0x69, 0x6E, 0x64, 0x20, 0x62, 0x79, 0x29, 0x0A, 0x0A,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x6F, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x79, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+	0x6C, 0x64, 0x20, 0x6F, 0x6E, 0x65, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xFE, 0xD1, 0x02, 0xCD, 0xE4, 0xD3,
+	0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02,
+	0x02, 0x02, 0x06, 0xCE, 0x06, 0x73, 0x6F, 0x72, 0x74, 0x65,
+	0x64, 0xDA, 0x10, 0xDA, 0x87, 0x01, 0xDA, 0xCF, 0x09, 0x2B,
+	0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
+	0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x00, 0x01, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x08, 0x03, 0xBA, 0xD3, 0x02, 0x20, 0x03,
+	0x0B, 0x14, 0xCF, 0x0A, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x4A, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x66, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67,
+	0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xBA, 0xB4, 0x02, 0xCD, 0x92, 0xB6, 0x02,
+	0xDA, 0x03, 0xDA, 0xBF, 0x05, 0xDA, 0xE9, 0x09, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x2E, 0x28, 0x64, 0x69, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x3F, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xEC,
+	0x32, 0xCD, 0xCA, 0x34, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x02, 0x01, 0x03, 0x0B, 0xCE, 0x0B, 0x64, 0x69,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x3F, 0xDA,
+	0x10, 0xDA, 0x1D, 0xDA, 0x57, 0xDA, 0x56, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x48, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x03,
+	0x00, 0x23, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x26,
+	0x01, 0x02, 0x00, 0x1F, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00,
+	0x00, 0x0D, 0x03, 0xEA, 0x33, 0x0E, 0x02, 0x20, 0x08, 0x03,
+	0x07, 0x30, 0x03, 0x2C, 0x2D, 0xCF, 0x0C, 0x61, 0x6C, 0x6C,
+	0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x4B, 0x28, 0x61, 0x6C,
+	0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73,
+	0x20, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x47,
+	0x65, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x79, 0x6D,
+	0x62, 0x6F, 0x6C, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+	0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+	0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xA8,
+	0x85, 0x07, 0xCD, 0xEA, 0x8A, 0x07, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xC0, 0x09, 0x09, 0x01, 0x08, 0x39, 0xCE, 0x0C,
+	0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x73, 0xDA, 0x10, 0xDA, 0x13, 0xDA, 0xFE, 0x01, 0xDA,
+	0xD6, 0x07, 0xDA, 0xF9, 0x01, 0xDA, 0x1D, 0xDA, 0x1F, 0xDA,
+	0xF6, 0x06, 0xDA, 0xCF, 0x09, 0x22, 0x02, 0x00, 0x00, 0x48,
+	0x01, 0x02, 0x00, 0x1A, 0x01, 0x03, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x38,
+	0x02, 0x00, 0x00, 0x1A, 0x01, 0x08, 0x00, 0x2C, 0x02, 0x01,
+	0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x00, 0x03, 0x00, 0x2B,
+	0x01, 0x00, 0x00, 0x26, 0x00, 0x02, 0x00, 0x2F, 0x01, 0x00,
+	0x00, 0x18, 0xF9, 0xFF, 0xFF, 0x3C, 0x01, 0x00, 0x00, 0x17,
+	0x00, 0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x37, 0x01, 0x03,
+	0x00, 0x17, 0x02, 0x01, 0x00, 0x25, 0x01, 0x00, 0x00, 0x43,
+	0x04, 0x01, 0x02, 0x1A, 0x04, 0x1D, 0x00, 0x33, 0x04, 0x03,
+	0x01, 0x22, 0x05, 0x00, 0x00, 0x2C, 0x04, 0x05, 0x00, 0x26,
+	0x06, 0x03, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05,
+	0x00, 0x22, 0x05, 0x00, 0x00, 0x1F, 0x05, 0x05, 0x06, 0x19,
+	0x05, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x24, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x0E, 0x00, 0x17,
+	0x05, 0x06, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x07, 0x04,
+	0x00, 0x2F, 0x07, 0x07, 0x00, 0x26, 0x08, 0x05, 0x00, 0x48,
+	0x07, 0x07, 0x08, 0x1A, 0x07, 0x03, 0x00, 0x23, 0x07, 0x00,
+	0x00, 0x34, 0x00, 0x05, 0x07, 0x2C, 0x04, 0x06, 0x00, 0x26,
+	0x07, 0x03, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x18, 0xED, 0xFF,
+	0xFF, 0x49, 0x01, 0x02, 0x01, 0x18, 0xE5, 0xFF, 0xFF, 0x2B,
+	0x00, 0x00, 0x00, 0x26, 0x01, 0x06, 0x00, 0x2F, 0x03, 0x01,
+	0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x01, 0x07, 0x00, 0x30,
+	0x01, 0x00, 0x00, 0x35, 0x06, 0xDA, 0x86, 0x07, 0x24, 0x01,
+	0x2C, 0x09, 0x01, 0x42, 0x54, 0x03, 0x12, 0x49, 0x03, 0x36,
+	0x01, 0x01, 0x47, 0x4C, 0x02, 0x78, 0x47, 0x14, 0x2E, 0x9E,
+	0x01, 0x05, 0x74, 0xAF, 0x01, 0x01, 0x73, 0xB0, 0x01, 0x02,
+	0x96, 0x01, 0x97, 0x01, 0x06, 0x95, 0x01, 0x98, 0x01, 0x03,
+	0xD8, 0x01, 0xA3, 0x01, 0x03, 0x0B, 0x0E, 0xCF, 0x05, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x3B, 0x28, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xBA, 0x80,
+	0x04, 0xCD, 0xF4, 0x83, 0x04, 0xDA, 0x03, 0xDA, 0xE5, 0x04,
+	0xCF, 0x08, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x64, 0x65, 0x73, 0x63,
+	0x72, 0x69, 0x62, 0x65, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x64,
+	0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x68,
+	0x75, 0x6D, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E, 0xCF,
+	0x0A, 0x73, 0x61, 0x76, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0xB6, 0x01, 0xCB, 0xDA,
+	0x05, 0xCE, 0x8A, 0x01, 0x28, 0x73, 0x61, 0x76, 0x65, 0x2D,
+	0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x70,
+	0x61, 0x74, 0x68, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x64, 0x65,
+	0x70, 0x73, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x73, 0x74, 0x61, 0x6D, 0x70, 0x29, 0x0A, 0x0A, 0x57, 0x72,
+	0x69, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x6C,
+	0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+	0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x20, 0x62, 0x65, 0x20,
+	0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x65, 0x64, 0x20,
+	0x61, 0x72, 0x65, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x70, 0x65,
+	0x64, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xCE,
+	0xA0, 0x06, 0xCD, 0x90, 0xA9, 0x06, 0xDA, 0x03, 0xDA, 0xE8,
+	0x07, 0xCF, 0x07, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3F,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x21, 0x28, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x90, 0x2C,
+	0xCD, 0x8A, 0x2D, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x07, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x56,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00,
+	0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01,
+	0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0xE8, 0x2C, 0x0E, 0x03,
+	0x05, 0x18, 0xCF, 0x04, 0x6B, 0x65, 0x65, 0x70, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xA3, 0x01, 0x28, 0x6B, 0x65,
+	0x65, 0x70, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+	0x64, 0x29, 0x0A, 0x0A, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20,
+	0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E,
+	0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x20,
+	0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28, 0x70, 0x72, 0x65,
+	0x64, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68,
+	0x79, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD0, 0xF2, 0x02,
+	0xCD, 0xF6, 0xF6, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xE0, 0x09, 0x06, 0x02, 0x01, 0x10, 0xCE, 0x04, 0x6B, 0x65,
+	0x65, 0x70, 0xDA, 0x10, 0xDA, 0xFE, 0x01, 0x38, 0x02, 0x00,
+	0x00, 0x37, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25,
+	0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A, 0x05, 0x0A,
+	0x00, 0x33, 0x05, 0x01, 0x03, 0x2B, 0x05, 0x00, 0x00, 0x2F,
+	0x05, 0x00, 0x00, 0x1A, 0x05, 0x04, 0x00, 0x2C, 0x02, 0x05,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x49,
+	0x03, 0x04, 0x01, 0x18, 0xF8, 0xFF, 0xFF, 0x03, 0x02, 0x00,
+	0x00, 0x19, 0x01, 0xB4, 0xF5, 0x02, 0x18, 0x06, 0x20, 0x7C,
+	0x02, 0x48, 0x7F, 0x01, 0x15, 0x4C, 0x03, 0x3C, 0x3D, 0x02,
+	0x6D, 0x72, 0x01, 0x83, 0x03, 0x92, 0x03, 0xCF, 0x07, 0x67,
+	0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x38, 0x28, 0x67, 0x65, 0x74, 0x6C, 0x69,
+	0x6E, 0x65, 0x20, 0x62, 0x75, 0x66, 0x20, 0x70, 0x20, 0x26,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61, 0x64, 0x20, 0x61, 0x20,
+	0x6C, 0x69, 0x6E, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x73, 0x74, 0x64, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFE, 0xA6, 0x05,
+	0xCD, 0xB6, 0xA9, 0x05, 0xDA, 0x03, 0xDA, 0x92, 0x03, 0xCF,
+	0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0xD3, 0x02, 0xDA, 0x03,
+	0xD7, 0xCD, 0xBE, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x10,
+	0xCE, 0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0x17, 0x01, 0x00,
+	0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x4B,
+	0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00,
+	0x05, 0x42, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05,
+	0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05,
+	0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00, 0x03,
+	0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+	0x00, 0xDA, 0x05, 0xCE, 0x63, 0x28, 0x6E, 0x6F, 0x74, 0x3D,
+	0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E,
+	0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63,
+	0x61, 0x6C, 0x6C, 0x79, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+	0x20, 0x28, 0x33, 0x2E, 0x30, 0x20, 0x6E, 0x6F, 0x74, 0x3D,
+	0x3D, 0x20, 0x34, 0x29, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C,
+	0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0E, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2F, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+	0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xD6, 0x07, 0xDA, 0x05, 0xCE,
+	0x83, 0x01, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x67,
+	0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x20, 0x74, 0x61,
+	0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70,
+	0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20,
+	0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2C,
+	0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79,
+	0x70, 0x65, 0x2E, 0xCF, 0x12, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xDF, 0x01,
+	0xDA, 0x05, 0xCE, 0xD6, 0x01, 0x28, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x75,
+	0x73, 0x68, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x6F, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x4E, 0x6F,
+	0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+	0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72,
+	0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72,
+	0x65, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x75,
+	0x73, 0x68, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+	0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20,
+	0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F,
+	0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF,
+	0x06, 0x6F, 0x73, 0x2F, 0x63, 0x77, 0x64, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x06, 0x6F, 0x73, 0x2F, 0x63, 0x77, 0x64, 0xDA,
+	0x05, 0xCE, 0x30, 0x28, 0x6F, 0x73, 0x2F, 0x63, 0x77, 0x64,
+	0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67,
+	0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+	0x2E, 0xCF, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0xED, 0x01, 0x28, 0x72, 0x65, 0x70,
+	0x6C, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x6F,
+	0x6E, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x26, 0x29,
+	0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65,
+	0x70, 0x6C, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65,
+	0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20,
+	0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F,
+	0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x20,
+	0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E,
+	0x6B, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+	0x66, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+	0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x70,
+	0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x68,
+	0x65, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+	0x6C, 0x20, 0x69, 0x73, 0x20, 0x20, 0x63, 0x61, 0x75, 0x67,
+	0x68, 0x74, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0x9C, 0xF8, 0x06, 0xCD, 0xF8, 0x82, 0x07, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xD0, 0x0B, 0x09, 0x02, 0x07, 0x18, 0x01,
+	0xCE, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xDA, 0x10, 0xDA, 0x82,
+	0x03, 0xDA, 0x84, 0x03, 0xDA, 0x85, 0x03, 0xDA, 0x86, 0x03,
+	0xCE, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xDA, 0x88, 0x03, 0xDA,
+	0xB7, 0x03, 0x28, 0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00,
+	0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x07,
+	0x00, 0x00, 0x48, 0x06, 0x07, 0x01, 0x1A, 0x06, 0x04, 0x00,
+	0x2A, 0x07, 0x00, 0x00, 0x17, 0x05, 0x07, 0x00, 0x18, 0x02,
+	0x00, 0x00, 0x17, 0x05, 0x01, 0x00, 0x17, 0x06, 0x05, 0x00,
+	0x26, 0x07, 0x01, 0x00, 0x26, 0x08, 0x02, 0x00, 0x2D, 0x07,
+	0x00, 0x08, 0x26, 0x07, 0x03, 0x00, 0x26, 0x08, 0x04, 0x00,
+	0x2D, 0x06, 0x07, 0x08, 0x26, 0x07, 0x05, 0x00, 0x2C, 0x07,
+	0x04, 0x00, 0x3B, 0x07, 0x00, 0x00, 0x2B, 0x07, 0x00, 0x00,
+	0x26, 0x08, 0x06, 0x00, 0x30, 0x08, 0x00, 0x00, 0xCD, 0x80,
+	0x80, 0xA0, 0x0D, 0x04, 0x02, 0x07, 0x16, 0x01, 0xDA, 0x10,
+	0xDA, 0xAD, 0x03, 0xDA, 0xAE, 0x03, 0xDA, 0x03, 0xCF, 0x01,
+	0x5F, 0xDA, 0xBA, 0x02, 0xDA, 0xD2, 0x04, 0xDA, 0x93, 0x03,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x02,
+	0x02, 0x00, 0x26, 0x03, 0x01, 0x00, 0x48, 0x02, 0x02, 0x03,
+	0x1A, 0x02, 0x0E, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2C, 0x03,
+	0x01, 0x00, 0x3C, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x04,
+	0x26, 0x02, 0x03, 0x00, 0x34, 0x00, 0x02, 0x03, 0x25, 0x03,
+	0x14, 0x00, 0x2C, 0x01, 0x03, 0x00, 0x26, 0x00, 0x04, 0x00,
+	0x2F, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x00,
+	0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x01, 0x00,
+	0x26, 0x03, 0x06, 0x00, 0x30, 0x03, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x18, 0x03, 0xBC, 0xFD, 0x06, 0x1E, 0x03,
+	0x0B, 0xA4, 0x03, 0x06, 0xB2, 0x01, 0x8D, 0x03, 0x04, 0x86,
+	0x01, 0x0D, 0x03, 0x0D, 0x10, 0x03, 0x6C, 0x0B, 0x1D, 0x01,
+	0x9C, 0xF8, 0x06, 0xDC, 0x0A, 0x02, 0x94, 0x04, 0xC9, 0x0A,
+	0x01, 0x17, 0x1A, 0x03, 0x34, 0xFE, 0x03, 0x01, 0x24, 0x25,
+	0x04, 0x23, 0x26, 0x0C, 0xB2, 0x04, 0xB1, 0x02, 0xDA, 0xE8,
+	0x09, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x2E, 0x28,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0x20, 0x78,
+	0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+	0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xCE, 0x34, 0xCD, 0xAA, 0x36, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x03, 0x0B, 0xCE,
+	0x08, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0xDA,
+	0x10, 0xDA, 0x1D, 0xDA, 0x55, 0xDA, 0x58, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x48, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x03,
+	0x00, 0x23, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x26,
+	0x01, 0x02, 0x00, 0x1F, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00,
+	0x00, 0x0D, 0x03, 0xCC, 0x35, 0x0E, 0x02, 0x20, 0x08, 0x03,
+	0x07, 0x2E, 0x03, 0x2C, 0x2D, 0xCF, 0x02, 0x25, 0x3D, 0xD4,
+	0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x28, 0x28, 0x25, 0x3D,
+	0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F,
+	0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20, 0x28, 0x25,
+	0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA, 0x27, 0xCB,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF4, 0x52, 0xCD,
+	0x84, 0x54, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x03, 0x02, 0x02, 0x07, 0xCE, 0x02, 0x25, 0x3D, 0xDA, 0x10,
+	0xDA, 0x3C, 0xDA, 0x2C, 0x26, 0x02, 0x00, 0x00, 0x2D, 0x02,
+	0x00, 0x01, 0x3D, 0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+	0x2D, 0x02, 0x00, 0x01, 0x3D, 0x02, 0x00, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x04, 0x07, 0xDC, 0x53, 0x26, 0xCF, 0x09, 0x63,
+	0x61, 0x6C, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x35, 0x28, 0x63, 0x61, 0x6C,
+	0x6C, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xAE, 0x36, 0xCD, 0xA6,
+	0x38, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02,
+	0x01, 0x03, 0x0B, 0xCE, 0x09, 0x63, 0x61, 0x6C, 0x6C, 0x61,
+	0x62, 0x6C, 0x65, 0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0xD5,
+	0x02, 0xDA, 0xFB, 0x04, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00,
+	0x48, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x23, 0x01,
+	0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x26, 0x01, 0x02, 0x00,
+	0x1F, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x0D, 0x03,
+	0xBA, 0x37, 0x0E, 0x02, 0x20, 0x0E, 0x03, 0x07, 0x36, 0x03,
+	0x32, 0x33, 0xCF, 0x09, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61,
+	0x72, 0x73, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x37, 0x28, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73,
+	0x65, 0x20, 0x70, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29,
+	0x0A, 0x0A, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+	0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0x86, 0x9F, 0x05, 0xCD, 0xEA, 0xA3, 0x05,
+	0xDA, 0x03, 0xDA, 0xA2, 0x03, 0xDA, 0xE1, 0x0A, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0x5B, 0xDA, 0x05, 0xCE, 0xD1, 0x01, 0x28,
+	0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x0A, 0x0A, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x77, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E,
+	0x69, 0x71, 0x75, 0x65, 0x20, 0x61, 0x63, 0x72, 0x6F, 0x73,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x74,
+	0x69, 0x6D, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+	0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x20, 0x77,
+	0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F,
+	0x6C, 0x6C, 0x69, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+	0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61,
+	0x64, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+	0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x64,
+	0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+	0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73,
+	0x6F, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x74, 0x6F, 0x20,
+	0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61,
+	0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0xCF, 0x04,
+	0x62, 0x6E, 0x6F, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+	0xA6, 0x80, 0x40, 0x01, 0x01, 0x00, 0x02, 0xCE, 0x04, 0x62,
+	0x6E, 0x6F, 0x74, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0xDA, 0x05, 0xCE, 0x34, 0x28, 0x62, 0x6E, 0x6F, 0x74,
+	0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74,
+	0x2D, 0x77, 0x69, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x76, 0x65,
+	0x72, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74,
+	0x65, 0x67, 0x65, 0x72, 0x20, 0x78, 0x2E, 0xCF, 0x08, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x69, 0x6E, 0x66, 0xD3, 0x02, 0xDA,
+	0x03, 0xDD, 0x00, 0x00, 0x80, 0x7F, 0xDA, 0x05, 0xCE, 0x29,
+	0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+	0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+	0x76, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x69, 0x74,
+	0x79, 0xCF, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E,
+	0x65, 0x77, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xFD, 0x01, 0xDA,
+	0x05, 0xCE, 0xA6, 0x01, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+	0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x70,
+	0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74,
+	0x65, 0x64, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74,
+	0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+	0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x29, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63, 0x61, 0x6E,
+	0x20, 0x62, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x65,
+	0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x69,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69,
+	0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x69, 0x73, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x2E,
+	0xCF, 0x06, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0xB8, 0x02, 0xDA, 0x05, 0xCE, 0xA8, 0x01,
+	0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x26, 0x20,
+	0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20, 0x63,
+	0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69,
+	0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20,
+	0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x76, 0x69, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+	0x62, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+	0x63, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0B,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x72, 0x65, 0x73, 0x65,
+	0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x2F, 0x72, 0x65, 0x73, 0x65, 0x74, 0xDA, 0x05,
+	0xCE, 0x82, 0x02, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F,
+	0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x66, 0x69, 0x62, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x75,
+	0x73, 0x65, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E,
+	0x6F, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x6F, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x61, 0x20,
+	0x6E, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20,
+	0x69, 0x74, 0x73, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
+	0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x73, 0x69,
+	0x67, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20,
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x62, 0x65, 0x63,
+	0x6F, 0x6D, 0x65, 0x73, 0x20, 0x3A, 0x6E, 0x65, 0x77, 0x2E,
+	0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x63,
+	0x68, 0x65, 0x61, 0x70, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+	0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6E, 0x67,
+	0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x66, 0x69, 0x62,
+	0x2E, 0xCF, 0x09, 0x76, 0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62,
+	0x61, 0x6C, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x37,
+	0x28, 0x76, 0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C,
+	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x69, 0x74,
+	0x29, 0x0A, 0x0A, 0x44, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63,
+	0x61, 0x6C, 0x6C, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x20, 0x61, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C,
+	0x20, 0x76, 0x61, 0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0x80, 0x1B, 0xCD, 0x90, 0x1D, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x03, 0x02, 0x03, 0x0C, 0xCE,
+	0x09, 0x76, 0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C,
+	0xDA, 0x10, 0xDA, 0xDE, 0x07, 0xDA, 0x91, 0x04, 0xDA, 0x13,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00,
+	0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x2C, 0x02, 0x01, 0x00, 0x3C, 0x01,
+	0x00, 0x00, 0x26, 0x02, 0x02, 0x00, 0x35, 0x02, 0x02, 0x00,
+	0x34, 0x02, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x03,
+	0xA0, 0x1C, 0x18, 0x08, 0x22, 0x28, 0x01, 0xC1, 0x01, 0xD0,
+	0x01, 0xDA, 0x9A, 0x06, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x91, 0x0E, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x68,
+	0x65, 0x61, 0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+	0x29, 0x0A, 0x0A, 0x41, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+	0x61, 0x6C, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61,
+	0x63, 0x72, 0x6F, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6D,
+	0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x4C,
+	0x69, 0x73, 0x70, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2C, 0x20, 0x61, 0x6C, 0x74,
+	0x68, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x69, 0x6E, 0x74, 0x65,
+	0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+	0x6D, 0x75, 0x63, 0x68, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C,
+	0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x6F, 0x70,
+	0x65, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C,
+	0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F,
+	0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73,
+	0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x6F, 0x72,
+	0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x61, 0x6C, 0x73, 0x2E, 0x20, 0x41, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x73, 0x6F,
+	0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64,
+	0x20, 0x6C, 0x69, 0x6B, 0x65, 0x3A, 0x0A, 0x0A, 0x20, 0x20,
+	0x09, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x3A,
+	0x76, 0x65, 0x72, 0x62, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63,
+	0x74, 0x2F, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
+	0x6F, 0x6E, 0x0A, 0x0A, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72,
+	0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73,
+	0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x2C,
+	0x20, 0x3A, 0x76, 0x65, 0x72, 0x62, 0x20, 0x69, 0x73, 0x20,
+	0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x73,
+	0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x77,
+	0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+	0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F,
+	0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61,
+	0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x65, 0x72,
+	0x62, 0x73, 0x20, 0x61, 0x72, 0x65, 0x3A, 0x0A, 0x0A, 0x20,
+	0x20, 0x09, 0x3A, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x20, 0x2D, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65,
+	0x64, 0x6C, 0x79, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+	0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+	0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+	0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x0A,
+	0x20, 0x20, 0x09, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+	0x2D, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65,
+	0x72, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E,
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63,
+	0x74, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+	0x65, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+	0x65, 0x6E, 0x74, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E,
+	0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x54,
+	0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69,
+	0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65,
+	0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C,
+	0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x0A, 0x20, 0x20, 0x09,
+	0x3A, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x2D, 0x20, 0x49, 0x74,
+	0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+	0x0A, 0x20, 0x20, 0x09, 0x3A, 0x70, 0x61, 0x69, 0x72, 0x73,
+	0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6B, 0x65, 0x79, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x0A, 0x20, 0x20,
+	0x09, 0x3A, 0x69, 0x6E, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65,
+	0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+	0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+	0x6F, 0x72, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65,
+	0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x2E, 0x0A, 0x20, 0x20,
+	0x09, 0x3A, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x65, 0x64,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x62,
+	0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x65, 0x64, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65,
+	0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F,
+	0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64,
+	0x75, 0x63, 0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75,
+	0x6D, 0x65, 0x72, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+	0x6E, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x65,
+	0x70, 0x74, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x74, 0x6F, 0x20,
+	0x72, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x66,
+	0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x6F,
+	0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x0A, 0x0A,
+	0x20, 0x20, 0x09, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+	0x65, 0x72, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+	0x74, 0x0A, 0x0A, 0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+	0x20, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20,
+	0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+	0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x77,
+	0x6F, 0x72, 0x64, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64,
+	0x65, 0x6E, 0x74, 0x2E, 0x20, 0x20, 0x3A, 0x6D, 0x6F, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x62, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A,
+	0x0A, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x77, 0x68, 0x69, 0x6C,
+	0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
+	0x6F, 0x6E, 0x20, 0x2D, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B,
+	0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x69, 0x66, 0x20, 0x65,
+	0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+	0x69, 0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x2E,
+	0x0A, 0x20, 0x20, 0x09, 0x3A, 0x6C, 0x65, 0x74, 0x20, 0x62,
+	0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x2D, 0x20,
+	0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x73,
+	0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73,
+	0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6C, 0x65, 0x74, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+	0x0A, 0x20, 0x20, 0x09, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72,
+	0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x20, 0x65,
+	0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x61, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x66, 0x66,
+	0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C,
+	0x6F, 0x6F, 0x70, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x61,
+	0x66, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+	0x2D, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20,
+	0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x2C, 0x20, 0x62,
+	0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64,
+	0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x68,
+	0x61, 0x70, 0x70, 0x65, 0x6E, 0x73, 0x20, 0x61, 0x66, 0x74,
+	0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78,
+	0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F,
+	0x6F, 0x70, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x72, 0x65,
+	0x70, 0x65, 0x61, 0x74, 0x20, 0x6E, 0x20, 0x2D, 0x20, 0x72,
+	0x65, 0x70, 0x65, 0x61, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65,
+	0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6E, 0x20, 0x74,
+	0x69, 0x6D, 0x65, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A,
+	0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x20, 0x6F, 0x6E, 0x6C,
+	0x79, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E,
+	0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x0A,
+	0x0A, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x61, 0x6C,
+	0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69,
+	0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xDA, 0x8E, 0x01, 0xCD, 0xB6, 0x87, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x09, 0x01, 0x03,
+	0x15, 0x01, 0xCE, 0x04, 0x6C, 0x6F, 0x6F, 0x70, 0xDA, 0x10,
+	0xDA, 0x1D, 0xDA, 0x58, 0xCE, 0x1C, 0x65, 0x78, 0x70, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x68, 0x65, 0x61, 0x64, 0x28, 0x02, 0x00, 0x00, 0x37, 0x03,
+	0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x26, 0x06, 0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x26, 0x07,
+	0x01, 0x00, 0x1F, 0x06, 0x07, 0x05, 0x19, 0x06, 0x03, 0x00,
+	0x23, 0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x06,
+	0x00, 0x00, 0x1A, 0x06, 0x03, 0x00, 0x26, 0x05, 0x02, 0x00,
+	0x01, 0x05, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x17, 0x06,
+	0x05, 0x00, 0x25, 0x07, 0x00, 0x00, 0x22, 0x08, 0x00, 0x00,
+	0x2C, 0x07, 0x08, 0x00, 0x30, 0x06, 0x00, 0x00, 0xCD, 0x80,
+	0x80, 0xC0, 0x0D, 0x10, 0x02, 0x2B, 0xB7, 0x04, 0x01, 0xCE,
+	0x05, 0x64, 0x6F, 0x6F, 0x6E, 0x65, 0xDA, 0x10, 0xDA, 0xD9,
+	0x08, 0xDA, 0x5F, 0xD8, 0x0D, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x2F, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0xDA, 0x1D,
+	0xDA, 0x20, 0xD0, 0x05, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA,
+	0xFE, 0x01, 0xD0, 0x03, 0x6C, 0x65, 0x74, 0xDA, 0xD7, 0x03,
+	0xDA, 0x5D, 0xD0, 0x04, 0x77, 0x68, 0x65, 0x6E, 0xDA, 0x5E,
+	0xD0, 0x06, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0xD0, 0x05,
+	0x61, 0x66, 0x74, 0x65, 0x72, 0xD0, 0x06, 0x72, 0x65, 0x70,
+	0x65, 0x61, 0x74, 0xDA, 0x5B, 0xDA, 0x8D, 0x02, 0xDA, 0x5C,
+	0xDA, 0xA1, 0x04, 0xDA, 0x89, 0x01, 0xDA, 0x2B, 0xDA, 0x2C,
+	0xDA, 0xA6, 0x04, 0xCE, 0x1B, 0x75, 0x6E, 0x65, 0x78, 0x70,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+	0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x3A, 0x20, 0xDA, 0xBC, 0x02, 0xD0, 0x07, 0x69, 0x74, 0x65,
+	0x72, 0x61, 0x74, 0x65, 0xD0, 0x05, 0x72, 0x61, 0x6E, 0x67,
+	0x65, 0xD0, 0x04, 0x6B, 0x65, 0x79, 0x73, 0xDA, 0xA5, 0x02,
+	0xDA, 0xF9, 0x01, 0xD0, 0x05, 0x70, 0x61, 0x69, 0x72, 0x73,
+	0xDA, 0x1F, 0xDA, 0xEB, 0x09, 0xD0, 0x02, 0x69, 0x6E, 0xDA,
+	0xA6, 0x0B, 0xD0, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0xDA, 0xAD, 0x03, 0xDA, 0xF9, 0x03, 0xDA, 0xAA,
+	0x03, 0xD0, 0x03, 0x6E, 0x65, 0x77, 0xDA, 0xB7, 0x04, 0xDA,
+	0xD3, 0x0C, 0xCE, 0x16, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+	0x76, 0x65, 0x72, 0x62, 0x3A, 0x20, 0x28, 0x02, 0x00, 0x00,
+	0x22, 0x04, 0x00, 0x00, 0x48, 0x03, 0x04, 0x01, 0x1A, 0x03,
+	0x05, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00,
+	0x38, 0x04, 0x00, 0x00, 0x17, 0x01, 0x04, 0x00, 0x17, 0x03,
+	0x01, 0x00, 0x27, 0x01, 0x00, 0x04, 0x46, 0x04, 0x00, 0x01,
+	0x1A, 0x04, 0x06, 0x00, 0x27, 0x01, 0x00, 0x01, 0x26, 0x04,
+	0x01, 0x00, 0x2C, 0x01, 0x04, 0x00, 0x26, 0x01, 0x02, 0x00,
+	0x30, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x02, 0x27, 0x05,
+	0x00, 0x00, 0x33, 0x01, 0x05, 0x04, 0x17, 0x05, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x27, 0x04, 0x00, 0x00, 0x33, 0x01,
+	0x04, 0x01, 0x17, 0x04, 0x01, 0x00, 0x27, 0x06, 0x00, 0x00,
+	0x33, 0x01, 0x06, 0x00, 0x17, 0x06, 0x01, 0x00, 0x2B, 0x01,
+	0x00, 0x00, 0x26, 0x01, 0x03, 0x00, 0x2F, 0x01, 0x01, 0x00,
+	0x26, 0x07, 0x04, 0x00, 0x48, 0x01, 0x01, 0x07, 0x1A, 0x01,
+	0x6B, 0x00, 0x26, 0x07, 0x05, 0x00, 0x48, 0x01, 0x06, 0x07,
+	0x1A, 0x01, 0x07, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x26, 0x01,
+	0x06, 0x00, 0x2F, 0x07, 0x01, 0x00, 0x05, 0x07, 0x00, 0x02,
+	0x2C, 0x07, 0x03, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x01,
+	0x07, 0x00, 0x48, 0x07, 0x06, 0x01, 0x1A, 0x07, 0x08, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x2C, 0x01, 0x03, 0x00, 0x2F, 0x08,
+	0x02, 0x00, 0x26, 0x01, 0x08, 0x00, 0x2D, 0x01, 0x04, 0x08,
+	0x26, 0x01, 0x09, 0x00, 0x30, 0x01, 0x00, 0x00, 0x26, 0x08,
+	0x0A, 0x00, 0x48, 0x01, 0x06, 0x08, 0x1A, 0x01, 0x08, 0x00,
+	0x05, 0x08, 0x00, 0x02, 0x2C, 0x08, 0x03, 0x00, 0x2F, 0x09,
+	0x02, 0x00, 0x26, 0x08, 0x0B, 0x00, 0x2D, 0x08, 0x04, 0x09,
+	0x26, 0x08, 0x09, 0x00, 0x30, 0x08, 0x00, 0x00, 0x26, 0x09,
+	0x0C, 0x00, 0x48, 0x08, 0x06, 0x09, 0x1A, 0x08, 0x08, 0x00,
+	0x05, 0x09, 0x00, 0x02, 0x2C, 0x09, 0x03, 0x00, 0x2F, 0x0A,
+	0x02, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2D, 0x09, 0x04, 0x0A,
+	0x26, 0x09, 0x09, 0x00, 0x30, 0x09, 0x00, 0x00, 0x26, 0x0A,
+	0x0D, 0x00, 0x48, 0x09, 0x06, 0x0A, 0x1A, 0x09, 0x08, 0x00,
+	0x05, 0x0A, 0x00, 0x02, 0x2C, 0x0A, 0x03, 0x00, 0x2F, 0x03,
+	0x02, 0x00, 0x26, 0x0A, 0x01, 0x00, 0x2D, 0x0A, 0x03, 0x04,
+	0x26, 0x0A, 0x09, 0x00, 0x30, 0x0A, 0x00, 0x00, 0x26, 0x03,
+	0x0E, 0x00, 0x48, 0x0A, 0x06, 0x03, 0x1A, 0x0A, 0x32, 0x00,
+	0x26, 0x0B, 0x0F, 0x00, 0x2F, 0x03, 0x0B, 0x00, 0x17, 0x0B,
+	0x03, 0x00, 0x26, 0x07, 0x0F, 0x00, 0x2F, 0x03, 0x07, 0x00,
+	0x17, 0x07, 0x03, 0x00, 0x26, 0x03, 0x10, 0x00, 0x2D, 0x03,
+	0x0B, 0x07, 0x26, 0x0C, 0x09, 0x00, 0x2F, 0x03, 0x0C, 0x00,
+	0x26, 0x0C, 0x00, 0x00, 0x2C, 0x0C, 0x03, 0x00, 0x38, 0x03,
+	0x00, 0x00, 0x17, 0x0C, 0x03, 0x00, 0x05, 0x03, 0x00, 0x02,
+	0x2C, 0x03, 0x0C, 0x00, 0x2F, 0x0D, 0x02, 0x00, 0x17, 0x03,
+	0x0D, 0x00, 0x26, 0x0D, 0x11, 0x00, 0x2D, 0x0D, 0x07, 0x04,
+	0x26, 0x04, 0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00, 0x26, 0x04,
+	0x12, 0x00, 0x25, 0x0E, 0x00, 0x00, 0x2D, 0x04, 0x0B, 0x0E,
+	0x26, 0x0E, 0x09, 0x00, 0x2F, 0x04, 0x0E, 0x00, 0x2B, 0x0C,
+	0x00, 0x00, 0x26, 0x0F, 0x13, 0x00, 0x2F, 0x0E, 0x0F, 0x00,
+	0x26, 0x0F, 0x14, 0x00, 0x25, 0x00, 0x01, 0x00, 0x2D, 0x0F,
+	0x00, 0x0B, 0x26, 0x00, 0x09, 0x00, 0x2F, 0x0F, 0x00, 0x00,
+	0x26, 0x00, 0x15, 0x00, 0x2D, 0x00, 0x0B, 0x0F, 0x26, 0x02,
+	0x09, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x26, 0x0F, 0x16, 0x00,
+	0x2D, 0x0F, 0x0E, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x02,
+	0x09, 0x00, 0x2F, 0x0F, 0x02, 0x00, 0x26, 0x0E, 0x01, 0x00,
+	0x2D, 0x0E, 0x0D, 0x04, 0x2B, 0x0F, 0x00, 0x00, 0x26, 0x0E,
+	0x09, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x26, 0x03, 0x17, 0x00,
+	0x2C, 0x03, 0x06, 0x00, 0x26, 0x0B, 0x18, 0x00, 0x2F, 0x03,
+	0x0B, 0x00, 0x01, 0x03, 0x00, 0x00, 0x26, 0x07, 0x19, 0x00,
+	0x48, 0x01, 0x04, 0x07, 0x1A, 0x01, 0x25, 0x00, 0x26, 0x01,
+	0x0F, 0x00, 0x2F, 0x07, 0x01, 0x00, 0x17, 0x01, 0x07, 0x00,
+	0x26, 0x07, 0x15, 0x00, 0x2D, 0x07, 0x01, 0x05, 0x26, 0x08,
+	0x09, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x26, 0x08, 0x00, 0x00,
+	0x2C, 0x08, 0x07, 0x00, 0x38, 0x07, 0x00, 0x00, 0x17, 0x08,
+	0x07, 0x00, 0x05, 0x07, 0x00, 0x03, 0x2C, 0x07, 0x08, 0x00,
+	0x2F, 0x09, 0x02, 0x00, 0x17, 0x07, 0x09, 0x00, 0x26, 0x09,
+	0x12, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x2D, 0x09, 0x01, 0x0A,
+	0x26, 0x0A, 0x09, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x2B, 0x08,
+	0x00, 0x00, 0x26, 0x03, 0x13, 0x00, 0x2F, 0x0A, 0x03, 0x00,
+	0x26, 0x03, 0x11, 0x00, 0x2D, 0x03, 0x06, 0x01, 0x26, 0x0B,
+	0x09, 0x00, 0x2F, 0x03, 0x0B, 0x00, 0x26, 0x0B, 0x16, 0x00,
+	0x2D, 0x0B, 0x0A, 0x03, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x07,
+	0x09, 0x00, 0x2F, 0x0B, 0x07, 0x00, 0x26, 0x0A, 0x01, 0x00,
+	0x2D, 0x0A, 0x09, 0x0B, 0x26, 0x0A, 0x09, 0x00, 0x30, 0x0A,
+	0x00, 0x00, 0x26, 0x01, 0x1A, 0x00, 0x48, 0x07, 0x04, 0x01,
+	0x1A, 0x07, 0x3F, 0x00, 0x35, 0x01, 0x05, 0x00, 0x17, 0x08,
+	0x01, 0x00, 0x35, 0x01, 0x05, 0x01, 0x17, 0x09, 0x01, 0x00,
+	0x35, 0x01, 0x05, 0x02, 0x17, 0x0A, 0x01, 0x00, 0x1A, 0x0A,
+	0x03, 0x00, 0x17, 0x01, 0x0A, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x25, 0x01, 0x01, 0x00, 0x17, 0x03, 0x01, 0x00, 0x26, 0x0B,
+	0x0F, 0x00, 0x2F, 0x01, 0x0B, 0x00, 0x17, 0x0B, 0x01, 0x00,
+	0x26, 0x07, 0x0F, 0x00, 0x2F, 0x01, 0x07, 0x00, 0x17, 0x07,
+	0x01, 0x00, 0x26, 0x01, 0x10, 0x00, 0x2D, 0x01, 0x07, 0x0B,
+	0x26, 0x0C, 0x09, 0x00, 0x2F, 0x01, 0x0C, 0x00, 0x26, 0x0C,
+	0x00, 0x00, 0x2C, 0x0C, 0x01, 0x00, 0x38, 0x01, 0x00, 0x00,
+	0x17, 0x0C, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x2C, 0x01,
+	0x0C, 0x00, 0x2F, 0x0D, 0x02, 0x00, 0x17, 0x01, 0x0D, 0x00,
+	0x26, 0x0D, 0x12, 0x00, 0x2D, 0x0D, 0x07, 0x08, 0x26, 0x04,
+	0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00, 0x26, 0x04, 0x11, 0x00,
+	0x2D, 0x04, 0x0B, 0x09, 0x26, 0x0E, 0x09, 0x00, 0x2F, 0x04,
+	0x0E, 0x00, 0x2B, 0x0C, 0x00, 0x00, 0x26, 0x0F, 0x13, 0x00,
+	0x2F, 0x0E, 0x0F, 0x00, 0x26, 0x0F, 0x11, 0x00, 0x2D, 0x0F,
+	0x06, 0x07, 0x26, 0x00, 0x09, 0x00, 0x2F, 0x0F, 0x00, 0x00,
+	0x26, 0x00, 0x14, 0x00, 0x2D, 0x00, 0x07, 0x03, 0x26, 0x02,
+	0x09, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x26, 0x02, 0x15, 0x00,
+	0x2D, 0x02, 0x07, 0x00, 0x26, 0x05, 0x09, 0x00, 0x2F, 0x02,
+	0x05, 0x00, 0x26, 0x00, 0x16, 0x00, 0x2D, 0x00, 0x0E, 0x0F,
+	0x2C, 0x01, 0x02, 0x00, 0x26, 0x05, 0x09, 0x00, 0x2F, 0x00,
+	0x05, 0x00, 0x26, 0x0E, 0x01, 0x00, 0x2D, 0x0E, 0x0D, 0x04,
+	0x2B, 0x00, 0x00, 0x00, 0x26, 0x0E, 0x09, 0x00, 0x30, 0x0E,
+	0x00, 0x00, 0x26, 0x08, 0x1B, 0x00, 0x48, 0x01, 0x04, 0x08,
+	0x1A, 0x01, 0x3A, 0x00, 0x26, 0x09, 0x0F, 0x00, 0x2F, 0x08,
+	0x09, 0x00, 0x17, 0x09, 0x08, 0x00, 0x26, 0x0A, 0x0F, 0x00,
+	0x2F, 0x08, 0x0A, 0x00, 0x17, 0x0A, 0x08, 0x00, 0x26, 0x08,
+	0x1C, 0x00, 0x22, 0x03, 0x00, 0x00, 0x2D, 0x08, 0x03, 0x0A,
+	0x26, 0x03, 0x09, 0x00, 0x2F, 0x08, 0x03, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2C, 0x03, 0x08, 0x00, 0x38, 0x08, 0x00, 0x00,
+	0x17, 0x03, 0x08, 0x00, 0x05, 0x08, 0x00, 0x03, 0x2C, 0x08,
+	0x03, 0x00, 0x2F, 0x0B, 0x02, 0x00, 0x17, 0x08, 0x0B, 0x00,
+	0x26, 0x0B, 0x11, 0x00, 0x2D, 0x0B, 0x09, 0x05, 0x26, 0x07,
+	0x09, 0x00, 0x2F, 0x0B, 0x07, 0x00, 0x26, 0x07, 0x1D, 0x00,
+	0x22, 0x0C, 0x00, 0x00, 0x2D, 0x07, 0x09, 0x0C, 0x26, 0x0C,
+	0x09, 0x00, 0x2F, 0x07, 0x0C, 0x00, 0x26, 0x0C, 0x12, 0x00,
+	0x2D, 0x0C, 0x0A, 0x07, 0x26, 0x0D, 0x09, 0x00, 0x2F, 0x0C,
+	0x0D, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x0D, 0x13, 0x00,
+	0x2F, 0x07, 0x0D, 0x00, 0x26, 0x0D, 0x11, 0x00, 0x2D, 0x0D,
+	0x06, 0x0A, 0x26, 0x04, 0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00,
+	0x26, 0x04, 0x1D, 0x00, 0x2D, 0x04, 0x09, 0x0A, 0x26, 0x0E,
+	0x09, 0x00, 0x2F, 0x04, 0x0E, 0x00, 0x26, 0x0E, 0x15, 0x00,
+	0x2D, 0x0E, 0x0A, 0x04, 0x26, 0x0F, 0x09, 0x00, 0x2F, 0x0E,
+	0x0F, 0x00, 0x26, 0x04, 0x16, 0x00, 0x2D, 0x04, 0x07, 0x0D,
+	0x2C, 0x08, 0x0E, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2F, 0x04,
+	0x0F, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2D, 0x07, 0x0B, 0x0C,
+	0x2B, 0x04, 0x00, 0x00, 0x26, 0x07, 0x09, 0x00, 0x30, 0x07,
+	0x00, 0x00, 0x26, 0x09, 0x1E, 0x00, 0x48, 0x08, 0x04, 0x09,
+	0x1A, 0x08, 0x64, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x09,
+	0x03, 0x00, 0x2F, 0x09, 0x09, 0x00, 0x26, 0x0A, 0x1F, 0x00,
+	0x1F, 0x09, 0x09, 0x0A, 0x26, 0x03, 0x0F, 0x00, 0x2F, 0x0A,
+	0x03, 0x00, 0x17, 0x03, 0x0A, 0x00, 0x26, 0x0B, 0x0F, 0x00,
+	0x2F, 0x0A, 0x0B, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x26, 0x0A,
+	0x1C, 0x00, 0x22, 0x07, 0x00, 0x00, 0x2D, 0x0A, 0x07, 0x0B,
+	0x26, 0x07, 0x09, 0x00, 0x2F, 0x0A, 0x07, 0x00, 0x26, 0x07,
+	0x00, 0x00, 0x2C, 0x07, 0x0A, 0x00, 0x38, 0x0A, 0x00, 0x00,
+	0x17, 0x07, 0x0A, 0x00, 0x05, 0x0A, 0x00, 0x03, 0x2C, 0x0A,
+	0x07, 0x00, 0x2F, 0x0C, 0x02, 0x00, 0x17, 0x0A, 0x0C, 0x00,
+	0x26, 0x0C, 0x11, 0x00, 0x2D, 0x0C, 0x03, 0x05, 0x26, 0x0D,
+	0x09, 0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x26, 0x0D, 0x1D, 0x00,
+	0x22, 0x04, 0x00, 0x00, 0x2D, 0x0D, 0x03, 0x04, 0x26, 0x04,
+	0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00, 0x26, 0x04, 0x12, 0x00,
+	0x2D, 0x04, 0x0B, 0x0D, 0x26, 0x0E, 0x09, 0x00, 0x2F, 0x04,
+	0x0E, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x0E, 0x13, 0x00,
+	0x2F, 0x0D, 0x0E, 0x00, 0x1A, 0x09, 0x0F, 0x00, 0x26, 0x0F,
+	0x20, 0x00, 0x2D, 0x0F, 0x03, 0x0B, 0x26, 0x00, 0x09, 0x00,
+	0x2F, 0x0F, 0x00, 0x00, 0x26, 0x00, 0x09, 0x00, 0x2D, 0x00,
+	0x0B, 0x0F, 0x26, 0x02, 0x09, 0x00, 0x2F, 0x00, 0x02, 0x00,
+	0x26, 0x0F, 0x11, 0x00, 0x2D, 0x0F, 0x06, 0x00, 0x26, 0x02,
+	0x09, 0x00, 0x2F, 0x0F, 0x02, 0x00, 0x17, 0x0E, 0x0F, 0x00,
+	0x18, 0x02, 0x00, 0x00, 0x22, 0x0E, 0x00, 0x00, 0x1A, 0x09,
+	0x03, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00,
+	0x25, 0x02, 0x00, 0x00, 0x33, 0x00, 0x06, 0x02, 0x26, 0x02,
+	0x11, 0x00, 0x2D, 0x02, 0x00, 0x0B, 0x26, 0x05, 0x09, 0x00,
+	0x2F, 0x02, 0x05, 0x00, 0x17, 0x0F, 0x02, 0x00, 0x1A, 0x09,
+	0x03, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00,
+	0x25, 0x05, 0x01, 0x00, 0x33, 0x02, 0x06, 0x05, 0x26, 0x05,
+	0x20, 0x00, 0x2D, 0x05, 0x03, 0x0B, 0x26, 0x01, 0x09, 0x00,
+	0x2F, 0x05, 0x01, 0x00, 0x26, 0x01, 0x11, 0x00, 0x2D, 0x01,
+	0x02, 0x05, 0x26, 0x00, 0x09, 0x00, 0x2F, 0x01, 0x00, 0x00,
+	0x17, 0x00, 0x01, 0x00, 0x26, 0x02, 0x1D, 0x00, 0x2D, 0x02,
+	0x03, 0x0B, 0x26, 0x05, 0x09, 0x00, 0x2F, 0x02, 0x05, 0x00,
+	0x26, 0x05, 0x15, 0x00, 0x2D, 0x05, 0x0B, 0x02, 0x26, 0x01,
+	0x09, 0x00, 0x2F, 0x05, 0x01, 0x00, 0x26, 0x02, 0x16, 0x00,
+	0x2D, 0x02, 0x0D, 0x0E, 0x2D, 0x0F, 0x00, 0x0A, 0x2B, 0x05,
+	0x00, 0x00, 0x26, 0x01, 0x09, 0x00, 0x2F, 0x02, 0x01, 0x00,
+	0x26, 0x0D, 0x01, 0x00, 0x2D, 0x0D, 0x0C, 0x04, 0x2B, 0x02,
+	0x00, 0x00, 0x26, 0x0D, 0x09, 0x00, 0x30, 0x0D, 0x00, 0x00,
+	0x26, 0x0A, 0x21, 0x00, 0x48, 0x09, 0x04, 0x0A, 0x1A, 0x09,
+	0x46, 0x00, 0x26, 0x03, 0x0F, 0x00, 0x2F, 0x0A, 0x03, 0x00,
+	0x17, 0x03, 0x0A, 0x00, 0x26, 0x0B, 0x0F, 0x00, 0x2F, 0x0A,
+	0x0B, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x26, 0x07, 0x0F, 0x00,
+	0x2F, 0x0A, 0x07, 0x00, 0x17, 0x07, 0x0A, 0x00, 0x26, 0x0A,
+	0x10, 0x00, 0x2D, 0x0A, 0x0B, 0x03, 0x26, 0x0C, 0x09, 0x00,
+	0x2F, 0x0A, 0x0C, 0x00, 0x26, 0x0C, 0x00, 0x00, 0x2C, 0x0C,
+	0x0A, 0x00, 0x38, 0x0A, 0x00, 0x00, 0x17, 0x0C, 0x0A, 0x00,
+	0x05, 0x0A, 0x00, 0x03, 0x2C, 0x0A, 0x0C, 0x00, 0x2F, 0x0D,
+	0x02, 0x00, 0x17, 0x0A, 0x0D, 0x00, 0x26, 0x0D, 0x11, 0x00,
+	0x2D, 0x0D, 0x07, 0x05, 0x26, 0x04, 0x09, 0x00, 0x2F, 0x0D,
+	0x04, 0x00, 0x26, 0x04, 0x22, 0x00, 0x2C, 0x04, 0x07, 0x00,
+	0x26, 0x0E, 0x09, 0x00, 0x2F, 0x04, 0x0E, 0x00, 0x26, 0x0E,
+	0x11, 0x00, 0x2D, 0x0E, 0x03, 0x04, 0x26, 0x0F, 0x09, 0x00,
+	0x2F, 0x0E, 0x0F, 0x00, 0x26, 0x04, 0x12, 0x00, 0x25, 0x0F,
+	0x00, 0x00, 0x2D, 0x04, 0x0B, 0x0F, 0x26, 0x0F, 0x09, 0x00,
+	0x2F, 0x04, 0x0F, 0x00, 0x25, 0x0F, 0x00, 0x00, 0x2C, 0x0C,
+	0x0F, 0x00, 0x26, 0x00, 0x13, 0x00, 0x2F, 0x0F, 0x00, 0x00,
+	0x26, 0x00, 0x20, 0x00, 0x2D, 0x00, 0x07, 0x0B, 0x26, 0x02,
+	0x09, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x26, 0x02, 0x11, 0x00,
+	0x2D, 0x02, 0x06, 0x00, 0x26, 0x05, 0x09, 0x00, 0x2F, 0x02,
+	0x05, 0x00, 0x26, 0x00, 0x14, 0x00, 0x25, 0x05, 0x01, 0x00,
+	0x2D, 0x00, 0x05, 0x0B, 0x26, 0x05, 0x09, 0x00, 0x2F, 0x00,
+	0x05, 0x00, 0x26, 0x05, 0x15, 0x00, 0x2D, 0x05, 0x0B, 0x00,
+	0x26, 0x01, 0x09, 0x00, 0x2F, 0x05, 0x01, 0x00, 0x26, 0x00,
+	0x16, 0x00, 0x2D, 0x00, 0x0F, 0x02, 0x2C, 0x0A, 0x05, 0x00,
+	0x26, 0x01, 0x09, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x26, 0x0F,
+	0x01, 0x00, 0x2D, 0x0F, 0x0D, 0x0E, 0x2C, 0x04, 0x00, 0x00,
+	0x26, 0x0F, 0x09, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x26, 0x03,
+	0x23, 0x00, 0x48, 0x0A, 0x04, 0x03, 0x1A, 0x0A, 0x52, 0x00,
+	0x26, 0x0B, 0x0F, 0x00, 0x2F, 0x03, 0x0B, 0x00, 0x17, 0x0B,
+	0x03, 0x00, 0x26, 0x07, 0x0F, 0x00, 0x2F, 0x03, 0x07, 0x00,
+	0x17, 0x07, 0x03, 0x00, 0x26, 0x0C, 0x0F, 0x00, 0x2F, 0x03,
+	0x0C, 0x00, 0x17, 0x0C, 0x03, 0x00, 0x26, 0x03, 0x24, 0x00,
+	0x2C, 0x03, 0x0B, 0x00, 0x26, 0x0D, 0x09, 0x00, 0x2F, 0x03,
+	0x0D, 0x00, 0x26, 0x0D, 0x11, 0x00, 0x2D, 0x0D, 0x0C, 0x03,
+	0x26, 0x04, 0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00, 0x26, 0x03,
+	0x25, 0x00, 0x26, 0x04, 0x26, 0x00, 0x2D, 0x03, 0x0C, 0x04,
+	0x26, 0x04, 0x09, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x26, 0x04,
+	0x25, 0x00, 0x26, 0x0E, 0x27, 0x00, 0x2D, 0x04, 0x0C, 0x0E,
+	0x26, 0x0E, 0x09, 0x00, 0x2F, 0x04, 0x0E, 0x00, 0x26, 0x0E,
+	0x28, 0x00, 0x2D, 0x0E, 0x03, 0x04, 0x26, 0x0F, 0x09, 0x00,
+	0x2F, 0x0E, 0x0F, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2D, 0x03,
+	0x0D, 0x0E, 0x26, 0x04, 0x09, 0x00, 0x2F, 0x03, 0x04, 0x00,
+	0x26, 0x0C, 0x00, 0x00, 0x2C, 0x0C, 0x03, 0x00, 0x38, 0x03,
+	0x00, 0x00, 0x17, 0x0C, 0x03, 0x00, 0x05, 0x03, 0x00, 0x03,
+	0x2C, 0x03, 0x0C, 0x00, 0x2F, 0x0D, 0x02, 0x00, 0x17, 0x03,
+	0x0D, 0x00, 0x26, 0x0D, 0x11, 0x00, 0x2D, 0x0D, 0x0B, 0x05,
+	0x26, 0x04, 0x09, 0x00, 0x2F, 0x0D, 0x04, 0x00, 0x26, 0x04,
+	0x29, 0x00, 0x2C, 0x04, 0x0B, 0x00, 0x26, 0x0E, 0x09, 0x00,
+	0x2F, 0x04, 0x0E, 0x00, 0x26, 0x0E, 0x12, 0x00, 0x2D, 0x0E,
+	0x07, 0x04, 0x26, 0x0F, 0x09, 0x00, 0x2F, 0x0E, 0x0F, 0x00,
+	0x25, 0x04, 0x00, 0x00, 0x2C, 0x0C, 0x04, 0x00, 0x26, 0x0F,
+	0x13, 0x00, 0x2F, 0x04, 0x0F, 0x00, 0x26, 0x0F, 0x11, 0x00,
+	0x2D, 0x0F, 0x06, 0x07, 0x26, 0x00, 0x09, 0x00, 0x2F, 0x0F,
+	0x00, 0x00, 0x26, 0x00, 0x29, 0x00, 0x2C, 0x00, 0x0B, 0x00,
+	0x26, 0x02, 0x09, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x26, 0x02,
+	0x15, 0x00, 0x2D, 0x02, 0x07, 0x00, 0x26, 0x05, 0x09, 0x00,
+	0x2F, 0x02, 0x05, 0x00, 0x26, 0x00, 0x16, 0x00, 0x2D, 0x00,
+	0x04, 0x0F, 0x2C, 0x03, 0x02, 0x00, 0x26, 0x05, 0x09, 0x00,
+	0x2F, 0x00, 0x05, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2D, 0x04,
+	0x0D, 0x0E, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x09, 0x00,
+	0x30, 0x04, 0x00, 0x00, 0x26, 0x03, 0x2A, 0x00, 0x2C, 0x03,
+	0x04, 0x00, 0x26, 0x0B, 0x18, 0x00, 0x2F, 0x03, 0x0B, 0x00,
+	0x01, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xB8,
+	0x05, 0x01, 0xF2, 0xAD, 0x01, 0xA2, 0x59, 0x08, 0x40, 0xF5,
+	0x58, 0x02, 0x40, 0x19, 0x01, 0x07, 0x96, 0x58, 0x05, 0x2A,
+	0xF9, 0x57, 0x01, 0xCA, 0x01, 0x21, 0x03, 0x73, 0x90, 0x01,
+	0x01, 0x3E, 0x8F, 0x01, 0x06, 0x3D, 0x90, 0x01, 0x05, 0xB8,
+	0x01, 0x77, 0x01, 0x07, 0xD0, 0x55, 0x03, 0x44, 0xA7, 0x46,
+	0x03, 0x76, 0x9F, 0x0F, 0x01, 0x68, 0x1F, 0x02, 0x0D, 0x1C,
+	0x03, 0xCF, 0x01, 0xA4, 0x0F, 0x01, 0xD0, 0x02, 0xBF, 0x0F,
+	0x02, 0x0D, 0x1C, 0x04, 0x21, 0x24, 0x03, 0x9F, 0x02, 0x80,
+	0x0F, 0x01, 0xC2, 0x03, 0xBF, 0x0F, 0x02, 0x0D, 0x1C, 0x04,
+	0x1F, 0x22, 0x03, 0x93, 0x03, 0x82, 0x0F, 0x01, 0xB8, 0x04,
+	0xBF, 0x0F, 0x02, 0x0D, 0x1C, 0x04, 0x1F, 0x22, 0x03, 0x89,
+	0x04, 0x82, 0x0F, 0x01, 0xA2, 0x05, 0xBF, 0x0F, 0x02, 0x0D,
+	0x1C, 0x04, 0x15, 0x22, 0x03, 0xFD, 0x04, 0x82, 0x0F, 0x02,
+	0xBE, 0x06, 0xBD, 0x0F, 0x01, 0x15, 0x18, 0x02, 0x66, 0x17,
+	0x01, 0x0F, 0x12, 0x04, 0x76, 0x02, 0x04, 0x25, 0x2A, 0x01,
+	0x9C, 0x01, 0x3F, 0x02, 0x0D, 0x1E, 0x01, 0x11, 0x14, 0x04,
+	0xBE, 0x01, 0x17, 0x05, 0x64, 0x00, 0x03, 0xC8, 0x01, 0x00,
+	0x05, 0x96, 0x01, 0x05, 0x04, 0x23, 0x26, 0x05, 0xD5, 0x01,
+	0xA8, 0x02, 0x05, 0x97, 0x02, 0x9A, 0x02, 0x04, 0xB4, 0x05,
+	0xAB, 0x04, 0x01, 0x0D, 0x10, 0x03, 0x86, 0x01, 0xDE, 0x44,
+	0x02, 0x8C, 0x01, 0xBB, 0x45, 0x01, 0x15, 0x18, 0x04, 0x7C,
+	0x0A, 0x04, 0x23, 0x28, 0x01, 0xB2, 0x01, 0x4B, 0x02, 0x0D,
+	0x1C, 0x01, 0x19, 0x1C, 0x05, 0xC8, 0x01, 0x19, 0x03, 0x86,
+	0x01, 0x05, 0x04, 0x72, 0x10, 0x05, 0x8D, 0x01, 0xEA, 0x01,
+	0x04, 0xBB, 0x01, 0xBE, 0x01, 0x03, 0xCD, 0x03, 0xEE, 0x41,
+	0x06, 0x88, 0x08, 0x91, 0x45, 0x04, 0x78, 0x19, 0x01, 0x11,
+	0x14, 0x02, 0x78, 0x23, 0x01, 0x17, 0x1A, 0x02, 0x6C, 0x19,
+	0x01, 0x15, 0x18, 0x04, 0x78, 0x04, 0x04, 0x23, 0x28, 0x01,
+	0xA8, 0x01, 0x45, 0x02, 0x0D, 0x1C, 0x01, 0x19, 0x1C, 0x04,
+	0xC0, 0x01, 0x15, 0x04, 0x6A, 0x01, 0x03, 0x84, 0x01, 0x07,
+	0x04, 0x6E, 0x10, 0x04, 0xF8, 0x01, 0x0F, 0x04, 0x23, 0x26,
+	0x05, 0xDD, 0x02, 0xE0, 0x02, 0x05, 0x9F, 0x02, 0xA2, 0x02,
+	0x03, 0xE9, 0x0C, 0xFE, 0x3F, 0x02, 0xA6, 0x13, 0xBB, 0x45,
+	0x01, 0x15, 0x18, 0x02, 0x68, 0x17, 0x01, 0x15, 0x18, 0x05,
+	0x76, 0x04, 0x04, 0x23, 0x28, 0x01, 0xA6, 0x01, 0x45, 0x02,
+	0x0D, 0x1C, 0x01, 0x19, 0x1C, 0x04, 0xBC, 0x01, 0x13, 0x05,
+	0x8E, 0x01, 0x05, 0x04, 0x23, 0x26, 0x03, 0xA6, 0x01, 0x2B,
+	0x04, 0x6C, 0x10, 0x04, 0xF4, 0x01, 0x05, 0x04, 0x23, 0x26,
+	0x05, 0xD7, 0x02, 0xDA, 0x02, 0x05, 0xBF, 0x02, 0xC2, 0x02,
+	0x03, 0xA1, 0x16, 0xDA, 0x3F, 0x05, 0x84, 0x1D, 0xA7, 0x45,
+	0x02, 0x68, 0x13, 0x01, 0x15, 0x18, 0x02, 0x6A, 0x17, 0x01,
+	0x15, 0x18, 0x05, 0x78, 0x04, 0x04, 0x23, 0x28, 0x01, 0xA8,
+	0x01, 0x45, 0x02, 0x0D, 0x1C, 0x01, 0x19, 0x1C, 0x04, 0xC0,
+	0x01, 0x13, 0x05, 0x90, 0x01, 0x05, 0x04, 0x23, 0x26, 0x03,
+	0xA8, 0x01, 0x2B, 0x01, 0x6E, 0xBA, 0x01, 0x04, 0xAC, 0x01,
+	0xB1, 0x01, 0x04, 0x25, 0x28, 0x04, 0x29, 0x2C, 0x03, 0x5B,
+	0x5E, 0x03, 0xA8, 0x02, 0x7D, 0x02, 0x32, 0x41, 0x04, 0x17,
+	0x26, 0x01, 0x19, 0x1C, 0x03, 0xAA, 0x01, 0x24, 0x02, 0x32,
+	0x65, 0x04, 0x22, 0x0E, 0x04, 0x39, 0x3C, 0x01, 0x19, 0x1C,
+	0x04, 0xC8, 0x02, 0x55, 0x04, 0x23, 0x26, 0x06, 0xFF, 0x06,
+	0x82, 0x07, 0x05, 0xC5, 0x02, 0xC8, 0x02, 0x03, 0xEF, 0x20,
+	0xAC, 0x3B, 0x02, 0xF4, 0x2B, 0xBB, 0x45, 0x01, 0x13, 0x16,
+	0x02, 0x5C, 0x15, 0x01, 0x0F, 0x12, 0x02, 0x64, 0x11, 0x01,
+	0x1B, 0x1E, 0x04, 0x78, 0x0B, 0x04, 0x23, 0x28, 0x01, 0x98,
+	0x01, 0x3B, 0x02, 0x0D, 0x1C, 0x01, 0x19, 0x1C, 0x04, 0xB4,
+	0x01, 0x0D, 0x04, 0x8E, 0x01, 0x09, 0x04, 0x21, 0x24, 0x05,
+	0x86, 0x01, 0x2F, 0x04, 0x72, 0x08, 0x04, 0x96, 0x01, 0x04,
+	0x04, 0x29, 0x2C, 0x05, 0x8A, 0x02, 0x3D, 0x04, 0x1D, 0x20,
+	0x05, 0xF3, 0x02, 0xF6, 0x02, 0x05, 0x8F, 0x03, 0x92, 0x03,
+	0x03, 0xA3, 0x2F, 0x88, 0x3F, 0x02, 0xE2, 0x36, 0xBB, 0x45,
+	0x01, 0x17, 0x1A, 0x02, 0x74, 0x19, 0x01, 0x1D, 0x20, 0x02,
+	0xA2, 0x02, 0x1F, 0x01, 0x0D, 0x10, 0x04, 0xF2, 0x01, 0x16,
+	0x04, 0x1B, 0x1E, 0x05, 0xC2, 0x01, 0x2B, 0x05, 0x2A, 0x07,
+	0x04, 0x3F, 0x42, 0x04, 0x97, 0x02, 0x9A, 0x02, 0x04, 0xA1,
+	0x02, 0xA8, 0x02, 0x01, 0xF8, 0x05, 0x95, 0x05, 0x02, 0x0D,
+	0x1C, 0x01, 0x19, 0x1C, 0x04, 0xC0, 0x01, 0x11, 0x04, 0x9A,
+	0x01, 0x09, 0x04, 0x2B, 0x2E, 0x04, 0xAE, 0x01, 0x2D, 0x04,
+	0x72, 0x14, 0x04, 0x88, 0x02, 0x13, 0x04, 0x2B, 0x2E, 0x05,
+	0xE9, 0x02, 0xEC, 0x02, 0x05, 0xCD, 0x02, 0xD0, 0x02, 0x04,
+	0xBE, 0x06, 0xC7, 0x05, 0x01, 0x0D, 0x10, 0x23, 0x01, 0xDA,
+	0x8E, 0x01, 0xDC, 0x78, 0x01, 0xDE, 0x1D, 0xC3, 0x78, 0x01,
+	0x11, 0x14, 0x03, 0x56, 0x17, 0x06, 0x19, 0x1C, 0x01, 0x07,
+	0x60, 0x02, 0x44, 0x45, 0x02, 0x54, 0xD8, 0x58, 0x04, 0xAA,
+	0x59, 0x89, 0x59, 0xCF, 0x05, 0x7A, 0x65, 0x72, 0x6F, 0x3F,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x1E, 0x28, 0x7A,
+	0x65, 0x72, 0x6F, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x94, 0x1F, 0xCD, 0xF0, 0x1F,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01,
+	0x00, 0x03, 0xCE, 0x05, 0x7A, 0x65, 0x72, 0x6F, 0x3F, 0xDA,
+	0x10, 0x25, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x01, 0x03,
+	0x00, 0x00, 0x00, 0x04, 0x03, 0xE0, 0x1F, 0x0E, 0xCF, 0x09,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xD3,
+	0x02, 0xDA, 0x03, 0xDA, 0x9C, 0x01, 0xDA, 0x05, 0xCE, 0xB8,
+	0x06, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65,
+	0x77, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x5B, 0x2C, 0x73,
+	0x69, 0x67, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x5B, 0x2C, 0x63,
+	0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5D, 0x5D, 0x29,
+	0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20,
+	0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79,
+	0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x73, 0x65,
+	0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+	0x6C, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+	0x6B, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x70,
+	0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x61, 0x6C,
+	0x6C, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6D,
+	0x61, 0x73, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x73, 0x70, 0x65,
+	0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+	0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x20,
+	0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+	0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x20, 0x61, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20,
+	0x74, 0x6F, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x20,
+	0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+	0x74, 0x20, 0x73, 0x69, 0x67, 0x6D, 0x61, 0x73, 0x6B, 0x20,
+	0x69, 0x73, 0x20, 0x3A, 0x79, 0x69, 0x2E, 0x20, 0x46, 0x6F,
+	0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2C,
+	0x20, 0x0A, 0x0A, 0x09, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6D, 0x79, 0x66, 0x75, 0x6E,
+	0x20, 0x3A, 0x65, 0x31, 0x32, 0x33, 0x29, 0x0A, 0x0A, 0x62,
+	0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6F,
+	0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x73,
+	0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x31, 0x2C, 0x20,
+	0x32, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x33, 0x2E, 0x20, 0x54,
+	0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73,
+	0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6F,
+	0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x3A, 0x20, 0x0A, 0x0A, 0x09,
+	0x61, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+	0x73, 0x0A, 0x09, 0x64, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F,
+	0x63, 0x6B, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73,
+	0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x65, 0x20,
+	0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+	0x73, 0x0A, 0x09, 0x69, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F,
+	0x63, 0x6B, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75,
+	0x70, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73,
+	0x0A, 0x09, 0x75, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+	0x6B, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67,
+	0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x79, 0x20, 0x2D, 0x20,
+	0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x79, 0x69, 0x65, 0x6C,
+	0x64, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A,
+	0x09, 0x30, 0x2D, 0x39, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F,
+	0x63, 0x6B, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
+	0x66, 0x69, 0x63, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x73,
+	0x69, 0x67, 0x6E, 0x61, 0x6C, 0x0A, 0x0A, 0x54, 0x68, 0x65,
+	0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20,
+	0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65,
+	0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x73, 0x74,
+	0x61, 0x63, 0x6B, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x20, 0x67, 0x72, 0x6F, 0x77, 0x73,
+	0x20, 0x61, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64,
+	0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61,
+	0x6C, 0x6C, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74,
+	0x79, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+	0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x73,
+	0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x73, 0x20, 0x63, 0x68, 0x65, 0x61, 0x70,
+	0x65, 0x72, 0x2E, 0x20, 0x41, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+	0x73, 0x69, 0x67, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x75, 0x73,
+	0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66,
+	0x61, 0x75, 0x6C, 0x74, 0x2E, 0xCF, 0x04, 0x66, 0x69, 0x6E,
+	0x64, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xF8, 0x01,
+	0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x64,
+	0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x46, 0x69, 0x6E,
+	0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+	0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+	0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x61,
+	0x74, 0x69, 0x73, 0x66, 0x69, 0x65, 0x73, 0x20, 0x61, 0x20,
+	0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x20,
+	0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74,
+	0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20, 0x4E, 0x6F,
+	0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x69,
+	0x73, 0x20, 0x6E, 0x6F, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74,
+	0x6F, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E,
+	0x74, 0x69, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x69,
+	0x6C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x63,
+	0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x74,
+	0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20, 0x43, 0x6F,
+	0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6E,
+	0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x69, 0x66,
+	0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61,
+	0x6E, 0x20, 0x69, 0x73, 0x73, 0x75, 0x65, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xC8, 0x86, 0x03, 0xCD, 0xD4,
+	0x8B, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09,
+	0x03, 0x02, 0x01, 0x09, 0xCE, 0x04, 0x66, 0x69, 0x6E, 0x64,
+	0xDA, 0x10, 0xDA, 0x86, 0x04, 0x2C, 0x00, 0x01, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00,
+	0x00, 0x48, 0x02, 0x00, 0x02, 0x1A, 0x02, 0x02, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x33, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
+	0x00, 0x0E, 0x03, 0xE6, 0x8A, 0x03, 0x28, 0x02, 0x3A, 0x17,
+	0x02, 0x07, 0x2A, 0x02, 0x24, 0x25, 0xCF, 0x0B, 0x64, 0x65,
+	0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67,
+	0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA, 0x05, 0xCE, 0xAD,
+	0x06, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74,
+	0x61, 0x63, 0x6B, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A,
+	0x47, 0x65, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72,
+	0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F,
+	0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
+	0x63, 0x6B, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68,
+	0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+	0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69,
+	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x70, 0x20,
+	0x6D, 0x6F, 0x73, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
+	0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74,
+	0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x74,
+	0x74, 0x6F, 0x6D, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+	0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20,
+	0x45, 0x61, 0x63, 0x68, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+	0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+	0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x73, 0x6F, 0x6D, 0x65,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F,
+	0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74,
+	0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x3A, 0x0A,
+	0x0A, 0x09, 0x3A, 0x63, 0x20, 0x2D, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x76,
+	0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A,
+	0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x2D, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F,
+	0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72,
+	0x61, 0x6D, 0x65, 0x0A, 0x09, 0x3A, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+	0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+	0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+	0x73, 0x0A, 0x09, 0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x2D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6E, 0x74, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+	0x6C, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72,
+	0x61, 0x6D, 0x65, 0x0A, 0x09, 0x3A, 0x6E, 0x61, 0x6D, 0x65,
+	0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x6D,
+	0x61, 0x6E, 0x20, 0x66, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x6C,
+	0x79, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x70, 0x63, 0x20, 0x2D, 0x20,
+	0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x69, 0x6E,
+	0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+	0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x63, 0x6F, 0x75,
+	0x6E, 0x74, 0x65, 0x72, 0x0A, 0x09, 0x3A, 0x73, 0x6F, 0x75,
+	0x72, 0x63, 0x65, 0x20, 0x2D, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+	0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65,
+	0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64,
+	0x65, 0x0A, 0x09, 0x3A, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20,
+	0x2D, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+	0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+	0x73, 0x6C, 0x6F, 0x74, 0x0A, 0x09, 0x3A, 0x74, 0x61, 0x69,
+	0x6C, 0x20, 0x2D, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+	0x6E, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69,
+	0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20,
+	0x63, 0x61, 0x6C, 0x6C, 0xCF, 0x14, 0x6D, 0x6F, 0x64, 0x75,
+	0x6C, 0x65, 0x2F, 0x2A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D,
+	0x63, 0x61, 0x63, 0x68, 0x65, 0x2A, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x9D, 0x02, 0x57, 0x68, 0x65, 0x6E, 0x20,
+	0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x71, 0x75,
+	0x69, 0x72, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x73, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x64, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61,
+	0x63, 0x68, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x6D,
+	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x20, 0x69, 0x6E, 0x20,
+	0x61, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x65, 0x64, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6E,
+	0x65, 0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x73,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67,
+	0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20,
+	0x54, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+	0x69, 0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20,
+	0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66,
+	0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63,
+	0x65, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C,
+	0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20,
+	0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+	0x73, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C,
+	0x64, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x2E,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFC, 0x82, 0x06,
+	0xCD, 0x88, 0x88, 0x06, 0xDA, 0x91, 0x04, 0xDA, 0xC5, 0x07,
+	0xCF, 0x05, 0x6A, 0x75, 0x78, 0x74, 0x2A, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x7C, 0x28, 0x6A, 0x75, 0x78, 0x74,
+	0x2A, 0x20, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6A, 0x75, 0x78, 0x74, 0x61, 0x70, 0x6F,
+	0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20,
+	0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E,
+	0x20, 0x49, 0x6E, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+	0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20, 0x20, 0x28, 0x28,
+	0x6A, 0x75, 0x78, 0x74, 0x2A, 0x20, 0x61, 0x20, 0x62, 0x20,
+	0x63, 0x29, 0x20, 0x78, 0x29, 0x20, 0x65, 0x76, 0x61, 0x6C,
+	0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x28,
+	0x28, 0x61, 0x20, 0x78, 0x29, 0x20, 0x28, 0x62, 0x20, 0x78,
+	0x29, 0x20, 0x28, 0x63, 0x20, 0x78, 0x29, 0x29, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xE2, 0x96, 0x03, 0xCD,
+	0xD8, 0x9A, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8,
+	0x0B, 0x03, 0x00, 0x00, 0x03, 0x01, 0xCE, 0x05, 0x6A, 0x75,
+	0x78, 0x74, 0x2A, 0xDA, 0x10, 0x28, 0x01, 0x00, 0x00, 0x2A,
+	0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x80, 0x80,
+	0x88, 0x2D, 0x06, 0x00, 0x02, 0x13, 0x01, 0xDA, 0x10, 0xDA,
+	0xFE, 0x01, 0xDA, 0x89, 0x01, 0x38, 0x01, 0x00, 0x00, 0x27,
+	0x02, 0x00, 0x00, 0x37, 0x03, 0x02, 0x00, 0x17, 0x04, 0x03,
+	0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x05, 0x03, 0x04, 0x1A,
+	0x05, 0x09, 0x00, 0x33, 0x05, 0x02, 0x03, 0x4C, 0x00, 0x00,
+	0x00, 0x2F, 0x05, 0x05, 0x00, 0x2C, 0x01, 0x05, 0x00, 0x26,
+	0x05, 0x00, 0x00, 0x2F, 0x05, 0x05, 0x00, 0x49, 0x03, 0x04,
+	0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x25, 0x02, 0x00, 0x00, 0x2C,
+	0x01, 0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x14, 0x01, 0x9A, 0x99,
+	0x03, 0x18, 0x07, 0x24, 0x4E, 0x02, 0x52, 0x55, 0x03, 0x1F,
+	0x22, 0x02, 0x31, 0x34, 0x04, 0x72, 0x41, 0x0B, 0x01, 0xE2,
+	0x96, 0x03, 0xF6, 0x03, 0x02, 0x96, 0x02, 0x97, 0x02, 0xCF,
+	0x0B, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x6A, 0x6F,
+	0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0xDA,
+	0x05, 0xCE, 0x76, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74,
+	0x73, 0x20, 0x5B, 0x2C, 0x73, 0x65, 0x70, 0x5D, 0x29, 0x0A,
+	0x0A, 0x4A, 0x6F, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2C, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+	0x61, 0x6C, 0x6C, 0x79, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72,
+	0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+	0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x70,
+	0x2E, 0xCF, 0x07, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3F,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+	0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xCC, 0x27, 0xCD, 0xCC, 0x28, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x07,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3F, 0xDA, 0x10, 0xDA,
+	0x1D, 0xDA, 0x21, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x1F,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0xAA,
+	0x28, 0x0E, 0x03, 0x05, 0x18, 0xCF, 0x06, 0x69, 0x6D, 0x70,
+	0x6F, 0x72, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0x96, 0x02, 0x28, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74,
+	0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E,
+	0x20, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x65, 0x71,
+	0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x6D, 0x65, 0x72,
+	0x67, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x70, 0x72, 0x65,
+	0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20,
+	0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x65, 0x66,
+	0x69, 0x78, 0x20, 0x61, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64,
+	0x65, 0x64, 0x2E, 0x20, 0x20, 0x28, 0x75, 0x73, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x3A, 0x61, 0x73, 0x20, 0x6F, 0x72,
+	0x20, 0x3A, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6F,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73,
+	0x65, 0x74, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69,
+	0x78, 0x29, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20,
+	0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x69, 0x73, 0x20,
+	0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x20,
+	0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+	0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x61, 0x73,
+	0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2E,
+	0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xD0, 0xF0, 0x06, 0xCD, 0x96, 0xF8, 0x06, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x0B, 0x04, 0x01, 0x05, 0x0D, 0x01,
+	0xCE, 0x06, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0xDA, 0x10,
+	0xDA, 0xEB, 0x02, 0xDA, 0xBC, 0x02, 0xD7, 0xCD, 0x80, 0x80,
+	0xC8, 0x29, 0x08, 0x02, 0x0B, 0x4C, 0xCE, 0x07, 0x69, 0x6D,
+	0x70, 0x6F, 0x72, 0x74, 0x2A, 0xDA, 0x10, 0xDA, 0xB2, 0x04,
+	0xD0, 0x02, 0x61, 0x73, 0xD0, 0x06, 0x70, 0x72, 0x65, 0x66,
+	0x69, 0x78, 0xDA, 0xEF, 0x07, 0xCE, 0x01, 0x2F, 0xDA, 0xBC,
+	0x02, 0xDA, 0xF9, 0x01, 0xDA, 0xB6, 0x01, 0xDA, 0x5A, 0xDA,
+	0x81, 0x03, 0xDA, 0xDE, 0x07, 0x4C, 0x02, 0x00, 0x00, 0x26,
+	0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x26, 0x05, 0x01,
+	0x00, 0x33, 0x04, 0x03, 0x05, 0x17, 0x05, 0x04, 0x00, 0x26,
+	0x06, 0x02, 0x00, 0x33, 0x04, 0x03, 0x06, 0x17, 0x06, 0x04,
+	0x00, 0x2B, 0x01, 0x00, 0x00, 0x4C, 0x02, 0x00, 0x00, 0x26,
+	0x04, 0x03, 0x00, 0x2F, 0x04, 0x04, 0x00, 0x1A, 0x05, 0x06,
+	0x00, 0x26, 0x02, 0x04, 0x00, 0x2C, 0x05, 0x02, 0x00, 0x26,
+	0x03, 0x05, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x18, 0x02, 0x00,
+	0x00, 0x22, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x02, 0x00, 0x18,
+	0x0F, 0x00, 0x00, 0x1A, 0x06, 0x03, 0x00, 0x17, 0x03, 0x06,
+	0x00, 0x18, 0x0B, 0x00, 0x00, 0x26, 0x05, 0x04, 0x00, 0x2C,
+	0x01, 0x05, 0x00, 0x26, 0x01, 0x05, 0x00, 0x2F, 0x05, 0x01,
+	0x00, 0x17, 0x01, 0x05, 0x00, 0x1A, 0x01, 0x03, 0x00, 0x17,
+	0x05, 0x01, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x05, 0x00,
+	0x00, 0x17, 0x03, 0x05, 0x00, 0x17, 0x02, 0x03, 0x00, 0x17,
+	0x03, 0x04, 0x00, 0x22, 0x05, 0x00, 0x00, 0x2C, 0x03, 0x05,
+	0x00, 0x26, 0x01, 0x06, 0x00, 0x2F, 0x05, 0x01, 0x00, 0x17,
+	0x01, 0x05, 0x00, 0x22, 0x04, 0x00, 0x00, 0x1F, 0x05, 0x04,
+	0x01, 0x19, 0x05, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x18,
+	0x02, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x1B,
+	0x00, 0x17, 0x04, 0x01, 0x00, 0x33, 0x05, 0x03, 0x01, 0x17,
+	0x06, 0x05, 0x00, 0x26, 0x05, 0x07, 0x00, 0x2B, 0x05, 0x00,
+	0x00, 0x2F, 0x05, 0x06, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x26,
+	0x07, 0x08, 0x00, 0x2F, 0x05, 0x07, 0x00, 0x1A, 0x05, 0x0D,
+	0x00, 0x26, 0x05, 0x07, 0x00, 0x23, 0x07, 0x00, 0x00, 0x2C,
+	0x05, 0x07, 0x00, 0x3C, 0x05, 0x00, 0x00, 0x2C, 0x05, 0x06,
+	0x00, 0x26, 0x06, 0x09, 0x00, 0x2F, 0x07, 0x06, 0x00, 0x17,
+	0x05, 0x07, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26, 0x06, 0x0A,
+	0x00, 0x2F, 0x07, 0x06, 0x00, 0x34, 0x00, 0x07, 0x05, 0x2C,
+	0x03, 0x01, 0x00, 0x26, 0x05, 0x06, 0x00, 0x2F, 0x01, 0x05,
+	0x00, 0x18, 0xE0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x40,
+	0x03, 0xBA, 0xEC, 0x06, 0x18, 0x06, 0x49, 0x4C, 0x04, 0x84,
+	0x01, 0x3D, 0x01, 0x50, 0x08, 0x04, 0x10, 0x11, 0x02, 0x0F,
+	0x12, 0x05, 0x07, 0x3C, 0x04, 0x48, 0x49, 0x07, 0x47, 0x4A,
+	0x10, 0x74, 0xAE, 0x01, 0x03, 0x4C, 0x81, 0x02, 0x03, 0x09,
+	0x0C, 0x01, 0x41, 0xF6, 0x01, 0x07, 0x86, 0x01, 0xD3, 0x01,
+	0x01, 0x13, 0x16, 0x03, 0x78, 0x39, 0x01, 0x11, 0x1E, 0x05,
+	0xD7, 0x01, 0xDA, 0x01, 0xDA, 0xDD, 0x0B, 0xDA, 0x5D, 0x2A,
+	0x02, 0x00, 0x00, 0x2C, 0x02, 0x01, 0x00, 0x26, 0x01, 0x00,
+	0x00, 0x2F, 0x02, 0x01, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x26, 0x00, 0x02,
+	0x00, 0x26, 0x03, 0x03, 0x00, 0x2D, 0x00, 0x03, 0x01, 0x2E,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0xCD, 0x80, 0x80, 0xA0, 0x09, 0x04, 0x01, 0x03, 0x0A,
+	0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x20, 0xDA, 0xBC, 0x02, 0x2B,
+	0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x2F, 0x01, 0x01,
+	0x00, 0x26, 0x02, 0x01, 0x00, 0x48, 0x01, 0x01, 0x02, 0x1A,
+	0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x01, 0x02, 0x00, 0x30, 0x01, 0x00, 0x00, 0x0B,
+	0x05, 0x82, 0xF6, 0x06, 0x16, 0x02, 0x07, 0x78, 0x03, 0x7A,
+	0x7B, 0x11, 0x01, 0xC4, 0xF5, 0x06, 0xC6, 0x01, 0x03, 0x09,
+	0x38, 0x03, 0xB4, 0x02, 0xE5, 0x01, 0x06, 0x2B, 0x3A, 0xCF,
+	0x03, 0x6D, 0x61, 0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05,
+	0xCE, 0x73, 0x28, 0x6D, 0x61, 0x70, 0x20, 0x66, 0x20, 0x26,
+	0x20, 0x69, 0x6E, 0x64, 0x73, 0x29, 0x0A, 0x0A, 0x4D, 0x61,
+	0x70, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x65, 0x76,
+	0x65, 0x72, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+	0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xBA, 0xD7, 0x02, 0xCD, 0xEC, 0xE5,
+	0x02, 0xDA, 0x03, 0xDA, 0xEB, 0x02, 0xCF, 0x03, 0x74, 0x72,
+	0x79, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x92, 0x03,
+	0x28, 0x74, 0x72, 0x79, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20,
+	0x63, 0x61, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x0A, 0x54, 0x72,
+	0x79, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E,
+	0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x74, 0x63,
+	0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x20,
+	0x42, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E,
+	0x79, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
+	0x6F, 0x6E, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63,
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C,
+	0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65,
+	0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70,
+	0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x74,
+	0x75, 0x70, 0x6C, 0x65, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x75,
+	0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
+	0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x20, 0x6F,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x62, 0x69,
+	0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x77, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F,
+	0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x66, 0x20,
+	0x6E, 0x6F, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C, 0x20,
+	0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+	0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x61,
+	0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E, 0x20,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x74,
+	0x68, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62,
+	0x65, 0x72, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79,
+	0x20, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+	0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x6E, 0x6F, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+	0x64, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xE8, 0x76, 0xCD, 0xE8, 0x82, 0x01, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x0A, 0x02, 0x0E, 0x48,
+	0xCE, 0x03, 0x74, 0x72, 0x79, 0xDA, 0x10, 0xDA, 0x5B, 0xDA,
+	0x99, 0x01, 0xDA, 0x9C, 0x01, 0xD0, 0x01, 0x65, 0xDA, 0xD0,
+	0x0C, 0xDA, 0xAD, 0x03, 0xDA, 0x97, 0x02, 0xDA, 0xD6, 0x02,
+	0xDA, 0x5C, 0xDA, 0x89, 0x01, 0xDA, 0x5F, 0xDA, 0x5E, 0xDA,
+	0xD7, 0x03, 0xCF, 0x04, 0x74, 0x72, 0x79, 0x2A, 0x35, 0x02,
+	0x01, 0x00, 0x35, 0x03, 0x02, 0x00, 0x17, 0x04, 0x03, 0x00,
+	0x35, 0x03, 0x02, 0x01, 0x17, 0x05, 0x03, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00,
+	0x26, 0x06, 0x00, 0x00, 0x2F, 0x02, 0x06, 0x00, 0x17, 0x06,
+	0x02, 0x00, 0x1A, 0x05, 0x2C, 0x00, 0x3D, 0x02, 0x00, 0x00,
+	0x26, 0x08, 0x01, 0x00, 0x2D, 0x08, 0x02, 0x00, 0x3D, 0x07,
+	0x00, 0x00, 0x26, 0x08, 0x02, 0x00, 0x26, 0x09, 0x03, 0x00,
+	0x2D, 0x08, 0x07, 0x09, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x08,
+	0x04, 0x00, 0x2C, 0x08, 0x03, 0x00, 0x3D, 0x07, 0x00, 0x00,
+	0x2D, 0x03, 0x02, 0x06, 0x2B, 0x07, 0x00, 0x00, 0x3D, 0x08,
+	0x00, 0x00, 0x26, 0x07, 0x05, 0x00, 0x2C, 0x07, 0x03, 0x00,
+	0x3D, 0x02, 0x00, 0x00, 0x26, 0x09, 0x06, 0x00, 0x26, 0x00,
+	0x07, 0x00, 0x2D, 0x09, 0x02, 0x00, 0x3D, 0x07, 0x00, 0x00,
+	0x26, 0x09, 0x08, 0x00, 0x2D, 0x09, 0x04, 0x06, 0x3D, 0x02,
+	0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x2D, 0x00, 0x05, 0x03,
+	0x3D, 0x09, 0x00, 0x00, 0x25, 0x00, 0x01, 0x00, 0x2C, 0x01,
+	0x00, 0x00, 0x26, 0x00, 0x09, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x26, 0x01, 0x0A, 0x00, 0x2D, 0x01, 0x02, 0x09, 0x2E, 0x00,
+	0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x26, 0x09, 0x0B, 0x00,
+	0x2D, 0x09, 0x07, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x3D, 0x02,
+	0x00, 0x00, 0x26, 0x09, 0x0C, 0x00, 0x2D, 0x09, 0x08, 0x02,
+	0x3D, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x1A, 0x04,
+	0x03, 0x00, 0x17, 0x02, 0x04, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x17, 0x02, 0x06, 0x00, 0x25, 0x07, 0x01, 0x00, 0x2C, 0x01,
+	0x07, 0x00, 0x26, 0x08, 0x09, 0x00, 0x2F, 0x07, 0x08, 0x00,
+	0x26, 0x09, 0x0A, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x2E, 0x07,
+	0x00, 0x00, 0x3D, 0x08, 0x00, 0x00, 0x26, 0x09, 0x0D, 0x00,
+	0x2D, 0x09, 0x00, 0x02, 0x2B, 0x08, 0x00, 0x00, 0x3D, 0x07,
+	0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x33, 0x05, 0xBA, 0x7D,
+	0xAC, 0x05, 0x02, 0x44, 0x9D, 0x05, 0x01, 0x43, 0x9E, 0x05,
+	0x02, 0x6A, 0x9D, 0x05, 0x01, 0x69, 0x9E, 0x05, 0x01, 0x86,
+	0x01, 0x87, 0x01, 0x1B, 0x1C, 0x9F, 0x01, 0x04, 0xB8, 0x02,
+	0xD9, 0x02, 0x0C, 0xB7, 0x02, 0xDA, 0x02, 0x04, 0x94, 0x03,
+	0x91, 0x02, 0x04, 0x44, 0x47, 0x09, 0x43, 0x48, 0xCF, 0x04,
+	0x61, 0x73, 0x2D, 0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0x9E, 0x01, 0x28, 0x61, 0x73, 0x2D, 0x3E, 0x20, 0x78,
+	0x20, 0x61, 0x73, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67,
+	0x65, 0x74, 0x68, 0x65, 0x72, 0x2C, 0x20, 0x72, 0x65, 0x70,
+	0x6C, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20,
+	0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72,
+	0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20,
+	0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xAC, 0xCF, 0x03, 0xCD, 0xF6, 0xD4, 0x03, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x09, 0x02, 0x03, 0x09,
+	0x02, 0xCE, 0x04, 0x61, 0x73, 0x2D, 0x3E, 0xDA, 0x10, 0xDA,
+	0x5B, 0xDA, 0xEA, 0x0A, 0xDA, 0xD7, 0x03, 0x28, 0x03, 0x00,
+	0x00, 0x17, 0x04, 0x00, 0x00, 0x17, 0x05, 0x02, 0x00, 0x37,
+	0x06, 0x05, 0x00, 0x17, 0x07, 0x06, 0x00, 0x25, 0x06, 0x00,
+	0x00, 0x2A, 0x08, 0x01, 0x00, 0x2F, 0x08, 0x08, 0x00, 0x03,
+	0x04, 0x00, 0x00, 0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x02, 0x01,
+	0x00, 0x06, 0x01, 0xDA, 0x10, 0x27, 0x01, 0x00, 0x01, 0x48,
+	0x01, 0x00, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x27, 0x01, 0x00,
+	0x0B, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0x08, 0x02, 0xDC, 0xD3, 0x03, 0x0E,
+	0x04, 0x07, 0x16, 0xCD, 0x80, 0x80, 0xD0, 0x0F, 0x07, 0x00,
+	0x03, 0x1E, 0x01, 0x01, 0xCE, 0x06, 0x5F, 0x77, 0x68, 0x69,
+	0x6C, 0x65, 0xDA, 0x10, 0xDA, 0x5B, 0xDA, 0xEA, 0x0A, 0xDA,
+	0xD7, 0x03, 0x27, 0x01, 0x00, 0x06, 0x27, 0x02, 0x00, 0x07,
+	0x3E, 0x00, 0x01, 0x02, 0x19, 0x00, 0x02, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x27, 0x02, 0x00, 0x05, 0x27, 0x03, 0x00, 0x06,
+	0x33, 0x01, 0x02, 0x03, 0x17, 0x02, 0x01, 0x00, 0x26, 0x03,
+	0x00, 0x00, 0x2F, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01, 0x00,
+	0x2A, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x05,
+	0x01, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17, 0x01, 0x04, 0x00,
+	0x27, 0x05, 0x00, 0x04, 0x2C, 0x03, 0x05, 0x00, 0x3D, 0x04,
+	0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x04, 0x01,
+	0x3D, 0x05, 0x00, 0x00, 0x29, 0x05, 0x00, 0x04, 0x25, 0x04,
+	0x01, 0x00, 0x27, 0x05, 0x00, 0x06, 0x06, 0x01, 0x04, 0x05,
+	0x29, 0x01, 0x00, 0x06, 0x28, 0x04, 0x00, 0x00, 0x30, 0x04,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xCD, 0x80, 0x80,
+	0xA0, 0x0D, 0x02, 0x01, 0x00, 0x06, 0x02, 0xDA, 0x10, 0x27,
+	0x01, 0x00, 0x01, 0x48, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x03,
+	0x00, 0x27, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x08,
+	0x02, 0xDC, 0xD3, 0x03, 0x0E, 0x04, 0x07, 0x16, 0x1F, 0x09,
+	0xAE, 0xD2, 0x03, 0xB8, 0x02, 0x02, 0x48, 0xA9, 0x02, 0x01,
+	0x11, 0x14, 0x01, 0x60, 0x14, 0x03, 0x13, 0x20, 0x01, 0x1D,
+	0x20, 0x07, 0x96, 0x01, 0x3B, 0x06, 0xF9, 0x01, 0xFE, 0x01,
+	0x14, 0x01, 0xAC, 0xCF, 0x03, 0xCA, 0x05, 0x01, 0xE4, 0x02,
+	0xB3, 0x05, 0x06, 0x1E, 0xA2, 0x02, 0x01, 0x81, 0x03, 0x92,
+	0x03, 0xCF, 0x03, 0x6D, 0x61, 0x78, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0x3B, 0x28, 0x6D, 0x61, 0x78, 0x20, 0x26,
+	0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6D, 0x61,
+	0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+	0x74, 0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0x88, 0xBC, 0x02, 0xCD, 0xB6, 0xBD, 0x02, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x09, 0x02, 0x00, 0x02, 0x04, 0xCE,
+	0x03, 0x6D, 0x61, 0x78, 0xDA, 0x10, 0xDA, 0xBB, 0x07, 0xDA,
+	0x8F, 0x02, 0x26, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00,
+	0x26, 0x01, 0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x05, 0x04,
+	0x96, 0xBD, 0x02, 0x1E, 0xCF, 0x0D, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0xD3,
+	0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x2F, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0xDA, 0x05,
+	0xCE, 0x51, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+	0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x62, 0x79, 0x74,
+	0x65, 0x73, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+	0x73, 0x20, 0x6E, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x73,
+	0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74,
+	0x65, 0x64, 0x2E, 0xCF, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x62, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+	0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69,
+	0x74, 0xDA, 0x05, 0xCE, 0x6D, 0x28, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29,
+	0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69,
+	0x74, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75,
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+	0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2C,
+	0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20,
+	0x6E, 0x6F, 0x74, 0x2E, 0xCF, 0x06, 0x66, 0x69, 0x62, 0x65,
+	0x72, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x22,
+	0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x69,
+	0x62, 0x65, 0x72, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xBC, 0x23, 0xCD, 0xB6, 0x24, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x02, 0x06, 0xCE, 0x06,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x3F, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0xB2, 0x03, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x1F,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0x96,
+	0x24, 0x0E, 0x03, 0x05, 0x16, 0xCF, 0x03, 0x66, 0x6F, 0x72,
+	0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x54, 0x28, 0x66,
+	0x6F, 0x72, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+	0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x65, 0x6E, 0x64,
+	0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A,
+	0x44, 0x6F, 0x20, 0x61, 0x20, 0x63, 0x20, 0x73, 0x74, 0x79,
+	0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x64, 0x65,
+	0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+	0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0x82, 0x8F, 0x02, 0xCD, 0xC2, 0x91, 0x02, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x04, 0x03, 0x03,
+	0x0B, 0xCE, 0x03, 0x66, 0x6F, 0x72, 0xDA, 0x10, 0xDA, 0x5D,
+	0xDA, 0xEB, 0x0D, 0xDA, 0xF2, 0x0D, 0x2C, 0x01, 0x02, 0x00,
+	0x26, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x26, 0x02,
+	0x01, 0x00, 0x2D, 0x00, 0x02, 0x01, 0x26, 0x00, 0x00, 0x00,
+	0x2F, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x4C, 0x03,
+	0x00, 0x00, 0x26, 0x01, 0x02, 0x00, 0x30, 0x01, 0x00, 0x00,
+	0x0B, 0x03, 0x92, 0x91, 0x02, 0x20, 0x04, 0x2B, 0x2E, 0x04,
+	0x17, 0x24, 0xCF, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x41, 0x28, 0x66, 0x69,
+	0x72, 0x73, 0x74, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x47,
+	0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+	0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+	0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69,
+	0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74,
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+	0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x98,
+	0xC3, 0x02, 0xCD, 0xCA, 0xC4, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x00, 0x03, 0xCE, 0x05,
+	0x66, 0x69, 0x72, 0x73, 0x74, 0xDA, 0x10, 0x25, 0x01, 0x00,
+	0x00, 0x33, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x05,
+	0x03, 0xB6, 0xC4, 0x02, 0x12, 0xCF, 0x04, 0x77, 0x61, 0x6C,
+	0x6B, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xAD, 0x01,
+	0x28, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x49, 0x74, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+	0x6E, 0x20, 0x61, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x66, 0x20, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x43, 0x6F,
+	0x6C, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x2E, 0x20,
+	0x49, 0x66, 0x20, 0x61, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x20, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x6F,
+	0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C, 0x20, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xB0, 0xC4, 0x03, 0xCD, 0x90, 0xCA, 0x03, 0xDA, 0x03, 0xDA,
+	0x80, 0x02, 0xCF, 0x04, 0x65, 0x61, 0x63, 0x68, 0xD4, 0x02,
+	0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x44, 0x28, 0x65, 0x61, 0x63,
+	0x68, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+	0x69, 0x6E, 0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+	0x29, 0x0A, 0x0A, 0x4C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76,
+	0x65, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+	0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xC8, 0x91, 0x02, 0xCD, 0xC6, 0x93,
+	0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x04,
+	0x02, 0x03, 0x08, 0xCE, 0x04, 0x65, 0x61, 0x63, 0x68, 0xDA,
+	0x10, 0xDA, 0xEE, 0x0D, 0xDA, 0x5D, 0xDA, 0xF2, 0x0D, 0x26,
+	0x03, 0x00, 0x00, 0x2D, 0x00, 0x03, 0x01, 0x26, 0x00, 0x01,
+	0x00, 0x2F, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x4C,
+	0x02, 0x00, 0x00, 0x26, 0x00, 0x02, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0x08, 0x04, 0x8C, 0x93, 0x02, 0x2C, 0x04, 0x17, 0x24,
+	0xCF, 0x0E, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61,
+	0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0E, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61,
+	0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA, 0x05, 0xCE, 0x88,
+	0x02, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61,
+	0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x69, 0x62,
+	0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20,
+	0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65,
+	0x20, 0x69, 0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C,
+	0x6F, 0x77, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+	0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+	0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x73, 0x74, 0x61,
+	0x63, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20,
+	0x75, 0x70, 0x20, 0x66, 0x72, 0x6F, 0x6E, 0x74, 0x2C, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+	0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61,
+	0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6D,
+	0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74,
+	0x68, 0x69, 0x73, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+	0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x73, 0x74,
+	0x61, 0x63, 0x6B, 0x2D, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+	0x6F, 0x77, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69,
+	0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6D,
+	0x6F, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65,
+	0x64, 0x65, 0x64, 0x2E, 0x20, 0xCF, 0x03, 0x73, 0x75, 0x6D,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x3B, 0x28, 0x73,
+	0x75, 0x6D, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20,
+	0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x30, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xE8, 0x95, 0x02, 0xCD, 0xE6, 0x97,
+	0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x05,
+	0x01, 0x00, 0x0B, 0xCE, 0x03, 0x73, 0x75, 0x6D, 0xDA, 0x10,
+	0x25, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04, 0x02, 0x03,
+	0x1A, 0x04, 0x05, 0x00, 0x33, 0x04, 0x00, 0x02, 0x06, 0x01,
+	0x01, 0x04, 0x49, 0x02, 0x03, 0x01, 0x18, 0xFD, 0xFF, 0xFF,
+	0x03, 0x01, 0x00, 0x00, 0x13, 0x01, 0xFA, 0x96, 0x02, 0x18,
+	0x06, 0x20, 0x22, 0x01, 0x22, 0x23, 0x02, 0x21, 0x24, 0x01,
+	0xB1, 0x01, 0xC4, 0x01, 0xCF, 0x0C, 0x66, 0x6C, 0x61, 0x74,
+	0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x91, 0x01, 0x28, 0x66, 0x6C,
+	0x61, 0x74, 0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x78, 0x73, 0x29, 0x0A,
+	0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E,
+	0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x29, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74,
+	0x68, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72,
+	0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66,
+	0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x27, 0x69, 0x6E, 0x74, 0x6F,
+	0x27, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x6E, 0x74,
+	0x6F, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xC4,
+	0x8F, 0x04, 0xCD, 0xCC, 0x93, 0x04, 0xDA, 0x03, 0xDA, 0xA0,
+	0x08, 0xCF, 0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0xD4,
+	0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x38, 0x28, 0x75, 0x6E,
+	0x6C, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68,
+	0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x77,
+	0x68, 0x65, 0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x2E,
+	0x2E, 0x2E, 0x20, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xE2, 0x5B, 0xCD, 0xB6, 0x5D, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x04, 0x01, 0x02, 0x0A,
+	0xCE, 0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0xDA, 0x10,
+	0xDA, 0x5F, 0xDA, 0x5E, 0x26, 0x02, 0x00, 0x00, 0x2B, 0x02,
+	0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D, 0x01, 0x00, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x22, 0x03, 0x00, 0x00, 0x2D, 0x02,
+	0x00, 0x03, 0x2B, 0x01, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00,
+	0x03, 0x02, 0x00, 0x00, 0x04, 0x0A, 0xF6, 0x5C, 0x3E, 0xCF,
+	0x0B, 0x73, 0x63, 0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x63,
+	0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0xDA,
+	0x05, 0xCE, 0xD8, 0x01, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x2D,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72,
+	0x29, 0x0A, 0x0A, 0x50, 0x61, 0x72, 0x73, 0x65, 0x20, 0x61,
+	0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x61,
+	0x6E, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+	0x68, 0x61, 0x74, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x2C, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x20, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C,
+	0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+	0x65, 0x72, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+	0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+	0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20,
+	0x61, 0x73, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73,
+	0x20, 0x69, 0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+	0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64,
+	0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x6F,
+	0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C,
+	0x69, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E,
+	0xCF, 0x07, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xA5, 0x01, 0x28, 0x69,
+	0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A, 0x20, 0x65, 0x6E, 0x76,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72,
+	0x67, 0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6D, 0x70, 0x6F, 0x72,
+	0x74, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+	0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x67, 0x69,
+	0x76, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63,
+	0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x20, 0x6F, 0x66, 0x20, 0x28, 0x69, 0x6D, 0x70, 0x6F,
+	0x72, 0x74, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x73,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x69,
+	0x63, 0x69, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+	0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x74, 0x61, 0x62,
+	0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0x86, 0xE9, 0x06, 0xCD, 0xCA, 0xF0, 0x06, 0xDA, 0x03, 0xDA,
+	0xA9, 0x0E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65,
+	0x78, 0x70, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61,
+	0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0xDA, 0x05, 0xCE, 0x2A,
+	0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+	0x78, 0x2E, 0xCF, 0x0D, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+	0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0xD3, 0x02, 0xDA,
+	0x03, 0xDA, 0xE2, 0x0D, 0xDA, 0x05, 0xCE, 0xBC, 0x01, 0x28,
+	0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x70, 0x72, 0x65, 0x70,
+	0x65, 0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x20, 0x26, 0x20,
+	0x69, 0x74, 0x65, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x50, 0x72,
+	0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x65, 0x61, 0x63,
+	0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x69, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x74,
+	0x6F, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E,
+	0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+	0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x2E, 0x20, 0x49, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x61,
+	0x72, 0x65, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64,
+	0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x69, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x69,
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x09, 0x66,
+	0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0x91, 0x03, 0xDA, 0x05, 0xCE, 0x9A, 0x03,
+	0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64,
+	0x20, 0x66, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x5B, 0x2C,
+	0x62, 0x75, 0x66, 0x5D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61,
+	0x64, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+	0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x41, 0x20, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x62, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65,
+	0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x75,
+	0x72, 0x74, 0x68, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+	0x6E, 0x74, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+	0x69, 0x73, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x27,
+	0x77, 0x68, 0x61, 0x74, 0x27, 0x20, 0x63, 0x61, 0x6E, 0x20,
+	0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x65, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x20, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77,
+	0x6F, 0x72, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
+	0x74, 0x73, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x73,
+	0x20, 0x66, 0x6F, 0x72, 0x20, 0x27, 0x77, 0x68, 0x61, 0x74,
+	0x27, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x61, 0x6C, 0x6C, 0x20,
+	0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C,
+	0x65, 0x0A, 0x09, 0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x2D,
+	0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x75, 0x70, 0x20, 0x74,
+	0x6F, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x63, 0x6C,
+	0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6E, 0x65, 0x78, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69,
+	0x6E, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+	0x65, 0x72, 0x0A, 0x09, 0x6E, 0x20, 0x28, 0x69, 0x6E, 0x74,
+	0x65, 0x67, 0x65, 0x72, 0x29, 0x20, 0x2D, 0x20, 0x72, 0x65,
+	0x61, 0x64, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x6E,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0xDA, 0x99, 0x06, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xFE, 0x01,
+	0xDA, 0x05, 0xCE, 0x66, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x61, 0x72, 0x72, 0x20,
+	0x78, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+	0x20, 0x61, 0x6E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+	0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+	0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x4D, 0x6F, 0x64, 0x69,
+	0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+	0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6E, 0x73, 0x20, 0x69, 0x74, 0x2E, 0xCF, 0x0D, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2F, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0xDA, 0x05, 0xCE, 0x81, 0x05, 0x28, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x2F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+	0x78, 0x20, 0x5B, 0x2C, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+	0x20, 0x5B, 0x2C, 0x6D, 0x61, 0x78, 0x6C, 0x65, 0x6E, 0x20,
+	0x5B, 0x2C, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F,
+	0x6E, 0x5D, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x46, 0x6F, 0x72,
+	0x6D, 0x61, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x70, 0x61, 0x72, 0x61,
+	0x6D, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x69,
+	0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x68, 0x6F, 0x77, 0x20,
+	0x74, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x2C, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20,
+	0x61, 0x73, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x69, 0x6E,
+	0x67, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x2C, 0x20, 0x73,
+	0x63, 0x69, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x63, 0x2C,
+	0x20, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x65,
+	0x76, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73,
+	0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+	0x73, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x65, 0x72, 0x2E,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x63, 0x61,
+	0x6E, 0x20, 0x62, 0x65, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x67,
+	0x20, 0x2D, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+	0x74, 0x29, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x65, 0x73,
+	0x74, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E,
+	0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x63, 0x61, 0x73,
+	0x65, 0x20, 0x65, 0x2E, 0x0A, 0x09, 0x3A, 0x47, 0x20, 0x2D,
+	0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x65, 0x73, 0x74, 0x20,
+	0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x75, 0x70, 0x70, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x20,
+	0x45, 0x2E, 0x0A, 0x09, 0x3A, 0x65, 0x20, 0x2D, 0x20, 0x73,
+	0x63, 0x69, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x63, 0x20,
+	0x77, 0x69, 0x74, 0x68, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72,
+	0x63, 0x61, 0x73, 0x65, 0x20, 0x65, 0x2E, 0x0A, 0x09, 0x3A,
+	0x45, 0x20, 0x2D, 0x20, 0x73, 0x63, 0x69, 0x65, 0x6E, 0x74,
+	0x69, 0x66, 0x69, 0x63, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x75, 0x70, 0x70, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x20,
+	0x45, 0x2E, 0x0A, 0x09, 0x3A, 0x66, 0x20, 0x2D, 0x20, 0x66,
+	0x6C, 0x6F, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F,
+	0x69, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73,
+	0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A,
+	0x09, 0x3A, 0x46, 0x20, 0x2D, 0x20, 0x73, 0x61, 0x6D, 0x65,
+	0x20, 0x61, 0x73, 0x20, 0x3A, 0x66, 0x0A, 0x0A, 0x54, 0x68,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x6D,
+	0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73,
+	0x6F, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x20, 0x6C, 0x65,
+	0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73,
+	0x69, 0x6F, 0x6E, 0x20, 0x28, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65,
+	0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65,
+	0x63, 0x69, 0x6D, 0x61, 0x6C, 0x29, 0x20, 0x69, 0x6E, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74,
+	0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x70, 0x72,
+	0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x67, 0x63,
+	0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0xD3, 0x02, 0xDA,
+	0x03, 0xD8, 0x09, 0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+	0x63, 0x74, 0xDA, 0x05, 0xCE, 0x50, 0x28, 0x67, 0x63, 0x63,
+	0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x29, 0x0A, 0x0A, 0x52,
+	0x75, 0x6E, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+	0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x2E, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x73, 0x68, 0x6F,
+	0x75, 0x6C, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x62, 0x61, 0x62,
+	0x6C, 0x79, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x61, 0x6C,
+	0x6C, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x6E,
+	0x75, 0x61, 0x6C, 0x6C, 0x79, 0x2E, 0xCF, 0x04, 0x63, 0x6F,
+	0x6D, 0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x70,
+	0x28, 0x63, 0x6F, 0x6D, 0x70, 0x20, 0x26, 0x20, 0x66, 0x75,
+	0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x29, 0x0A, 0x0A,
+	0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74,
+	0x69, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x66,
+	0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F,
+	0x6E, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x6F, 0x73,
+	0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+	0x73, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD6,
+	0xAB, 0x02, 0xCD, 0x9E, 0xB3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xD8, 0x0B, 0x19, 0x00, 0x01, 0x41, 0x04, 0xCE,
+	0x04, 0x63, 0x6F, 0x6D, 0x70, 0xDA, 0x10, 0xDA, 0x89, 0x01,
+	0x28, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17, 0x03,
+	0x02, 0x00, 0x25, 0x04, 0x00, 0x00, 0x47, 0x02, 0x03, 0x04,
+	0x1A, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x05,
+	0x01, 0x00, 0x47, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x04, 0x00,
+	0x25, 0x06, 0x00, 0x00, 0x33, 0x05, 0x00, 0x06, 0x03, 0x05,
+	0x00, 0x00, 0x25, 0x06, 0x02, 0x00, 0x47, 0x05, 0x03, 0x06,
+	0x1A, 0x05, 0x07, 0x00, 0x35, 0x06, 0x00, 0x00, 0x17, 0x07,
+	0x06, 0x00, 0x35, 0x06, 0x00, 0x01, 0x17, 0x08, 0x06, 0x00,
+	0x2A, 0x06, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x25, 0x09,
+	0x03, 0x00, 0x47, 0x06, 0x03, 0x09, 0x1A, 0x06, 0x09, 0x00,
+	0x35, 0x09, 0x00, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x35, 0x09,
+	0x00, 0x01, 0x17, 0x0B, 0x09, 0x00, 0x35, 0x09, 0x00, 0x02,
+	0x17, 0x0C, 0x09, 0x00, 0x2A, 0x09, 0x01, 0x00, 0x03, 0x09,
+	0x00, 0x00, 0x25, 0x0D, 0x04, 0x00, 0x47, 0x09, 0x03, 0x0D,
+	0x1A, 0x09, 0x0B, 0x00, 0x35, 0x0D, 0x00, 0x00, 0x17, 0x0E,
+	0x0D, 0x00, 0x35, 0x0D, 0x00, 0x01, 0x17, 0x0F, 0x0D, 0x00,
+	0x35, 0x0D, 0x00, 0x02, 0x17, 0x10, 0x0D, 0x00, 0x35, 0x0D,
+	0x00, 0x03, 0x17, 0x11, 0x0D, 0x00, 0x2A, 0x0D, 0x02, 0x00,
+	0x03, 0x0D, 0x00, 0x00, 0x35, 0x0D, 0x00, 0x00, 0x17, 0x12,
+	0x0D, 0x00, 0x35, 0x0D, 0x00, 0x01, 0x17, 0x13, 0x0D, 0x00,
+	0x35, 0x0D, 0x00, 0x02, 0x17, 0x14, 0x0D, 0x00, 0x35, 0x0D,
+	0x00, 0x03, 0x17, 0x15, 0x0D, 0x00, 0x35, 0x0D, 0x00, 0x04,
+	0x17, 0x16, 0x0D, 0x00, 0x2A, 0x0D, 0x03, 0x00, 0x25, 0x17,
+	0x05, 0x00, 0x25, 0x18, 0xFF, 0xFF, 0x2D, 0x00, 0x17, 0x18,
+	0x26, 0x18, 0x00, 0x00, 0x2F, 0x17, 0x18, 0x00, 0x2B, 0x0D,
+	0x00, 0x00, 0x2E, 0x17, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+	0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x01, 0x01, 0x00, 0x06, 0x01,
+	0xDA, 0x10, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x08,
+	0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00,
+	0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x08, 0x03, 0xA6, 0xAF, 0x02, 0x08, 0x03, 0x05, 0x08,
+	0xCD, 0x80, 0x80, 0xA0, 0x0D, 0x01, 0x01, 0x00, 0x09, 0x01,
+	0xDA, 0x10, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x0C,
+	0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00,
+	0x00, 0x0B, 0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x0A, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x0B, 0x03, 0x9A, 0xB0, 0x02, 0x08, 0x03,
+	0x05, 0x08, 0x03, 0x05, 0x08, 0xCD, 0x80, 0x80, 0xA0, 0x0D,
+	0x01, 0x01, 0x00, 0x0C, 0x01, 0xDA, 0x10, 0x2B, 0x00, 0x00,
+	0x00, 0x27, 0x00, 0x00, 0x11, 0x2F, 0x00, 0x00, 0x00, 0x2B,
+	0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x10, 0x2F, 0x00, 0x00,
+	0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x0F, 0x2F,
+	0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+	0x0E, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x0E, 0x03, 0x96, 0xB1, 0x02, 0x08, 0x03, 0x05, 0x08, 0x03,
+	0x05, 0x08, 0x03, 0x05, 0x08, 0xCD, 0x80, 0x80, 0xA0, 0x0D,
+	0x01, 0x01, 0x00, 0x0F, 0x01, 0xDA, 0x10, 0x2B, 0x00, 0x00,
+	0x00, 0x27, 0x00, 0x00, 0x16, 0x2F, 0x00, 0x00, 0x00, 0x2B,
+	0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x15, 0x2F, 0x00, 0x00,
+	0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x14, 0x2F,
+	0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+	0x13, 0x2F, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27,
+	0x00, 0x00, 0x12, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0F, 0x11, 0x03, 0xAE, 0xB2, 0x02, 0x08, 0x03, 0x05,
+	0x08, 0x03, 0x05, 0x08, 0x03, 0x05, 0x08, 0x03, 0x05, 0x08,
+	0x47, 0x01, 0xD6, 0xAB, 0x02, 0xC8, 0x07, 0x01, 0x8A, 0x02,
+	0xA5, 0x07, 0x08, 0x0B, 0xA6, 0x05, 0x03, 0x52, 0xA7, 0x05,
+	0x03, 0x51, 0xA8, 0x05, 0x04, 0x82, 0x01, 0xE9, 0x04, 0x02,
+	0x3A, 0x3B, 0x03, 0xBB, 0x01, 0xA6, 0x05, 0x06, 0xF0, 0x01,
+	0xE1, 0x04, 0x02, 0x3A, 0x3B, 0x03, 0xA9, 0x02, 0x9E, 0x05,
+	0x08, 0xE6, 0x02, 0xD9, 0x04, 0x02, 0x3A, 0x3B, 0x0A, 0x40,
+	0xB4, 0x01, 0x01, 0x52, 0xAB, 0x01, 0x05, 0x58, 0x01, 0x03,
+	0x63, 0x66, 0xCF, 0x07, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x24, 0x28,
+	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xBA, 0x24, 0xCD, 0xBA, 0x25, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01, 0x02, 0x06, 0xCE,
+	0x07, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0xDA, 0x10,
+	0xDA, 0x1D, 0xDA, 0x1E, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00,
+	0x1F, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03,
+	0x98, 0x25, 0x0E, 0x03, 0x05, 0x18, 0xCF, 0x0D, 0x63, 0x6F,
+	0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x62, 0x61, 0x74, 0x63,
+	0x68, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0xAF, 0x03, 0xDA, 0x05,
+	0xCE, 0xB9, 0x05, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x2D, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x73, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x5B, 0x2C,
+	0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x5B, 0x2C,
+	0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5D,
+	0x5D, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+	0x65, 0x73, 0x20, 0x61, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x6F,
+	0x66, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6C, 0x65, 0x76, 0x65,
+	0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x66, 0x72,
+	0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x63, 0x6F,
+	0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66,
+	0x6F, 0x72, 0x6D, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+	0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72,
+	0x75, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75,
+	0x65, 0x73, 0x20, 0x70, 0x61, 0x73, 0x74, 0x20, 0x61, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+	0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61,
+	0x20, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x61,
+	0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6F, 0x65,
+	0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x66, 0x69,
+	0x6E, 0x65, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+	0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x6F, 0x70,
+	0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x61,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x74, 0x68, 0x61, 0x74,
+	0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65,
+	0x66, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x20, 0x65, 0x61, 0x72,
+	0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x72, 0x75, 0x6E, 0x2C, 0x20, 0x75, 0x6E, 0x6C,
+	0x65, 0x73, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63,
+	0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x2C, 0x20, 0x62,
+	0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x61, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61,
+	0x6C, 0x6C, 0x73, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72,
+	0x6F, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x65, 0x66,
+	0x6F, 0x72, 0x65, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+	0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+	0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+	0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72,
+	0x6D, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+	0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x69, 0x74, 0x68,
+	0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x2C, 0x20,
+	0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+	0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65,
+	0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x63, 0x6F, 0x75,
+	0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+	0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x2C, 0x20,
+	0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x69,
+	0x6B, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6E, 0x65,
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20,
+	0x62, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+	0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65,
+	0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65,
+	0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E,
+	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x75, 0x74, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+	0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F,
+	0x72, 0x6D, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72,
+	0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20,
+	0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x30, 0x20, 0x6F, 0x66,
+	0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x2E,
+	0xDA, 0xE0, 0x0A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x4E, 0x28, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65,
+	0x6E, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+	0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75,
+	0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74,
+	0x73, 0x65, 0x6C, 0x66, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+	0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xD0, 0x3B, 0xCD, 0xA0,
+	0x40, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02,
+	0x01, 0x03, 0x08, 0xCE, 0x0B, 0x69, 0x64, 0x65, 0x6D, 0x70,
+	0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0xDA, 0x10, 0xDA, 0x1D,
+	0xDA, 0x59, 0xDA, 0x5A, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x00,
+	0x33, 0x00, 0x01, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x88, 0x40,
+	0x0E, 0x02, 0x2B, 0x2E, 0x03, 0x09, 0x0C, 0xCF, 0x0B, 0x6D,
+	0x61, 0x74, 0x68, 0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D,
+	0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x6D, 0x61, 0x74, 0x68,
+	0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0xDA, 0x05, 0xCE,
+	0x4D, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x61, 0x6E,
+	0x64, 0x6F, 0x6D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x75, 0x6E, 0x69, 0x66,
+	0x6F, 0x72, 0x6D, 0x6C, 0x79, 0x20, 0x64, 0x69, 0x73, 0x74,
+	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x72, 0x61,
+	0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+	0x72, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20,
+	0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x2E, 0xCF, 0x06,
+	0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0xB8, 0x01, 0x28, 0x69, 0x6E, 0x76, 0x65,
+	0x72, 0x74, 0x20, 0x64, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x77, 0x68, 0x65,
+	0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+	0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x73,
+	0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x75, 0x72, 0x65, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20,
+	0x6B, 0x65, 0x79, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x76, 0x61,
+	0x6C, 0x75, 0x65, 0x2C, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6B,
+	0x65, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+	0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xCE, 0xE4, 0x03, 0xCD,
+	0xE6, 0xE8, 0x03, 0xDA, 0x03, 0xDA, 0xE5, 0x07, 0xCF, 0x09,
+	0x64, 0x65, 0x66, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xD4,
+	0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x38, 0x28, 0x64, 0x65,
+	0x66, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6E, 0x61,
+	0x6D, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A,
+	0x0A, 0x44, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61, 0x6C,
+	0x6C, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+	0x61, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x64,
+	0x65, 0x66, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD,
+	0xE8, 0x18, 0xCD, 0xFA, 0x1A, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xE0, 0x09, 0x03, 0x02, 0x03, 0x0A, 0xCE, 0x09, 0x64,
+	0x65, 0x66, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xDA, 0x10,
+	0xDA, 0xDE, 0x07, 0xDA, 0x03, 0xDA, 0x13, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+	0x02, 0x01, 0x00, 0x2C, 0x02, 0x01, 0x00, 0x3C, 0x02, 0x00,
+	0x00, 0x26, 0x01, 0x02, 0x00, 0x35, 0x01, 0x01, 0x00, 0x34,
+	0x01, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x8A,
+	0x1A, 0x18, 0x06, 0x22, 0x28, 0x01, 0xC3, 0x01, 0xD2, 0x01,
+	0xCF, 0x04, 0x63, 0x6F, 0x6E, 0x64, 0xD4, 0x02, 0xD3, 0x02,
+	0xDA, 0x05, 0xCE, 0x8A, 0x02, 0x28, 0x63, 0x6F, 0x6E, 0x64,
+	0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x0A,
+	0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+	0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+	0x73, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x69,
+	0x61, 0x6C, 0x6C, 0x79, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64,
+	0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x20, 0x69, 0x73, 0x20,
+	0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x78, 0x65, 0x63,
+	0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+	0x6F, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69,
+	0x6E, 0x67, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20, 0x49,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72,
+	0x65, 0x20, 0x61, 0x6E, 0x20, 0x20, 0x6F, 0x64, 0x64, 0x20,
+	0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+	0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+	0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x20, 0x69,
+	0x66, 0x20, 0x6E, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+	0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63,
+	0x68, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F,
+	0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C,
+	0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0xBC, 0x5D, 0xCD, 0xC0, 0x65, 0xDA, 0x03, 0xD7, 0xCD,
+	0x80, 0x80, 0xD8, 0x0B, 0x05, 0x00, 0x00, 0x06, 0x01, 0xCE,
+	0x04, 0x63, 0x6F, 0x6E, 0x64, 0xDA, 0x10, 0x28, 0x01, 0x00,
+	0x00, 0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x25,
+	0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x30, 0x03, 0x00,
+	0x00, 0xCD, 0x80, 0x80, 0xE0, 0x0D, 0x06, 0x01, 0x02, 0x1B,
+	0x01, 0xDA, 0x54, 0xDA, 0x10, 0xDA, 0x5E, 0xDA, 0x5D, 0x28,
+	0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x37, 0x02, 0x02,
+	0x00, 0x07, 0x02, 0x02, 0x00, 0x25, 0x03, 0x00, 0x00, 0x47,
+	0x03, 0x02, 0x03, 0x1A, 0x03, 0x02, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x25, 0x03, 0x01, 0x00, 0x47, 0x03, 0x02, 0x03, 0x1A,
+	0x03, 0x04, 0x00, 0x27, 0x02, 0x00, 0x00, 0x33, 0x03, 0x02,
+	0x00, 0x03, 0x03, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x33,
+	0x03, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x27, 0x05, 0x00,
+	0x00, 0x33, 0x04, 0x05, 0x02, 0x05, 0x02, 0x00, 0x02, 0x2B,
+	0x02, 0x00, 0x00, 0x2F, 0x05, 0x01, 0x00, 0x26, 0x02, 0x00,
+	0x00, 0x2D, 0x02, 0x03, 0x04, 0x2B, 0x05, 0x00, 0x00, 0x26,
+	0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0F, 0x33, 0x01, 0xFA, 0x61, 0xB0, 0x03, 0x02, 0x44,
+	0x95, 0x03, 0x01, 0x05, 0x0C, 0x02, 0x3C, 0x0D, 0x02, 0x07,
+	0xA4, 0x02, 0x02, 0x40, 0xA3, 0x02, 0x01, 0x07, 0xEA, 0x01,
+	0x03, 0x24, 0xE9, 0x01, 0x02, 0x42, 0x00, 0x01, 0x50, 0x0B,
+	0x02, 0x15, 0x18, 0x01, 0x50, 0x17, 0x02, 0x09, 0x0C, 0x05,
+	0x95, 0x01, 0x98, 0x01, 0x0F, 0x01, 0xBC, 0x5D, 0x84, 0x08,
+	0x02, 0xBE, 0x04, 0xD3, 0x04, 0x03, 0xB8, 0x03, 0xA3, 0x03,
+	0xDA, 0xD7, 0x03, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE,
+	0xAA, 0x01, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E,
+	0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F,
+	0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x20, 0x61, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65, 0x20,
+	0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x73,
+	0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2E, 0x20, 0x45, 0x61,
+	0x63, 0x68, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x69, 0x6E,
+	0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+	0x69, 0x73, 0x20, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E,
+	0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x66, 0x2C, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64,
+	0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+	0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x72, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6C, 0x61, 0x73, 0x74, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0x8A, 0x6F, 0xCD, 0xE2, 0x76, 0xDA, 0x03, 0xD7,
+	0xCD, 0x80, 0x80, 0xC8, 0x09, 0x08, 0x01, 0x08, 0x2C, 0xCE,
+	0x03, 0x6C, 0x65, 0x74, 0xDA, 0x10, 0xDA, 0x3C, 0xCE, 0x27,
+	0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x65,
+	0x76, 0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+	0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+	0x67, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x65, 0x74, 0xDA,
+	0x5F, 0xDA, 0x5C, 0xDA, 0x5D, 0xDA, 0xFE, 0x01, 0xDA, 0x88,
+	0x01, 0xDA, 0x89, 0x01, 0x37, 0x02, 0x00, 0x00, 0x25, 0x03,
+	0x02, 0x00, 0x2C, 0x02, 0x03, 0x00, 0x26, 0x02, 0x00, 0x00,
+	0x2F, 0x03, 0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x1F, 0x02,
+	0x02, 0x03, 0x19, 0x02, 0x04, 0x00, 0x23, 0x02, 0x00, 0x00,
+	0x17, 0x04, 0x02, 0x00, 0x18, 0x03, 0x00, 0x00, 0x24, 0x02,
+	0x00, 0x00, 0x17, 0x04, 0x02, 0x00, 0x1A, 0x04, 0x03, 0x00,
+	0x26, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x37, 0x02,
+	0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x26, 0x04, 0x02, 0x00,
+	0x2B, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x43, 0x05,
+	0x03, 0x02, 0x1A, 0x05, 0x0F, 0x00, 0x05, 0x05, 0x03, 0x01,
+	0x33, 0x05, 0x00, 0x05, 0x17, 0x06, 0x05, 0x00, 0x33, 0x05,
+	0x00, 0x03, 0x17, 0x07, 0x05, 0x00, 0x26, 0x05, 0x03, 0x00,
+	0x2D, 0x05, 0x07, 0x06, 0x26, 0x05, 0x04, 0x00, 0x2F, 0x05,
+	0x05, 0x00, 0x2C, 0x04, 0x05, 0x00, 0x26, 0x05, 0x05, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x49, 0x03, 0x02, 0x02, 0x18, 0xF3,
+	0xFF, 0xFF, 0x2C, 0x04, 0x01, 0x00, 0x26, 0x05, 0x06, 0x00,
+	0x2F, 0x05, 0x05, 0x00, 0x25, 0x05, 0x00, 0x00, 0x2C, 0x04,
+	0x05, 0x00, 0x26, 0x05, 0x07, 0x00, 0x30, 0x05, 0x00, 0x00,
+	0x3A, 0x01, 0x9A, 0x72, 0x20, 0x0C, 0x0B, 0x0E, 0x01, 0x07,
+	0x6E, 0x02, 0x3A, 0x3B, 0x01, 0x7C, 0x3F, 0x01, 0x2A, 0x0F,
+	0x03, 0x18, 0x12, 0x01, 0x38, 0x11, 0x01, 0x0D, 0xC0, 0x01,
+	0x01, 0x3E, 0xC3, 0x01, 0x04, 0x13, 0x2E, 0x04, 0x6A, 0x1B,
+	0x03, 0x23, 0x26, 0x01, 0x50, 0x35, 0x01, 0xBF, 0x01, 0xC2,
+	0x01, 0x03, 0xD8, 0x01, 0x9F, 0x01, 0x04, 0x38, 0x07, 0xCF,
+	0x06, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x3F, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x22, 0x28, 0x74, 0x75, 0x70, 0x6C,
+	0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+	0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8E, 0x2E, 0xCD, 0x88,
+	0x2F, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02,
+	0x01, 0x02, 0x06, 0xCE, 0x06, 0x74, 0x75, 0x70, 0x6C, 0x65,
+	0x3F, 0xDA, 0x10, 0xDA, 0x1D, 0xDA, 0x58, 0x2B, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
+	0x00, 0x07, 0x03, 0xE8, 0x2E, 0x0E, 0x03, 0x05, 0x16, 0xCF,
+	0x07, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0xD3, 0x02,
+	0xDA, 0x03, 0xDA, 0xB9, 0x03, 0xDA, 0x05, 0xCE, 0x7C, 0x28,
+	0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0x20, 0x78, 0x29,
+	0x0A, 0x0A, 0x45, 0x78, 0x69, 0x74, 0x20, 0x66, 0x72, 0x6F,
+	0x6D, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x69, 0x74,
+	0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x65, 0x71, 0x75, 0x61,
+	0x6C, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x2E, 0x20, 0x49, 0x66,
+	0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+	0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x61, 0x74,
+	0x75, 0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x6F, 0x66,
+	0x20, 0x78, 0x2E, 0xCF, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F,
+	0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x1E, 0x28, 0x65,
+	0x76, 0x65, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+	0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+	0x69, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0xDA, 0x0F,
+	0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xBC, 0x1D, 0xCD, 0xA4, 0x1E,
+	0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x02, 0x01,
+	0x01, 0x07, 0xCE, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0xDA,
+	0x10, 0xDA, 0x3C, 0x25, 0x01, 0x02, 0x00, 0x2C, 0x00, 0x01,
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x25,
+	0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
+	0x00, 0x07, 0x04, 0x94, 0x1E, 0x0C, 0x03, 0x0B, 0x0E, 0xCF,
+	0x07, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x31, 0x28, 0x70, 0x61, 0x72,
+	0x74, 0x69, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x26, 0x20, 0x6D,
+	0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x50, 0x61, 0x72, 0x74,
+	0x69, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA,
+	0x10, 0xCD, 0xD4, 0xDB, 0x03, 0xCD, 0xC2, 0xDD, 0x03, 0xDA,
+	0x03, 0xD7, 0xCD, 0x80, 0x80, 0xD8, 0x0B, 0x07, 0x01, 0x00,
+	0x0A, 0x01, 0xCE, 0x07, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61,
+	0x6C, 0xDA, 0x10, 0x28, 0x02, 0x00, 0x00, 0x37, 0x03, 0x01,
+	0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05, 0x00, 0x00, 0x42,
+	0x04, 0x04, 0x05, 0x17, 0x06, 0x04, 0x00, 0x1A, 0x06, 0x02,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00, 0x03,
+	0x03, 0x00, 0x00, 0xCD, 0x80, 0x80, 0x88, 0x2D, 0x02, 0x00,
+	0x00, 0x05, 0x01, 0xDA, 0x10, 0x27, 0x01, 0x00, 0x01, 0x2E,
+	0x01, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00,
+	0x00, 0x30, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x05, 0x05, 0xA6, 0xDD, 0x03, 0x16, 0x14, 0x01, 0xD4, 0xDB,
+	0x03, 0xEE, 0x01, 0x01, 0x94, 0x01, 0xD5, 0x01, 0x04, 0x0D,
+	0x10, 0x02, 0x07, 0x46, 0x02, 0x40, 0x41, 0xCF, 0x11, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x2D,
+	0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E,
+	0x65, 0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xDA,
+	0x05, 0xCE, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2F, 0x6E, 0x65, 0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65,
+	0x64, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x5B, 0x2C,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x3D, 0x30, 0x5D, 0x29, 0x0A,
+	0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+	0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+	0x68, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x66, 0x69,
+	0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+	0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+	0x04, 0x62, 0x61, 0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD7,
+	0xCD, 0x9A, 0x80, 0xC8, 0x20, 0x06, 0x00, 0x00, 0x13, 0xCE,
+	0x04, 0x62, 0x61, 0x6E, 0x64, 0x17, 0x01, 0x00, 0x00, 0x20,
+	0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0xFF,
+	0xFF, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A,
+	0x02, 0x05, 0x00, 0x25, 0x03, 0xFF, 0xFF, 0x4B, 0x04, 0x00,
+	0x00, 0x0C, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x4B,
+	0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x4A, 0x04, 0x00,
+	0x05, 0x0C, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F,
+	0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00,
+	0x00, 0xDA, 0x05, 0xCE, 0x5B, 0x28, 0x62, 0x61, 0x6E, 0x64,
+	0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73, 0x65, 0x20, 0x61,
+	0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+	0x78, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x78,
+	0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x6D, 0x75, 0x73,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF, 0x05, 0x73, 0x6C,
+	0x75, 0x72, 0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE,
+	0x50, 0x28, 0x73, 0x6C, 0x75, 0x72, 0x70, 0x20, 0x70, 0x61,
+	0x74, 0x68, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61, 0x64, 0x20,
+	0x61, 0x6C, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66,
+	0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 0x61, 0x6E, 0x64,
+	0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6C, 0x6F, 0x73,
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+	0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xF0, 0x8A,
+	0x07, 0xCD, 0xD8, 0x8E, 0x07, 0xDA, 0x03, 0xD7, 0xCD, 0x80,
+	0x80, 0xE0, 0x09, 0x03, 0x01, 0x07, 0x13, 0xCE, 0x05, 0x73,
+	0x6C, 0x75, 0x72, 0x70, 0xDA, 0x10, 0xD0, 0x01, 0x72, 0xDA,
+	0x8A, 0x06, 0xCE, 0x14, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+	0x6E, 0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0xDA, 0xBC, 0x02, 0xDA, 0xCD, 0x07,
+	0xDA, 0x91, 0x03, 0xDA, 0x8D, 0x06, 0x26, 0x01, 0x00, 0x00,
+	0x2C, 0x00, 0x01, 0x00, 0x26, 0x01, 0x01, 0x00, 0x2F, 0x01,
+	0x01, 0x00, 0x1A, 0x01, 0x02, 0x00, 0x18, 0x06, 0x00, 0x00,
+	0x26, 0x02, 0x02, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02,
+	0x03, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x26, 0x02, 0x04, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x02,
+	0x05, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x2B, 0x01, 0x00, 0x00,
+	0x26, 0x00, 0x06, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x19, 0x04, 0xBC, 0x8C, 0x07, 0x24, 0x02, 0x2E,
+	0x48, 0x04, 0x22, 0x25, 0x01, 0x0D, 0x10, 0x04, 0x7C, 0x33,
+	0x03, 0x2C, 0x07, 0x01, 0xB5, 0x03, 0xCE, 0x03, 0xCF, 0x07,
+	0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0xD4, 0x02, 0xD3,
+	0x01, 0xDA, 0x05, 0xCE, 0x52, 0x28, 0x7A, 0x69, 0x70, 0x63,
+	0x6F, 0x6C, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x76,
+	0x61, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x77, 0x6F,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2F, 0x74, 0x75,
+	0x70, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74,
+	0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+	0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2,
+	0x03, 0xDA, 0x10, 0xCD, 0xEC, 0xE8, 0x03, 0xCD, 0x82, 0xED,
+	0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x07,
+	0x02, 0x00, 0x11, 0xCE, 0x07, 0x7A, 0x69, 0x70, 0x63, 0x6F,
+	0x6C, 0x6C, 0xDA, 0x10, 0x3C, 0x02, 0x00, 0x00, 0x37, 0x03,
+	0x00, 0x00, 0x37, 0x04, 0x01, 0x00, 0x43, 0x05, 0x03, 0x04,
+	0x1A, 0x05, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x03,
+	0x04, 0x00, 0x17, 0x05, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x43, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x06, 0x00, 0x33, 0x04,
+	0x00, 0x03, 0x33, 0x06, 0x01, 0x03, 0x34, 0x02, 0x04, 0x06,
+	0x49, 0x03, 0x05, 0x01, 0x18, 0xFC, 0xFF, 0xFF, 0x03, 0x02,
+	0x00, 0x00, 0x28, 0x01, 0xAE, 0xEA, 0x03, 0x18, 0x01, 0x30,
+	0x00, 0x01, 0x32, 0x00, 0x01, 0x3C, 0x07, 0x03, 0x07, 0x16,
+	0x01, 0x11, 0x14, 0x03, 0x42, 0x46, 0x01, 0x4C, 0x69, 0x01,
+	0x1A, 0x00, 0x01, 0x2B, 0x2E, 0x02, 0x39, 0x3C, 0x01, 0x87,
+	0x03, 0x96, 0x03, 0xCF, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2F, 0x70, 0x6F, 0x70, 0x6E, 0xD3, 0x02, 0xDA, 0x03,
+	0xD8, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70,
+	0x6F, 0x70, 0x6E, 0xDA, 0x05, 0xCE, 0x5E, 0x28, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F, 0x70, 0x6E, 0x20,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6E, 0x29, 0x0A,
+	0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+	0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x2E, 0xCF, 0x02, 0x2A, 0x3D, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+	0x05, 0xCE, 0x28, 0x28, 0x2A, 0x3D, 0x20, 0x78, 0x20, 0x6E,
+	0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61,
+	0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x65,
+	0x74, 0x20, 0x78, 0x20, 0x28, 0x2A, 0x20, 0x78, 0x20, 0x6E,
+	0x29, 0x29, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xCC, 0x50, 0xCD, 0xDC, 0x51, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x03, 0x02, 0x02, 0x07,
+	0xCE, 0x02, 0x2A, 0x3D, 0xDA, 0x10, 0xDA, 0x90, 0x07, 0xDA,
+	0x2C, 0x26, 0x02, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x3D,
+	0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2D, 0x02, 0x00,
+	0x01, 0x3D, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04,
+	0x07, 0xB4, 0x51, 0x26, 0xCF, 0x08, 0x67, 0x65, 0x6E, 0x65,
+	0x72, 0x61, 0x74, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05,
+	0xCE, 0xA4, 0x01, 0x28, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+	0x74, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x20, 0x26, 0x20,
+	0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67, 0x65, 0x6E, 0x65,
+	0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x73, 0x69,
+	0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+	0x70, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x2E, 0x20,
+	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x20, 0x74, 0x68, 0x61,
+	0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x61,
+	0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+	0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20, 0x6F,
+	0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x53, 0x65, 0x65, 0x20,
+	0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x64,
+	0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x2E, 0xDA, 0x27, 0xCB,
+	0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xA2, 0x8B, 0x02,
+	0xCD, 0xFC, 0x8E, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80,
+	0xC8, 0x29, 0x05, 0x01, 0x06, 0x14, 0xCE, 0x08, 0x67, 0x65,
+	0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0xDA, 0x10, 0xDA, 0x9A,
+	0x01, 0xDA, 0x5F, 0xDA, 0xE9, 0x03, 0xDA, 0x9A, 0x06, 0xDA,
+	0x99, 0x01, 0xDA, 0xFA, 0x0D, 0x26, 0x03, 0x00, 0x00, 0x2B,
+	0x03, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01,
+	0x00, 0x2B, 0x04, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x3D,
+	0x03, 0x00, 0x00, 0x26, 0x01, 0x02, 0x00, 0x2C, 0x01, 0x03,
+	0x00, 0x3D, 0x04, 0x00, 0x00, 0x26, 0x01, 0x03, 0x00, 0x2D,
+	0x01, 0x00, 0x04, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x01, 0x04,
+	0x00, 0x2D, 0x01, 0x02, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x26,
+	0x03, 0x05, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x3D, 0x02, 0x00,
+	0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x14, 0x90, 0x8E, 0x02,
+	0x6A, 0xCF, 0x05, 0x72, 0x61, 0x6E, 0x67, 0x65, 0xD4, 0x02,
+	0xD3, 0x01, 0xDA, 0x05, 0xCE, 0xDE, 0x01, 0x28, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73,
+	0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+	0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+	0x66, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x5B,
+	0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64,
+	0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x67,
+	0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x65, 0x70, 0x2E,
+	0x20, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x65,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+	0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x2C, 0x20,
+	0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68,
+	0x20, 0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6E, 0x73, 0x20, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E,
+	0x67, 0x65, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C,
+	0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69, 0x74,
+	0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2C, 0x20, 0x72,
+	0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x72,
+	0x61, 0x6E, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x73,
+	0x74, 0x65, 0x70, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0xFC, 0xF6, 0x02, 0xCD,
+	0xF2, 0x81, 0x03, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xC8,
+	0x29, 0x07, 0x00, 0x02, 0x3F, 0xCE, 0x05, 0x72, 0x61, 0x6E,
+	0x67, 0x65, 0xDA, 0x10, 0xDA, 0xFD, 0x01, 0xCE, 0x22, 0x65,
+	0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x31, 0x20,
+	0x74, 0x6F, 0x20, 0x33, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+	0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x17, 0x01, 0x00, 0x00, 0x17, 0x02, 0x01,
+	0x00, 0x25, 0x01, 0x01, 0x00, 0x47, 0x01, 0x02, 0x01, 0x1A,
+	0x01, 0x0F, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x17, 0x03, 0x01,
+	0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F,
+	0x01, 0x04, 0x00, 0x17, 0x04, 0x01, 0x00, 0x25, 0x01, 0x00,
+	0x00, 0x17, 0x02, 0x03, 0x00, 0x43, 0x05, 0x01, 0x02, 0x1A,
+	0x05, 0x04, 0x00, 0x34, 0x04, 0x01, 0x01, 0x49, 0x01, 0x02,
+	0x01, 0x18, 0xFE, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x25,
+	0x03, 0x02, 0x00, 0x47, 0x01, 0x02, 0x03, 0x1A, 0x01, 0x12,
+	0x00, 0x4B, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x4B,
+	0x03, 0x00, 0x01, 0x17, 0x02, 0x03, 0x00, 0x2B, 0x04, 0x00,
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x17,
+	0x05, 0x03, 0x00, 0x17, 0x03, 0x04, 0x00, 0x17, 0x00, 0x02,
+	0x00, 0x43, 0x01, 0x03, 0x00, 0x1A, 0x01, 0x05, 0x00, 0x07,
+	0x06, 0x03, 0x04, 0x34, 0x05, 0x06, 0x03, 0x49, 0x03, 0x00,
+	0x01, 0x18, 0xFD, 0xFF, 0xFF, 0x03, 0x05, 0x00, 0x00, 0x25,
+	0x04, 0x03, 0x00, 0x47, 0x03, 0x02, 0x04, 0x1A, 0x03, 0x14,
+	0x00, 0x4B, 0x04, 0x00, 0x00, 0x17, 0x02, 0x04, 0x00, 0x4B,
+	0x04, 0x00, 0x01, 0x17, 0x05, 0x04, 0x00, 0x4B, 0x04, 0x00,
+	0x02, 0x17, 0x00, 0x04, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26,
+	0x01, 0x00, 0x00, 0x2F, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04,
+	0x00, 0x17, 0x04, 0x02, 0x00, 0x17, 0x03, 0x05, 0x00, 0x43,
+	0x06, 0x04, 0x03, 0x1A, 0x06, 0x05, 0x00, 0x07, 0x05, 0x04,
+	0x02, 0x34, 0x01, 0x05, 0x04, 0x06, 0x04, 0x04, 0x00, 0x18,
+	0xFB, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x26, 0x04, 0x01,
+	0x00, 0x01, 0x04, 0x00, 0x00, 0x67, 0x01, 0xE4, 0xFA, 0x02,
+	0x18, 0x04, 0x0B, 0x80, 0x07, 0x02, 0x4C, 0xFD, 0x06, 0x03,
+	0x40, 0x01, 0x01, 0x11, 0x14, 0x04, 0x40, 0x1C, 0x01, 0x2E,
+	0x2F, 0x02, 0x2D, 0x30, 0x01, 0x85, 0x01, 0xA0, 0x01, 0x03,
+	0x33, 0xB0, 0x05, 0x04, 0xC4, 0x02, 0xF9, 0x06, 0x03, 0x44,
+	0x05, 0x01, 0x11, 0x14, 0x04, 0x40, 0x28, 0x01, 0x40, 0x47,
+	0x01, 0x11, 0x18, 0x02, 0x2D, 0x30, 0x01, 0x89, 0x01, 0xA4,
+	0x01, 0x03, 0xAB, 0x02, 0xA0, 0x05, 0x06, 0xCC, 0x04, 0xF5,
+	0x06, 0x03, 0x48, 0x09, 0x01, 0x11, 0x14, 0x04, 0x40, 0x2C,
+	0x01, 0x44, 0x4B, 0x01, 0x11, 0x18, 0x02, 0x31, 0x34, 0x01,
+	0x8D, 0x01, 0xA8, 0x01, 0x02, 0x8C, 0x02, 0xA9, 0x01, 0xCF,
+	0x05, 0x6D, 0x65, 0x72, 0x67, 0x65, 0xD4, 0x02, 0xD3, 0x01,
+	0xDA, 0x05, 0xCE, 0xA9, 0x01, 0x28, 0x6D, 0x65, 0x72, 0x67,
+	0x65, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x73, 0x29,
+	0x0A, 0x0A, 0x4D, 0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x6D,
+	0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x2E,
+	0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+	0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E,
+	0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E,
+	0x20, 0x6F, 0x6E, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+	0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68,
+	0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6C,
+	0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72,
+	0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x65,
+	0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+	0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x0F, 0xD2, 0x03, 0xDA, 0x10,
+	0xCD, 0x9C, 0xF5, 0x03, 0xCD, 0xF0, 0xF9, 0x03, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xC8, 0x29, 0x08, 0x00, 0x01, 0x1D,
+	0xCE, 0x05, 0x6D, 0x65, 0x72, 0x67, 0x65, 0xDA, 0x10, 0xDA,
+	0xF9, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00,
+	0x17, 0x03, 0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x43, 0x04,
+	0x02, 0x03, 0x1A, 0x04, 0x17, 0x00, 0x4A, 0x04, 0x00, 0x02,
+	0x22, 0x05, 0x00, 0x00, 0x2C, 0x04, 0x05, 0x00, 0x26, 0x06,
+	0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00,
+	0x22, 0x05, 0x00, 0x00, 0x1F, 0x05, 0x05, 0x06, 0x19, 0x05,
+	0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+	0x24, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x08, 0x00, 0x17, 0x05,
+	0x06, 0x00, 0x33, 0x07, 0x04, 0x05, 0x34, 0x01, 0x05, 0x07,
+	0x2C, 0x04, 0x06, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x06,
+	0x07, 0x00, 0x18, 0xF3, 0xFF, 0xFF, 0x49, 0x02, 0x03, 0x01,
+	0x18, 0xEB, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x18, 0x01,
+	0x8E, 0xF8, 0x03, 0x24, 0x13, 0x2C, 0x78, 0x01, 0x84, 0x01,
+	0x87, 0x01, 0x01, 0x29, 0x2C, 0x06, 0x59, 0x5C, 0x01, 0x9D,
+	0x03, 0xB8, 0x03, 0xCF, 0x06, 0x76, 0x61, 0x6C, 0x75, 0x65,
+	0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x05, 0xCE, 0x3C, 0x28,
+	0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x78, 0x29, 0x0A,
+	0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61,
+	0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74,
+	0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA,
+	0x0F, 0xD2, 0x03, 0xDA, 0x10, 0xCD, 0x8C, 0xFD, 0x03, 0xCD,
+	0xB4, 0x80, 0x04, 0xDA, 0x03, 0xD7, 0xCD, 0x80, 0x80, 0xE0,
+	0x09, 0x04, 0x01, 0x03, 0x18, 0xCE, 0x06, 0x76, 0x61, 0x6C,
+	0x75, 0x65, 0x73, 0xDA, 0x10, 0xDA, 0xFD, 0x01, 0xDA, 0xF9,
+	0x01, 0xDA, 0xFE, 0x01, 0x37, 0x01, 0x00, 0x00, 0x2B, 0x01,
+	0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00,
+	0x22, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x02,
+	0x01, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x22, 0x03, 0x00, 0x00,
+	0x1F, 0x03, 0x03, 0x02, 0x19, 0x03, 0x03, 0x00, 0x23, 0x03,
+	0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+	0x1A, 0x03, 0x09, 0x00, 0x33, 0x03, 0x00, 0x02, 0x2C, 0x01,
+	0x03, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F, 0x03, 0x03, 0x00,
+	0x2C, 0x00, 0x02, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02,
+	0x03, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00,
+	0x24, 0x01, 0xC8, 0xFE, 0x03, 0x12, 0x03, 0x15, 0x18, 0x04,
+	0x42, 0x13, 0x06, 0x2E, 0x00, 0x01, 0x0D, 0x7C, 0x01, 0x50,
+	0x81, 0x01, 0x03, 0x1F, 0x22, 0x03, 0x4C, 0x1F, 0x01, 0x7B,
+	0x80, 0x01, 0x01, 0x87, 0x02, 0x96, 0x02, 0xCF, 0x02, 0x2B,
+	0x2B, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x05, 0xCE, 0x22, 0x28,
+	0x2B, 0x2B, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x63,
+	0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79,
+	0x20, 0x31, 0x2E, 0xDA, 0x27, 0xCB, 0xDA, 0x0F, 0xD2, 0x03,
+	0xDA, 0x10, 0xCD, 0xA4, 0x4C, 0xCD, 0xA8, 0x4D, 0xDA, 0x03,
+	0xD7, 0xCD, 0x80, 0x80, 0xE0, 0x09, 0x03, 0x01, 0x02, 0x08,
+	0xCE, 0x02, 0x2B, 0x2B, 0xDA, 0x10, 0xDA, 0x2B, 0xDA, 0x2C,
+	0x26, 0x01, 0x00, 0x00, 0x25, 0x02, 0x01, 0x00, 0x2D, 0x01,
+	0x00, 0x02, 0x3D, 0x01, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+	0x2D, 0x02, 0x00, 0x01, 0x3D, 0x01, 0x00, 0x00, 0x03, 0x01,
+	0x00, 0x00, 0x04, 0x08, 0x80, 0x4D, 0x26, 0xCF, 0x06, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+	0xBC, 0x02, 0xDA, 0x05, 0xCE, 0xA7, 0x01, 0x28, 0x73, 0x74,
+	0x72, 0x69, 0x6E, 0x67, 0x20, 0x26, 0x20, 0x70, 0x61, 0x72,
+	0x74, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61,
+	0x74, 0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76,
+	0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65,
+	0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75,
+	0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+	0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20,
+	0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x69,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65,
+	0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+	0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x2E,
+	0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x2E
+};
+
+const unsigned char *janet_core_image = bytes_janet_core_image;
+
+int32_t janet_core_image_size = 102494;
@@ -0,0 +1,265 @@
+/* Auto generated - DO NOT EDIT */
+
+#include <stdint.h>
+
+static const unsigned char bytes_janet_gen_init[] = {
+	0x23, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68,
+	0x74, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2D, 0x32, 0x30, 0x31,
+	0x39, 0x20, 0x28, 0x43, 0x29, 0x20, 0x43, 0x61, 0x6C, 0x76,
+	0x69, 0x6E, 0x20, 0x52, 0x6F, 0x73, 0x65, 0x0A, 0x0A, 0x28,
+	0x64, 0x6F, 0x0A, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72,
+	0x20, 0x2A, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x2D, 0x72,
+	0x65, 0x70, 0x6C, 0x2A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x2A,
+	0x6E, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2A, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61,
+	0x72, 0x20, 0x2A, 0x71, 0x75, 0x69, 0x65, 0x74, 0x2A, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x28,
+	0x76, 0x61, 0x72, 0x20, 0x2A, 0x72, 0x61, 0x77, 0x2D, 0x73,
+	0x74, 0x64, 0x69, 0x6E, 0x2A, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20,
+	0x2A, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x6F, 0x70, 0x74,
+	0x73, 0x2A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A, 0x20,
+	0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x2A, 0x65, 0x78, 0x69,
+	0x74, 0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72,
+	0x2A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x20,
+	0x20, 0x23, 0x20, 0x46, 0x6C, 0x61, 0x67, 0x20, 0x68, 0x61,
+	0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x0A, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+	0x72, 0x73, 0x20, 0x3A, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74,
+	0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x22, 0x68, 0x22,
+	0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x22, 0x75, 0x73,
+	0x61, 0x67, 0x65, 0x3A, 0x20, 0x22, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2F,
+	0x61, 0x72, 0x67, 0x73, 0x20, 0x30, 0x29, 0x20, 0x22, 0x20,
+	0x5B, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5D, 0x20,
+	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x61, 0x72, 0x67,
+	0x73, 0x2E, 0x2E, 0x2E, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70,
+	0x72, 0x69, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x4F,
+	0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65,
+	0x3A, 0x0A, 0x20, 0x20, 0x2D, 0x68, 0x20, 0x53, 0x68, 0x6F,
+	0x77, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x65, 0x6C,
+	0x70, 0x0A, 0x20, 0x20, 0x2D, 0x76, 0x20, 0x50, 0x72, 0x69,
+	0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72,
+	0x73, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+	0x67, 0x0A, 0x20, 0x20, 0x2D, 0x73, 0x20, 0x55, 0x73, 0x65,
+	0x20, 0x72, 0x61, 0x77, 0x20, 0x73, 0x74, 0x64, 0x69, 0x6E,
+	0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F,
+	0x66, 0x20, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+	0x6C, 0x69, 0x6B, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x0A, 0x20,
+	0x20, 0x2D, 0x65, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74,
+	0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x6F, 0x66, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x0A,
+	0x20, 0x20, 0x2D, 0x72, 0x20, 0x45, 0x6E, 0x74, 0x65, 0x72,
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x20,
+	0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+	0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x63,
+	0x72, 0x69, 0x70, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x2D, 0x70,
+	0x20, 0x4B, 0x65, 0x65, 0x70, 0x20, 0x6F, 0x6E, 0x20, 0x65,
+	0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69,
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73,
+	0x20, 0x61, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6C, 0x65, 0x76,
+	0x65, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28,
+	0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74,
+	0x29, 0x0A, 0x20, 0x20, 0x2D, 0x71, 0x20, 0x48, 0x69, 0x64,
+	0x65, 0x20, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x2C, 0x20,
+	0x6C, 0x6F, 0x67, 0x6F, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+	0x72, 0x65, 0x70, 0x6C, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75,
+	0x74, 0x20, 0x28, 0x71, 0x75, 0x69, 0x65, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x2D, 0x6C, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75,
+	0x74, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E,
+	0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x62, 0x65,
+	0x66, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+	0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x69,
+	0x6E, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0A, 0x20,
+	0x20, 0x2D, 0x2D, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x68,
+	0x61, 0x6E, 0x64, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70,
+	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x60, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0x20, 0x30, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x76, 0x22, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26,
+	0x5D, 0x20, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x6A,
+	0x61, 0x6E, 0x65, 0x74, 0x2F, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6F, 0x6E, 0x20, 0x22, 0x2D, 0x22, 0x20, 0x6A, 0x61, 0x6E,
+	0x65, 0x74, 0x2F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x29, 0x20,
+	0x28, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0x20, 0x30,
+	0x29, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x73, 0x22, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26,
+	0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x72, 0x61,
+	0x77, 0x2D, 0x73, 0x74, 0x64, 0x69, 0x6E, 0x2A, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x29, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x2A, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x2D, 0x72, 0x65,
+	0x70, 0x6C, 0x2A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x20,
+	0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72,
+	0x22, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x73, 0x68, 0x6F, 0x75,
+	0x6C, 0x64, 0x2D, 0x72, 0x65, 0x70, 0x6C, 0x2A, 0x20, 0x74,
+	0x72, 0x75, 0x65, 0x29, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x22, 0x70, 0x22, 0x20, 0x28, 0x66, 0x6E,
+	0x20, 0x5B, 0x26, 0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x2A, 0x65, 0x78, 0x69, 0x74, 0x2D, 0x6F, 0x6E, 0x2D, 0x65,
+	0x72, 0x72, 0x6F, 0x72, 0x2A, 0x20, 0x66, 0x61, 0x6C, 0x73,
+	0x65, 0x29, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x22, 0x71, 0x22, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B,
+	0x26, 0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x71,
+	0x75, 0x69, 0x65, 0x74, 0x2A, 0x20, 0x74, 0x72, 0x75, 0x65,
+	0x29, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x22, 0x2D, 0x22, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26,
+	0x5D, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x68, 0x61,
+	0x6E, 0x64, 0x6C, 0x65, 0x6F, 0x70, 0x74, 0x73, 0x2A, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x20, 0x31, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x22, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x69, 0x20, 0x26, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A, 0x20, 0x2A,
+	0x65, 0x6E, 0x76, 0x2A, 0x20, 0x28, 0x67, 0x65, 0x74, 0x20,
+	0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2F, 0x61, 0x72,
+	0x67, 0x73, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3A, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20,
+	0x22, 0x22, 0x20, 0x3A, 0x65, 0x78, 0x69, 0x74, 0x20, 0x2A,
+	0x65, 0x78, 0x69, 0x74, 0x2D, 0x6F, 0x6E, 0x2D, 0x65, 0x72,
+	0x72, 0x6F, 0x72, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x22, 0x20, 0x28,
+	0x66, 0x6E, 0x20, 0x5B, 0x69, 0x20, 0x26, 0x5D, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x6E, 0x6F, 0x2D, 0x66,
+	0x69, 0x6C, 0x65, 0x2A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x65, 0x76, 0x61, 0x6C, 0x2D, 0x73,
+	0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2F, 0x61,
+	0x72, 0x67, 0x73, 0x20, 0x28, 0x2B, 0x20, 0x69, 0x20, 0x31,
+	0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x29, 0x7D, 0x29, 0x0A,
+	0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0x20,
+	0x64, 0x6F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20,
+	0x5B, 0x6E, 0x20, 0x69, 0x20, 0x26, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x68, 0x20, 0x28,
+	0x67, 0x65, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+	0x72, 0x73, 0x20, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x69, 0x66, 0x20, 0x68, 0x20, 0x28, 0x68, 0x20,
+	0x69, 0x29, 0x20, 0x28, 0x64, 0x6F, 0x20, 0x28, 0x70, 0x72,
+	0x69, 0x6E, 0x74, 0x20, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F,
+	0x77, 0x6E, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x20, 0x2D, 0x22,
+	0x20, 0x6E, 0x29, 0x20, 0x28, 0x28, 0x67, 0x65, 0x74, 0x20,
+	0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x22,
+	0x68, 0x22, 0x29, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20,
+	0x20, 0x23, 0x20, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73,
+	0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+	0x0A, 0x20, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20,
+	0x31, 0x29, 0x0A, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+	0x6C, 0x65, 0x6E, 0x61, 0x72, 0x67, 0x73, 0x20, 0x28, 0x6C,
+	0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63,
+	0x65, 0x73, 0x73, 0x2F, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29,
+	0x0A, 0x20, 0x20, 0x28, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+	0x28, 0x3C, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x61, 0x72,
+	0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64,
+	0x65, 0x66, 0x20, 0x61, 0x72, 0x67, 0x20, 0x28, 0x67, 0x65,
+	0x74, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2F,
+	0x61, 0x72, 0x67, 0x73, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x61, 0x6E,
+	0x64, 0x20, 0x2A, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x6F,
+	0x70, 0x74, 0x73, 0x2A, 0x20, 0x28, 0x3D, 0x20, 0x22, 0x2D,
+	0x22, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+	0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x67, 0x20,
+	0x30, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x2B, 0x3D, 0x20, 0x69, 0x20, 0x28,
+	0x64, 0x6F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20,
+	0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C,
+	0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x67, 0x20, 0x31, 0x20,
+	0x32, 0x29, 0x20, 0x69, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20,
+	0x2A, 0x6E, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2A, 0x20,
+	0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x6D, 0x70, 0x6F,
+	0x72, 0x74, 0x2A, 0x20, 0x2A, 0x65, 0x6E, 0x76, 0x2A, 0x20,
+	0x61, 0x72, 0x67, 0x20, 0x3A, 0x70, 0x72, 0x65, 0x66, 0x69,
+	0x78, 0x20, 0x22, 0x22, 0x20, 0x3A, 0x65, 0x78, 0x69, 0x74,
+	0x20, 0x2A, 0x65, 0x78, 0x69, 0x74, 0x2D, 0x6F, 0x6E, 0x2D,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x2A, 0x20, 0x3A, 0x69, 0x6D,
+	0x61, 0x67, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x73, 0x65, 0x74, 0x20, 0x69, 0x20, 0x6C, 0x65, 0x6E, 0x61,
+	0x72, 0x67, 0x73, 0x29, 0x29, 0x29, 0x29, 0x0A, 0x0A, 0x20,
+	0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x6F, 0x72,
+	0x20, 0x2A, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x2D, 0x72,
+	0x65, 0x70, 0x6C, 0x2A, 0x20, 0x2A, 0x6E, 0x6F, 0x2D, 0x66,
+	0x69, 0x6C, 0x65, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x2A, 0x71,
+	0x75, 0x69, 0x65, 0x74, 0x2A, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x22,
+	0x4A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x22, 0x20, 0x6A, 0x61,
+	0x6E, 0x65, 0x74, 0x2F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F,
+	0x6E, 0x20, 0x22, 0x2D, 0x22, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+	0x74, 0x2F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x22, 0x20,
+	0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
+	0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2D,
+	0x32, 0x30, 0x31, 0x39, 0x20, 0x43, 0x61, 0x6C, 0x76, 0x69,
+	0x6E, 0x20, 0x52, 0x6F, 0x73, 0x65, 0x22, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20,
+	0x6E, 0x6F, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x20, 0x5B,
+	0x5F, 0x5D, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x67, 0x65, 0x74,
+	0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x20, 0x5B, 0x70, 0x5D,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x28,
+	0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65,
+	0x72, 0x65, 0x20, 0x70, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+	0x20, 0x22, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x3A, 0x22, 0x20,
+	0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x22, 0x3A, 0x22,
+	0x20, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73,
+	0x74, 0x61, 0x74, 0x65, 0x20, 0x70, 0x29, 0x20, 0x22, 0x3E,
+	0x20, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28,
+	0x64, 0x65, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74,
+	0x65, 0x72, 0x20, 0x28, 0x69, 0x66, 0x20, 0x2A, 0x71, 0x75,
+	0x69, 0x65, 0x74, 0x2A, 0x20, 0x6E, 0x6F, 0x70, 0x72, 0x6F,
+	0x6D, 0x70, 0x74, 0x20, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F,
+	0x6D, 0x70, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x28, 0x64, 0x65, 0x66, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x73,
+	0x74, 0x64, 0x69, 0x6E, 0x20, 0x5B, 0x70, 0x72, 0x6F, 0x6D,
+	0x70, 0x74, 0x20, 0x62, 0x75, 0x66, 0x5D, 0x0A, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+	0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x64, 0x6F,
+	0x75, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x29,
+	0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x66, 0x69,
+	0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x73,
+	0x74, 0x64, 0x6F, 0x75, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72,
+	0x65, 0x61, 0x64, 0x20, 0x73, 0x74, 0x64, 0x69, 0x6E, 0x20,
+	0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x62, 0x75, 0x66, 0x29,
+	0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65, 0x66,
+	0x20, 0x67, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x2A, 0x72, 0x61, 0x77, 0x2D, 0x73, 0x74, 0x64,
+	0x69, 0x6E, 0x2A, 0x20, 0x67, 0x65, 0x74, 0x73, 0x74, 0x64,
+	0x69, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x63, 0x68, 0x75, 0x6E,
+	0x6B, 0x20, 0x5B, 0x62, 0x75, 0x66, 0x20, 0x70, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x67, 0x65, 0x74,
+	0x74, 0x65, 0x72, 0x20, 0x28, 0x70, 0x72, 0x6F, 0x6D, 0x70,
+	0x74, 0x65, 0x72, 0x20, 0x70, 0x29, 0x20, 0x62, 0x75, 0x66,
+	0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x65,
+	0x66, 0x20, 0x6F, 0x6E, 0x73, 0x69, 0x67, 0x20, 0x28, 0x69,
+	0x66, 0x20, 0x2A, 0x71, 0x75, 0x69, 0x65, 0x74, 0x2A, 0x20,
+	0x28, 0x66, 0x6E, 0x20, 0x5B, 0x78, 0x20, 0x26, 0x5D, 0x20,
+	0x78, 0x29, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x29, 0x0A, 0x20,
+	0x20, 0x20, 0x20, 0x28, 0x72, 0x65, 0x70, 0x6C, 0x20, 0x67,
+	0x65, 0x74, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x6E,
+	0x73, 0x69, 0x67, 0x29, 0x29, 0x29, 0x0A
+};
+
+const unsigned char *janet_gen_init = bytes_janet_gen_init;
+
+int32_t janet_gen_init_size = 2547;
@@ -0,0 +1,70 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+/* A minimal janet used only at build time. It boots the core library from
+ * source and runs a script in the core environment itself, with nothing
+ * else defined, so the script can capture that environment. */
+
+#include <janet/janet.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+    int status;
+    long len;
+    uint8_t *bytes;
+    FILE *f;
+    JanetTable *env;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s script\n", argv[0]);
+        return 1;
+    }
+
+    /* Read script */
+    f = fopen(argv[1], "rb");
+    if (NULL == f) {
+        fprintf(stderr, "could not open %s\n", argv[1]);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    bytes = malloc(len);
+    if (NULL == bytes || fread(bytes, 1, len, f) != (size_t) len) {
+        fprintf(stderr, "could not read %s\n", argv[1]);
+        return 1;
+    }
+    fclose(f);
+
+    /* Set up VM */
+    janet_init();
+    env = janet_core_env();
+
+    /* Run script */
+    status = janet_dobytes(env, bytes, (int32_t) len, argv[1], NULL);
+
+    /* Deinitialize vm */
+    janet_deinit();
+    free(bytes);
+
+    return status;
+}
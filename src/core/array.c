@@ -72,6 +72,7 @@ void janet_array_ensure(JanetArray *array, int32_t capacity, int32_t growth) {
     Janet *old = array->data;
     if (capacity <= array->capacity) return;
     capacity *= growth;
+    janet_gccharge((capacity - array->capacity) * sizeof(Janet));
     newData = realloc(old, capacity * sizeof(Janet));
     if (NULL == newData) {
         JANET_OUT_OF_MEMORY;
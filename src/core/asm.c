@@ -77,14 +77,21 @@ static const JanetInstructionDef janet_ops[] = {
     {"divim", JOP_DIVIDE_IMMEDIATE},
     {"eq", JOP_EQUALS},
     {"eqim", JOP_EQUALS_IMMEDIATE},
+    {"eqj", JOP_EQUALS_JUMP},
     {"eqn", JOP_NUMERIC_EQUAL},
+    {"eqnj", JOP_NUMERIC_EQUAL_JUMP},
     {"err", JOP_ERROR},
+    {"forlt", JOP_NUMERIC_FOR_LESS_THAN},
     {"get", JOP_GET},
     {"geti", JOP_GET_INDEX},
+    {"getiv", JOP_GET_INDEX_VARARG},
+    {"getv", JOP_GET_VARARG},
     {"gt", JOP_GREATER_THAN},
     {"gten", JOP_NUMERIC_GREATER_THAN_EQUAL},
+    {"gtenj", JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP},
     {"gtim", JOP_GREATER_THAN_IMMEDIATE},
     {"gtn", JOP_NUMERIC_GREATER_THAN},
+    {"gtnj", JOP_NUMERIC_GREATER_THAN_JUMP},
     {"jmp", JOP_JUMP},
     {"jmpif", JOP_JUMP_IF},
     {"jmpno", JOP_JUMP_IF_NOT},
@@ -98,8 +105,10 @@ static const JanetInstructionDef janet_ops[] = {
     {"len", JOP_LENGTH},
     {"lt", JOP_LESS_THAN},
     {"lten", JOP_NUMERIC_LESS_THAN_EQUAL},
+    {"ltenj", JOP_NUMERIC_LESS_THAN_EQUAL_JUMP},
     {"ltim", JOP_LESS_THAN_IMMEDIATE},
     {"ltn", JOP_NUMERIC_LESS_THAN},
+    {"ltnj", JOP_NUMERIC_LESS_THAN_JUMP},
     {"mkarr", JOP_MAKE_ARRAY},
     {"mkbuf", JOP_MAKE_BUFFER},
     {"mkstr", JOP_MAKE_STRING},
@@ -115,6 +124,7 @@ static const JanetInstructionDef janet_ops[] = {
     {"push2", JOP_PUSH_2},
     {"push3", JOP_PUSH_3},
     {"pusha", JOP_PUSH_ARRAY},
+    {"pushv", JOP_PUSH_VARARG},
     {"put", JOP_PUT},
     {"puti", JOP_PUT_INDEX},
     {"res", JOP_RESUME},
@@ -550,6 +560,10 @@ static JanetAssembleResult janet_asm1(JanetAssembler *parent, Janet source, int
     x = janet_get1(s, janet_csymbolv("fix-arity"));
     if (janet_truthy(x)) def->flags |= JANET_FUNCDEF_FLAG_FIXARITY;
 
+    /* Check varargs kept on the stack */
+    x = janet_get1(s, janet_csymbolv("stack-args"));
+    if (janet_truthy(x)) def->flags |= JANET_FUNCDEF_FLAG_STACKARGS;
+
     /* Check source */
     x = janet_get1(s, janet_csymbolv("source"));
     if (janet_checktype(x, JANET_STRING)) def->source = janet_unwrap_string(x);
@@ -700,11 +714,9 @@ static JanetAssembleResult janet_asm1(JanetAssembler *parent, Janet source, int
     x = janet_get1(s, janet_csymbolv("sourcemap"));
     if (janet_indexed_view(x, &arr, &count)) {
         janet_asm_assert(&a, count == def->bytecode_length, "sourcemap must have the same length as the bytecode");
-        def->sourcemap = malloc(sizeof(JanetSourceMapping) * count);
         for (i = 0; i < count; i++) {
             const Janet *tup;
             Janet entry = arr[i];
-            JanetSourceMapping mapping;
             if (!janet_checktype(entry, JANET_TUPLE)) {
                 janet_asm_error(&a, "expected tuple");
             }
@@ -715,9 +727,52 @@ static JanetAssembleResult janet_asm1(JanetAssembler *parent, Janet source, int
             if (!janet_checkint(tup[1])) {
                 janet_asm_error(&a, "expected integer");
             }
-            mapping.start = janet_unwrap_integer(tup[0]);
-            mapping.end = janet_unwrap_integer(tup[1]);
-            def->sourcemap[i] = mapping;
+        }
+        JanetSourceMapping *map = malloc(sizeof(JanetSourceMapping) * (count + 1));
+        if (NULL == map) {
+            JANET_OUT_OF_MEMORY;
+        }
+        for (i = 0; i < count; i++) {
+            const Janet *tup = janet_unwrap_tuple(arr[i]);
+            map[i].start = janet_unwrap_integer(tup[0]);
+            map[i].end = janet_unwrap_integer(tup[1]);
+        }
+        def->sourcemap = janet_sourcemap_encode(map, count, &def->sourcemap_length);
+        free(map);
+    }
+
+    /* Check for error handlers */
+    x = janet_get1(s, janet_csymbolv("handlers"));
+    if (janet_indexed_view(x, &arr, &count)) {
+        def->handlers_length = count;
+        def->handlers = malloc(sizeof(JanetHandler) * count);
+        if (NULL == def->handlers) {
+            JANET_OUT_OF_MEMORY;
+        }
+        for (i = 0; i < count; i++) {
+            const Janet *tup;
+            int32_t j, fields[4];
+            Janet entry = arr[i];
+            if (!janet_checktype(entry, JANET_TUPLE) ||
+                    janet_tuple_length(janet_unwrap_tuple(entry)) != 4) {
+                janet_asm_error(&a, "expected handler tuple (start end target slot)");
+            }
+            tup = janet_unwrap_tuple(entry);
+            for (j = 0; j < 3; j++) {
+                Janet pc = tup[j];
+                if (janet_checktype(pc, JANET_KEYWORD)) {
+                    pc = janet_table_get(&a.labels, pc);
+                }
+                if (!janet_checkint(pc)) {
+                    janet_asm_error(&a, "expected integer or label");
+                }
+                fields[j] = janet_unwrap_integer(pc);
+            }
+            fields[3] = doarg_1(&a, JANET_OAT_SLOT, tup[3]);
+            def->handlers[i].start = fields[0];
+            def->handlers[i].end = fields[1];
+            def->handlers[i].target = fields[2];
+            def->handlers[i].slot = fields[3];
         }
     }
 
@@ -834,6 +889,7 @@ Janet janet_asm_decode_instruction(uint32_t instr) {
 
 Janet janet_disasm(JanetFuncDef *def) {
     int32_t i;
+    janet_funcdef_load(def);
     JanetArray *bcode = janet_array(def->bytecode_length);
     JanetArray *constants;
     JanetTable *ret = janet_table(10);
@@ -848,6 +904,9 @@ Janet janet_disasm(JanetFuncDef *def) {
     if (def->flags & JANET_FUNCDEF_FLAG_FIXARITY) {
         janet_table_put(ret, janet_csymbolv("fix-arity"), janet_wrap_true());
     }
+    if (def->flags & JANET_FUNCDEF_FLAG_STACKARGS) {
+        janet_table_put(ret, janet_csymbolv("stack-args"), janet_wrap_true());
+    }
     if (NULL != def->name) {
         janet_table_put(ret, janet_csymbolv("name"), janet_wrap_string(def->name));
     }
@@ -876,19 +935,37 @@ Janet janet_disasm(JanetFuncDef *def) {
     bcode->count = def->bytecode_length;
 
     /* Add source map */
-    if (NULL != def->sourcemap) {
+    JanetSourceMapping *map = janet_sourcemap_decode(def);
+    if (NULL != map) {
         JanetArray *sourcemap = janet_array(def->bytecode_length);
         for (i = 0; i < def->bytecode_length; i++) {
             Janet *t = janet_tuple_begin(2);
-            JanetSourceMapping mapping = def->sourcemap[i];
+            JanetSourceMapping mapping = map[i];
             t[0] = janet_wrap_integer(mapping.start);
             t[1] = janet_wrap_integer(mapping.end);
             sourcemap->data[i] = janet_wrap_tuple(janet_tuple_end(t));
         }
         sourcemap->count = def->bytecode_length;
+        free(map);
         janet_table_put(ret, janet_csymbolv("sourcemap"), janet_wrap_array(sourcemap));
     }
 
+    /* Add error handlers */
+    if (NULL != def->handlers) {
+        JanetArray *handlers = janet_array(def->handlers_length);
+        for (i = 0; i < def->handlers_length; i++) {
+            JanetHandler h = def->handlers[i];
+            Janet *t = janet_tuple_begin(4);
+            t[0] = janet_wrap_integer(h.start);
+            t[1] = janet_wrap_integer(h.end);
+            t[2] = janet_wrap_integer(h.target);
+            t[3] = janet_wrap_integer(h.slot);
+            handlers->data[i] = janet_wrap_tuple(janet_tuple_end(t));
+        }
+        handlers->count = def->handlers_length;
+        janet_table_put(ret, janet_csymbolv("handlers"), janet_wrap_array(handlers));
+    }
+
     /* Add environments */
     if (NULL != def->environments) {
         JanetArray *envs = janet_array(def->environments_length);
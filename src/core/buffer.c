@@ -59,6 +59,7 @@ void janet_buffer_ensure(JanetBuffer *buffer, int32_t capacity, int32_t growth)
     if (capacity <= buffer->capacity) return;
     int64_t big_capacity = capacity * growth;
     capacity = big_capacity > INT32_MAX ? INT32_MAX : (int32_t) big_capacity;
+    janet_gccharge(capacity - buffer->capacity);
     new_data = realloc(old, capacity * sizeof(uint8_t));
     if (NULL == new_data) {
         JANET_OUT_OF_MEMORY;
@@ -89,6 +90,7 @@ void janet_buffer_extra(JanetBuffer *buffer, int32_t n) {
     int32_t new_size = buffer->count + n;
     if (new_size > buffer->capacity) {
         int32_t new_capacity = new_size * 2;
+        janet_gccharge(new_capacity - buffer->capacity);
         uint8_t *new_data = realloc(buffer->data, new_capacity * sizeof(uint8_t));
         if (NULL == new_data) {
             JANET_OUT_OF_MEMORY;
@@ -155,6 +157,151 @@ void janet_buffer_push_u64(JanetBuffer *buffer, uint64_t x) {
     buffer->count += 8;
 }
 
+/* Compression. The format is a 4 byte little endian length of the
+ * uncompressed data followed by LZ77 sequences in the style of LZ4. Each
+ * sequence is a token byte, whose high nibble is the number of literals
+ * and low nibble the match length minus 4, then the literals, then a 2
+ * byte offset back into the output. Nibbles of 15 are followed by bytes
+ * of 255 and a final byte, which are added to them. The last sequence
+ * has literals only. */
+
+#define JANET_LZ_MINMATCH 4
+#define JANET_LZ_HASHLOG 12
+#define JANET_LZ_MAXOFFSET 0xFFFF
+
+static uint32_t lz_read32(const uint8_t *p) {
+    return (uint32_t) p[0] |
+           ((uint32_t) p[1] << 8) |
+           ((uint32_t) p[2] << 16) |
+           ((uint32_t) p[3] << 24);
+}
+
+static uint32_t lz_hash(uint32_t x) {
+    return (x * 2654435761u) >> (32 - JANET_LZ_HASHLOG);
+}
+
+static uint8_t *lz_pushlength(uint8_t *op, int32_t n) {
+    while (n >= 255) {
+        *op++ = 255;
+        n -= 255;
+    }
+    *op++ = (uint8_t) n;
+    return op;
+}
+
+static uint8_t *lz_sequence(uint8_t *op, const uint8_t *lit, int32_t litlen,
+                            int32_t offset, int32_t matchlen) {
+    uint8_t *token = op++;
+    int32_t m = matchlen ? matchlen - JANET_LZ_MINMATCH : 0;
+    *token = (uint8_t)(((litlen < 15 ? litlen : 15) << 4) | (m < 15 ? m : 15));
+    if (litlen >= 15) op = lz_pushlength(op, litlen - 15);
+    memcpy(op, lit, litlen);
+    op += litlen;
+    if (matchlen) {
+        *op++ = offset & 0xFF;
+        *op++ = (offset >> 8) & 0xFF;
+        if (m >= 15) op = lz_pushlength(op, m - 15);
+    }
+    return op;
+}
+
+/* Append the compressed form of some bytes to a buffer */
+void janet_buffer_compress(JanetBuffer *buffer, const uint8_t *data, int32_t len) {
+    int32_t table[1 << JANET_LZ_HASHLOG];
+    int64_t bound = 4 + (int64_t) len + len / 255 + 16;
+    if (bound > INT32_MAX) janet_panic("buffer overflow");
+    janet_buffer_extra(buffer, (int32_t) bound);
+    uint8_t *out = buffer->data + buffer->count;
+    uint8_t *op = out + 4;
+    out[0] = len & 0xFF;
+    out[1] = (len >> 8) & 0xFF;
+    out[2] = (len >> 16) & 0xFF;
+    out[3] = (len >> 24) & 0xFF;
+    for (int i = 0; i < (1 << JANET_LZ_HASHLOG); i++)
+        table[i] = -1;
+    int32_t anchor = 0;
+    int32_t i = 0;
+    while (i + JANET_LZ_MINMATCH <= len) {
+        uint32_t seq = lz_read32(data + i);
+        uint32_t h = lz_hash(seq);
+        int32_t ref = table[h];
+        table[h] = i;
+        if (ref >= 0 && i - ref <= JANET_LZ_MAXOFFSET && lz_read32(data + ref) == seq) {
+            int32_t m = JANET_LZ_MINMATCH;
+            while (i + m < len && data[ref + m] == data[i + m]) m++;
+            op = lz_sequence(op, data + anchor, i - anchor, i - ref, m);
+            i += m;
+            anchor = i;
+            if (i >= 2 && i + 2 <= len - JANET_LZ_MINMATCH)
+                table[lz_hash(lz_read32(data + i - 2))] = i - 2;
+        } else {
+            /* Skip faster through data that does not compress */
+            i += 1 + ((i - anchor) >> 6);
+        }
+    }
+    op = lz_sequence(op, data + anchor, len - anchor, 0, 0);
+    buffer->count += (int32_t)(op - out);
+}
+
+/* Append the decompressed form of some bytes to a buffer. Returns non
+ * zero if the bytes are not valid compressed data. */
+int janet_buffer_decompress(JanetBuffer *buffer, const uint8_t *data, int32_t len) {
+    if (len < 5) return 1;
+    uint32_t rawlen = lz_read32(data);
+    /* A byte of input makes at most 255 bytes of output */
+    if (rawlen > INT32_MAX || rawlen > (uint64_t)(len - 4) * 255) return 1;
+    janet_buffer_extra(buffer, (int32_t) rawlen);
+    uint8_t *out = buffer->data + buffer->count;
+    uint8_t *op = out;
+    uint8_t *oend = out + rawlen;
+    const uint8_t *ip = data + 4;
+    const uint8_t *iend = data + len;
+    while (ip < iend) {
+        int32_t token = *ip++;
+        int32_t litlen = token >> 4;
+        if (litlen == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return 1;
+                b = *ip++;
+                litlen += b;
+            } while (b == 255 && litlen <= (int32_t) rawlen);
+        }
+        if (litlen > iend - ip || litlen > oend - op) return 1;
+        memcpy(op, ip, litlen);
+        op += litlen;
+        ip += litlen;
+        if (ip == iend) break;
+        if (iend - ip < 2) return 1;
+        int32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - out) return 1;
+        int32_t m = token & 15;
+        if (m == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return 1;
+                b = *ip++;
+                m += b;
+            } while (b == 255 && m <= (int32_t) rawlen);
+        }
+        m += JANET_LZ_MINMATCH;
+        if (m > oend - op) return 1;
+        const uint8_t *match = op - offset;
+        if (offset >= m) {
+            memcpy(op, match, m);
+            op += m;
+        } else {
+            /* Overlapping matches repeat the last offset bytes */
+            for (int32_t k = 0; k < m; k++)
+                *op++ = match[k];
+        }
+    }
+    if (op != oend) return 1;
+    buffer->count += (int32_t) rawlen;
+    return 0;
+}
+
 /* C functions */
 
 static Janet cfun_buffer_new(int32_t argc, Janet *argv) {
@@ -317,6 +464,23 @@ static Janet cfun_buffer_blit(int32_t argc, Janet *argv) {
     return argv[0];
 }
 
+static Janet cfun_buffer_compress(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 2);
+    JanetByteView view = janet_getbytes(argv, 0);
+    JanetBuffer *buffer = (argc > 1) ? janet_getbuffer(argv, 1) : janet_buffer(view.len / 2 + 16);
+    janet_buffer_compress(buffer, view.bytes, view.len);
+    return janet_wrap_buffer(buffer);
+}
+
+static Janet cfun_buffer_decompress(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 2);
+    JanetByteView view = janet_getbytes(argv, 0);
+    JanetBuffer *buffer = (argc > 1) ? janet_getbuffer(argv, 1) : janet_buffer(0);
+    if (janet_buffer_decompress(buffer, view.bytes, view.len))
+        janet_panic("invalid compressed data");
+    return janet_wrap_buffer(buffer);
+}
+
 static const JanetReg buffer_cfuns[] = {
     {"buffer/new", cfun_buffer_new,
         JDOC("(buffer/new capacity)\n\n"
@@ -383,6 +547,17 @@ static const JanetReg buffer_cfuns[] = {
                 "indicate which part of src to copy into which part of dest. Indices can be "
                 "negative to index from the end of src or dest. Returns dest.")
     },
+    {"buffer/compress", cfun_buffer_compress,
+        JDOC("(buffer/compress bytes [, buffer])\n\n"
+                "Compress a byte sequence with a fast LZ77 compressor. The result is "
+                "appended to buffer, or to a new buffer if none is given. Returns the buffer.")
+    },
+    {"buffer/decompress", cfun_buffer_decompress,
+        JDOC("(buffer/decompress bytes [, buffer])\n\n"
+                "Decompress bytes made by buffer/compress. The result is appended to buffer, "
+                "or to a new buffer if none is given. Returns the buffer. Will throw an error "
+                "if bytes is not valid compressed data.")
+    },
     {NULL, NULL, NULL}
 };
 
@@ -93,7 +93,17 @@ enum JanetInstructionType janet_instructions[JOP_INSTRUCTION_COUNT] = {
     JINT_SSS, /* JOP_NUMERIC_LESS_THAN_EQUAL */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_EQUAL */
-    JINT_SSS /* JOP_NUMERIC_EQUAL */
+    JINT_SSS, /* JOP_NUMERIC_EQUAL */
+    JINT_SSS, /* JOP_NUMERIC_LESS_THAN_JUMP */
+    JINT_SSS, /* JOP_NUMERIC_LESS_THAN_EQUAL_JUMP */
+    JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_JUMP */
+    JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP */
+    JINT_SSS, /* JOP_NUMERIC_EQUAL_JUMP */
+    JINT_SSS, /* JOP_EQUALS_JUMP */
+    JINT_SSI, /* JOP_NUMERIC_FOR_LESS_THAN */
+    JINT_SSS, /* JOP_GET_VARARG */
+    JINT_SSU, /* JOP_GET_INDEX_VARARG */
+    JINT_S /* JOP_PUSH_VARARG */
 };
 
 /* Verify some bytecode */
@@ -107,6 +117,9 @@ int32_t janet_verify(JanetFuncDef *def) {
 
     if (maxslot > sc) return 2;
 
+    /* Varargs kept on the stack are counted in the rest parameter */
+    if ((def->flags & JANET_FUNCDEF_FLAG_STACKARGS) && !vargs) return 12;
+
     /* Verify each instruction */
     for (i = 0; i < def->bytecode_length; i++) {
         uint32_t instr = def->bytecode[i];
@@ -147,6 +160,11 @@ int32_t janet_verify(JanetFuncDef *def) {
                 {
                     if ((int32_t)((instr >> 8) & 0xFF) >= sc ||
                         (int32_t)((instr >> 16) & 0xFF) >= sc) return 4;
+                    /* Counted loop steps must be followed by the jump back */
+                    if ((instr & 0x7F) == JOP_NUMERIC_FOR_LESS_THAN) {
+                        uint32_t next = (i + 1 < def->bytecode_length) ? def->bytecode[i + 1] : 0;
+                        if ((next & 0x7F) != JOP_JUMP) return 11;
+                    }
                     continue;
                 }
             case JINT_SL:
@@ -161,6 +179,12 @@ int32_t janet_verify(JanetFuncDef *def) {
                     if (((int32_t)(instr >> 8) & 0xFF) >= sc ||
                         ((int32_t)(instr >> 16) & 0xFF) >= sc ||
                         ((int32_t)(instr >> 24) & 0xFF) >= sc) return 4;
+                    /* Fused compares must be followed by a branch on their result */
+                    if ((instr & 0x7F) >= JOP_NUMERIC_LESS_THAN_JUMP &&
+                            (instr & 0x7F) <= JOP_EQUALS_JUMP) {
+                        uint32_t next = (i + 1 < def->bytecode_length) ? def->bytecode[i + 1] : 0;
+                        if ((next & 0x7F) != JOP_JUMP_IF_NOT || ((next ^ instr) & 0xFF00)) return 11;
+                    }
                     continue;
                 }
             case JINT_SD:
@@ -205,6 +229,15 @@ int32_t janet_verify(JanetFuncDef *def) {
         }
     }
 
+    /* Verify error handlers cover valid ranges of bytecode and land on
+     * a valid instruction. */
+    for (i = 0; i < def->handlers_length; i++) {
+        JanetHandler h = def->handlers[i];
+        if (h.start < 0 || h.start > h.end || h.end > def->bytecode_length) return 10;
+        if (h.target < 0 || h.target >= def->bytecode_length) return 10;
+        if (h.slot < 0 || h.slot >= sc) return 10;
+    }
+
     return 0;
 }
 
@@ -220,9 +253,13 @@ JanetFuncDef *janet_funcdef_alloc() {
     def->arity = 0;
     def->source = NULL;
     def->sourcemap = NULL;
+    def->sourcemap_length = 0;
     def->name = NULL;
+    def->lazy = NULL;
     def->defs = NULL;
     def->defs_length = 0;
+    def->handlers = NULL;
+    def->handlers_length = 0;
     def->constants_length = 0;
     def->bytecode_length = 0;
     def->environments_length = 0;
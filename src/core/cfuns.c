@@ -48,6 +48,13 @@ static int fixarity3(JanetFopts opts, JanetSlot *args) {
     return janet_v_count(args) == 3;
 }
 
+/* Record the types an instruction wrote to a slot it made */
+static JanetSlot typedslot(JanetSlot s, uint16_t types) {
+    if (!(s.flags & JANET_SLOT_CONSTANT))
+        s.flags = (s.flags & ~JANET_SLOTTYPE_ANY) | types;
+    return s;
+}
+
 /* Generic handling for $A = op $B */
 static JanetSlot genericSS(JanetFopts opts, int op, JanetSlot s) {
     JanetSlot target = janetc_gettarget(opts);
@@ -62,6 +69,105 @@ static JanetSlot genericSSI(JanetFopts opts, int op, JanetSlot s, int32_t imm) {
     return target;
 }
 
+/* Immutable types that give the same results when folded at compile time
+ * as they would at runtime. Other types may be mutated or compare by address. */
+#define JANET_TFLAG_CBYTES (JANET_TFLAG_STRING | JANET_TFLAG_SYMBOL | JANET_TFLAG_KEYWORD)
+#define JANET_TFLAG_FOLDABLE (JANET_TFLAG_NIL | JANET_TFLAG_BOOLEAN | \
+        JANET_TFLAG_NUMBER | JANET_TFLAG_CBYTES)
+
+/* Evaluate $A = $B op $C at compile time. Returns 0 if the instruction
+ * could error, or could give a different result at runtime. */
+static int foldop(int op, Janet x, Janet y, Janet *out) {
+    int num = janet_checktype(x, JANET_NUMBER) && janet_checktype(y, JANET_NUMBER);
+    double x1 = num ? janet_unwrap_number(x) : 0.0;
+    double x2 = num ? janet_unwrap_number(y) : 0.0;
+    int32_t i1 = num ? janet_unwrap_integer(x) : 0;
+    int32_t i2 = num ? janet_unwrap_integer(y) : 0;
+    switch (op) {
+        default:
+            return 0;
+        case JOP_ADD:
+            if (!num) return 0;
+            *out = janet_wrap_number(x1 + x2);
+            return 1;
+        case JOP_SUBTRACT:
+            if (!num) return 0;
+            *out = janet_wrap_number(x1 - x2);
+            return 1;
+        case JOP_MULTIPLY:
+            if (!num) return 0;
+            *out = janet_wrap_number(x1 * x2);
+            return 1;
+        case JOP_DIVIDE:
+            if (!num) return 0;
+            *out = janet_wrap_number(x1 / x2);
+            return 1;
+        case JOP_BAND:
+            if (!num) return 0;
+            *out = janet_wrap_integer(i1 & i2);
+            return 1;
+        case JOP_BOR:
+            if (!num) return 0;
+            *out = janet_wrap_integer(i1 | i2);
+            return 1;
+        case JOP_BXOR:
+            if (!num) return 0;
+            *out = janet_wrap_integer(i1 ^ i2);
+            return 1;
+        case JOP_SHIFT_LEFT:
+            if (!num || i1 < 0 || i2 < 0 || i2 > 31) return 0;
+            *out = janet_wrap_integer((int32_t)((uint32_t) i1 << i2));
+            return 1;
+        case JOP_SHIFT_RIGHT:
+            if (!num || i2 < 0 || i2 > 31) return 0;
+            *out = janet_wrap_integer(i1 >> i2);
+            return 1;
+        case JOP_NUMERIC_LESS_THAN:
+            if (!num) return 0;
+            *out = janet_wrap_boolean(x1 < x2);
+            return 1;
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+            if (!num) return 0;
+            *out = janet_wrap_boolean(x1 <= x2);
+            return 1;
+        case JOP_NUMERIC_GREATER_THAN:
+            if (!num) return 0;
+            *out = janet_wrap_boolean(x1 > x2);
+            return 1;
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+            if (!num) return 0;
+            *out = janet_wrap_boolean(x1 >= x2);
+            return 1;
+        case JOP_NUMERIC_EQUAL:
+            if (!num) return 0;
+            *out = janet_wrap_boolean(x1 == x2);
+            return 1;
+        case JOP_LESS_THAN:
+        case JOP_GREATER_THAN:
+            if (!janet_checktypes(x, JANET_TFLAG_FOLDABLE) ||
+                    !janet_checktypes(y, JANET_TFLAG_FOLDABLE))
+                return 0;
+            *out = janet_wrap_boolean(op == JOP_LESS_THAN
+                    ? janet_compare(x, y) < 0
+                    : janet_compare(x, y) > 0);
+            return 1;
+        case JOP_EQUALS:
+            if (!janet_checktypes(x, JANET_TFLAG_FOLDABLE | JANET_TFLAG_TUPLE | JANET_TFLAG_STRUCT) ||
+                    !janet_checktypes(y, JANET_TFLAG_FOLDABLE | JANET_TFLAG_TUPLE | JANET_TFLAG_STRUCT))
+                return 0;
+            *out = janet_wrap_boolean(janet_equals(x, y));
+            return 1;
+        case JOP_GET:
+            if (janet_checktype(x, JANET_STRUCT) ||
+                    (janet_checktypes(x, JANET_TFLAG_CBYTES | JANET_TFLAG_TUPLE) &&
+                     janet_checkint(y))) {
+                *out = janet_get(x, y);
+                return 1;
+            }
+            return 0;
+    }
+}
+
 /* Emit a series of instructions instead of a function call to a math op */
 static JanetSlot opreduce(
         JanetFopts opts,
@@ -74,7 +180,18 @@ static JanetSlot opreduce(
     JanetSlot t;
     if (len == 0) {
         return janetc_cslot(nullary);
-    } else if (len == 1) {
+    }
+    if (janetc_allconstant(args)) {
+        /* Fold constant arguments */
+        Janet acc;
+        int ok = len == 1
+            ? foldop(op, nullary, args[0].constant, &acc)
+            : foldop(op, args[0].constant, args[1].constant, &acc);
+        for (i = 2; ok && i < len; i++)
+            ok = foldop(op, acc, args[i].constant, &acc);
+        if (ok) return janetc_cslot(acc);
+    }
+    if (len == 1) {
         t = janetc_gettarget(opts);
         janetc_emit_sss(c, op, t, janetc_cslot(nullary), args[0], 1);
         return t;
@@ -112,7 +229,11 @@ static JanetSlot do_put(JanetFopts opts, JanetSlot *args) {
     }
 }
 static JanetSlot do_length(JanetFopts opts, JanetSlot *args) {
-    return genericSS(opts, JOP_LENGTH, args[0]);
+    if ((args[0].flags & JANET_SLOT_CONSTANT) &&
+            janet_checktypes(args[0].constant,
+                JANET_TFLAG_CBYTES | JANET_TFLAG_TUPLE | JANET_TFLAG_STRUCT))
+        return janetc_cslot(janet_wrap_integer(janet_length(args[0].constant)));
+    return typedslot(genericSS(opts, JOP_LENGTH, args[0]), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_yield(JanetFopts opts, JanetSlot *args) {
     return genericSSI(opts, JOP_SIGNAL, args[0], 3);
@@ -148,37 +269,40 @@ static JanetSlot do_apply(JanetFopts opts, JanetSlot *args) {
 /* Variadic operators specialization */
 
 static JanetSlot do_add(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_ADD, janet_wrap_integer(0));
+    return typedslot(opreduce(opts, args, JOP_ADD, janet_wrap_integer(0)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_sub(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_SUBTRACT, janet_wrap_integer(0));
+    return typedslot(opreduce(opts, args, JOP_SUBTRACT, janet_wrap_integer(0)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_mul(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_MULTIPLY, janet_wrap_integer(1));
+    return typedslot(opreduce(opts, args, JOP_MULTIPLY, janet_wrap_integer(1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_div(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_DIVIDE, janet_wrap_integer(1));
+    return typedslot(opreduce(opts, args, JOP_DIVIDE, janet_wrap_integer(1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_band(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_BAND, janet_wrap_integer(-1));
+    return typedslot(opreduce(opts, args, JOP_BAND, janet_wrap_integer(-1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_bor(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_BOR, janet_wrap_integer(0));
+    return typedslot(opreduce(opts, args, JOP_BOR, janet_wrap_integer(0)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_bxor(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_BXOR, janet_wrap_integer(0));
+    return typedslot(opreduce(opts, args, JOP_BXOR, janet_wrap_integer(0)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_lshift(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_SHIFT_LEFT, janet_wrap_integer(1));
+    return typedslot(opreduce(opts, args, JOP_SHIFT_LEFT, janet_wrap_integer(1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_rshift(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1));
+    return typedslot(opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_rshiftu(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1));
+    return typedslot(opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1)), JANET_TFLAG_NUMBER);
 }
 static JanetSlot do_bnot(JanetFopts opts, JanetSlot *args) {
-    return genericSS(opts, JOP_BNOT, args[0]);
+    if ((args[0].flags & JANET_SLOT_CONSTANT) &&
+            janet_checktype(args[0].constant, JANET_NUMBER))
+        return janetc_cslot(janet_wrap_integer(~janet_unwrap_integer(args[0].constant)));
+    return typedslot(genericSS(opts, JOP_BNOT, args[0]), JANET_TFLAG_NUMBER);
 }
 
 /* Specialization for comparators */
@@ -197,6 +321,21 @@ static JanetSlot compreduce(
             ? janetc_cslot(janet_wrap_false())
             : janetc_cslot(janet_wrap_true());
     }
+    if (janetc_allconstant(args)) {
+        /* Fold constant arguments, stopping at the first false comparison */
+        Janet result = janet_wrap_true();
+        int ok = 1;
+        for (i = 1; ok && i < len && janet_truthy(result); i++)
+            ok = foldop(op, args[i - 1].constant, args[i].constant, &result);
+        if (ok) return janetc_cslot(janet_wrap_boolean(invert ^ janet_truthy(result)));
+    }
+    if (op == JOP_EQUALS) {
+        /* Numbers can be compared without janet_equals */
+        int numeric = 1;
+        for (i = 0; numeric && i < len; i++)
+            numeric = janetc_slottypes(args[i]) == JANET_TFLAG_NUMBER;
+        if (numeric) op = JOP_NUMERIC_EQUAL;
+    }
     t = janetc_gettarget(opts);
     for (i = 1; i < len; i++) {
         janetc_emit_sss(c, op, t, args[i - 1], args[i], 1);
@@ -217,7 +356,7 @@ static JanetSlot compreduce(
         c->buffer[label] |= ((end - label) << 16);
     }
     janet_v_free(labels);
-    return t;
+    return typedslot(t, JANET_TFLAG_BOOLEAN);
 }
 
 static JanetSlot do_order_gt(JanetFopts opts, JanetSlot *args) {
@@ -58,13 +58,51 @@ void janetc_freeslot(JanetCompiler *c, JanetSlot s) {
     janetc_regalloc_free(&c->scope->ra, s.index);
 }
 
+/* Find the bucket for a symbol in the symbol index of a function scope.
+ * Symbols are interned, so they can be compared by pointer. */
+static SymBucket *janetc_symbucket(JanetScope *f, const uint8_t *sym) {
+    uint32_t mask = (uint32_t) f->symcap - 1;
+    uint32_t i = (uint32_t) janet_string_hash(sym) & mask;
+    while (f->symindex[i].sym && f->symindex[i].sym != sym)
+        i = (i + 1) & mask;
+    return f->symindex + i;
+}
+
+/* Make room for one more symbol in the symbol index */
+static void janetc_symgrow(JanetScope *f) {
+    if (2 * (f->symcount + 1) <= f->symcap) return;
+    SymBucket *old = f->symindex;
+    int32_t oldcap = f->symcap;
+    f->symcap = oldcap ? 2 * oldcap : 16;
+    f->symindex = calloc(f->symcap, sizeof(SymBucket));
+    if (NULL == f->symindex) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (int32_t i = 0; i < oldcap; i++) {
+        if (old[i].sym) *janetc_symbucket(f, old[i].sym) = old[i];
+    }
+    free(old);
+}
+
 /* Add a slot to a scope with a symbol associated with it (def or var). */
 void janetc_nameslot(JanetCompiler *c, const uint8_t *sym, JanetSlot s) {
+    JanetScope *f = c->scope->function;
+    SymBucket *bucket;
     SymPair sp;
+    janetc_symgrow(f);
+    bucket = janetc_symbucket(f, sym);
+    if (NULL == bucket->sym) {
+        bucket->sym = sym;
+        bucket->ref.scope = NULL;
+        f->symcount++;
+    }
     sp.sym = sym;
     sp.slot = s;
     sp.keep = 0;
+    sp.shadowed = bucket->ref;
     sp.slot.flags |= JANET_SLOT_NAMED;
+    bucket->ref.scope = c->scope;
+    bucket->ref.index = janet_v_count(c->scope->syms);
     janet_v_push(c->scope->syms, sp);
 }
 
@@ -95,12 +133,18 @@ void janetc_scope(JanetScope *s, JanetCompiler *c, int flags, const char *name)
     scope.child = NULL;
     scope.consts = NULL;
     scope.syms = NULL;
+    scope.symindex = NULL;
+    scope.symcount = 0;
+    scope.symcap = 0;
     scope.envs = NULL;
     scope.defs = NULL;
     scope.selfconst = -1;
     scope.bytecode_start = janet_v_count(c->buffer);
     scope.flags = flags;
     scope.parent = c->scope;
+    scope.function = ((flags & JANET_SCOPE_FUNCTION) || !c->scope) ? s : c->scope->function;
+    scope.depth = c->scope ? c->scope->depth + 1 : 0;
+    scope.unused = (flags & JANET_SCOPE_UNUSED) ? scope.depth : c->scope ? c->scope->unused : -1;
     /* Inherit slots */
     if ((!(flags & JANET_SCOPE_FUNCTION)) && c->scope) {
         janetc_regalloc_clone(&scope.ra, &(c->scope->ra));
@@ -118,15 +162,23 @@ void janetc_scope(JanetScope *s, JanetCompiler *c, int flags, const char *name)
 void janetc_popscope(JanetCompiler *c) {
     JanetScope *oldscope = c->scope;
     JanetScope *newscope = oldscope->parent;
+    /* Unbind the symbols of this scope, or drop the index of a function */
+    if (oldscope->function == oldscope) {
+        free(oldscope->symindex);
+    } else {
+        for (int32_t i = janet_v_count(oldscope->syms) - 1; i >= 0; i--) {
+            SymPair *pair = oldscope->syms + i;
+            if (pair->sym)
+                janetc_symbucket(oldscope->function, pair->sym)->ref = pair->shadowed;
+        }
+    }
     /* Move free slots to parent scope if not a new function.
      * We need to know the total number of slots used when compiling the function. */
     if (!(oldscope->flags & (JANET_SCOPE_FUNCTION | JANET_SCOPE_UNUSED)) && newscope) {
-        /* Parent scopes inherit child's closure flag. Needed
-         * for while loops. (if a while loop creates a closure, it
-         * is compiled to a tail recursive iife) */
-        if (oldscope->flags & JANET_SCOPE_CLOSURE) {
-            newscope->flags |= JANET_SCOPE_CLOSURE;
-        }
+        /* Parent scopes inherit child's closure and captured flags. Needed
+         * for while loops. (if a while loop creates a closure that captures
+         * a binding made in the loop, it is compiled to a tail recursive iife) */
+        newscope->flags |= oldscope->flags & (JANET_SCOPE_CLOSURE | JANET_SCOPE_CAPTURED);
         if (newscope->ra.max < oldscope->ra.max)
             newscope->ra.max = oldscope->ra.max;
 
@@ -171,27 +223,25 @@ JanetSlot janetc_resolve(
 
     JanetSlot ret = janetc_cslot(janet_wrap_nil());
     JanetScope *scope = c->scope;
+    JanetScope *f = scope ? scope->function : NULL;
     SymPair *pair;
-    int foundlocal = 1;
-    int unused = 0;
-
-    /* Search scopes for symbol, starting from top */
-    while (scope) {
-        int32_t i, len;
-        if (scope->flags & JANET_SCOPE_UNUSED)
-            unused = 1;
-        len = janet_v_count(scope->syms);
-        /* Search in reverse order */
-        for (i = len - 1; i >= 0; i--) {
-            pair = scope->syms + i;
-            if (pair->sym == sym) {
+    int foundlocal;
+    int unused;
+
+    /* Search the index of each function scope, starting from top */
+    while (f) {
+        if (f->symcap) {
+            SymBucket *bucket = janetc_symbucket(f, sym);
+            if (bucket->sym && bucket->ref.scope) {
+                scope = bucket->ref.scope;
+                pair = scope->syms + bucket->ref.index;
                 ret = pair->slot;
+                foundlocal = f == c->scope->function;
+                unused = c->scope->unused >= scope->depth;
                 goto found;
             }
         }
-        if (scope->flags & JANET_SCOPE_FUNCTION)
-            foundlocal = 0;
-        scope = scope->parent;
+        f = f->parent ? f->parent->function : NULL;
     }
 
     /* Symbol not found - check for global */
@@ -209,7 +259,7 @@ JanetSlot janetc_resolve(
             case JANET_BINDING_VAR:
             {
                 JanetSlot ret = janetc_cslot(check);
-                /* TODO save type info */
+                /* Vars can be set to any type from anywhere, so none is saved */
                 ret.flags |= JANET_SLOT_REF | JANET_SLOT_NAMED | JANET_SLOT_MUTABLE | JANET_SLOTTYPE_ANY;
                 ret.flags &= ~JANET_SLOT_CONSTANT;
                 return ret;
@@ -232,6 +282,7 @@ JanetSlot janetc_resolve(
 
     /* non-local scope needs to expose its environment */
     pair->keep = 1;
+    scope->flags |= JANET_SCOPE_CAPTURED;
     while (scope && !(scope->flags & JANET_SCOPE_FUNCTION))
         scope = scope->parent;
     janet_assert(scope, "invalid scopes");
@@ -360,6 +411,46 @@ static int has_spliced(JanetSlot *slots) {
     return 0;
 }
 
+/* Check if every slot is an unspliced constant */
+int janetc_allconstant(JanetSlot *slots) {
+    int32_t i;
+    for (i = 0; i < janet_v_count(slots); i++) {
+        if ((slots[i].flags & (JANET_SLOT_CONSTANT | JANET_SLOT_SPLICED)) != JANET_SLOT_CONSTANT)
+            return 0;
+    }
+    return 1;
+}
+
+/* Get the types a slot can hold. Values written to a slot by the
+ * expression that made it have known types until the slot is reassigned,
+ * so only slots that cannot be reassigned keep them. */
+uint16_t janetc_slottypes(JanetSlot s) {
+    uint16_t t = (uint16_t)(s.flags & JANET_SLOTTYPE_ANY);
+    if (s.flags & (JANET_SLOT_MUTABLE | JANET_SLOT_REF | JANET_SLOT_SPLICED) || !t)
+        return JANET_SLOTTYPE_ANY;
+    return t;
+}
+
+/* Check if x is an unnamed function literal taking exactly argc
+ * arguments, which can be called without creating a closure. */
+static int iifeliteral(Janet x, int32_t argc) {
+    if (!janet_checktype(x, JANET_TUPLE)) return 0;
+    const Janet *form = janet_unwrap_tuple(x);
+    if (janet_tuple_length(form) < 2 ||
+            !janet_checktype(form[0], JANET_SYMBOL) ||
+            janet_cstrcmp(janet_unwrap_symbol(form[0]), "fn") ||
+            !janet_checktype(form[1], JANET_TUPLE))
+        return 0;
+    const Janet *params = janet_unwrap_tuple(form[1]);
+    if (janet_tuple_length(params) != argc) return 0;
+    for (int32_t i = 0; i < argc; i++) {
+        if (janet_checktype(params[i], JANET_SYMBOL) &&
+                !janet_cstrcmp(janet_unwrap_symbol(params[i]), "&"))
+            return 0;
+    }
+    return 1;
+}
+
 /* Free slots loaded via janetc_toslots */
 void janetc_freeslots(JanetCompiler *c, JanetSlot *slots) {
     int32_t i;
@@ -377,6 +468,7 @@ void janetc_throwaway(JanetFopts opts, Janet x) {
     JanetScope unusedScope;
     int32_t bufstart = janet_v_count(c->buffer);
     int32_t mapbufstart = janet_v_count(c->mapbuffer);
+    int32_t handlerstart = janet_v_count(c->handlers);
     janetc_scope(&unusedScope, c, JANET_SCOPE_UNUSED, "unusued");
     janetc_value(opts, x);
     janetc_popscope(c);
@@ -385,6 +477,8 @@ void janetc_throwaway(JanetFopts opts, Janet x) {
         if (c->mapbuffer)
             janet_v__cnt(c->mapbuffer) = mapbufstart;
     }
+    if (c->handlers)
+        janet_v__cnt(c->handlers) = handlerstart;
 }
 
 /* Compile a call or tailcall instruction */
@@ -399,9 +493,10 @@ static JanetSlot janetc_call(JanetFopts opts, JanetSlot *slots, JanetSlot fun) {
             if (o && (!o->can_optimize || o->can_optimize(opts, slots))) {
                 specialized = 1;
                 retslot = o->optimize(opts, slots);
+            } else if (!o) {
+                specialized = janetc_inline(opts, slots, f->def, &retslot);
             }
         }
-        /* TODO janet function inlining (no c functions)*/
     }
     if (!specialized) {
         janetc_pushslots(c, slots);
@@ -423,6 +518,15 @@ static JanetSlot janetc_call(JanetFopts opts, JanetSlot *slots, JanetSlot fun) {
 static JanetSlot janetc_maker(JanetFopts opts, JanetSlot *slots, int op) {
     JanetCompiler *c = opts.compiler;
     JanetSlot retslot;
+    if (op == JOP_MAKE_STRUCT && janetc_allconstant(slots)) {
+        /* Structs of constants are constants */
+        int32_t count = janet_v_count(slots);
+        JanetKV *st = janet_struct_begin(count / 2);
+        for (int32_t i = 0; i + 1 < count; i += 2)
+            janet_struct_put(st, slots[i].constant, slots[i + 1].constant);
+        janetc_freeslots(c, slots);
+        return janetc_cslot(janet_wrap_struct(janet_struct_end(st)));
+    }
     janetc_pushslots(c, slots);
     janetc_freeslots(c, slots);
     retslot = janetc_gettarget(opts);
@@ -547,6 +651,15 @@ JanetSlot janetc_value(JanetFopts opts, Janet x) {
                     /* Empty tuple is tuple literal */
                     if (janet_tuple_length(tup) == 0) {
                         ret = janetc_cslot(x);
+                    } else if (iifeliteral(tup[0], janet_tuple_length(tup) - 1)) {
+                        JanetSlot *slots = janetc_toslots(c, tup + 1, janet_tuple_length(tup) - 1);
+                        if (has_spliced(slots)) {
+                            JanetSlot head = janetc_value(subopts, tup[0]);
+                            ret = janetc_call(opts, slots, head);
+                            janetc_freeslot(c, head);
+                        } else {
+                            ret = janetc_iife(opts, janet_unwrap_tuple(tup[0]), slots);
+                        }
                     } else {
                         JanetSlot head = janetc_value(subopts, tup[0]);
                         subopts.flags = JANET_FUNCTION | JANET_CFUNCTION;
@@ -594,6 +707,7 @@ JanetSlot janetc_value(JanetFopts opts, Janet x) {
 JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c) {
     JanetScope *scope = c->scope;
     JanetFuncDef *def = janet_funcdef_alloc();
+    JanetSourceMapping *map = NULL;
     def->slotcount = scope->ra.max + 1;
 
     janet_assert(scope->flags & JANET_SCOPE_FUNCTION, "expected function scope");
@@ -620,15 +734,38 @@ JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c) {
         janet_v__cnt(c->buffer) = scope->bytecode_start;
         if (NULL != c->mapbuffer) {
             size_t s = sizeof(JanetSourceMapping) * def->bytecode_length;
-            def->sourcemap = malloc(s);
-            if (NULL == def->sourcemap) {
+            map = malloc(s);
+            if (NULL == map) {
                 JANET_OUT_OF_MEMORY;
             }
-            memcpy(def->sourcemap, c->mapbuffer + scope->bytecode_start, s);
+            memcpy(map, c->mapbuffer + scope->bytecode_start, s);
             janet_v__cnt(c->mapbuffer) = scope->bytecode_start;
         }
     }
 
+    /* Copy error handlers for this function. Nested functions have already
+     * taken theirs, so the rest of the handlers all belong to this scope. */
+    if (NULL != c->handlers) {
+        int32_t first = janet_v_count(c->handlers);
+        while (first > 0 && c->handlers[first - 1].start >= scope->bytecode_start)
+            first--;
+        def->handlers_length = janet_v_count(c->handlers) - first;
+        if (def->handlers_length) {
+            def->handlers = malloc(sizeof(JanetHandler) * def->handlers_length);
+            if (NULL == def->handlers) {
+                JANET_OUT_OF_MEMORY;
+            }
+            for (int32_t i = 0; i < def->handlers_length; i++) {
+                JanetHandler h = c->handlers[first + i];
+                h.start -= scope->bytecode_start;
+                h.end -= scope->bytecode_start;
+                h.target -= scope->bytecode_start;
+                def->handlers[i] = h;
+            }
+            janet_v__cnt(c->handlers) = first;
+        }
+    }
+
     /* Get source from parser */
     def->source = c->source;
 
@@ -637,6 +774,13 @@ JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c) {
     if (scope->flags & JANET_SCOPE_ENV) {
         def->flags |= JANET_FUNCDEF_FLAG_NEEDSENV;
     }
+    janetc_peephole(def, map);
+
+    /* Keep the sourcemap in its compact form */
+    if (NULL != map) {
+        def->sourcemap = janet_sourcemap_encode(map, def->bytecode_length, &def->sourcemap_length);
+        free(map);
+    }
 
     /* Pop the scope */
     janetc_popscope(c);
@@ -649,6 +793,7 @@ static void janetc_init(JanetCompiler *c, JanetTable *env, const uint8_t *where)
     c->scope = NULL;
     c->buffer = NULL;
     c->mapbuffer = NULL;
+    c->handlers = NULL;
     c->recursion_guard = JANET_RECURSION_GUARD;
     c->env = env;
     c->source = where;
@@ -667,6 +812,7 @@ static void janetc_init(JanetCompiler *c, JanetTable *env, const uint8_t *where)
 static void janetc_deinit(JanetCompiler *c) {
     janet_v_free(c->buffer);
     janet_v_free(c->mapbuffer);
+    janet_v_free(c->handlers);
     c->env = NULL;
 }
 
@@ -703,15 +849,197 @@ JanetCompileResult janet_compile(Janet source, JanetTable *env, const uint8_t *w
     return c.result;
 }
 
-/* C Function for compiling */
-static Janet cfun(int32_t argc, Janet *argv) {
-    janet_arity(argc, 2, 3);
-    JanetTable *env = janet_gettable(argv, 1);
-    const uint8_t *source = NULL;
-    if (argc == 3) {
-        source = janet_getstring(argv, 2);
+/* Check if a form refers to a def made earlier in a batch whose value is
+ * not a constant. Such a form has to be compiled after the def runs. */
+static int janetc_batch_refers(JanetScope *root, Janet x, int depth) {
+    const Janet *data;
+    const JanetKV *kvs;
+    int32_t len, cap;
+    if (depth <= 0) return 1;
+    if (janet_checktype(x, JANET_SYMBOL)) {
+        SymBucket *bucket;
+        if (!root->symcap) return 0;
+        bucket = janetc_symbucket(root, janet_unwrap_symbol(x));
+        if (NULL == bucket->sym || NULL == bucket->ref.scope) return 0;
+        uint32_t flags = bucket->ref.scope->syms[bucket->ref.index].slot.flags;
+        return !(flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF));
+    }
+    if (janet_indexed_view(x, &data, &len)) {
+        for (int32_t i = 0; i < len; i++)
+            if (janetc_batch_refers(root, data[i], depth - 1)) return 1;
+    } else if (janet_dictionary_view(x, &kvs, &len, &cap)) {
+        for (int32_t i = 0; i < cap; i++) {
+            if (janet_checktype(kvs[i].key, JANET_NIL)) continue;
+            if (janetc_batch_refers(root, kvs[i].key, depth - 1) ||
+                    janetc_batch_refers(root, kvs[i].value, depth - 1))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+/* Check if a form calls a macro anywhere outside of a quote. A macro may
+ * look at the environment, so the form has to be expanded after the forms
+ * before it have run. */
+static int janetc_batch_macro(JanetTable *env, Janet x, int depth) {
+    const Janet *data;
+    const JanetKV *kvs;
+    int32_t len, cap;
+    if (depth <= 0) return 1;
+    if (janet_checktype(x, JANET_TUPLE)) {
+        data = janet_unwrap_tuple(x);
+        len = janet_tuple_length(data);
+        if (len && janet_checktype(data[0], JANET_SYMBOL)) {
+            Janet macroval;
+            const uint8_t *name = janet_unwrap_symbol(data[0]);
+            if (!janet_cstrcmp(name, "quote")) return 0;
+            if (NULL == janetc_special(name) &&
+                    janet_resolve(env, name, &macroval) == JANET_BINDING_MACRO)
+                return 1;
+        }
+    }
+    if (janet_indexed_view(x, &data, &len)) {
+        for (int32_t i = 0; i < len; i++)
+            if (janetc_batch_macro(env, data[i], depth - 1)) return 1;
+    } else if (janet_dictionary_view(x, &kvs, &len, &cap)) {
+        for (int32_t i = 0; i < cap; i++) {
+            if (janet_checktype(kvs[i].key, JANET_NIL)) continue;
+            if (janetc_batch_macro(env, kvs[i].key, depth - 1) ||
+                    janetc_batch_macro(env, kvs[i].value, depth - 1))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+/* Check if an expanded top level form is a def or var that is not a
+ * macro. Later forms of a batch can only follow such forms. */
+static int janetc_batch_def(Janet x) {
+    if (!janet_checktype(x, JANET_TUPLE)) return 0;
+    const Janet *tup = janet_unwrap_tuple(x);
+    int32_t len = janet_tuple_length(tup);
+    if (len < 3 || !janet_checktype(tup[0], JANET_SYMBOL)) return 0;
+    const uint8_t *head = janet_unwrap_symbol(tup[0]);
+    if (janet_cstrcmp(head, "def") && janet_cstrcmp(head, "var")) return 0;
+    for (int32_t i = 2; i < len - 1; i++) {
+        if (janet_equals(tup[i], janet_ckeywordv("macro"))) return 0;
     }
-    JanetCompileResult res = janet_compile(argv[0], env, source);
+    return 1;
+}
+
+/* Compile as many forms as possible into one function. */
+static JanetCompileResult janetc_batch(const Janet *forms, int32_t n, JanetTable *env,
+                                       const uint8_t *where, int32_t *count, JanetArray *progress) {
+    JanetCompiler c;
+    JanetScope rootscope;
+    JanetFopts fopts;
+    JanetSlot ret = janetc_cslot(janet_wrap_nil());
+    int32_t i;
+
+    janetc_init(&c, env, where);
+    janetc_scope(&rootscope, &c, JANET_SCOPE_FUNCTION | JANET_SCOPE_TOP | JANET_SCOPE_BATCH, "root");
+
+    fopts.compiler = &c;
+    fopts.flags = JANET_SLOTTYPE_ANY;
+    fopts.hint = janetc_cslot(janet_wrap_nil());
+
+    for (i = 0; i < n; i++) {
+        const JanetSpecial *spec = NULL;
+        int macroi = JANET_MAX_MACRO_EXPAND;
+        Janet x = forms[i];
+        int32_t bufstart, mapbufstart, handlerstart, conststart, defstart, symstart;
+        JanetSlot lastret = ret;
+        if (i > 0 && (janetc_batch_macro(env, x, JANET_RECURSION_GUARD) ||
+                      janetc_batch_refers(&rootscope, x, JANET_RECURSION_GUARD)))
+            break;
+        /* Remember where this form starts so a form after the first can be
+         * dropped from the run if it does not compile */
+        bufstart = janet_v_count(c.buffer);
+        mapbufstart = janet_v_count(c.mapbuffer);
+        handlerstart = janet_v_count(c.handlers);
+        conststart = janet_v_count(rootscope.consts);
+        defstart = janet_v_count(rootscope.defs);
+        symstart = janet_v_count(rootscope.syms);
+        janetc_freeslot(&c, ret);
+        c.current_mapping.start = -1;
+        c.current_mapping.end = -1;
+        if (NULL != progress) {
+            janetc_emit_ssu(&c, JOP_PUT_INDEX,
+                            janetc_cslot(janet_wrap_array(progress)),
+                            janetc_cslot(janet_wrap_integer(i)), 0, 0);
+        }
+        /* Expand here to see what the form is. janetc_value will not
+         * expand it again. */
+        while (macroi &&
+                c.result.status != JANET_COMPILE_ERROR &&
+                macroexpand1(&c, x, &x, &spec))
+            macroi--;
+        if (macroi == 0)
+            janetc_cerror(&c, "recursed too deeply in macro expansion");
+        ret = janetc_value(fopts, x);
+        if (c.result.status == JANET_COMPILE_ERROR && i > 0) {
+            /* The form may compile once the forms before it have run, so
+             * end the run before it. Forms after the first use no macros,
+             * so nothing is expanded twice. */
+            while (c.scope != &rootscope)
+                janetc_popscope(&c);
+            for (int32_t j = janet_v_count(rootscope.syms) - 1; j >= symstart; j--) {
+                SymPair *pair = rootscope.syms + j;
+                janetc_symbucket(&rootscope, pair->sym)->ref = pair->shadowed;
+            }
+            if (c.buffer) janet_v__cnt(c.buffer) = bufstart;
+            if (c.mapbuffer) janet_v__cnt(c.mapbuffer) = mapbufstart;
+            if (c.handlers) janet_v__cnt(c.handlers) = handlerstart;
+            if (rootscope.consts) janet_v__cnt(rootscope.consts) = conststart;
+            if (rootscope.defs) janet_v__cnt(rootscope.defs) = defstart;
+            if (rootscope.syms) janet_v__cnt(rootscope.syms) = symstart;
+            c.result.status = JANET_COMPILE_OK;
+            c.result.error = NULL;
+            c.result.macrofiber = NULL;
+            ret = lastret;
+            break;
+        }
+        if (c.result.status == JANET_COMPILE_ERROR || !janetc_batch_def(x)) {
+            i++;
+            break;
+        }
+    }
+    *count = i;
+
+    if (c.result.status == JANET_COMPILE_OK) {
+        janetc_return(&c, ret);
+        JanetFuncDef *def = janetc_pop_funcdef(&c);
+        def->name = janet_cstring("_thunk");
+        c.result.funcdef = def;
+    } else {
+        c.result.error_mapping = c.current_mapping;
+        janetc_popscope(&c);
+    }
+
+    janetc_deinit(&c);
+
+    return c.result;
+}
+
+/* Compile a run of top level forms into one function. The run continues
+ * past a form only if that form is a def or var that does not define a macro,
+ * and stops before a form that uses the value of such a def, unless the value
+ * is a constant, before a form that calls a macro, and before a form that does
+ * not compile. Defs made in the run are also bound as locals, so later forms of
+ * the run see their values. If progress is not NULL,
+ * the function stores the index of the form it is running at index 0 of
+ * progress. On success, *count is the number of forms compiled. On error,
+ * the error is in form *count - 1. */
+JanetCompileResult janet_compile_batch(const Janet *forms, int32_t n, JanetTable *env,
+                                       const uint8_t *where, int32_t *count, JanetArray *progress) {
+    if (n > JANET_BATCH_MAX) n = JANET_BATCH_MAX;
+    if (NULL != progress && progress->count < 1)
+        janet_array_push(progress, janet_wrap_integer(0));
+    return janetc_batch(forms, n, env, where, count, progress);
+}
+
+/* Wrap the result of compilation as a function or an error table */
+static Janet compile_result(JanetCompileResult res) {
     if (res.status == JANET_COMPILE_OK) {
         return janet_wrap_function(janet_thunk(res.funcdef));
     } else {
@@ -726,6 +1054,39 @@ static Janet cfun(int32_t argc, Janet *argv) {
     }
 }
 
+/* C Function for compiling */
+static Janet cfun(int32_t argc, Janet *argv) {
+    janet_arity(argc, 2, 3);
+    JanetTable *env = janet_gettable(argv, 1);
+    const uint8_t *source = NULL;
+    if (argc == 3) {
+        source = janet_getstring(argv, 2);
+    }
+    return compile_result(janet_compile(argv[0], env, source));
+}
+
+static Janet cfun_batch(int32_t argc, Janet *argv) {
+    janet_arity(argc, 2, 4);
+    JanetView forms = janet_getindexed(argv, 0);
+    JanetTable *env = janet_gettable(argv, 1);
+    const uint8_t *source = NULL;
+    JanetArray *progress = NULL;
+    int32_t count = 0;
+    if (argc >= 3 && !janet_checktype(argv[2], JANET_NIL)) {
+        source = janet_getstring(argv, 2);
+    }
+    if (argc == 4) {
+        progress = janet_getarray(argv, 3);
+    }
+    if (forms.len == 0) {
+        janet_panic("expected at least 1 form");
+    }
+    Janet tup[2];
+    tup[1] = compile_result(janet_compile_batch(forms.items, forms.len, env, source, &count, progress));
+    tup[0] = janet_wrap_integer(count);
+    return janet_wrap_tuple(janet_tuple_n(tup, 2));
+}
+
 static const JanetReg compile_cfuns[] = {
     {"compile", cfun,
         JDOC("(compile ast env [, source])\n\n"
@@ -734,6 +1095,19 @@ static const JanetReg compile_cfuns[] = {
                 "eval. Returns a janet function and does not modify ast. Throws an "
                 "error if the ast cannot be compiled.")
     },
+    {"compile-batch", cfun_batch,
+        JDOC("(compile-batch forms env [, source [, progress]])\n\n"
+                "Compiles a run of top level forms from the start of the indexed "
+                "collection forms into a single janet function. The run continues past "
+                "a form only if it is a def or var that does not define a macro, and "
+                "stops before a form that uses a def made earlier in the run, unless its "
+                "value is a constant, before a form that calls a macro, and before a form "
+                "that does not compile. Returns a "
+                "tuple of the number of forms compiled and either the function or, "
+                "if the last of those forms could not be compiled, a table like the "
+                "one returned by compile. If an array progress is given, the function "
+                "puts the index of the form it is running at index 0 of progress.")
+    },
     {NULL, NULL, NULL}
 };
 
@@ -96,14 +96,30 @@ struct JanetSlot {
 #define JANET_SCOPE_TOP 4
 #define JANET_SCOPE_UNUSED 8
 #define JANET_SCOPE_CLOSURE 16
+#define JANET_SCOPE_BATCH 32
+#define JANET_SCOPE_CAPTURED 64
+
+/* The location of a symbol and slot pair in the syms of a scope */
+typedef struct SymRef {
+    JanetScope *scope;
+    int32_t index;
+} SymRef;
 
 /* A symbol and slot pair */
 typedef struct SymPair {
     JanetSlot slot;
     const uint8_t *sym;
+    SymRef shadowed; /* Binding of sym in the function before this one */
     int keep;
 } SymPair;
 
+/* An entry in the symbol index of a function scope. Bindings that have
+ * gone out of scope leave their symbol in the index with a NULL scope. */
+typedef struct SymBucket {
+    const uint8_t *sym;
+    SymRef ref;
+} SymBucket;
+
 /* A lexical scope during compilation */
 struct JanetScope {
 
@@ -117,9 +133,23 @@ struct JanetScope {
     /* Constants for this funcdef */
     Janet *consts;
 
-    /* Map of symbols to slots. Use a simple linear scan for symbols. */
+    /* Symbols bound in this scope, in order of definition */
     SymPair *syms;
 
+    /* Hash index from symbols to the innermost binding in the function.
+     * Only used in function scopes. */
+    SymBucket *symindex;
+    int32_t symcount;
+    int32_t symcap;
+
+    /* The innermost function scope containing this scope */
+    JanetScope *function;
+
+    /* Nesting depth, and the depth of the innermost unused scope
+     * containing this scope (-1 if none) */
+    int32_t depth;
+    int32_t unused;
+
     /* FuncDefs */
     JanetFuncDef **defs;
 
@@ -147,6 +177,9 @@ struct JanetCompiler {
     uint32_t *buffer;
     JanetSourceMapping *mapbuffer;
 
+    /* Error handlers, with absolute offsets into buffer */
+    JanetHandler *handlers;
+
     /* Hold the environment */
     JanetTable *env;
 
@@ -194,6 +227,19 @@ struct JanetSpecial {
 /* Get an optimizer if it exists, otherwise NULL */
 const JanetFunOptimizer *janetc_funopt(uint32_t flags);
 
+/* Optimize the bytecode of a funcdef in place. map is the sourcemap of
+ * the bytecode, one mapping per instruction, or NULL. */
+void janetc_peephole(JanetFuncDef *def, JanetSourceMapping *map);
+
+/* Keep the varargs of a variadic funcdef on the stack if they do not escape */
+void janetc_stackargs(JanetFuncDef *def);
+
+/* Compile a call to a small Janet function inline. Returns 0 if it cannot be. */
+int janetc_inline(JanetFopts opts, JanetSlot *slots, JanetFuncDef *def, JanetSlot *out);
+
+/* Compile a call to an unnamed function literal as a block */
+JanetSlot janetc_iife(JanetFopts opts, const Janet *form, JanetSlot *slots);
+
 /* Get a special. Return NULL if none exists */
 const JanetSpecial *janetc_special(const uint8_t *name);
 
@@ -220,6 +266,12 @@ void janetc_pushslots(JanetCompiler *c, JanetSlot *slots);
 /* Free slots loaded via janetc_toslots */
 void janetc_freeslots(JanetCompiler *c, JanetSlot *slots);
 
+/* Check if every slot loaded via janetc_toslots is an unspliced constant */
+int janetc_allconstant(JanetSlot *slots);
+
+/* Get the types a slot can hold, as a mask of JANET_TFLAG_* */
+uint16_t janetc_slottypes(JanetSlot s);
+
 /* Generate the return instruction for a slot. */
 JanetSlot janetc_return(JanetCompiler *c, JanetSlot s);
 
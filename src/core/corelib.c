@@ -28,8 +28,13 @@
 #endif
 
 /* Generated bytes */
+#ifdef JANET_CORE_IMAGE
+extern const unsigned char *janet_core_image;
+extern int32_t janet_core_image_size;
+#else
 extern const unsigned char *janet_gen_core;
 extern int32_t janet_gen_core_size;
+#endif
 
 /* Use LoadLibrary on windows or dlopen on posix to load dynamic libaries
  * with native code. */
@@ -394,6 +399,7 @@ static void janet_quick_asm(
         JANET_OUT_OF_MEMORY;
     }
     memcpy(def->bytecode, bytecode, bytecode_size);
+    janetc_stackargs(def);
     janet_def(env, name, janet_wrap_function(janet_thunk(def)), doc);
 }
 
@@ -757,8 +763,39 @@ JanetTable *janet_core_env(void) {
 #endif
 
 #ifndef JANET_NO_BOOTSTRAP
+#ifdef JANET_CORE_IMAGE
+    /* Load the core environment marshaled at build time. Cfunctions and
+     * abstract values in the image are looked up by name in the
+     * environment made above. The image is static, so functions are
+     * loaded lazily and only decoded when first called. */
+    {
+        Janet image;
+        int status = janet_unmarshal(janet_core_image, (size_t) janet_core_image_size,
+                                     JANET_MARSHAL_LAZY, &image, janet_env_lookup(env), NULL);
+        janet_assert(!status && janet_checktype(image, JANET_TABLE), "could not load core image");
+        janet_gcunroot(janet_wrap_table(env));
+        env = janet_unwrap_table(image);
+        janet_gcroot(janet_wrap_table(env));
+        /* The image was made at build time, so compute the system
+         * module path again, the same way as core.janet does */
+        const char *syspath = getenv("JANET_PATH");
+        Janet ref;
+        if (NULL == syspath) {
+#ifdef JANET_WINDOWS
+            syspath = "";
+#else
+            syspath = "/usr/local/lib/janet";
+#endif
+        }
+        if (janet_resolve(env, janet_csymbol("module/*syspath*"), &ref) == JANET_BINDING_VAR &&
+                janet_unwrap_array(ref)->count) {
+            janet_unwrap_array(ref)->data[0] = janet_cstringv(syspath);
+        }
+    }
+#else
     /* Run bootstrap source */
     janet_dobytes(env, janet_gen_core, janet_gen_core_size, "core.janet", NULL);
+#endif
 #endif
 
     return env;
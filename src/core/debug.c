@@ -32,8 +32,153 @@
  * The repl should also be able to serve as pretty featured debugger
  * out of the box. */
 
+/* Sourcemaps are stored compactly, as runs of instructions with the same
+ * mapping. Each run is a varint count of instructions, then the change in
+ * the start of the mapping and the change in its length from the previous
+ * run as zigzag varints. Most instructions share a mapping with their
+ * neighbours, so this is usually one or two bytes per run. */
+
+static int32_t sm_pushvarint(uint8_t *out, uint32_t x) {
+    int32_t n = 0;
+    while (x >= 0x80) {
+        if (out) out[n] = (uint8_t)(x | 0x80);
+        n++;
+        x >>= 7;
+    }
+    if (out) out[n] = (uint8_t) x;
+    return n + 1;
+}
+
+static int sm_readvarint(const uint8_t **data, const uint8_t *end, uint32_t *x) {
+    uint32_t ret = 0;
+    const uint8_t *p = *data;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (p >= end) return 1;
+        uint8_t b = *p++;
+        ret |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *data = p;
+            *x = ret;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Read the next run of a sourcemap. Returns non-zero if there is no
+ * valid run. */
+static int sm_readrun(const uint8_t **data, const uint8_t *end,
+                      uint32_t *count, uint32_t *start, uint32_t *span) {
+    uint32_t c, ds, dl;
+    if (sm_readvarint(data, end, &c) ||
+            sm_readvarint(data, end, &ds) ||
+            sm_readvarint(data, end, &dl) ||
+            c == 0)
+        return 1;
+    *count = c;
+    *start += (ds >> 1) ^ (0 - (ds & 1));
+    *span += (dl >> 1) ^ (0 - (dl & 1));
+    return 0;
+}
+
+/* Encode the mappings of n instructions. Returns a malloced sourcemap and
+ * sets len to its size. */
+uint8_t *janet_sourcemap_encode(const JanetSourceMapping *map, int32_t n, int32_t *len) {
+    uint8_t *out = NULL;
+    int32_t k = 0;
+    /* The first pass counts bytes and the second writes them */
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t prevstart = 0;
+        uint32_t prevspan = 0;
+        k = 0;
+        for (int32_t i = 0, j; i < n; i = j) {
+            for (j = i + 1; j < n; j++)
+                if (map[j].start != map[i].start || map[j].end != map[i].end) break;
+            uint32_t start = (uint32_t) map[i].start;
+            uint32_t span = (uint32_t) map[i].end - start;
+            uint32_t ds = start - prevstart;
+            uint32_t dl = span - prevspan;
+            k += sm_pushvarint(out ? out + k : NULL, (uint32_t)(j - i));
+            k += sm_pushvarint(out ? out + k : NULL, (ds << 1) ^ (0 - (ds >> 31)));
+            k += sm_pushvarint(out ? out + k : NULL, (dl << 1) ^ (0 - (dl >> 31)));
+            prevstart = start;
+            prevspan = span;
+        }
+        if (pass == 0) {
+            out = malloc(k ? k : 1);
+            if (NULL == out) {
+                JANET_OUT_OF_MEMORY;
+            }
+        }
+    }
+    *len = k;
+    return out;
+}
+
+/* Check that a sourcemap has exactly n instructions. Returns non-zero if
+ * it does not. */
+int janet_sourcemap_check(const uint8_t *data, int32_t len, int32_t n) {
+    const uint8_t *end = data + len;
+    uint32_t start = 0, span = 0, count;
+    int32_t pos = 0;
+    while (data < end) {
+        if (sm_readrun(&data, end, &count, &start, &span)) return 1;
+        if (count > (uint32_t)(n - pos)) return 1;
+        pos += (int32_t) count;
+    }
+    return pos != n;
+}
+
+/* Get the mapping of the instruction at pc. Returns non-zero if there is
+ * none. Only whole runs are skipped, so this is fast enough for stack
+ * traces. */
+int janet_sourcemap_get(const JanetFuncDef *def, int32_t pc, JanetSourceMapping *out) {
+    if (NULL == def->sourcemap || pc < 0) return 1;
+    const uint8_t *data = def->sourcemap;
+    const uint8_t *end = data + def->sourcemap_length;
+    uint32_t start = 0, span = 0, count;
+    int32_t pos = 0;
+    while (data < end) {
+        if (sm_readrun(&data, end, &count, &start, &span)) return 1;
+        if (count > (uint32_t)(pc - pos)) {
+            out->start = (int32_t) start;
+            out->end = (int32_t)(start + span);
+            return 0;
+        }
+        pos += (int32_t) count;
+    }
+    return 1;
+}
+
+/* Decode the mapping of every instruction of a function definition.
+ * Returns a malloced array, or NULL if the definition has no valid
+ * sourcemap. */
+JanetSourceMapping *janet_sourcemap_decode(const JanetFuncDef *def) {
+    if (NULL == def->sourcemap ||
+            janet_sourcemap_check(def->sourcemap, def->sourcemap_length, def->bytecode_length))
+        return NULL;
+    JanetSourceMapping *map = malloc(sizeof(JanetSourceMapping) * (def->bytecode_length + 1));
+    if (NULL == map) {
+        JANET_OUT_OF_MEMORY;
+    }
+    const uint8_t *data = def->sourcemap;
+    const uint8_t *end = data + def->sourcemap_length;
+    uint32_t start = 0, span = 0, count;
+    int32_t pos = 0;
+    while (data < end) {
+        sm_readrun(&data, end, &count, &start, &span);
+        for (uint32_t i = 0; i < count; i++) {
+            map[pos].start = (int32_t) start;
+            map[pos].end = (int32_t)(start + span);
+            pos++;
+        }
+    }
+    return map;
+}
+
 /* Add a break point to a function */
 void janet_debug_break(JanetFuncDef *def, int32_t pc) {
+    janet_funcdef_load(def);
     if (pc >= def->bytecode_length || pc < 0)
         janet_panic("invalid bytecode offset");
     def->bytecode[pc] |= 0x80;
@@ -41,6 +186,7 @@ void janet_debug_break(JanetFuncDef *def, int32_t pc) {
 
 /* Remove a break point from a function */
 void janet_debug_unbreak(JanetFuncDef *def, int32_t pc) {
+    janet_funcdef_load(def);
     if (pc >= def->bytecode_length || pc < 0)
         janet_panic("invalid bytecode offset");
     def->bytecode[pc] &= ~((uint32_t)0x80);
@@ -62,15 +208,15 @@ void janet_debug_find(
     while (NULL != current) {
         if ((current->flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_FUNCDEF) {
             JanetFuncDef *def = (JanetFuncDef *)(current + 1);
-            if (def->sourcemap &&
-                    def->source &&
-                    !janet_string_compare(source, def->source)) {
+            if (def->source && !janet_string_compare(source, def->source)) {
                 /* Correct source file, check mappings. The chosen
                  * pc index is the first match with the smallest range. */
                 int32_t i;
-                for (i = 0; i < def->bytecode_length; i++) {
-                    int32_t start = def->sourcemap[i].start;
-                    int32_t end = def->sourcemap[i].end;
+                janet_funcdef_load(def);
+                JanetSourceMapping *map = janet_sourcemap_decode(def);
+                for (i = 0; map && i < def->bytecode_length; i++) {
+                    int32_t start = map[i].start;
+                    int32_t end = map[i].end;
                     if (end - start < best_range &&
                             start <= offset &&
                             end >= offset) {
@@ -79,6 +225,7 @@ void janet_debug_find(
                         best_def = def;
                     }
                 }
+                free(map);
             }
         }
         current = current->next;
@@ -145,8 +292,8 @@ void janet_stacktrace(JanetFiber *fiber, Janet err) {
                 fprintf(stderr, " (tailcall)");
             if (frame->func && frame->pc) {
                 int32_t off = (int32_t) (frame->pc - def->bytecode);
-                if (def->sourcemap) {
-                    JanetSourceMapping mapping = def->sourcemap[off];
+                JanetSourceMapping mapping;
+                if (!janet_sourcemap_get(def, off, &mapping)) {
                     fprintf(stderr, " at (%d:%d)", mapping.start, mapping.end);
                 } else {
                     fprintf(stderr, " pc=%d", off);
@@ -254,8 +401,8 @@ static Janet doframe(JanetStackFrame *frame) {
         JanetArray *slots;
         off = (int32_t) (frame->pc - def->bytecode);
         janet_table_put(t, janet_ckeywordv("pc"), janet_wrap_integer(off));
-        if (def->sourcemap) {
-            JanetSourceMapping mapping = def->sourcemap[off];
+        JanetSourceMapping mapping;
+        if (!janet_sourcemap_get(def, off, &mapping)) {
             janet_table_put(t, janet_ckeywordv("source-start"), janet_wrap_integer(mapping.start));
             janet_table_put(t, janet_ckeywordv("source-end"), janet_wrap_integer(mapping.end));
         }
@@ -28,34 +28,137 @@
 #include "util.h"
 #endif
 
+/* Fiber stacks are recycled through a small pool of free lists, one per
+ * power of two size class. A free stack stores the next free stack of its
+ * class in its first slot. */
+#define JANET_STACK_POOL_MIN 16
+#define JANET_STACK_POOL_CLASSES 10
+#define JANET_STACK_POOL_DEPTH 16
+
+static JANET_THREAD_LOCAL Janet *stack_pool[JANET_STACK_POOL_CLASSES];
+static JANET_THREAD_LOCAL int32_t stack_pool_count[JANET_STACK_POOL_CLASSES];
+
+/* Get the size class of a capacity, rounding the capacity up to the size
+ * of the class. Returns -1 for capacities too large to pool. */
+static int stack_class(int32_t *capacity) {
+    int32_t size = JANET_STACK_POOL_MIN;
+    for (int i = 0; i < JANET_STACK_POOL_CLASSES; i++, size <<= 1) {
+        if (*capacity <= size) {
+            *capacity = size;
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Get memory for a stack of at least capacity values. Sets capacity
+ * to the real capacity of the stack. */
+static Janet *stack_alloc(int32_t *capacity) {
+    int c = stack_class(capacity);
+    if (c >= 0 && stack_pool[c]) {
+        Janet *data = stack_pool[c];
+        stack_pool[c] = ((Janet **)data)[0];
+        stack_pool_count[c]--;
+        return data;
+    }
+    Janet *data = malloc(sizeof(Janet) * *capacity);
+    if (NULL == data) {
+        JANET_OUT_OF_MEMORY;
+    }
+    return data;
+}
+
+/* Give back the memory of a stack. */
+static void stack_free(Janet *data, int32_t capacity) {
+    int32_t size = capacity;
+    int c = stack_class(&size);
+    if (c >= 0 && size == capacity && stack_pool_count[c] < JANET_STACK_POOL_DEPTH) {
+        ((Janet **)data)[0] = stack_pool[c];
+        stack_pool[c] = data;
+        stack_pool_count[c]++;
+    } else {
+        free(data);
+    }
+}
+
+/* Free the stack of a fiber that is being collected. */
+void janet_fiber_freestack(JanetFiber *fiber) {
+    if (NULL != fiber->data)
+        stack_free(fiber->data, fiber->capacity);
+    fiber->data = NULL;
+}
+
+/* Free all pooled stacks */
+void janet_fiber_pool_deinit(void) {
+    for (int i = 0; i < JANET_STACK_POOL_CLASSES; i++) {
+        while (stack_pool[i]) {
+            Janet *next = ((Janet **)stack_pool[i])[0];
+            free(stack_pool[i]);
+            stack_pool[i] = next;
+        }
+        stack_pool_count[i] = 0;
+    }
+}
+
+/* If a frame has a closure environment, detach it from
+ * the stack and have it keep its own values */
+static void janet_env_detach(JanetFuncEnv *env) {
+    /* Check for closure environment */
+    if (env) {
+        size_t s = sizeof(Janet) * env->length;
+        Janet *vmem = malloc(s);
+        if (NULL == vmem) {
+            JANET_OUT_OF_MEMORY;
+        }
+        memcpy(vmem, env->as.fiber->data + env->offset, s);
+        env->offset = 0;
+        env->as.values = vmem;
+    }
+}
+
 static void fiber_reset(JanetFiber *fiber) {
     fiber->maxstack = JANET_STACK_MAX;
     fiber->frame = 0;
     fiber->stackstart = JANET_FRAME_SIZE;
     fiber->stacktop = JANET_FRAME_SIZE;
     fiber->child = NULL;
-    fiber->flags = JANET_FIBER_MASK_YIELD;
+    fiber->flags = JANET_FIBER_MASK_YIELD | JANET_FIBER_MASK_INTERRUPT;
+    fiber->budget = 0;
+    fiber->ticks = 0;
+    fiber->resumer = NULL;
+    fiber->quotaparent = NULL;
+    fiber->memquota = 0;
+    fiber->memused = 0;
+    fiber->tickquota = 0;
+    fiber->tickused = 0;
     janet_fiber_set_status(fiber, JANET_STATUS_NEW);
 }
 
 static JanetFiber *fiber_alloc(int32_t capacity) {
-    Janet *data;
     JanetFiber *fiber = janet_gcalloc(JANET_MEMORY_FIBER, sizeof(JanetFiber));
-    if (capacity < 32) {
-        capacity = 32;
+    if (capacity < (int32_t) JANET_FRAME_SIZE) {
+        capacity = JANET_FRAME_SIZE;
     }
+    fiber->frame = 0;
+    fiber->data = stack_alloc(&capacity);
     fiber->capacity = capacity;
-    data = malloc(sizeof(Janet) * capacity);
-    if (NULL == data) {
-        JANET_OUT_OF_MEMORY;
-    }
-    fiber->data = data;
     return fiber;
 }
 
-/* Create a new fiber with argn values on the stack by reusing a fiber. */
+/* Create a new fiber with argn values on the stack by reusing a fiber. The
+ * stack of the old fiber is kept, so resetting a finished fiber is cheaper
+ * than making a new one. */
 JanetFiber *janet_fiber_reset(JanetFiber *fiber, JanetFunction *callee, int32_t argc, const Janet *argv) {
     int32_t newstacktop;
+    /* Closures may still refer to frames of a suspended or errored fiber */
+    int32_t i = fiber->frame;
+    while (i > 0) {
+        JanetStackFrame *frame = janet_stack_frame(fiber->data + i);
+        if (NULL != frame->func)
+            janet_env_detach(frame->env);
+        frame->env = NULL;
+        i = frame->prevframe;
+    }
     fiber_reset(fiber);
     if (argc) {
         newstacktop = fiber->stacktop + argc;
@@ -75,12 +178,13 @@ JanetFiber *janet_fiber(JanetFunction *callee, int32_t capacity, int32_t argc, c
     return janet_fiber_reset(fiber_alloc(capacity), callee, argc, argv);
 }
 
-/* Ensure that the fiber has enough extra capacity */
+/* Ensure that the fiber has enough extra capacity. Only values below
+ * the top of the stack are kept. */
 void janet_fiber_setcapacity(JanetFiber *fiber, int32_t n) {
-    Janet *newData = realloc(fiber->data, sizeof(Janet) * n);
-    if (NULL == newData) {
-        JANET_OUT_OF_MEMORY;
-    }
+    int32_t count = fiber->stacktop < n ? fiber->stacktop : n;
+    Janet *newData = stack_alloc(&n);
+    if (count > 0) memcpy(newData, fiber->data, sizeof(Janet) * count);
+    stack_free(fiber->data, fiber->capacity);
     fiber->data = newData;
     fiber->capacity = n;
 }
@@ -126,6 +230,23 @@ void janet_fiber_pushn(JanetFiber *fiber, const Janet *arr, int32_t n) {
     fiber->stacktop = newtop;
 }
 
+/* Get the number of varargs a function keeps on the stack instead of in a
+ * tuple when called with argc arguments. */
+static int32_t fiber_stackargs(JanetFuncDef *def, int32_t argc) {
+    if (!(def->flags & JANET_FUNCDEF_FLAG_STACKARGS) || argc <= def->arity) return 0;
+    return argc - def->arity;
+}
+
+/* Move n varargs from after the fixed arguments of the current frame to
+ * after its slots, and store their count in the rest parameter. */
+static void fiber_movestackargs(JanetFiber *fiber, JanetFuncDef *def, int32_t n) {
+    Janet *stack = fiber->data + fiber->frame;
+    if (n) memmove(stack + def->slotcount, stack + def->arity, n * sizeof(Janet));
+    for (int32_t i = def->arity + 1; i < def->slotcount; i++)
+        stack[i] = janet_wrap_nil();
+    stack[def->arity] = janet_wrap_integer(n);
+}
+
 /* Push a stack frame to a fiber */
 int janet_fiber_funcframe(JanetFiber *fiber, JanetFunction *func) {
     JanetStackFrame *newframe;
@@ -134,8 +255,12 @@ int janet_fiber_funcframe(JanetFiber *fiber, JanetFunction *func) {
     int32_t oldtop = fiber->stacktop;
     int32_t oldframe = fiber->frame;
     int32_t nextframe = fiber->stackstart;
-    int32_t nextstacktop = nextframe + func->def->slotcount + JANET_FRAME_SIZE;
     int32_t next_arity = fiber->stacktop - fiber->stackstart;
+    int32_t stackargs = fiber_stackargs(func->def, next_arity);
+    int32_t nextstacktop = nextframe + func->def->slotcount + stackargs + JANET_FRAME_SIZE;
+
+    /* Decode the code of a def from a lazy image on first call */
+    if (func->def->lazy) janet_funcdef_load(func->def);
 
     /* Check strict arity before messing with state */
     if (func->def->flags & JANET_FUNCDEF_FLAG_FIXARITY) {
@@ -164,7 +289,9 @@ int janet_fiber_funcframe(JanetFiber *fiber, JanetFunction *func) {
     newframe->flags = 0;
 
     /* Check varargs */
-    if (func->def->flags & JANET_FUNCDEF_FLAG_VARARG) {
+    if (func->def->flags & JANET_FUNCDEF_FLAG_STACKARGS) {
+        fiber_movestackargs(fiber, func->def, stackargs);
+    } else if (func->def->flags & JANET_FUNCDEF_FLAG_VARARG) {
         int32_t tuplehead = fiber->frame + func->def->arity;
         if (tuplehead >= oldtop) {
             fiber->data[tuplehead] = janet_wrap_tuple(janet_tuple_n(NULL, 0));
@@ -179,30 +306,17 @@ int janet_fiber_funcframe(JanetFiber *fiber, JanetFunction *func) {
     return 0;
 }
 
-/* If a frame has a closure environment, detach it from
- * the stack and have it keep its own values */
-static void janet_env_detach(JanetFuncEnv *env) {
-    /* Check for closure environment */
-    if (env) {
-        size_t s = sizeof(Janet) * env->length;
-        Janet *vmem = malloc(s);
-        if (NULL == vmem) {
-            JANET_OUT_OF_MEMORY;
-        }
-        memcpy(vmem, env->as.fiber->data + env->offset, s);
-        env->offset = 0;
-        env->as.values = vmem;
-    }
-}
-
 /* Create a tail frame for a function */
 int janet_fiber_funcframe_tail(JanetFiber *fiber, JanetFunction *func) {
     int32_t i;
-    int32_t nextframetop = fiber->frame + func->def->slotcount;
-    int32_t nextstacktop = nextframetop + JANET_FRAME_SIZE;
     int32_t next_arity = fiber->stacktop - fiber->stackstart;
+    int32_t stackargs = fiber_stackargs(func->def, next_arity);
+    int32_t nextframetop = fiber->frame + func->def->slotcount;
+    int32_t nextstacktop = nextframetop + stackargs + JANET_FRAME_SIZE;
     int32_t stacksize;
 
+    if (func->def->lazy) janet_funcdef_load(func->def);
+
     /* Check strict arity before messing with state */
     if (func->def->flags & JANET_FUNCDEF_FLAG_FIXARITY) {
         if (func->def->arity != next_arity) {
@@ -223,7 +337,10 @@ int janet_fiber_funcframe_tail(JanetFiber *fiber, JanetFunction *func) {
     janet_fiber_frame(fiber)->env = NULL;
 
     /* Check varargs */
-    if (func->def->flags & JANET_FUNCDEF_FLAG_VARARG) {
+    if (func->def->flags & JANET_FUNCDEF_FLAG_STACKARGS) {
+        /* Moved into place after the locals are cleared */
+        stacksize = next_arity;
+    } else if (func->def->flags & JANET_FUNCDEF_FLAG_VARARG) {
         int32_t tuplehead = fiber->stackstart + func->def->arity;
         if (tuplehead >= fiber->stacktop) {
             if (tuplehead >= fiber->capacity) janet_fiber_setcapacity(fiber, 2 * (tuplehead + 1));
@@ -244,6 +361,8 @@ int janet_fiber_funcframe_tail(JanetFiber *fiber, JanetFunction *func) {
     /* Nil unset locals (Needed for functional correctness) */
     for (i = fiber->frame + stacksize; i < nextframetop; ++i)
         fiber->data[i] = janet_wrap_nil();
+    if (func->def->flags & JANET_FUNCDEF_FLAG_STACKARGS)
+        fiber_movestackargs(fiber, func->def, stackargs);
 
     /* Set stack stuff */
     fiber->stacktop = fiber->stackstart = nextstacktop;
@@ -299,17 +418,30 @@ void janet_fiber_popframe(JanetFiber *fiber) {
 
 /* CFuns */
 
-static Janet cfun_fiber_new(int32_t argc, Janet *argv) {
-    janet_arity(argc, 1, 2);
-    JanetFunction *func = janet_getfunction(argv, 0);
-    JanetFiber *fiber;
+/* Get the body of a fiber from the arguments */
+static JanetFunction *fiber_getbody(const Janet *argv, int32_t n) {
+    JanetFunction *func = janet_getfunction(argv, n);
     if (func->def->flags & JANET_FUNCDEF_FLAG_FIXARITY) {
         if (func->def->arity != 0) {
             janet_panic("expected nullary function in fiber constructor");
         }
     }
-    fiber = janet_fiber(func, 64, 0, NULL);
-    if (argc == 2) {
+    return func;
+}
+
+static Janet cfun_fiber_new(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 3);
+    JanetFunction *func = fiber_getbody(argv, 0);
+    JanetFiber *fiber;
+    int32_t capacity = 64;
+    if (argc == 3) {
+        capacity = janet_getinteger(argv, 2);
+        if (capacity < 0) {
+            janet_panic("expected non-negative integer");
+        }
+    }
+    fiber = janet_fiber(func, capacity, 0, NULL);
+    if (argc >= 2 && !janet_checktype(argv[1], JANET_NIL)) {
         int32_t i;
         JanetByteView view = janet_getbytes(argv, 1);
         fiber->flags = 0;
@@ -320,13 +452,14 @@ static Janet cfun_fiber_new(int32_t argc, Janet *argv) {
             } else {
                 switch (view.bytes[i]) {
                     default:
-                        janet_panicf("invalid flag %c, expected a, d, e, u, or y", view.bytes[i]);
+                        janet_panicf("invalid flag %c, expected a, d, e, i, u, or y", view.bytes[i]);
                         break;
                     case 'a':
                         fiber->flags |=
                             JANET_FIBER_MASK_DEBUG |
                             JANET_FIBER_MASK_ERROR |
                             JANET_FIBER_MASK_USER |
+                            JANET_FIBER_MASK_INTERRUPT |
                             JANET_FIBER_MASK_YIELD;
                         break;
                     case 'd':
@@ -335,6 +468,9 @@ static Janet cfun_fiber_new(int32_t argc, Janet *argv) {
                     case 'e':
                         fiber->flags |= JANET_FIBER_MASK_ERROR;
                         break;
+                    case 'i':
+                        fiber->flags |= JANET_FIBER_MASK_INTERRUPT;
+                        break;
                     case 'u':
                         fiber->flags |= JANET_FIBER_MASK_USER;
                         break;
@@ -348,6 +484,26 @@ static Janet cfun_fiber_new(int32_t argc, Janet *argv) {
     return janet_wrap_fiber(fiber);
 }
 
+static Janet cfun_fiber_reset(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    JanetFiber *fiber = janet_getfiber(argv, 0);
+    JanetFunction *func = fiber_getbody(argv, 1);
+    if (janet_fiber_status(fiber) == JANET_STATUS_ALIVE) {
+        janet_panic("cannot reset alive fiber");
+    }
+    int32_t mask = fiber->flags & ~JANET_FIBER_STATUS_MASK;
+    int32_t budget = fiber->budget;
+    size_t memquota = fiber->memquota;
+    size_t tickquota = fiber->tickquota;
+    janet_fiber_reset(fiber, func, 0, NULL);
+    fiber->flags = mask;
+    fiber->budget = budget;
+    fiber->memquota = memquota;
+    fiber->tickquota = tickquota;
+    janet_fiber_set_status(fiber, JANET_STATUS_NEW);
+    return argv[0];
+}
+
 static Janet cfun_fiber_status(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 1);
     JanetFiber *fiber = janet_getfiber(argv, 0);
@@ -379,14 +535,64 @@ static Janet cfun_fiber_setmaxstack(int32_t argc, Janet *argv) {
     return argv[0];
 }
 
+static Janet cfun_fiber_budget(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetFiber *fiber = janet_getfiber(argv, 0);
+    return janet_wrap_integer(fiber->budget);
+}
+
+static Janet cfun_fiber_setbudget(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    JanetFiber *fiber = janet_getfiber(argv, 0);
+    int32_t budget = janet_getinteger(argv, 1);
+    if (budget < 0) {
+        janet_panic("expected non-negative integer");
+    }
+    fiber->budget = budget;
+    fiber->ticks = budget;
+    return argv[0];
+}
+
+static Janet cfun_fiber_quota(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetFiber *fiber = janet_getfiber(argv, 0);
+    JanetKV *st = janet_struct_begin(4);
+    janet_struct_put(st, janet_ckeywordv("memory"), janet_wrap_number((double) fiber->memquota));
+    janet_struct_put(st, janet_ckeywordv("memory-used"), janet_wrap_number((double) fiber->memused));
+    janet_struct_put(st, janet_ckeywordv("ticks"), janet_wrap_number((double) fiber->tickquota));
+    janet_struct_put(st, janet_ckeywordv("ticks-used"), janet_wrap_number((double) fiber->tickused));
+    return janet_wrap_struct(janet_struct_end(st));
+}
+
+static size_t fiber_getquota(const Janet *argv, int32_t n) {
+    double x = janet_getnumber(argv, n);
+    if (x < 0 || x > 9007199254740992.0 || x != (double)(int64_t) x) {
+        janet_panicf("expected non-negative integer, got %v", argv[n]);
+    }
+    return (size_t) x;
+}
+
+static Janet cfun_fiber_setquota(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 3);
+    JanetFiber *fiber = janet_getfiber(argv, 0);
+    size_t memquota = fiber_getquota(argv, 1);
+    size_t tickquota = fiber_getquota(argv, 2);
+    if (janet_fiber_status(fiber) == JANET_STATUS_ALIVE) {
+        janet_panic("cannot change quota of alive fiber");
+    }
+    fiber->memquota = memquota;
+    fiber->tickquota = tickquota;
+    return argv[0];
+}
+
 static const JanetReg fiber_cfuns[] = {
     {
         "fiber/new", cfun_fiber_new,
-        JDOC("(fiber/new func [,sigmask])\n\n"
+        JDOC("(fiber/new func [,sigmask [,capacity]])\n\n"
                 "Create a new fiber with function body func. Can optionally "
                 "take a set of signals to block from the current parent fiber "
                 "when called. The mask is specified as a keyword where each character "
-                "is used to indicate a signal to block. The default sigmask is :y. "
+                "is used to indicate a signal to block. The default sigmask is :yi. "
                 "For example, \n\n"
                 "\t(fiber/new myfun :e123)\n\n"
                 "blocks error signals and user signals 1, 2 and 3. The signals are "
@@ -394,9 +600,21 @@ static const JanetReg fiber_cfuns[] = {
                 "\ta - block all signals\n"
                 "\td - block debug signals\n"
                 "\te - block error signals\n"
+                "\ti - block interrupt signals\n"
                 "\tu - block user signals\n"
                 "\ty - block yield signals\n"
-                "\t0-9 - block a specific user signal")
+                "\t0-9 - block a specific user signal\n\n"
+                "The optional capacity is the number of values initially reserved for "
+                "the fiber's stack. The stack grows as needed, so a small capacity makes "
+                "fibers that only run small functions cheaper. A nil sigmask uses the default.")
+    },
+    {
+        "fiber/reset", cfun_fiber_reset,
+        JDOC("(fiber/reset fib func)\n\n"
+                "Reuse a fiber that is not currently running to run a new function body func. "
+                "The fiber keeps its stack memory, signal mask and budget, and its status "
+                "becomes :new. This is cheaper than creating a new fiber with fiber/new. "
+                "Returns fib.")
     },
     {
         "fiber/status", cfun_fiber_status,
@@ -406,6 +624,7 @@ static const JanetReg fiber_cfuns[] = {
                 "\t:error - the fiber has errored out\n"
                 "\t:debug - the fiber is suspended in debug mode\n"
                 "\t:pending - the fiber has been yielded\n"
+                "\t:interrupted - the fiber used up its budget, see fiber/setbudget\n"
                 "\t:user(0-9) - the fiber is suspended by a user signal\n"
                 "\t:alive - the fiber is currently running and cannot be resumed\n"
                 "\t:new - the fiber has just been created and not yet run")
@@ -428,6 +647,38 @@ static const JanetReg fiber_cfuns[] = {
                 "Sets the maximum stack size in janet values for a fiber. By default, the "
                 "maximum stack size is usually 8192.")
     },
+    {
+        "fiber/budget", cfun_fiber_budget,
+        JDOC("(fiber/budget fib)\n\n"
+                "Gets the number of back edges and function calls a fiber may run each time "
+                "it is resumed before it is interrupted. A budget of 0 means the fiber is never "
+                "interrupted.")
+    },
+    {
+        "fiber/setbudget", cfun_fiber_setbudget,
+        JDOC("(fiber/setbudget fib budget)\n\n"
+                "Sets the number of back edges (backwards jumps) and function calls a fiber "
+                "may run each time it is resumed. When the budget runs out, the fiber is suspended "
+                "with the interrupt signal and its status becomes :interrupted. Resuming the fiber "
+                "refills the budget and continues where it left off, so a scheduler can time "
+                "slice long running fibers. Interrupts are blocked by default, see fiber/new. "
+                "A budget of 0, the default, disables interrupts. Returns fib.")
+    },
+    {
+        "fiber/quota", cfun_fiber_quota,
+        JDOC("(fiber/quota fib)\n\n"
+                "Gets the quotas of a fiber and how much of them it has used, as a struct "
+                "with the keys :memory, :memory-used, :ticks and :ticks-used.")
+    },
+    {
+        "fiber/setquota", cfun_fiber_setquota,
+        JDOC("(fiber/setquota fib memory ticks)\n\n"
+                "Limits the total bytes of memory allocated and the total back edges and "
+                "function calls run by a fiber and every fiber it resumes, over the life of "
+                "the fiber. A fiber that goes over either quota raises an error that it cannot "
+                "recover from, so untrusted code can be run in a sandbox. A quota of 0 means no "
+                "limit. The quota of a running fiber cannot be changed. Returns fib.")
+    },
     {NULL, NULL, NULL}
 };
 
@@ -25,6 +25,7 @@
 #include "state.h"
 #include "symcache.h"
 #include "gc.h"
+#include "fiber.h"
 #endif
 
 /* GC State */
@@ -176,6 +177,8 @@ static void janet_mark_funcdef(JanetFuncDef *def) {
         janet_mark_string(def->source);
     if (def->name)
         janet_mark_string(def->name);
+    if (def->lazy)
+        janet_mark(def->lazy->image);
 }
 
 static void janet_mark_function(JanetFunction *func) {
@@ -242,7 +245,7 @@ static void janet_deinit_block(JanetGCMemoryHeader *block) {
             janet_table_deinit((JanetTable*) mem);
             break;
         case JANET_MEMORY_FIBER:
-            free(((JanetFiber *)mem)->data);
+            janet_fiber_freestack((JanetFiber *)mem);
             break;
         case JANET_MEMORY_BUFFER:
             janet_buffer_deinit((JanetBuffer *) mem);
@@ -268,6 +271,8 @@ static void janet_deinit_block(JanetGCMemoryHeader *block) {
                 free(def->constants);
                 free(def->bytecode);
                 free(def->sourcemap);
+                free(def->handlers);
+                free(def->lazy);
             }
             break;
     }
@@ -298,6 +303,13 @@ void janet_sweep() {
 }
 
 /* Allocate some memory that is tracked for garbage collection */
+/* Charge allocated bytes to every running fiber with a quota. The
+ * VM checks quotas at safe points. */
+void janet_gccharge(size_t size) {
+    for (JanetFiber *q = janet_vm_quota; NULL != q; q = q->quotaparent)
+        q->memused += size;
+}
+
 void *janet_gcalloc(enum JanetMemoryType type, size_t size) {
     JanetGCMemoryHeader *mdata;
     size_t total = size + sizeof(JanetGCMemoryHeader);
@@ -318,6 +330,7 @@ void *janet_gcalloc(enum JanetMemoryType type, size_t size) {
 
     /* Prepend block to heap list */
     janet_vm_next_collection += (int32_t) size;
+    if (NULL != janet_vm_quota) janet_gccharge(size);
     mdata->next = janet_vm_blocks;
     janet_vm_blocks = mdata;
 
@@ -68,4 +68,7 @@ enum JanetMemoryType {
  * and then call when janet_enablegc when it is initailize and reachable by the gc (on the JANET stack) */
 void *janet_gcalloc(enum JanetMemoryType type, size_t size);
 
+/* Charge memory allocated outside of janet_gcalloc to running fibers with quotas */
+void janet_gccharge(size_t size);
+
 #endif
@@ -53,6 +53,8 @@ static int cfun_io_gc(void *p, size_t len);
 JanetAbstractType cfun_io_filetype = {
     "core/file",
     cfun_io_gc,
+    NULL,
+    NULL,
     NULL
 };
 
@@ -248,6 +250,22 @@ static Janet cfun_io_fflush(int32_t argc, Janet *argv) {
     return argv[0];
 }
 
+/* Get the stream of an open file for reading or writing, or NULL if
+ * x is not a file. */
+FILE *janet_io_getfile(Janet x, int write) {
+    if (!janet_checktype(x, JANET_ABSTRACT)) return NULL;
+    void *abst = janet_unwrap_abstract(x);
+    if (janet_abstract_type(abst) != &cfun_io_filetype) return NULL;
+    IOFile *iof = (IOFile *) abst;
+    if (iof->flags & IO_CLOSED)
+        janet_panic("file is closed");
+    if (write && !(iof->flags & (IO_WRITE | IO_APPEND | IO_UPDATE)))
+        janet_panic("file is not writeable");
+    if (!write && !(iof->flags & (IO_READ | IO_UPDATE)))
+        janet_panic("file is not readable");
+    return iof->file;
+}
+
 /* Cleanup a file */
 static int cfun_io_gc(void *p, size_t len) {
     (void) len;
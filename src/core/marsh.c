@@ -29,15 +29,48 @@
 #include "util.h"
 #endif
 
+#ifdef JANET_UNIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* The version of the format written by janet_marshal. Version 1 has no
+ * header, fixed width integers and 8 byte reals. Version 2 starts with
+ * LB_VERSION, uses LEB128 varints and writes reals as 4 bytes when that
+ * is exact. Version 3 writes sourcemaps in their compact form. */
+#define JANET_MARSHAL_VERSION 3
+
+/* Marshalling to a file writes length prefixed chunks of about this
+ * size, ended by an empty chunk, so a reader never reads past the end
+ * of a value. */
+#define JANET_MARSHAL_CHUNK 0x10000
+
+/* An entry in the set of marshalled values, funcdefs and funcenvs, keyed
+ * on their address and kind. The kind is needed as strings, symbols and
+ * keywords with the same contents can share memory. */
+typedef struct {
+    const void *key;
+    int32_t kind;
+    int32_t id;
+} MarshalSeen;
+
+#define MARSHAL_SEEN_ENV (-1)
+#define MARSHAL_SEEN_DEF (-2)
+
 typedef struct {
     jmp_buf err;
     Janet current;
     JanetBuffer *buf;
-    JanetTable seen;
+    FILE *file;
+    MarshalSeen *seen;
+    int32_t seen_count;
+    int32_t seen_capacity;
     JanetTable *rreg;
-    JanetFuncEnv **seen_envs;
-    JanetFuncDef **seen_defs;
     int32_t nextid;
+    int32_t nextenv;
+    int32_t nextdef;
 } MarshalState;
 
 enum {
@@ -47,7 +80,9 @@ enum {
     MR_NRV,
     MR_C_STACKFRAME,
     MR_OVERFLOW,
-    MR_LIVEFIBER
+    MR_LIVEFIBER,
+    MR_INVALID_BYTECODE,
+    MR_IO
 } MarshalResult;
 
 const char *mr_strings[] = {
@@ -57,7 +92,9 @@ const char *mr_strings[] = {
     "no registry value",
     "fiber has c stack frame",
     "buffer overflow",
-    "alive fiber"
+    "alive fiber",
+    "invalid bytecode",
+    "could not write to file"
 };
 
 /* Lead bytes in marshaling protocol */
@@ -82,7 +119,10 @@ enum {
     LB_ABSTRACT,
     LB_REFERENCE,
     LB_FUNCENV_REF,
-    LB_FUNCDEF_REF
+    LB_FUNCDEF_REF,
+    LB_REAL32,
+    LB_VERSION,
+    LB_COMPRESSED
 } LeadBytes;
 
 /* Helper to look inside an entry in an environment */
@@ -122,27 +162,120 @@ JanetTable *janet_env_lookup(JanetTable *env) {
     return renv;
 }
 
-/* Marshal an integer onto the buffer */
-static void pushint(MarshalState *st, int32_t x) {
-    if (x >= 0 && x < 200) {
-        janet_buffer_push_u8(st->buf, x);
-    } else {
-        uint8_t intbuf[5];
-        intbuf[0] = LB_INTEGER;
-        intbuf[1] = x & 0xFF;
-        intbuf[2] = (x >> 8) & 0xFF;
-        intbuf[3] = (x >> 16) & 0xFF;
-        intbuf[4] = (x >> 24) & 0xFF;
-        janet_buffer_push_bytes(st->buf, intbuf, 5);
+/* Write a chunk of marshalled bytes to the output file */
+static void marshal_write_chunk(MarshalState *st, const uint8_t *bytes, int32_t len) {
+    uint8_t header[5];
+    uint32_t u = (uint32_t) len;
+    int n = 0;
+    while (u >= 0x80) {
+        header[n++] = (uint8_t)(u | 0x80);
+        u >>= 7;
+    }
+    header[n++] = (uint8_t) u;
+    if (fwrite(header, 1, n, st->file) != (size_t) n)
+        longjmp(st->err, MR_IO);
+    if (len && fwrite(bytes, 1, len, st->file) != (size_t) len)
+        longjmp(st->err, MR_IO);
+}
+
+/* Write out the buffered bytes when marshalling to a file */
+static void marshal_flush(MarshalState *st) {
+    if (st->buf->count) {
+        marshal_write_chunk(st, st->buf->data, st->buf->count);
+        st->buf->count = 0;
     }
 }
 
+#define MARSHAL_CHECK_FLUSH(st) \
+    if ((st)->file && (st)->buf->count >= JANET_MARSHAL_CHUNK) marshal_flush(st)
+
 static void pushbyte(MarshalState *st, uint8_t b) {
     janet_buffer_push_u8(st->buf, b);
+    MARSHAL_CHECK_FLUSH(st);
 }
 
 static void pushbytes(MarshalState *st, const uint8_t *bytes, int32_t len) {
+    if (st->file && len >= JANET_MARSHAL_CHUNK) {
+        /* Write large strings and buffers without copying them */
+        marshal_flush(st);
+        marshal_write_chunk(st, bytes, len);
+        return;
+    }
     janet_buffer_push_bytes(st->buf, bytes, len);
+    MARSHAL_CHECK_FLUSH(st);
+}
+
+/* Marshal an integer onto the buffer as an unsigned LEB128 varint */
+static void pushint(MarshalState *st, int32_t x) {
+    uint32_t u = (uint32_t) x;
+    uint8_t intbuf[5];
+    int n = 0;
+    while (u >= 0x80) {
+        intbuf[n++] = (uint8_t)(u | 0x80);
+        u >>= 7;
+    }
+    intbuf[n++] = (uint8_t) u;
+    pushbytes(st, intbuf, n);
+}
+
+/* Marshal an integer where a lead byte could also be read. Small
+ * integers are one byte, others follow LB_INTEGER as a zigzag varint. */
+static void pushleadint(MarshalState *st, int32_t x) {
+    if (x >= 0 && x < 200) {
+        pushbyte(st, x);
+    } else {
+        pushbyte(st, LB_INTEGER);
+        pushint(st, (int32_t)(((uint32_t) x << 1) ^ (uint32_t)(x >> 31)));
+    }
+}
+
+static uint32_t seen_hash(const void *key, int32_t kind) {
+    uint64_t h = (uint64_t)(uintptr_t) key ^ (uint64_t)(uint32_t) kind;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (uint32_t) h;
+}
+
+/* Find the reference number of something already marshalled, or -1 */
+static int32_t seen_get(MarshalState *st, const void *key, int32_t kind) {
+    if (!st->seen_capacity) return -1;
+    uint32_t mask = (uint32_t) st->seen_capacity - 1;
+    for (uint32_t i = seen_hash(key, kind) & mask;; i = (i + 1) & mask) {
+        if (st->seen[i].key == key && st->seen[i].kind == kind) return st->seen[i].id;
+        if (NULL == st->seen[i].key) return -1;
+    }
+}
+
+static void seen_insert(MarshalSeen *seen, int32_t capacity, MarshalSeen entry) {
+    uint32_t mask = (uint32_t) capacity - 1;
+    uint32_t i = seen_hash(entry.key, entry.kind) & mask;
+    while (NULL != seen[i].key) i = (i + 1) & mask;
+    seen[i] = entry;
+}
+
+/* Record the reference number of a marshalled value. The set is kept
+ * at most half full. */
+static void seen_put(MarshalState *st, const void *key, int32_t kind, int32_t id) {
+    if (2 * (st->seen_count + 1) > st->seen_capacity) {
+        int32_t newcap = st->seen_capacity ? 2 * st->seen_capacity : 64;
+        MarshalSeen *newseen = calloc(newcap, sizeof(MarshalSeen));
+        if (NULL == newseen) {
+            JANET_OUT_OF_MEMORY;
+        }
+        for (int32_t i = 0; i < st->seen_capacity; i++)
+            if (NULL != st->seen[i].key)
+                seen_insert(newseen, newcap, st->seen[i]);
+        free(st->seen);
+        st->seen = newseen;
+        st->seen_capacity = newcap;
+    }
+    MarshalSeen entry;
+    entry.key = key;
+    entry.kind = kind;
+    entry.id = id;
+    seen_insert(st->seen, st->seen_capacity, entry);
+    st->seen_count++;
 }
 
 /* Forward declaration to enable mutual recursion. */
@@ -150,20 +283,20 @@ static void marshal_one(MarshalState *st, Janet x, int flags);
 static void marshal_one_fiber(MarshalState *st, JanetFiber *fiber, int flags);
 static void marshal_one_def(MarshalState *st, JanetFuncDef *def, int flags);
 static void marshal_one_env(MarshalState *st, JanetFuncEnv *env, int flags);
+static int unmarshal_lazy(JanetFuncDef *def);
 
 /* Marshal a function env */
 static void marshal_one_env(MarshalState *st, JanetFuncEnv *env, int flags) {
     if ((flags & 0xFFFF) > JANET_RECURSION_GUARD)
         longjmp(st->err, MR_STACKOVERFLOW);
-    for (int32_t i = 0; i < janet_v_count(st->seen_envs); i++) {
-        if (st->seen_envs[i] == env) {
-            pushbyte(st, LB_FUNCENV_REF);
-            pushint(st, i);
-            return;
-        }
+    int32_t id = seen_get(st, env, MARSHAL_SEEN_ENV);
+    if (id >= 0) {
+        pushbyte(st, LB_FUNCENV_REF);
+        pushint(st, id);
+        return;
     }
-    janet_v_push(st->seen_envs, env);
-    pushint(st, env->offset);
+    seen_put(st, env, MARSHAL_SEEN_ENV, st->nextenv++);
+    pushleadint(st, env->offset);
     pushint(st, env->length);
     if (env->offset) {
         /* On stack variant */
@@ -182,23 +315,25 @@ static void janet_func_addflags(JanetFuncDef *def) {
     if (def->defs) def->flags |= JANET_FUNCDEF_FLAG_HASDEFS;
     if (def->environments) def->flags |= JANET_FUNCDEF_FLAG_HASENVS;
     if (def->sourcemap) def->flags |= JANET_FUNCDEF_FLAG_HASSOURCEMAP;
+    if (def->handlers) def->flags |= JANET_FUNCDEF_FLAG_HASHANDLERS;
 }
 
 /* Marshal a function def */
 static void marshal_one_def(MarshalState *st, JanetFuncDef *def, int flags) {
     if ((flags & 0xFFFF) > JANET_RECURSION_GUARD)
         longjmp(st->err, MR_STACKOVERFLOW);
-    for (int32_t i = 0; i < janet_v_count(st->seen_defs); i++) {
-        if (st->seen_defs[i] == def) {
-            pushbyte(st, LB_FUNCDEF_REF);
-            pushint(st, i);
-            return;
-        }
+    int32_t id = seen_get(st, def, MARSHAL_SEEN_DEF);
+    if (id >= 0) {
+        pushbyte(st, LB_FUNCDEF_REF);
+        pushint(st, id);
+        return;
     }
+    if (def->lazy && unmarshal_lazy(def))
+        longjmp(st->err, MR_INVALID_BYTECODE);
     janet_func_addflags(def);
     /* Add to lookup */
-    janet_v_push(st->seen_defs, def);
-    pushint(st, def->flags);
+    seen_put(st, def, MARSHAL_SEEN_DEF, st->nextdef++);
+    pushleadint(st, def->flags);
     pushint(st, def->slotcount);
     pushint(st, def->arity);
     pushint(st, def->constants_length);
@@ -207,6 +342,8 @@ static void marshal_one_def(MarshalState *st, JanetFuncDef *def, int flags) {
         pushint(st, def->environments_length);
     if (def->flags & JANET_FUNCDEF_FLAG_HASDEFS)
         pushint(st, def->defs_length);
+    if (def->flags & JANET_FUNCDEF_FLAG_HASHANDLERS)
+        pushint(st, def->handlers_length);
     if (def->flags & JANET_FUNCDEF_FLAG_HASNAME)
         marshal_one(st, janet_wrap_string(def->name), flags);
     if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCE)
@@ -234,23 +371,40 @@ static void marshal_one_def(MarshalState *st, JanetFuncDef *def, int flags) {
 
     /* marshal source maps if needed */
     if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
-        for (int32_t i = 0; i < def->bytecode_length; i++) {
-            JanetSourceMapping map = def->sourcemap[i];
-            pushint(st, map.start);
-            pushint(st, map.end);
-        }
+        pushint(st, def->sourcemap_length);
+        pushbytes(st, def->sourcemap, def->sourcemap_length);
+    }
+
+    /* marshal error handlers if needed */
+    for (int32_t i = 0; i < def->handlers_length; i++) {
+        JanetHandler h = def->handlers[i];
+        pushint(st, h.start);
+        pushint(st, h.end);
+        pushint(st, h.target);
+        pushint(st, h.slot);
     }
 }
 
+#define JANET_FIBER_FLAG_HASQUOTA (1 << 28)
 #define JANET_FIBER_FLAG_HASCHILD (1 << 29)
 #define JANET_STACKFRAME_HASENV (1 << 30)
 
-/* Marshal a fiber */
+/* Push a size_t as two 32 bit halves */
+static void pushsize(MarshalState *st, size_t x) {
+    pushint(st, (int32_t)(uint32_t)((uint64_t) x & 0xFFFFFFFF));
+    pushint(st, (int32_t)(uint32_t)((uint64_t) x >> 32));
+}
+
+/* Marshal a fiber. Only suspended fibers can be marshalled - a fiber that
+ * is running, or is waiting on a fiber that is running, has live state in
+ * the C stack. */
 static void marshal_one_fiber(MarshalState *st, JanetFiber *fiber, int flags) {
     int32_t fflags = fiber->flags;
     if ((flags & 0xFFFF) > JANET_RECURSION_GUARD)
         longjmp(st->err, MR_STACKOVERFLOW);
     if (fiber->child) fflags |= JANET_FIBER_FLAG_HASCHILD;
+    if (fiber->budget || fiber->memquota || fiber->tickquota)
+        fflags |= JANET_FIBER_FLAG_HASQUOTA;
     if (janet_fiber_status(fiber) == JANET_STATUS_ALIVE)
         longjmp(st->err, MR_LIVEFIBER);
     pushint(st, fflags);
@@ -258,14 +412,22 @@ static void marshal_one_fiber(MarshalState *st, JanetFiber *fiber, int flags) {
     pushint(st, fiber->stackstart);
     pushint(st, fiber->stacktop);
     pushint(st, fiber->maxstack);
+    if (fflags & JANET_FIBER_FLAG_HASQUOTA) {
+        pushint(st, fiber->budget);
+        pushsize(st, fiber->memquota);
+        pushsize(st, fiber->memused);
+        pushsize(st, fiber->tickquota);
+        pushsize(st, fiber->tickused);
+    }
     /* Do frames */
     int32_t i = fiber->frame;
     int32_t j = fiber->stackstart - JANET_FRAME_SIZE;
     while (i > 0) {
         JanetStackFrame *frame = (JanetStackFrame *)(fiber->data + i - JANET_FRAME_SIZE);
-        if (frame->env) frame->flags |= JANET_STACKFRAME_HASENV;
+        int32_t frameflags = frame->flags;
+        if (frame->env) frameflags |= JANET_STACKFRAME_HASENV;
         if (!frame->func) longjmp(st->err, MR_C_STACKFRAME);
-        pushint(st, frame->flags);
+        pushint(st, frameflags);
         pushint(st, frame->prevframe);
         int32_t pcdiff = (int32_t)(frame->pc - frame->func->def->bytecode);
         pushint(st, pcdiff);
@@ -277,6 +439,9 @@ static void marshal_one_fiber(MarshalState *st, JanetFiber *fiber, int flags) {
         j = i - JANET_FRAME_SIZE;
         i = frame->prevframe;
     }
+    /* Marshal arguments pushed for the next call */
+    for (int32_t k = fiber->stackstart; k < fiber->stacktop; k++)
+        marshal_one(st, fiber->data[k], flags + 1);
     if (fiber->child)
         marshal_one(st, janet_wrap_fiber(fiber->child), flags + 1);
 }
@@ -303,7 +468,7 @@ static void marshal_one(MarshalState *st, Janet x, int flags) {
             {
                 double xval = janet_unwrap_number(x);
                 if (janet_checkintrange(xval)) {
-                    pushint(st, (int32_t) xval);
+                    pushleadint(st, (int32_t) xval);
                     goto done;
                 }
                 break;
@@ -311,18 +476,20 @@ static void marshal_one(MarshalState *st, Janet x, int flags) {
     }
 
 #define MARK_SEEN() \
-    janet_table_put(&st->seen, x, janet_wrap_integer(st->nextid++))
+    seen_put(st, janet_unwrap_pointer(x), type, st->nextid++)
 
     /* Check reference and registry value */
-    {
-        Janet check = janet_table_get(&st->seen, x);
-        if (janet_checkint(check)) {
+    if (type != JANET_NUMBER) {
+        int32_t id = seen_get(st, janet_unwrap_pointer(x), type);
+        if (id >= 0) {
             pushbyte(st, LB_REFERENCE);
-            pushint(st, janet_unwrap_integer(check));
+            pushint(st, id);
             goto done;
         }
+    }
+    {
         if (st->rreg) {
-            check = janet_table_get(st->rreg, x);
+            Janet check = janet_table_get(st->rreg, x);
             if (janet_checktype(check, JANET_SYMBOL)) {
                 MARK_SEEN();
                 const uint8_t *regname = janet_unwrap_symbol(check);
@@ -338,22 +505,37 @@ static void marshal_one(MarshalState *st, Janet x, int flags) {
     switch (type) {
         case JANET_NUMBER:
             {
-                union {
-                    double d;
-                    uint8_t bytes[8];
-                } u;
-                u.d = janet_unwrap_number(x);
+                /* Reals are not references, as they are no larger */
+                double d = janet_unwrap_number(x);
+                float f = (float) d;
+                if ((double) f == d) {
+                    uint32_t bits;
+                    memcpy(&bits, &f, sizeof(bits));
+                    uint8_t bytes[5] = {
+                        LB_REAL32,
+                        bits & 0xFF,
+                        (bits >> 8) & 0xFF,
+                        (bits >> 16) & 0xFF,
+                        (bits >> 24) & 0xFF
+                    };
+                    pushbytes(st, bytes, 5);
+                } else {
+                    union {
+                        double d;
+                        uint8_t bytes[8];
+                    } u;
+                    u.d = d;
 #ifdef JANET_BIG_ENDIAN
-                /* Swap byte order */
-                uint8_t temp;
-                temp = u.bytes[7]; u.bytes[7] = u.bytes[0]; u.bytes[0] = temp;
-                temp = u.bytes[6]; u.bytes[6] = u.bytes[1]; u.bytes[1] = temp;
-                temp = u.bytes[5]; u.bytes[5] = u.bytes[2]; u.bytes[2] = temp;
-                temp = u.bytes[4]; u.bytes[4] = u.bytes[3]; u.bytes[3] = temp;
+                    /* Swap byte order */
+                    uint8_t temp;
+                    temp = u.bytes[7]; u.bytes[7] = u.bytes[0]; u.bytes[0] = temp;
+                    temp = u.bytes[6]; u.bytes[6] = u.bytes[1]; u.bytes[1] = temp;
+                    temp = u.bytes[5]; u.bytes[5] = u.bytes[2]; u.bytes[2] = temp;
+                    temp = u.bytes[4]; u.bytes[4] = u.bytes[3]; u.bytes[3] = temp;
 #endif
-                pushbyte(st, LB_REAL);
-                pushbytes(st, u.bytes, 8);
-                MARK_SEEN();
+                    pushbyte(st, LB_REAL);
+                    pushbytes(st, u.bytes, 8);
+                }
             }
             goto done;
         case JANET_STRING:
@@ -440,6 +622,18 @@ static void marshal_one(MarshalState *st, Janet x, int flags) {
             }
             goto done;
         case JANET_ABSTRACT:
+            {
+                void *abst = janet_unwrap_abstract(x);
+                const JanetAbstractType *at = janet_abstract_type(abst);
+                if (!at->marshal) goto noregval;
+                pushbyte(st, LB_ABSTRACT);
+                marshal_one(st, janet_ckeywordv(at->name), flags + 1);
+                /* Mark seen before the contents, which may refer back */
+                MARK_SEEN();
+                JanetMarshalContext context = {st, NULL, at, NULL, abst, flags + 1};
+                at->marshal(abst, &context);
+            }
+            goto done;
         case JANET_CFUNCTION:
             goto noregval;
         case JANET_FUNCTION:
@@ -479,8 +673,9 @@ noregval:
     longjmp(st->err, MR_NRV);
 }
 
-int janet_marshal(
+static int marshal_to(
         JanetBuffer *buf,
+        FILE *file,
         Janet x,
         Janet *errval,
         JanetTable *rreg,
@@ -488,22 +683,88 @@ int janet_marshal(
     int status;
     MarshalState st;
     st.buf = buf;
+    st.file = file;
     st.nextid = 0;
-    st.seen_defs = NULL;
-    st.seen_envs = NULL;
+    st.nextenv = 0;
+    st.nextdef = 0;
+    st.seen = NULL;
+    st.seen_count = 0;
+    st.seen_capacity = 0;
     st.rreg = rreg;
     st.current = x;
-    janet_table_init(&st.seen, 0);
-    if (!(status = setjmp(st.err)))
+    if (!(status = setjmp(st.err))) {
+        pushbyte(&st, LB_VERSION);
+        pushbyte(&st, JANET_MARSHAL_VERSION);
         marshal_one(&st, x, flags);
+        if (file) {
+            marshal_flush(&st);
+            marshal_write_chunk(&st, NULL, 0);
+        }
+    }
     if (status && errval)
         *errval = st.current;
-    janet_table_deinit(&st.seen);
-    janet_v_free(st.seen_envs);
-    janet_v_free(st.seen_defs);
+    free(st.seen);
+    return status;
+}
+
+/* With JANET_MARSHAL_COMPRESS, the image is written as LB_COMPRESSED,
+ * the length of the compressed data as 4 little endian bytes, and the
+ * output of janet_buffer_compress. */
+int janet_marshal(
+        JanetBuffer *buf,
+        Janet x,
+        Janet *errval,
+        JanetTable *rreg,
+        int flags) {
+    if (!(flags & JANET_MARSHAL_COMPRESS))
+        return marshal_to(buf, NULL, x, errval, rreg, flags);
+    JanetBuffer image;
+    janet_buffer_init(&image, 64);
+    int status = marshal_to(&image, NULL, x, errval, rreg, flags & ~JANET_MARSHAL_COMPRESS);
+    if (!status) {
+        janet_buffer_push_u8(buf, LB_COMPRESSED);
+        janet_buffer_push_u32(buf, 0);
+        int32_t start = buf->count;
+        janet_buffer_compress(buf, image.data, image.count);
+        uint32_t clen = (uint32_t)(buf->count - start);
+        buf->data[start - 4] = clen & 0xFF;
+        buf->data[start - 3] = (clen >> 8) & 0xFF;
+        buf->data[start - 2] = (clen >> 16) & 0xFF;
+        buf->data[start - 1] = (clen >> 24) & 0xFF;
+    }
+    janet_buffer_deinit(&image);
     return status;
 }
 
+/* Marshal a value to a file without building the whole image in
+ * memory. The output can only be read with janet_unmarshal_file. */
+int janet_marshal_file(
+        FILE *file,
+        Janet x,
+        Janet *errval,
+        JanetTable *rreg,
+        int flags) {
+    JanetBuffer buf;
+    janet_buffer_init(&buf, JANET_MARSHAL_CHUNK + 16);
+    int status = marshal_to(&buf, file, x, errval, rreg, flags);
+    janet_buffer_deinit(&buf);
+    return status;
+}
+
+/* Marshalling functions for the hooks of abstract types */
+
+void janet_marshal_int(JanetMarshalContext *ctx, int32_t value) {
+    pushint((MarshalState *)(ctx->m_state), value);
+}
+
+void janet_marshal_bytes(JanetMarshalContext *ctx, const uint8_t *bytes, int32_t len) {
+    pushbytes((MarshalState *)(ctx->m_state), bytes, len);
+}
+
+void janet_marshal_janet(JanetMarshalContext *ctx, Janet x) {
+    marshal_one((MarshalState *)(ctx->m_state), x, ctx->flags);
+}
+
 typedef struct {
     jmp_buf err;
     JanetArray lookup;
@@ -511,6 +772,12 @@ typedef struct {
     JanetFuncEnv **lookup_envs;
     JanetFuncDef **lookup_defs;
     const uint8_t *end;
+    Janet image;
+    int32_t version;
+    FILE *file;
+    uint8_t *window;
+    size_t window_capacity;
+    uint32_t chunk_left;
 } UnmarshalState;
 
 enum {
@@ -524,7 +791,11 @@ enum {
     UMR_EXPECTED_STRING,
     UMR_INVALID_REFERENCE,
     UMR_INVALID_BYTECODE,
-    UMR_INVALID_FIBER
+    UMR_INVALID_FIBER,
+    UMR_IO,
+    UMR_UNKNOWN_ABSTRACT,
+    UMR_INVALID_ABSTRACT,
+    UMR_COMPRESSED
 } UnmarshalResult;
 
 const char *umr_strings[] = {
@@ -538,18 +809,95 @@ const char *umr_strings[] = {
     "expected string",
     "invalid reference",
     "invalid bytecode",
-    "invalid fiber"
+    "invalid fiber",
+    "could not read file",
+    "unknown abstract type",
+    "invalid abstract",
+    "invalid compressed image"
 };
 
-/* Helper to read a 32 bit integer from an unmarshal state */
-static int32_t readint(UnmarshalState *st, const uint8_t **atdata) {
+/* Read the length of the next chunk of a marshalled file */
+static uint32_t unmarshal_chunk_length(UnmarshalState *st) {
+    uint32_t ret = 0;
+    for (int shift = 0;; shift += 7) {
+        int c = fgetc(st->file);
+        if (c == EOF) longjmp(st->err, ferror(st->file) ? UMR_IO : UMR_EOS);
+        if (shift > 28) longjmp(st->err, UMR_EXPECTED_INTEGER);
+        ret |= (uint32_t)(c & 0x7F) << shift;
+        if (!(c & 0x80)) break;
+    }
+    return ret;
+}
+
+/* Make n bytes readable at data. Only a file can be refilled; the
+ * unread bytes are moved to the front of the window and more chunks
+ * are read after them. Returns the new position of data. */
+static const uint8_t *unmarshal_refill(UnmarshalState *st, const uint8_t *data, size_t n) {
+    if (!st->file) longjmp(st->err, UMR_EOS);
+    size_t have = (size_t)(st->end - data);
+    if (n > st->window_capacity) {
+        size_t newcap = 2 * st->window_capacity;
+        if (newcap < n) newcap = n;
+        uint8_t *newwindow = malloc(newcap);
+        if (!newwindow) {
+            JANET_OUT_OF_MEMORY;
+        }
+        if (have) memcpy(newwindow, data, have);
+        free(st->window);
+        st->window = newwindow;
+        st->window_capacity = newcap;
+    } else if (have) {
+        memmove(st->window, data, have);
+    }
+    while (have < n) {
+        if (!st->chunk_left) {
+            st->chunk_left = unmarshal_chunk_length(st);
+            /* An empty chunk ends the value */
+            if (!st->chunk_left) longjmp(st->err, UMR_EOS);
+        }
+        size_t want = st->window_capacity - have;
+        if (want > st->chunk_left) want = st->chunk_left;
+        size_t got = fread(st->window + have, 1, want, st->file);
+        if (!got) longjmp(st->err, ferror(st->file) ? UMR_IO : UMR_EOS);
+        have += got;
+        st->chunk_left -= (uint32_t) got;
+    }
+    st->end = st->window + have;
+    return st->window;
+}
+
+/* Make sure n more bytes can be read at data */
+#define UNMARSHAL_NEED(st, data, n) \
+    if ((size_t)((st)->end - (data)) < (size_t)(n)) (data) = unmarshal_refill((st), (data), (n))
+
+/* Read an unsigned LEB128 varint */
+static uint32_t readvarint(UnmarshalState *st, const uint8_t **atdata) {
+    const uint8_t *data = *atdata;
+    uint32_t ret = 0;
+    for (int shift = 0;; shift += 7) {
+        UNMARSHAL_NEED(st, data, 1);
+        if (shift > 28) longjmp(st->err, UMR_EXPECTED_INTEGER);
+        uint8_t b = *data++;
+        ret |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    *atdata = data;
+    return ret;
+}
+
+/* Read an integer written where a lead byte could also be */
+static int32_t readleadint(UnmarshalState *st, const uint8_t **atdata) {
     const uint8_t *data = *atdata;
     int32_t ret;
-    if (data >= st->end) longjmp(st->err, UMR_EOS);
+    UNMARSHAL_NEED(st, data, 1);
     if (*data < 200) {
         ret = *data++;
+    } else if (*data == LB_INTEGER && st->version >= 2) {
+        data++;
+        uint32_t u = readvarint(st, &data);
+        ret = (int32_t)((u >> 1) ^ (0 - (u & 1)));
     } else if (*data == LB_INTEGER) {
-        if (data + 5 > st->end) longjmp(st->err, UMR_EOS);
+        UNMARSHAL_NEED(st, data, 5);
         ret = (data[1]) |
             (data[2] << 8) |
             (data[3] << 16) |
@@ -562,6 +910,20 @@ static int32_t readint(UnmarshalState *st, const uint8_t **atdata) {
     return ret;
 }
 
+/* Helper to read a 32 bit integer from an unmarshal state */
+static int32_t readint(UnmarshalState *st, const uint8_t **atdata) {
+    if (st->version >= 2) return (int32_t) readvarint(st, atdata);
+    return readleadint(st, atdata);
+}
+
+/* Read a size_t written as two 32 bit halves */
+static size_t readsize(UnmarshalState *st, const uint8_t **atdata) {
+    uint64_t lo = (uint32_t) readint(st, atdata);
+    uint64_t hi = (uint32_t) readint(st, atdata);
+    if (hi && sizeof(size_t) < sizeof(uint64_t)) longjmp(st->err, UMR_INVALID_FIBER);
+    return (size_t)(lo | (hi << 32));
+}
+
 /* Forward declarations for mutual recursion */
 static const uint8_t *unmarshal_one(
         UnmarshalState *st,
@@ -590,8 +952,7 @@ static const uint8_t *unmarshal_one_env(
         const uint8_t *data,
         JanetFuncEnv **out,
         int flags) {
-    const uint8_t *end = st->end;
-    if (data >= end) longjmp(st->err, UMR_EOS);
+    UNMARSHAL_NEED(st, data, 1);
     if (*data == LB_FUNCENV_REF) {
         data++;
         int32_t index = readint(st, &data);
@@ -602,20 +963,27 @@ static const uint8_t *unmarshal_one_env(
         JanetFuncEnv *env = janet_gcalloc(JANET_MEMORY_FUNCENV, sizeof(JanetFuncEnv));
         env->length = 0;
         env->offset = 0;
+        env->as.values = NULL;
         janet_v_push(st->lookup_envs, env);
-        int32_t offset = readint(st, &data);
+        int32_t offset = readleadint(st, &data);
         int32_t length = readint(st, &data);
         if (offset) {
             Janet fiberv;
-            /* On stack variant */
+            /* On stack variant. Set the offset first so the env is never
+             * freed as an off stack env if unmarshalling fails. */
+            env->offset = offset;
             data = unmarshal_one(st, data, &fiberv, flags);
             if (!janet_checktype(fiberv, JANET_FIBER)) longjmp(st->err, UMR_EXPECTED_FIBER);
             env->as.fiber = janet_unwrap_fiber(fiberv);
             /* Unmarshalling fiber may set values */
-            if (env->offset != 0 && env->offset != offset) longjmp(st->err, UMR_UNKNOWN);
+            if (env->offset != offset) longjmp(st->err, UMR_UNKNOWN);
             if (env->length != 0 && env->length != length) longjmp(st->err, UMR_UNKNOWN);
+            if (offset < (int32_t) JANET_FRAME_SIZE || length < 0 ||
+                    length > env->as.fiber->stackstart - offset)
+                longjmp(st->err, UMR_UNKNOWN);
         } else {
             /* Off stack variant */
+            if (length < 0) longjmp(st->err, UMR_UNKNOWN);
             env->as.values = malloc(sizeof(Janet) * length);
             if (!env->as.values) {
                 JANET_OUT_OF_MEMORY;
@@ -630,14 +998,131 @@ static const uint8_t *unmarshal_one_env(
     return data;
 }
 
+/* Read the bytecode of a funcdef */
+static const uint8_t *unmarshal_bytecode(
+        UnmarshalState *st,
+        const uint8_t *data,
+        JanetFuncDef *def,
+        int32_t bytecode_length) {
+    def->bytecode = malloc(sizeof(uint32_t) * bytecode_length);
+    if (!def->bytecode) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (int32_t i = 0; i < bytecode_length; i++) {
+        UNMARSHAL_NEED(st, data, 4);
+        def->bytecode[i] =
+            (uint32_t)(data[0]) |
+            ((uint32_t)(data[1]) << 8) |
+            ((uint32_t)(data[2]) << 16) |
+            ((uint32_t)(data[3]) << 24);
+        data += 4;
+    }
+    return data;
+}
+
+/* Read the source map of a funcdef. Before version 3 it is a pair of
+ * integers per instruction, which is encoded as it is read. */
+static const uint8_t *unmarshal_sourcemap(
+        UnmarshalState *st,
+        const uint8_t *data,
+        JanetFuncDef *def) {
+    if (st->version >= 3) {
+        int32_t len = readint(st, &data);
+        if (len < 0) longjmp(st->err, UMR_UNKNOWN);
+        UNMARSHAL_NEED(st, data, len);
+        if (janet_sourcemap_check(data, len, def->bytecode_length))
+            longjmp(st->err, UMR_UNKNOWN);
+        def->sourcemap = malloc(len ? len : 1);
+        if (!def->sourcemap) {
+            JANET_OUT_OF_MEMORY;
+        }
+        memcpy(def->sourcemap, data, len);
+        def->sourcemap_length = len;
+        return data + len;
+    }
+    JanetSourceMapping *map = malloc(sizeof(JanetSourceMapping) * (def->bytecode_length + 1));
+    if (!map) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (int32_t i = 0; i < def->bytecode_length; i++) {
+        map[i].start = readint(st, &data);
+        map[i].end = readint(st, &data);
+    }
+    def->sourcemap = janet_sourcemap_encode(map, def->bytecode_length, &def->sourcemap_length);
+    free(map);
+    return data;
+}
+
+/* Unmarshalling functions for the hooks of abstract types */
+
+int32_t janet_unmarshal_int(JanetMarshalContext *ctx) {
+    return readint((UnmarshalState *)(ctx->u_state), &(ctx->data));
+}
+
+void janet_unmarshal_bytes(JanetMarshalContext *ctx, uint8_t *dest, int32_t len) {
+    UnmarshalState *st = (UnmarshalState *)(ctx->u_state);
+    if (len < 0) longjmp(st->err, UMR_INVALID_ABSTRACT);
+    UNMARSHAL_NEED(st, ctx->data, len);
+    memcpy(dest, ctx->data, len);
+    ctx->data += len;
+}
+
+Janet janet_unmarshal_janet(JanetMarshalContext *ctx) {
+    Janet ret;
+    ctx->data = unmarshal_one((UnmarshalState *)(ctx->u_state), ctx->data, &ret, ctx->flags);
+    return ret;
+}
+
+/* Create the value being unmarshalled. It is numbered for references
+ * before its contents are read, so they can refer back to it. */
+void *janet_unmarshal_abstract(JanetMarshalContext *ctx, size_t size) {
+    UnmarshalState *st = (UnmarshalState *)(ctx->u_state);
+    if (ctx->abstract) longjmp(st->err, UMR_INVALID_ABSTRACT);
+    ctx->abstract = janet_abstract(ctx->at, size);
+    janet_array_push(&st->lookup, janet_wrap_abstract(ctx->abstract));
+    return ctx->abstract;
+}
+
+/* Decode the code of a lazily unmarshalled funcdef. Returns
+ * non-zero if the code is invalid. */
+static int unmarshal_lazy(JanetFuncDef *def) {
+    int status;
+    JanetLazyCode *lazy = def->lazy;
+    UnmarshalState st;
+    st.end = lazy->end;
+    st.file = NULL;
+    st.version = lazy->version;
+    if (!(status = setjmp(st.err))) {
+        unmarshal_bytecode(&st, lazy->bytecode, def, def->bytecode_length);
+        if (lazy->sourcemap)
+            unmarshal_sourcemap(&st, lazy->sourcemap, def);
+        if (janet_verify(def)) status = UMR_INVALID_BYTECODE;
+    }
+    if (status) {
+        free(def->bytecode);
+        free(def->sourcemap);
+        def->bytecode = NULL;
+        def->sourcemap = NULL;
+        def->sourcemap_length = 0;
+    } else {
+        def->lazy = NULL;
+        free(lazy);
+    }
+    return status;
+}
+
+void janet_funcdef_load(JanetFuncDef *def) {
+    if (def->lazy && unmarshal_lazy(def))
+        janet_panic("invalid bytecode");
+}
+
 /* Unmarshal a funcdef */
 static const uint8_t *unmarshal_one_def(
         UnmarshalState *st,
         const uint8_t *data,
         JanetFuncDef **out,
         int flags) {
-    const uint8_t *end = st->end;
-    if (data >= end) longjmp(st->err, UMR_EOS);
+    UNMARSHAL_NEED(st, data, 1);
     if (*data == LB_FUNCDEF_REF) {
         data++;
         int32_t index = readint(st, &data);
@@ -652,8 +1137,17 @@ static const uint8_t *unmarshal_one_def(
         def->defs_length = 0;
         def->constants_length = 0;
         def->bytecode_length = 0;
+        def->handlers_length = 0;
+        def->handlers = NULL;
+        def->bytecode = NULL;
+        def->sourcemap = NULL;
+        def->sourcemap_length = 0;
+        def->environments = NULL;
+        def->constants = NULL;
+        def->defs = NULL;
         def->name = NULL;
         def->source = NULL;
+        def->lazy = NULL;
         janet_v_push(st->lookup_defs, def);
 
         /* Set default lengths to zero */
@@ -661,9 +1155,10 @@ static const uint8_t *unmarshal_one_def(
         int32_t constants_length = 0;
         int32_t environments_length = 0;
         int32_t defs_length = 0;
+        int32_t handlers_length = 0;
 
         /* Read flags and other fixed values */
-        def->flags = readint(st, &data);
+        def->flags = readleadint(st, &data);
         def->slotcount = readint(st, &data);
         def->arity = readint(st, &data);
 
@@ -674,6 +1169,8 @@ static const uint8_t *unmarshal_one_def(
             environments_length = readint(st, &data);
         if (def->flags & JANET_FUNCDEF_FLAG_HASDEFS)
             defs_length = readint(st, &data);
+        if (def->flags & JANET_FUNCDEF_FLAG_HASHANDLERS)
+            handlers_length = readint(st, &data);
 
         /* Check name and source (optional) */
         if (def->flags & JANET_FUNCDEF_FLAG_HASNAME) {
@@ -702,19 +1199,22 @@ static const uint8_t *unmarshal_one_def(
         }
         def->constants_length = constants_length;
 
-        /* Unmarshal bytecode */
-        def->bytecode = malloc(sizeof(uint32_t) * bytecode_length);
-        if (!def->bytecode) {
-            JANET_OUT_OF_MEMORY;
-        }
-        for (int32_t i = 0; i < bytecode_length; i++) {
-            if (data + 4 > end) longjmp(st->err, UMR_EOS);
-            def->bytecode[i] =
-                (uint32_t)(data[0]) |
-                ((uint32_t)(data[1]) << 8) |
-                ((uint32_t)(data[2]) << 16) |
-                ((uint32_t)(data[3]) << 24);
-            data += 4;
+        /* Unmarshal bytecode, or only note where it is in a lazy image */
+        if (flags & JANET_MARSHAL_LAZY) {
+            if (bytecode_length < 0 || bytecode_length > (st->end - data) / 4)
+                longjmp(st->err, UMR_EOS);
+            def->lazy = malloc(sizeof(JanetLazyCode));
+            if (!def->lazy) {
+                JANET_OUT_OF_MEMORY;
+            }
+            def->lazy->bytecode = data;
+            def->lazy->sourcemap = NULL;
+            def->lazy->end = st->end;
+            def->lazy->image = st->image;
+            def->lazy->version = st->version;
+            data += 4 * bytecode_length;
+        } else {
+            data = unmarshal_bytecode(st, data, def, bytecode_length);
         }
         def->bytecode_length = bytecode_length;
 
@@ -746,22 +1246,41 @@ static const uint8_t *unmarshal_one_def(
         }
         def->defs_length = defs_length;
 
-        /* Unmarshal source maps if needed */
+        /* Unmarshal source maps if needed. A lazy def only skips them. */
+        def->sourcemap = NULL;
         if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
-            def->sourcemap = malloc(sizeof(JanetSourceMapping) * bytecode_length);
-            if (!def->sourcemap) {
+            if (def->lazy && st->version >= 3) {
+                def->lazy->sourcemap = data;
+                int32_t len = readint(st, &data);
+                if (len < 0) longjmp(st->err, UMR_UNKNOWN);
+                UNMARSHAL_NEED(st, data, len);
+                data += len;
+            } else if (def->lazy) {
+                def->lazy->sourcemap = data;
+                for (int32_t i = 0; i < 2 * bytecode_length; i++)
+                    readint(st, &data);
+            } else {
+                data = unmarshal_sourcemap(st, data, def);
+            }
+        }
+
+        /* Unmarshal error handlers if needed */
+        if (def->flags & JANET_FUNCDEF_FLAG_HASHANDLERS) {
+            def->handlers = malloc(sizeof(JanetHandler) * handlers_length);
+            if (!def->handlers) {
                 JANET_OUT_OF_MEMORY;
             }
-            for (int32_t i = 0; i < bytecode_length; i++) {
-                def->sourcemap[i].start = readint(st, &data);
-                def->sourcemap[i].end = readint(st, &data);
+            for (int32_t i = 0; i < handlers_length; i++) {
+                def->handlers[i].start = readint(st, &data);
+                def->handlers[i].end = readint(st, &data);
+                def->handlers[i].target = readint(st, &data);
+                def->handlers[i].slot = readint(st, &data);
             }
-        } else {
-            def->sourcemap = NULL;
+            def->handlers_length = handlers_length;
         }
 
-        /* Validate */
-        if (janet_verify(def)) longjmp(st->err, UMR_INVALID_BYTECODE);
+        /* Validate. Lazy defs are validated when their code is decoded. */
+        if (!def->lazy && janet_verify(def)) longjmp(st->err, UMR_INVALID_BYTECODE);
 
         /* Set def */
         *out = def;
@@ -784,8 +1303,17 @@ static const uint8_t *unmarshal_one_fiber(
     fiber->stacktop = 0;
     fiber->capacity = 0;
     fiber->maxstack = 0;
+    fiber->budget = 0;
+    fiber->ticks = 0;
+    fiber->resumer = NULL;
+    fiber->quotaparent = NULL;
+    fiber->memquota = 0;
+    fiber->memused = 0;
+    fiber->tickquota = 0;
+    fiber->tickused = 0;
     fiber->data = NULL;
     fiber->child = NULL;
+    janet_array_push(&st->lookup, janet_wrap_fiber(fiber));
 
     /* Set frame later so fiber can be GCed at anytime if unmarshalling fails */
     int32_t frame = 0;
@@ -798,9 +1326,25 @@ static const uint8_t *unmarshal_one_fiber(
     fiber->stackstart = readint(st, &data);
     fiber->stacktop = readint(st, &data);
     fiber->maxstack = readint(st, &data);
+    if (fiber->flags & JANET_FIBER_FLAG_HASQUOTA) {
+        fiber->flags &= ~JANET_FIBER_FLAG_HASQUOTA;
+        fiber->budget = readint(st, &data);
+        fiber->memquota = readsize(st, &data);
+        fiber->memused = readsize(st, &data);
+        fiber->tickquota = readsize(st, &data);
+        fiber->tickused = readsize(st, &data);
+        fiber->ticks = fiber->budget;
+        if (fiber->budget < 0) goto error;
+    }
+
+    /* Before version 3 there was no interrupted status, and new was one lower */
+    if (st->version < 3 && janet_fiber_status(fiber) == JANET_STATUS_INTERRUPTED)
+        janet_fiber_set_status(fiber, JANET_STATUS_NEW);
 
     /* Check for bad flags and ints */
-    if ((int32_t)(frame + JANET_FRAME_SIZE) > fiber->stackstart ||
+    if (janet_fiber_status(fiber) >= JANET_STATUS_ALIVE ||
+            frame < 0 ||
+            (int32_t)(frame + JANET_FRAME_SIZE) > fiber->stackstart ||
             fiber->stackstart > fiber->stacktop ||
             fiber->stacktop > fiber->maxstack) {
         goto error;
@@ -812,6 +1356,8 @@ static const uint8_t *unmarshal_one_fiber(
     if (!fiber->data) {
         JANET_OUT_OF_MEMORY;
     }
+    for (int32_t i = 0; i < fiber->capacity; i++)
+        fiber->data[i] = janet_wrap_nil();
 
     /* get frames */
     stack = frame;
@@ -825,6 +1371,7 @@ static const uint8_t *unmarshal_one_fiber(
         int32_t pcdiff = readint(st, &data);
 
         /* Get frame items */
+        if (stack < (int32_t) JANET_FRAME_SIZE) goto error;
         Janet *framestack = fiber->data + stack;
         JanetStackFrame *framep = janet_stack_frame(framestack);
 
@@ -836,28 +1383,33 @@ static const uint8_t *unmarshal_one_fiber(
         }
         func = janet_unwrap_function(funcv);
         def = func->def;
+        if (def->lazy && unmarshal_lazy(def)) goto error;
 
         /* Check env */
         if (frameflags & JANET_STACKFRAME_HASENV) {
             frameflags &= ~JANET_STACKFRAME_HASENV;
-            int32_t offset = stack;
-            int32_t length = stacktop - stack;
             data = unmarshal_one_env(st, data, &env, flags + 1);
-            if (env->offset != 0 && env->offset != offset) goto error;
-            if (env->length != 0 && env->length != offset) goto error;
-            env->offset = offset;
-            env->length = length;
+            if (env->offset != 0 && env->offset != stack) goto error;
+            if (env->length != 0 && env->length != def->slotcount) goto error;
+            env->offset = stack;
+            env->length = def->slotcount;
         }
 
-        /* Error checking */
-        int32_t expected_framesize = def->slotcount;
-        if (expected_framesize != stacktop - stack) goto error;
+        /* Error checking. Functions that keep varargs on the stack have
+         * extra slots after their own, counted in the rest parameter. */
+        int32_t extra = stacktop - stack - def->slotcount;
+        if (extra < 0) goto error;
+        if (extra > 0 && !(def->flags & JANET_FUNCDEF_FLAG_STACKARGS)) goto error;
         if (pcdiff < 0 || pcdiff >= def->bytecode_length) goto error;
         if ((int32_t)(prevframe + JANET_FRAME_SIZE) > stack) goto error;
 
         /* Get stack items */
         for (int32_t i = stack; i < stacktop; i++)
             data = unmarshal_one(st, data, fiber->data + i, flags + 1);
+        if (def->flags & JANET_FUNCDEF_FLAG_STACKARGS) {
+            Janet n = fiber->data[stack + def->arity];
+            if (!janet_checkint(n) || janet_unwrap_integer(n) != extra) goto error;
+        }
 
         /* Set frame */
         framep->env = env;
@@ -872,6 +1424,10 @@ static const uint8_t *unmarshal_one_fiber(
     }
     if (stack < 0) goto error;
 
+    /* Get arguments pushed for the next call */
+    for (int32_t i = fiber->stackstart; i < fiber->stacktop; i++)
+        data = unmarshal_one(st, data, fiber->data + i, flags + 1);
+
     /* Check for child fiber */
     if (fiber->flags & JANET_FIBER_FLAG_HASCHILD) {
         Janet fiberv;
@@ -896,12 +1452,11 @@ static const uint8_t *unmarshal_one(
         const uint8_t *data,
         Janet *out,
         int flags) {
-    const uint8_t *end = st->end;
     uint8_t lead;
     if ((flags & 0xFFFF) > JANET_RECURSION_GUARD) {
         longjmp(st->err, UMR_STACKOVERFLOW);
     }
-#define EXTRA(N) if (data + N > end) longjmp(st->err, UMR_EOS)
+#define EXTRA(N) UNMARSHAL_NEED(st, data, N)
     EXTRA(1);
     lead = data[0];
     if (lead < 200) {
@@ -920,13 +1475,21 @@ static const uint8_t *unmarshal_one(
             return data + 1;
         case LB_INTEGER:
             /* Long integer */
-            EXTRA(5);
-            *out = janet_wrap_integer(
-                    (data[1]) |
-                    (data[2] << 8) |
-                    (data[3] << 16) |
-                    (data[4] << 24));
-            return data + 5;
+            *out = janet_wrap_integer(readleadint(st, &data));
+            return data;
+        case LB_REAL32:
+            {
+                float f;
+                uint32_t bits;
+                EXTRA(5);
+                bits = (uint32_t)(data[1]) |
+                    ((uint32_t)(data[2]) << 8) |
+                    ((uint32_t)(data[3]) << 16) |
+                    ((uint32_t)(data[4]) << 24);
+                memcpy(&f, &bits, sizeof(f));
+                *out = janet_wrap_number((double) f);
+                return data + 5;
+            }
         case LB_REAL:
             /* Real */
             {
@@ -939,7 +1502,7 @@ static const uint8_t *unmarshal_one(
                 u.bytes[0] = data[8];
                 u.bytes[1] = data[7];
                 u.bytes[2] = data[6];
-                u.bytes[5] = data[5];
+                u.bytes[3] = data[5];
                 u.bytes[4] = data[4];
                 u.bytes[5] = data[3];
                 u.bytes[6] = data[2];
@@ -948,7 +1511,7 @@ static const uint8_t *unmarshal_one(
                 memcpy(&u.bytes, data + 1, sizeof(double));
 #endif
                 *out = janet_wrap_number(u.d);
-                janet_array_push(&st->lookup, *out);
+                if (st->version < 2) janet_array_push(&st->lookup, *out);
                 return data + 9;
             }
         case LB_STRING:
@@ -959,6 +1522,7 @@ static const uint8_t *unmarshal_one(
             {
                 data++;
                 int32_t len = readint(st, &data);
+                if (len < 0) longjmp(st->err, UMR_EOS);
                 EXTRA(len);
                 if (lead == LB_STRING) {
                     const uint8_t *str = janet_string(data, len);
@@ -985,6 +1549,19 @@ static const uint8_t *unmarshal_one(
                 janet_array_push(&st->lookup, *out);
                 return data + len;
             }
+        case LB_ABSTRACT:
+            {
+                Janet name;
+                data = unmarshal_one(st, data + 1, &name, flags + 1);
+                if (!janet_checktype(name, JANET_KEYWORD)) longjmp(st->err, UMR_UNKNOWN_ABSTRACT);
+                const JanetAbstractType *at = janet_get_abstract_type(janet_unwrap_keyword(name));
+                if (!at || !at->unmarshal) longjmp(st->err, UMR_UNKNOWN_ABSTRACT);
+                JanetMarshalContext context = {NULL, st, at, data, NULL, flags + 1};
+                void *abst = at->unmarshal(&context);
+                if (!abst || abst != context.abstract) longjmp(st->err, UMR_INVALID_ABSTRACT);
+                *out = janet_wrap_abstract(abst);
+                return context.data;
+            }
         case LB_FIBER:
             {
                 JanetFiber *fiber;
@@ -1017,6 +1594,7 @@ static const uint8_t *unmarshal_one(
             {
                 data++;
                 int32_t len = readint(st, &data);
+                if (len < 0) longjmp(st->err, UMR_UNKNOWN);
                 if (lead == LB_ARRAY) {
                     /* Array */
                     JanetArray *array = janet_array(len);
@@ -1076,23 +1654,48 @@ static const uint8_t *unmarshal_one(
 #undef EXTRA
 }
 
-int janet_unmarshal(
+static int unmarshal_image(
         const uint8_t *bytes,
         size_t len,
         int flags,
         Janet *out,
         JanetTable *reg,
-        const uint8_t **next) {
+        const uint8_t **next,
+        Janet image) {
     int status;
+    if (len >= 1 && bytes[0] == LB_COMPRESSED) {
+        /* Decompress the whole image first. Lazily decoded functions
+         * keep the decompressed image alive instead of the original. */
+        if (len < 5) return UMR_COMPRESSED;
+        uint32_t clen = (uint32_t) bytes[1] |
+                        ((uint32_t) bytes[2] << 8) |
+                        ((uint32_t) bytes[3] << 16) |
+                        ((uint32_t) bytes[4] << 24);
+        if (clen > INT32_MAX || clen > len - 5) return UMR_COMPRESSED;
+        JanetBuffer *raw = janet_buffer(0);
+        if (janet_buffer_decompress(raw, bytes + 5, (int32_t) clen) ||
+                (raw->count && raw->data[0] == LB_COMPRESSED))
+            return UMR_COMPRESSED;
+        status = unmarshal_image(raw->data, (size_t) raw->count, flags, out, reg, NULL,
+                                 janet_wrap_buffer(raw));
+        if (next) *next = bytes + 5 + clen;
+        return status;
+    }
     /* Avoid longjmp clobber warning in GCC */
     UnmarshalState st;
     st.end = bytes + len;
     st.lookup_defs = NULL;
     st.lookup_envs = NULL;
     st.reg = reg;
+    st.image = image;
+    st.file = NULL;
+    /* Images written before the format was versioned have no header */
+    const int hasheader = len >= 2 && bytes[0] == LB_VERSION;
+    st.version = hasheader ? bytes[1] : 1;
+    if (st.version > JANET_MARSHAL_VERSION) return UMR_UNKNOWN;
     janet_array_init(&st.lookup, 0);
     if (!(status = setjmp(st.err))) {
-        const uint8_t *nextbytes = unmarshal_one(&st, bytes, out, flags);
+        const uint8_t *nextbytes = unmarshal_one(&st, bytes + (hasheader ? 2 : 0), out, flags);
         if (next) *next = nextbytes;
     }
     janet_array_deinit(&st.lookup);
@@ -1101,6 +1704,124 @@ int janet_unmarshal(
     return status;
 }
 
+/* With JANET_MARSHAL_LAZY, the bytecode and sourcemaps of function
+ * definitions are decoded when first used, so the bytes must stay
+ * alive and unchanged as long as any unmarshalled function does. */
+int janet_unmarshal(
+        const uint8_t *bytes,
+        size_t len,
+        int flags,
+        Janet *out,
+        JanetTable *reg,
+        const uint8_t **next) {
+    return unmarshal_image(bytes, len, flags, out, reg, next, janet_wrap_nil());
+}
+
+/* Unmarshal a value written by janet_marshal_file. The file is read in
+ * chunks, so only a window of the image is ever in memory, and reading
+ * stops at the end of the value. Lazy decoding is not possible here. */
+int janet_unmarshal_file(
+        FILE *file,
+        int flags,
+        Janet *out,
+        JanetTable *reg) {
+    int status;
+    UnmarshalState st;
+    st.lookup_defs = NULL;
+    st.lookup_envs = NULL;
+    st.reg = reg;
+    st.image = janet_wrap_nil();
+    st.version = JANET_MARSHAL_VERSION;
+    st.file = file;
+    st.chunk_left = 0;
+    st.window_capacity = JANET_MARSHAL_CHUNK;
+    st.window = malloc(st.window_capacity);
+    if (!st.window) {
+        JANET_OUT_OF_MEMORY;
+    }
+    st.end = st.window;
+    janet_array_init(&st.lookup, 0);
+    if (!(status = setjmp(st.err))) {
+        const uint8_t *data = unmarshal_refill(&st, st.end, 2);
+        if (data[0] != LB_VERSION || data[1] < 2 || data[1] > JANET_MARSHAL_VERSION)
+            longjmp(st.err, UMR_UNKNOWN);
+        st.version = data[1];
+        data = unmarshal_one(&st, data + 2, out, flags & ~JANET_MARSHAL_LAZY);
+        /* The value must end exactly at the empty chunk */
+        if (data != st.end || st.chunk_left || unmarshal_chunk_length(&st))
+            longjmp(st.err, UMR_UNKNOWN);
+    }
+    free(st.window);
+    janet_array_deinit(&st.lookup);
+    janet_v_free(st.lookup_defs);
+    janet_v_free(st.lookup_envs);
+    return status;
+}
+
+/* A read only image file mapped into memory. Functions unmarshalled
+ * lazily from it reference their code in the mapping, and keep it mapped
+ * until they have all been decoded or collected. Where mmap is not
+ * available, the file is read into memory instead. */
+typedef struct {
+    uint8_t *bytes;
+    size_t len;
+} MappedImage;
+
+static int mapped_image_gc(void *p, size_t len) {
+    (void) len;
+    MappedImage *mi = (MappedImage *)p;
+    if (!mi->bytes) return 0;
+#ifdef JANET_UNIX
+    return munmap(mi->bytes, mi->len);
+#else
+    free(mi->bytes);
+    return 0;
+#endif
+}
+
+static const JanetAbstractType mapped_image_type = {
+    "core/image",
+    mapped_image_gc,
+    NULL,
+    NULL,
+    NULL
+};
+
+/* Map an image file. Returns non-zero if it could not be opened. */
+static int map_image(MappedImage *mi, const char *path) {
+#ifdef JANET_UNIX
+    struct stat sb;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 1;
+    if (fstat(fd, &sb) || sb.st_size <= 0) {
+        close(fd);
+        return 1;
+    }
+    void *bytes = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (bytes == MAP_FAILED) return 1;
+    mi->bytes = bytes;
+    mi->len = (size_t) sb.st_size;
+    return 0;
+#else
+    FILE *f = fopen(path, "rb");
+    if (!f) return 1;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *bytes = size > 0 ? malloc(size) : NULL;
+    if (!bytes || fread(bytes, 1, size, f) != (size_t) size) {
+        free(bytes);
+        fclose(f);
+        return 1;
+    }
+    fclose(f);
+    mi->bytes = bytes;
+    mi->len = (size_t) size;
+    return 0;
+#endif
+}
+
 /* C functions */
 
 static Janet cfun_env_lookup(int32_t argc, Janet *argv) {
@@ -1110,35 +1831,90 @@ static Janet cfun_env_lookup(int32_t argc, Janet *argv) {
 }
 
 static Janet cfun_marshal(int32_t argc, Janet *argv) {
-    janet_arity(argc, 1, 2);
+    janet_arity(argc, 1, 4);
     JanetBuffer *buffer;
     JanetTable *rreg = NULL;
     Janet err_param = janet_wrap_nil();
+    int flags = 0;
     int status;
-    if (argc > 1) {
+    if (argc > 1 && !janet_checktype(argv[1], JANET_NIL)) {
         rreg = janet_gettable(argv, 1);
     }
-    if (argc > 2) {
+    if (argc > 3 && janet_truthy(argv[3])) {
+        flags |= JANET_MARSHAL_COMPRESS;
+    }
+    if (argc > 2 && !janet_checktype(argv[2], JANET_NIL)) {
+        FILE *file = janet_io_getfile(argv[2], 1);
+        if (file) {
+            if (flags & JANET_MARSHAL_COMPRESS)
+                janet_panic("cannot compress when marshalling to a file");
+            status = janet_marshal_file(file, argv[0], &err_param, rreg, 0);
+            if (status)
+                janet_panicf("%s for %V", mr_strings[status], err_param);
+            return argv[2];
+        }
         buffer = janet_getbuffer(argv, 2);
     } else {
         buffer = janet_buffer(10);
     }
-    status = janet_marshal(buffer, argv[0], &err_param, rreg, 0);
+    status = janet_marshal(buffer, argv[0], &err_param, rreg, flags);
     if (status)
         janet_panicf("%s for %V", mr_strings[status], err_param);
     return janet_wrap_buffer(buffer);
 }
 
 static Janet cfun_unmarshal(int32_t argc, Janet *argv) {
-    janet_arity(argc, 1, 2);
-    JanetByteView view = janet_getbytes(argv, 0);
+    janet_arity(argc, 1, 3);
     JanetTable *reg = NULL;
+    Janet image = janet_wrap_nil();
+    int flags = 0;
     Janet ret;
     int status;
-    if (argc > 1) {
+    if (argc > 1 && !janet_checktype(argv[1], JANET_NIL)) {
+        reg = janet_gettable(argv, 1);
+    }
+    FILE *file = janet_io_getfile(argv[0], 0);
+    if (file) {
+        status = janet_unmarshal_file(file, 0, &ret, reg);
+        if (status) {
+            janet_panic(umr_strings[status]);
+        }
+        return ret;
+    }
+    JanetByteView view = janet_getbytes(argv, 0);
+    if (argc > 2 && janet_truthy(argv[2])) {
+        /* Functions keep the image alive, so it must not change. Compressed
+         * images are decompressed into memory that they keep instead. */
+        if (view.len == 0 || view.bytes[0] != LB_COMPRESSED) {
+            image = janet_checktype(argv[0], JANET_STRING)
+                    ? argv[0]
+                    : janet_wrap_string(janet_string(view.bytes, view.len));
+            view.bytes = janet_unwrap_string(image);
+        }
+        flags |= JANET_MARSHAL_LAZY;
+    }
+    status = unmarshal_image(view.bytes, (size_t) view.len, flags, &ret, reg, NULL, image);
+    if (status) {
+        janet_panic(umr_strings[status]);
+    }
+    return ret;
+}
+
+static Janet cfun_unmarshal_mapped(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 2);
+    const uint8_t *path = janet_getstring(argv, 0);
+    JanetTable *reg = NULL;
+    Janet ret;
+    if (argc > 1 && !janet_checktype(argv[1], JANET_NIL)) {
         reg = janet_gettable(argv, 1);
     }
-    status = janet_unmarshal(view.bytes, (size_t) view.len, 0, &ret, reg, NULL);
+    MappedImage *mi = janet_abstract(&mapped_image_type, sizeof(MappedImage));
+    mi->bytes = NULL;
+    mi->len = 0;
+    if (map_image(mi, (const char *) path))
+        janet_panicf("could not map image %S", path);
+    int status = unmarshal_image(mi->bytes, mi->len, JANET_MARSHAL_LAZY, &ret, reg, NULL,
+                                 janet_wrap_abstract(mi));
     if (status) {
         janet_panic(umr_strings[status]);
     }
@@ -1148,20 +1924,37 @@ static Janet cfun_unmarshal(int32_t argc, Janet *argv) {
 static const JanetReg marsh_cfuns[] = {
     {
         "marshal", cfun_marshal,
-        JDOC("(marshal x [,reverse-lookup [,buffer]])\n\n"
+        JDOC("(marshal x [,reverse-lookup [,buffer [,compress]]])\n\n"
                 "Marshal a janet value into a buffer and return the buffer. The buffer "
                 "can the later be unmarshalled to reconstruct the initial value. "
                 "Optionally, one can pass in a reverse lookup table to not marshal "
                 "aliased values that are found in the table. Then a forward"
                 "lookup table can be used to recover the original janet value when "
-                "unmarshalling.")
+                "unmarshalling. If buffer is a file, the value is written to the file "
+                "in chunks as it is marshalled and the file is returned. If compress "
+                "is truthy, the image is compressed with buffer/compress, which "
+                "unmarshal detects. Compression is not available for files.")
     },
     {
         "unmarshal", cfun_unmarshal,
-        JDOC("(unmarshal buffer [,lookup])\n\n"
+        JDOC("(unmarshal buffer [,lookup [,lazy]])\n\n"
                 "Unmarshal a janet value from a buffer. An optional lookup table "
-                "can be provided to allow for aliases to be resolved. Returns the value "
-                "unmarshalled from the buffer.")
+                "can be provided to allow for aliases to be resolved. If lazy is "
+                "truthy, the bytecode of functions is only decoded when they are first "
+                "called. The buffer can also be a file or pipe that a value was marshalled "
+                "to, in which case one value is read from the file as it is decoded, "
+                "and lazy is ignored. Compressed images are decompressed before they are "
+                "decoded. Returns the value unmarshalled from the buffer.")
+    },
+    {
+        "unmarshal-mapped", cfun_unmarshal_mapped,
+        JDOC("(unmarshal-mapped path [,lookup])\n\n"
+                "Unmarshal a janet value from the image file at path without reading "
+                "it into memory first. The file is mapped read only, and the bytecode "
+                "of functions is left in the mapping until they are first called, so "
+                "processes loading the same image share its pages. The file must not "
+                "change while any such function is alive. Returns the value unmarshalled "
+                "from the image.")
     },
     {
         "env-lookup", cfun_env_lookup,
@@ -1176,4 +1969,6 @@ static const JanetReg marsh_cfuns[] = {
 /* Module entry point */
 void janet_lib_marsh(JanetTable *env) {
     janet_cfuns(env, NULL, marsh_cfuns);
+    janet_def(env, "marshal/version", janet_wrap_integer(JANET_MARSHAL_VERSION),
+              JDOC("The version of the format written by marshal."));
 }
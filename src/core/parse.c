@@ -144,6 +144,32 @@ DEF_PARSER_STACK(_pushstate, JanetParseState, states, statecount, statecap)
 #define PFLAG_READERMAC 0x8000
 #define PFLAG_ATSYM 0x10000
 
+/* The errors a parser can be stopped with. Errors are always set from this
+ * table, so a marshaled parser can refer to its error by index. */
+enum {
+    PERR_HEX_ESCAPE,
+    PERR_ESCAPE,
+    PERR_SYMBOL_DIGIT,
+    PERR_SYMBOL_UTF8,
+    PERR_SYMBOL_EMPTY,
+    PERR_CHARACTER,
+    PERR_DELIMITER,
+    PERR_STRUCT_ODD,
+    PERR_MISMATCHED
+};
+
+static const char *parser_errors[] = {
+    "invalid hex digit in hex escape",
+    "invalid string escape sequence",
+    "symbol literal cannot start with a digit",
+    "invalid utf-8 in symbol",
+    "empty symbol invalid",
+    "unexpected character",
+    "unexpected delimiter",
+    "struct and table literals expect even number of arguments",
+    "mismatched delimiter"
+};
+
 static void pushstate(JanetParser *p, Consumer consumer, int flags) {
     JanetParseState s;
     s.counter = 0;
@@ -211,7 +237,7 @@ static int stringchar(JanetParser *p, JanetParseState *state, uint8_t c);
 static int escapeh(JanetParser *p, JanetParseState *state, uint8_t c) {
     int digit = to_hex(c);
     if (digit < 0) {
-        p->error = "invalid hex digit in hex escape";
+        p->error = parser_errors[PERR_HEX_ESCAPE];
         return 1;
     }
     state->argn = (state->argn << 4) + digit;;
@@ -227,7 +253,7 @@ static int escapeh(JanetParser *p, JanetParseState *state, uint8_t c) {
 static int escape1(JanetParser *p, JanetParseState *state, uint8_t c) {
     int e = checkescape(c);
     if (e < 0) {
-        p->error = "invalid string escape sequence";
+        p->error = parser_errors[PERR_ESCAPE];
         return 1;
     }
     if (c == 'x') {
@@ -309,19 +335,19 @@ static int tokenchar(JanetParser *p, JanetParseState *state, uint8_t c) {
         ret = janet_wrap_true();
     } else if (p->buf) {
         if (start_dig) {
-            p->error = "symbol literal cannot start with a digit";
+            p->error = parser_errors[PERR_SYMBOL_DIGIT];
             return 0;
         } else {
             /* Don't do full utf-8 check unless we have seen non ascii characters. */
             int valid = (!state->argn) || valid_utf8(p->buf, blen);
             if (!valid) {
-                p->error = "invalid utf-8 in symbol";
+                p->error = parser_errors[PERR_SYMBOL_UTF8];
                 return 0;
             }
             ret = janet_symbolv(p->buf, blen);
         }
     } else {
-        p->error = "empty symbol invalid";
+        p->error = parser_errors[PERR_SYMBOL_EMPTY];
         return 0;
     }
     p->bufcount = 0;
@@ -449,7 +475,7 @@ static int root(JanetParser *p, JanetParseState *state, uint8_t c) {
         default:
             if (is_whitespace(c)) return 1;
             if (!is_symbol_char(c)) {
-                p->error = "unexpected character";
+                p->error = parser_errors[PERR_CHARACTER];
                 return 1;
             }
             pushstate(p, tokenchar, 0);
@@ -478,7 +504,7 @@ static int root(JanetParser *p, JanetParseState *state, uint8_t c) {
             {
                 Janet ds;
                 if (p->statecount == 1) {
-                    p->error = "unexpected delimiter";
+                    p->error = parser_errors[PERR_DELIMITER];
                     return 1;
                 }
                 if ((c == ')' && (state->flags & PFLAG_PARENS)) ||
@@ -490,7 +516,7 @@ static int root(JanetParser *p, JanetParseState *state, uint8_t c) {
                     }
                 } else if (c == '}' && (state->flags & PFLAG_CURLYBRACKETS)) {
                     if (state->argn & 1) {
-                        p->error = "struct and table literals expect even number of arguments";
+                        p->error = parser_errors[PERR_STRUCT_ODD];
                         return 1;
                     }
                     if (state->flags & PFLAG_ATSYM) {
@@ -499,7 +525,7 @@ static int root(JanetParser *p, JanetParseState *state, uint8_t c) {
                         ds = close_struct(p, state);
                     }
                 } else {
-                    p->error = "mismatched delimiter";
+                    p->error = parser_errors[PERR_MISMATCHED];
                     return 1;
                 }
                 popstate(p, ds);
@@ -609,12 +635,118 @@ static int parsergc(void *p, size_t size) {
     return 0;
 }
 
+/* The consumers a parser state can be in, numbered for marshalling */
+static const Consumer parser_consumers[] = {
+    root,
+    tokenchar,
+    stringchar,
+    escape1,
+    escapeh,
+    longstring,
+    comment,
+    ampersand
+};
+
+#define PARSER_NUM_CONSUMERS ((int32_t)(sizeof(parser_consumers) / sizeof(Consumer)))
+#define PARSER_NUM_ERRORS ((int32_t)(sizeof(parser_errors) / sizeof(const char *)))
+
+static void parsermarshal(void *p, JanetMarshalContext *ctx) {
+    JanetParser *parser = (JanetParser *)p;
+    int32_t error = -1;
+    for (int32_t i = 0; parser->error && i < PARSER_NUM_ERRORS; i++)
+        if (parser->error == parser_errors[i]) error = i;
+    janet_marshal_int(ctx, error);
+    janet_marshal_int(ctx, (int32_t) parser->offset);
+    janet_marshal_int(ctx, (int32_t) parser->pending);
+    janet_marshal_int(ctx, parser->lookback);
+    janet_marshal_int(ctx, (int32_t) parser->statecount);
+    janet_marshal_int(ctx, (int32_t) parser->bufcount);
+    janet_marshal_int(ctx, (int32_t) parser->argcount);
+    for (size_t i = 0; i < parser->statecount; i++) {
+        JanetParseState *state = parser->states + i;
+        int32_t consumer = 0;
+        while (parser_consumers[consumer] != state->consumer) consumer++;
+        janet_marshal_int(ctx, consumer);
+        janet_marshal_int(ctx, state->counter);
+        janet_marshal_int(ctx, state->argn);
+        janet_marshal_int(ctx, state->flags);
+        janet_marshal_int(ctx, (int32_t) state->start);
+    }
+    janet_marshal_bytes(ctx, parser->buf, (int32_t) parser->bufcount);
+    for (size_t i = 0; i < parser->argcount; i++)
+        janet_marshal_janet(ctx, parser->args[i]);
+}
+
+static void *parserunmarshal(JanetMarshalContext *ctx);
+
 static JanetAbstractType janet_parse_parsertype = {
     "core/parser",
     parsergc,
-    parsermark
+    parsermark,
+    parsermarshal,
+    parserunmarshal
 };
 
+static void *parserunmarshal(JanetMarshalContext *ctx) {
+    JanetParser *parser = janet_unmarshal_abstract(ctx, sizeof(JanetParser));
+    parser->args = NULL;
+    parser->states = NULL;
+    parser->buf = NULL;
+    parser->argcount = 0;
+    parser->argcap = 0;
+    parser->bufcount = 0;
+    parser->bufcap = 0;
+    parser->statecount = 0;
+    parser->statecap = 0;
+    int32_t error = janet_unmarshal_int(ctx);
+    int32_t offset = janet_unmarshal_int(ctx);
+    int32_t pending = janet_unmarshal_int(ctx);
+    parser->lookback = janet_unmarshal_int(ctx);
+    int32_t statecount = janet_unmarshal_int(ctx);
+    int32_t bufcount = janet_unmarshal_int(ctx);
+    int32_t argcount = janet_unmarshal_int(ctx);
+    if (error < -1 || error >= PARSER_NUM_ERRORS || offset < 0 || pending < 0 ||
+            statecount < 1 || bufcount < 0 || argcount < pending)
+        return NULL;
+    parser->error = error < 0 ? NULL : parser_errors[error];
+    parser->offset = offset;
+    parser->pending = pending;
+
+    /* Read states. Containers take their arguments off the top of the
+     * argument stack when they close, so each must have its own. */
+    int64_t nested_args = 0;
+    for (int32_t i = 0; i < statecount; i++) {
+        JanetParseState state;
+        int32_t consumer = janet_unmarshal_int(ctx);
+        if (consumer < 0 || consumer >= PARSER_NUM_CONSUMERS) return NULL;
+        state.consumer = parser_consumers[consumer];
+        state.counter = janet_unmarshal_int(ctx);
+        state.argn = janet_unmarshal_int(ctx);
+        state.flags = janet_unmarshal_int(ctx);
+        state.start = (size_t) janet_unmarshal_int(ctx);
+        if (i == 0 && (state.consumer != root || !(state.flags & PFLAG_CONTAINER)))
+            return NULL;
+        if (i > 0 && (state.flags & PFLAG_CONTAINER)) {
+            if (state.argn < 0) return NULL;
+            nested_args += state.argn;
+        }
+        _pushstate(parser, state);
+    }
+    if (nested_args + pending != argcount) return NULL;
+
+    /* Read the token buffer and arguments */
+    parser->buf = malloc(bufcount ? bufcount : 1);
+    if (!parser->buf) {
+        JANET_OUT_OF_MEMORY;
+    }
+    parser->bufcap = bufcount ? bufcount : 1;
+    janet_unmarshal_bytes(ctx, parser->buf, bufcount);
+    parser->bufcount = bufcount;
+    for (int32_t i = 0; i < argcount; i++)
+        push_arg(parser, janet_unmarshal_janet(ctx));
+    return parser;
+}
+
 /* C Function parser */
 static Janet cfun_parse_parser(int32_t argc, Janet *argv) {
     (void) argv;
@@ -853,4 +985,5 @@ static const JanetReg parse_cfuns[] = {
 /* Load the library */
 void janet_lib_parse(JanetTable *env) {
     janet_cfuns(env, NULL, parse_cfuns);
+    janet_register_abstract_type(&janet_parse_parsertype);
 }
@@ -0,0 +1,1443 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#ifndef JANET_AMALG
+#include <janet/janet.h>
+#include "compile.h"
+#include "emit.h"
+#include "vector.h"
+#include "util.h"
+#endif
+
+/* Peephole optimizations over the bytecode of a finished funcdef. Removed
+ * instructions are first replaced with JOP_NOOP, then compacted out with
+ * jumps, error handlers and the sourcemap adjusted to match. */
+
+/* Maximum number of bits in all liveness sets before we give up on
+ * optimizations that need them. */
+#define JANET_PEEPHOLE_MAXLIVE (1 << 24)
+
+/* Maximum slotcount for register renaming, which needs an interference
+ * matrix of slotcount * slotcount bits. */
+#define JANET_PEEPHOLE_MAXRENAME 1024
+
+/* Maximum bytecode length of a function that is inlined at call sites */
+#define JANET_INLINE_MAXLENGTH 12
+
+/* Operand fields of an instruction word */
+typedef enum {
+    PH_A, /* bits 8-15 */
+    PH_B, /* bits 16-23 */
+    PH_C, /* bits 24-31 */
+    PH_D, /* bits 8-31 */
+    PH_E /* bits 16-31 */
+} PhField;
+
+/* Registers read and written by an instruction */
+typedef struct {
+    int32_t reads[3];
+    PhField fields[3];
+    int32_t nreads;
+    int32_t write;
+    PhField wfield;
+} PhRegs;
+
+static int32_t ph_get(uint32_t instr, PhField f) {
+    switch (f) {
+        default:
+        case PH_A:
+            return (instr >> 8) & 0xFF;
+        case PH_B:
+            return (instr >> 16) & 0xFF;
+        case PH_C:
+            return instr >> 24;
+        case PH_D:
+            return instr >> 8;
+        case PH_E:
+            return instr >> 16;
+    }
+}
+
+/* Set a field. Returns 0 if the value does not fit. */
+static int ph_set(uint32_t *instr, PhField f, int32_t x) {
+    switch (f) {
+        default:
+        case PH_A:
+            if (x > 0xFF) return 0;
+            *instr = (*instr & 0xFFFF00FF) | ((uint32_t) x << 8);
+            return 1;
+        case PH_B:
+            if (x > 0xFF) return 0;
+            *instr = (*instr & 0xFF00FFFF) | ((uint32_t) x << 16);
+            return 1;
+        case PH_C:
+            if (x > 0xFF) return 0;
+            *instr = (*instr & 0x00FFFFFF) | ((uint32_t) x << 24);
+            return 1;
+        case PH_D:
+            if (x > 0xFFFFFF) return 0;
+            *instr = (*instr & 0xFF) | ((uint32_t) x << 8);
+            return 1;
+        case PH_E:
+            if (x > 0xFFFF) return 0;
+            *instr = (*instr & 0xFFFF) | ((uint32_t) x << 16);
+            return 1;
+    }
+}
+
+static void ph_regs(uint32_t instr, PhRegs *r) {
+#define PH_READ(F) do { \
+    r->fields[r->nreads] = (F); \
+    r->reads[r->nreads++] = ph_get(instr, (F)); \
+} while (0)
+    r->nreads = 0;
+    r->write = -1;
+    r->wfield = PH_A;
+    switch (instr & 0xFF) {
+        default:
+            break;
+        case JOP_ERROR:
+        case JOP_RETURN:
+        case JOP_PUSH:
+        case JOP_PUSH_ARRAY:
+        case JOP_TAILCALL:
+            PH_READ(PH_D);
+            break;
+        case JOP_LOAD_NIL:
+        case JOP_LOAD_TRUE:
+        case JOP_LOAD_FALSE:
+        case JOP_LOAD_SELF:
+        case JOP_MAKE_ARRAY:
+        case JOP_MAKE_BUFFER:
+        case JOP_MAKE_STRING:
+        case JOP_MAKE_STRUCT:
+        case JOP_MAKE_TABLE:
+        case JOP_MAKE_TUPLE:
+            r->wfield = PH_D;
+            r->write = ph_get(instr, PH_D);
+            break;
+        case JOP_TYPECHECK:
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+        case JOP_SET_UPVALUE:
+            PH_READ(PH_A);
+            break;
+        case JOP_LOAD_INTEGER:
+        case JOP_LOAD_CONSTANT:
+        case JOP_LOAD_UPVALUE:
+        case JOP_CLOSURE:
+            r->write = ph_get(instr, PH_A);
+            break;
+        case JOP_MOVE_NEAR:
+        case JOP_BNOT:
+        case JOP_LENGTH:
+        case JOP_CALL:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_E);
+            break;
+        case JOP_MOVE_FAR:
+            r->wfield = PH_E;
+            r->write = ph_get(instr, PH_E);
+            PH_READ(PH_A);
+            break;
+        case JOP_PUSH_2:
+            PH_READ(PH_A);
+            PH_READ(PH_E);
+            break;
+        case JOP_PUSH_3:
+        case JOP_PUT:
+            PH_READ(PH_A);
+            PH_READ(PH_B);
+            PH_READ(PH_C);
+            break;
+        case JOP_PUT_INDEX:
+            PH_READ(PH_A);
+            PH_READ(PH_B);
+            break;
+        case JOP_NUMERIC_FOR_LESS_THAN:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_A);
+            PH_READ(PH_B);
+            break;
+        case JOP_GET_VARARG:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_B);
+            PH_READ(PH_C);
+            break;
+        case JOP_GET_INDEX_VARARG:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_B);
+            break;
+        case JOP_PUSH_VARARG:
+            PH_READ(PH_D);
+            break;
+        case JOP_ADD_IMMEDIATE:
+        case JOP_MULTIPLY_IMMEDIATE:
+        case JOP_DIVIDE_IMMEDIATE:
+        case JOP_SHIFT_LEFT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE:
+        case JOP_GREATER_THAN_IMMEDIATE:
+        case JOP_LESS_THAN_IMMEDIATE:
+        case JOP_EQUALS_IMMEDIATE:
+        case JOP_SIGNAL:
+        case JOP_GET_INDEX:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_B);
+            break;
+        case JOP_ADD:
+        case JOP_SUBTRACT:
+        case JOP_MULTIPLY:
+        case JOP_DIVIDE:
+        case JOP_BAND:
+        case JOP_BOR:
+        case JOP_BXOR:
+        case JOP_SHIFT_LEFT:
+        case JOP_SHIFT_RIGHT:
+        case JOP_SHIFT_RIGHT_UNSIGNED:
+        case JOP_GREATER_THAN:
+        case JOP_LESS_THAN:
+        case JOP_EQUALS:
+        case JOP_COMPARE:
+        case JOP_RESUME:
+        case JOP_GET:
+        case JOP_NUMERIC_LESS_THAN:
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+        case JOP_NUMERIC_GREATER_THAN:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+        case JOP_NUMERIC_EQUAL:
+        case JOP_NUMERIC_LESS_THAN_JUMP:
+        case JOP_NUMERIC_LESS_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_EQUAL_JUMP:
+        case JOP_EQUALS_JUMP:
+            r->write = ph_get(instr, PH_A);
+            PH_READ(PH_B);
+            PH_READ(PH_C);
+            break;
+    }
+#undef PH_READ
+}
+
+/* Instructions that can be removed when the register they write is dead */
+static int ph_pure(uint32_t instr) {
+    switch (instr & 0xFF) {
+        default:
+            return 0;
+        case JOP_LOAD_NIL:
+        case JOP_LOAD_TRUE:
+        case JOP_LOAD_FALSE:
+        case JOP_LOAD_INTEGER:
+        case JOP_LOAD_CONSTANT:
+        case JOP_LOAD_SELF:
+        case JOP_MOVE_NEAR:
+        case JOP_MOVE_FAR:
+        case JOP_CLOSURE:
+        case JOP_EQUALS:
+            return 1;
+    }
+}
+
+/* Get the successors of an instruction, not counting error handlers.
+ * Returns the number of successors. */
+static int ph_succ(const JanetFuncDef *def, int32_t i, int32_t *out) {
+    uint32_t instr = def->bytecode[i];
+    int n = 0;
+    switch (instr & 0xFF) {
+        case JOP_RETURN:
+        case JOP_RETURN_NIL:
+        case JOP_ERROR:
+        case JOP_TAILCALL:
+            return 0;
+        case JOP_JUMP:
+            out[0] = i + (((int32_t) instr) >> 8);
+            return 1;
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+            out[n++] = i + (((int32_t) instr) >> 16);
+            break;
+        case JOP_NUMERIC_FOR_LESS_THAN:
+            /* Skips the jump back when the loop is done */
+            if (i + 2 < def->bytecode_length) out[n++] = i + 2;
+            break;
+        default:
+            break;
+    }
+    if (i + 1 < def->bytecode_length) out[n++] = i + 1;
+    return n;
+}
+
+/* Get the target of a jump instruction, or -1 */
+static int32_t ph_target(uint32_t instr, int32_t i) {
+    switch (instr & 0xFF) {
+        default:
+            return -1;
+        case JOP_JUMP:
+            return i + (((int32_t) instr) >> 8);
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+            return i + (((int32_t) instr) >> 16);
+    }
+}
+
+/* Point a jump at a new target. Returns 0 if the offset does not fit. */
+static int ph_retarget(uint32_t *instr, int32_t i, int32_t target) {
+    int32_t off = target - i;
+    if ((*instr & 0xFF) == JOP_JUMP) {
+        if (off < -0x800000 || off > 0x7FFFFF) return 0;
+        *instr = ((uint32_t) off << 8) | JOP_JUMP;
+    } else {
+        if (off < -0x8000 || off > 0x7FFF) return 0;
+        *instr = (*instr & 0xFFFF) | ((uint32_t) off << 16);
+    }
+    return 1;
+}
+
+/* Live register sets for each instruction */
+typedef struct {
+    const JanetFuncDef *def;
+    int32_t words;
+    uint32_t *in; /* Registers live before each instruction */
+    uint32_t *scratch;
+} PhLive;
+
+#define ph_set_has(S, R) ((S)[(R) >> 5] & ((uint32_t) 1 << ((R) & 31)))
+#define ph_set_add(S, R) ((S)[(R) >> 5] |= ((uint32_t) 1 << ((R) & 31)))
+#define ph_set_rem(S, R) ((S)[(R) >> 5] &= ~((uint32_t) 1 << ((R) & 31)))
+
+/* Add the registers live at the error handlers covering instruction i */
+static void ph_live_handlers(PhLive *l, int32_t i, uint32_t *out) {
+    const JanetFuncDef *def = l->def;
+    for (int32_t h = 0; h < def->handlers_length; h++) {
+        JanetHandler handler = def->handlers[h];
+        if (i < handler.start || i >= handler.end) continue;
+        uint32_t *tin = l->in + (size_t) handler.target * l->words;
+        int slotlive = ph_set_has(out, handler.slot);
+        for (int32_t w = 0; w < l->words; w++) out[w] |= tin[w];
+        /* The handler slot is written before the handler runs */
+        if (!slotlive) ph_set_rem(out, handler.slot);
+    }
+}
+
+/* Get registers live after instruction i, not counting error handlers */
+static uint32_t *ph_live_out(PhLive *l, int32_t i) {
+    int32_t succ[2];
+    int n = ph_succ(l->def, i, succ);
+    memset(l->scratch, 0, sizeof(uint32_t) * l->words);
+    for (int k = 0; k < n; k++) {
+        uint32_t *sin = l->in + (size_t) succ[k] * l->words;
+        for (int32_t w = 0; w < l->words; w++) l->scratch[w] |= sin[w];
+    }
+    return l->scratch;
+}
+
+/* Compute liveness with a backwards dataflow analysis. Returns 0 if the
+ * function is too large. */
+static int ph_live_init(PhLive *l, const JanetFuncDef *def) {
+    int32_t len = def->bytecode_length;
+    l->def = def;
+    l->words = (def->slotcount + 31) >> 5;
+    if (l->words == 0) l->words = 1;
+    if ((int64_t) len * l->words * 32 > JANET_PEEPHOLE_MAXLIVE) return 0;
+    l->in = calloc((size_t) len * l->words, sizeof(uint32_t));
+    l->scratch = malloc(sizeof(uint32_t) * l->words * 2);
+    if (NULL == l->in || NULL == l->scratch) {
+        JANET_OUT_OF_MEMORY;
+    }
+    uint32_t *next = l->scratch + l->words;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int32_t i = len - 1; i >= 0; i--) {
+            PhRegs r;
+            ph_regs(def->bytecode[i], &r);
+            memcpy(next, ph_live_out(l, i), sizeof(uint32_t) * l->words);
+            if (r.write >= 0) ph_set_rem(next, r.write);
+            ph_live_handlers(l, i, next);
+            for (int32_t k = 0; k < r.nreads; k++) ph_set_add(next, r.reads[k]);
+            uint32_t *in = l->in + (size_t) i * l->words;
+            if (memcmp(in, next, sizeof(uint32_t) * l->words)) {
+                memcpy(in, next, sizeof(uint32_t) * l->words);
+                changed = 1;
+            }
+        }
+    }
+    return 1;
+}
+
+static void ph_live_deinit(PhLive *l) {
+    free(l->in);
+    free(l->scratch);
+}
+
+/* Check if register reg is live after instruction i, including in
+ * error handlers that run if i raises. */
+static int ph_live_after(PhLive *l, int32_t i, int32_t reg) {
+    uint32_t *out = ph_live_out(l, i);
+    if (ph_set_has(out, reg)) return 1;
+    memset(out, 0, sizeof(uint32_t) * l->words);
+    ph_live_handlers(l, i, out);
+    return !!ph_set_has(out, reg);
+}
+
+/* Check if the value register reg holds before instruction i is used
+ * after it. If i writes reg, later uses see the new value. */
+static int ph_used_after(PhLive *l, int32_t i, int32_t reg) {
+    PhRegs r;
+    ph_regs(l->def->bytecode[i], &r);
+    if (r.write != reg) return ph_live_after(l, i, reg);
+    uint32_t *out = l->scratch;
+    memset(out, 0, sizeof(uint32_t) * l->words);
+    ph_live_handlers(l, i, out);
+    return !!ph_set_has(out, reg);
+}
+
+/* Mark instructions that can be reached without falling through */
+static uint8_t *ph_targets(const JanetFuncDef *def) {
+    uint8_t *targets = calloc(def->bytecode_length + 1, 1);
+    if (NULL == targets) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (int32_t i = 0; i < def->bytecode_length; i++) {
+        int32_t t = ph_target(def->bytecode[i], i);
+        if (t >= 0) targets[t] = 1;
+    }
+    for (int32_t i = 0; i < def->handlers_length; i++)
+        targets[def->handlers[i].target] = 1;
+    return targets;
+}
+
+/* Optimizations that do not need liveness. Returns the number of changes. */
+static int ph_simplify(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int changes = 0;
+    uint8_t *targets = ph_targets(def);
+
+    for (int32_t i = 0; i < len; i++) {
+        uint32_t instr = bc[i];
+        switch (instr & 0xFF) {
+            default:
+                break;
+            case JOP_MOVE_NEAR:
+            case JOP_MOVE_FAR:
+                {
+                    /* Self moves, and moves that undo the previous move */
+                    PhRegs r, next;
+                    ph_regs(instr, &r);
+                    if (r.write == r.reads[0]) {
+                        bc[i] = JOP_NOOP;
+                        changes++;
+                        break;
+                    }
+                    if (i + 1 < len && !targets[i + 1] &&
+                            ((bc[i + 1] & 0xFF) == JOP_MOVE_NEAR ||
+                             (bc[i + 1] & 0xFF) == JOP_MOVE_FAR)) {
+                        ph_regs(bc[i + 1], &next);
+                        if (next.write == r.reads[0] && next.reads[0] == r.write) {
+                            bc[i + 1] = JOP_NOOP;
+                            changes++;
+                        }
+                    }
+                    break;
+                }
+            case JOP_JUMP:
+            case JOP_JUMP_IF:
+            case JOP_JUMP_IF_NOT:
+                {
+                    /* Thread jumps to jumps */
+                    int32_t t = ph_target(instr, i);
+                    for (int hops = 0; hops < 16; hops++) {
+                        uint32_t tinstr = bc[t];
+                        uint8_t top = tinstr & 0xFF;
+                        if (top == JOP_JUMP) {
+                            t = ph_target(tinstr, t);
+                        } else if ((instr & 0xFF) != JOP_JUMP &&
+                                (top == JOP_JUMP_IF || top == JOP_JUMP_IF_NOT) &&
+                                ((tinstr ^ instr) & 0xFF00) == 0) {
+                            /* Same condition, so we know which way it goes */
+                            t = top == (instr & 0xFF) ? ph_target(tinstr, t) : t + 1;
+                        } else {
+                            break;
+                        }
+                    }
+                    if ((instr & 0xFF) == JOP_JUMP &&
+                            ((bc[t] & 0xFF) == JOP_RETURN || (bc[t] & 0xFF) == JOP_RETURN_NIL)) {
+                        /* Jump to return */
+                        bc[i] = bc[t];
+                        changes++;
+                    } else if (t == i + 1) {
+                        /* Jump to the next instruction */
+                        bc[i] = JOP_NOOP;
+                        changes++;
+                    } else if (t != ph_target(instr, i) && ph_retarget(bc + i, i, t)) {
+                        changes++;
+                    }
+                    break;
+                }
+        }
+    }
+
+    /* Remove unreachable code. Error handlers are assumed reachable. */
+    {
+        uint8_t *reached = calloc(len, 1);
+        int32_t *stack = malloc(sizeof(int32_t) * (len + 1));
+        int32_t top = 0;
+        if (NULL == reached || NULL == stack) {
+            JANET_OUT_OF_MEMORY;
+        }
+        reached[0] = 1;
+        stack[top++] = 0;
+        for (int32_t h = 0; h < def->handlers_length; h++) {
+            int32_t t = def->handlers[h].target;
+            if (!reached[t]) {
+                reached[t] = 1;
+                stack[top++] = t;
+            }
+        }
+        while (top > 0) {
+            int32_t succ[2];
+            int32_t i = stack[--top];
+            int n = ph_succ(def, i, succ);
+            for (int k = 0; k < n; k++) {
+                if (!reached[succ[k]]) {
+                    reached[succ[k]] = 1;
+                    stack[top++] = succ[k];
+                }
+            }
+        }
+        for (int32_t i = 0; i < len; i++) {
+            if (!reached[i] && (bc[i] & 0xFF) != JOP_NOOP) {
+                bc[i] = JOP_NOOP;
+                changes++;
+            }
+        }
+        free(reached);
+        free(stack);
+    }
+
+    free(targets);
+    return changes;
+}
+
+/* Optimizations that need liveness. Only valid when no closure
+ * can see the function's registers. Returns the number of changes. */
+static int ph_uselive(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int changes = 0;
+    PhLive l;
+    if (!ph_live_init(&l, def)) return 0;
+    uint8_t *targets = ph_targets(def);
+
+    for (int32_t i = 0; i < len; i++) {
+        uint32_t instr = bc[i];
+        PhRegs r;
+        ph_regs(instr, &r);
+
+        /* Remove dead stores */
+        if (ph_pure(instr) && r.write >= 0 && !ph_live_after(&l, i, r.write)) {
+            bc[i] = JOP_NOOP;
+            changes++;
+            continue;
+        }
+
+        if (i + 1 >= len || targets[i + 1]) continue;
+        uint32_t next = bc[i + 1];
+        uint8_t nextop = next & 0xFF;
+        PhRegs nr;
+        ph_regs(next, &nr);
+
+        /* Copy propagation into the next instruction */
+        if ((instr & 0xFF) == JOP_MOVE_NEAR || (instr & 0xFF) == JOP_MOVE_FAR) {
+            int32_t t = r.write, s = r.reads[0];
+            int reads = 0;
+            for (int32_t k = 0; k < nr.nreads; k++)
+                if (nr.reads[k] == t) reads = 1;
+            if (reads && !ph_used_after(&l, i + 1, t)) {
+                uint32_t rewritten = next;
+                int ok = 1;
+                for (int32_t k = 0; k < nr.nreads; k++)
+                    if (nr.reads[k] == t) ok = ok && ph_set(&rewritten, nr.fields[k], s);
+                if (ok) {
+                    bc[i] = JOP_NOOP;
+                    bc[i + 1] = rewritten;
+                    changes++;
+                    i++;
+                }
+            }
+            continue;
+        }
+
+        /* Use immediate forms of arithmetic on small integers */
+        if ((instr & 0xFF) == JOP_LOAD_INTEGER && nr.nreads == 2) {
+            int32_t reg = r.write;
+            int32_t k = ((int32_t) instr) >> 16;
+            int32_t other;
+            uint8_t op;
+            if (nr.reads[1] == reg && nr.reads[0] != reg) {
+                other = nr.reads[0];
+            } else if (nr.reads[0] == reg && nr.reads[1] != reg &&
+                    (nextop == JOP_ADD || nextop == JOP_MULTIPLY)) {
+                other = nr.reads[1];
+            } else {
+                continue;
+            }
+            switch (nextop) {
+                default:
+                    continue;
+                case JOP_ADD:
+                    op = JOP_ADD_IMMEDIATE;
+                    break;
+                case JOP_SUBTRACT:
+                    op = JOP_ADD_IMMEDIATE;
+                    k = -k;
+                    break;
+                case JOP_MULTIPLY:
+                    op = JOP_MULTIPLY_IMMEDIATE;
+                    break;
+                case JOP_DIVIDE:
+                    op = JOP_DIVIDE_IMMEDIATE;
+                    break;
+                case JOP_SHIFT_LEFT:
+                    op = JOP_SHIFT_LEFT_IMMEDIATE;
+                    if (k < 0 || k > 31) continue;
+                    break;
+                case JOP_SHIFT_RIGHT:
+                    op = JOP_SHIFT_RIGHT_IMMEDIATE;
+                    if (k < 0 || k > 31) continue;
+                    break;
+                case JOP_SHIFT_RIGHT_UNSIGNED:
+                    op = JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE;
+                    if (k < 0 || k > 31) continue;
+                    break;
+            }
+            if (k < -128 || k > 127 || ph_used_after(&l, i + 1, reg)) continue;
+            bc[i] = JOP_NOOP;
+            bc[i + 1] = op |
+                ((uint32_t) nr.write << 8) |
+                ((uint32_t) other << 16) |
+                ((uint32_t) k << 24);
+            changes++;
+            i++;
+        }
+    }
+
+    free(targets);
+    ph_live_deinit(&l);
+    return changes;
+}
+
+/* Remove JOP_NOOP instructions */
+static void ph_compact(JanetFuncDef *def, JanetSourceMapping *sourcemap) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int32_t *map = malloc(sizeof(int32_t) * (len + 1));
+    if (NULL == map) {
+        JANET_OUT_OF_MEMORY;
+    }
+    int32_t n = 0;
+    for (int32_t i = 0; i < len; i++) {
+        map[i] = n;
+        if ((bc[i] & 0xFF) != JOP_NOOP) n++;
+    }
+    map[len] = n;
+    for (int32_t i = 0; i < len; i++) {
+        int32_t t = ph_target(bc[i], i);
+        if (t >= 0) ph_retarget(bc + i, map[i], map[t]);
+        if ((bc[i] & 0xFF) != JOP_NOOP) {
+            bc[map[i]] = bc[i];
+            if (NULL != sourcemap)
+                sourcemap[map[i]] = sourcemap[i];
+        }
+    }
+    for (int32_t i = 0; i < def->handlers_length; i++) {
+        JanetHandler *h = def->handlers + i;
+        h->start = map[h->start];
+        h->end = map[h->end];
+        h->target = map[h->target];
+    }
+    def->bytecode_length = n;
+    free(map);
+}
+
+/* Fuse comparisons with the conditional jump on their result */
+static void ph_fuse(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    for (int32_t i = 0; i + 1 < def->bytecode_length; i++) {
+        uint8_t op;
+        switch (bc[i] & 0xFF) {
+            default:
+                continue;
+            case JOP_NUMERIC_LESS_THAN:
+                op = JOP_NUMERIC_LESS_THAN_JUMP;
+                break;
+            case JOP_NUMERIC_LESS_THAN_EQUAL:
+                op = JOP_NUMERIC_LESS_THAN_EQUAL_JUMP;
+                break;
+            case JOP_NUMERIC_GREATER_THAN:
+                op = JOP_NUMERIC_GREATER_THAN_JUMP;
+                break;
+            case JOP_NUMERIC_GREATER_THAN_EQUAL:
+                op = JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP;
+                break;
+            case JOP_NUMERIC_EQUAL:
+                op = JOP_NUMERIC_EQUAL_JUMP;
+                break;
+            case JOP_EQUALS:
+                op = JOP_EQUALS_JUMP;
+                break;
+        }
+        if ((bc[i + 1] & 0xFF) == JOP_JUMP_IF_NOT && ((bc[i] ^ bc[i + 1]) & 0xFF00) == 0)
+            bc[i] = (bc[i] & 0xFFFFFF00) | op;
+    }
+}
+
+/* Undo ph_fuse and ph_fuseloops. A fused instruction reads the jump after
+ * it, so bytecode must be unfused before passes that can move or remove
+ * that jump. */
+static void ph_unfuse(uint32_t *bc, int32_t len) {
+    for (int32_t i = 0; i < len; i++) {
+        uint32_t instr = bc[i];
+        uint8_t op;
+        switch (instr & 0xFF) {
+            default:
+                continue;
+            case JOP_NUMERIC_LESS_THAN_JUMP:
+                op = JOP_NUMERIC_LESS_THAN;
+                break;
+            case JOP_NUMERIC_LESS_THAN_EQUAL_JUMP:
+                op = JOP_NUMERIC_LESS_THAN_EQUAL;
+                break;
+            case JOP_NUMERIC_GREATER_THAN_JUMP:
+                op = JOP_NUMERIC_GREATER_THAN;
+                break;
+            case JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP:
+                op = JOP_NUMERIC_GREATER_THAN_EQUAL;
+                break;
+            case JOP_NUMERIC_EQUAL_JUMP:
+                op = JOP_NUMERIC_EQUAL;
+                break;
+            case JOP_EQUALS_JUMP:
+                op = JOP_EQUALS;
+                break;
+            case JOP_NUMERIC_FOR_LESS_THAN:
+                {
+                    /* The jump after the step skips the test and branch at
+                     * the top of the loop, so point it back at the test */
+                    int32_t counter = ph_get(instr, PH_A);
+                    if (i + 1 >= len || (bc[i + 1] & 0xFF) != JOP_JUMP) continue;
+                    bc[i] = (instr & 0xFF000000) | ((uint32_t) counter << 16) |
+                            ((uint32_t) counter << 8) | JOP_ADD_IMMEDIATE;
+                    ph_retarget(bc + i + 1, i + 1, ph_target(bc[i + 1], i + 1) - 2);
+                    continue;
+                }
+        }
+        bc[i] = (instr & 0xFFFFFF00) | op;
+    }
+}
+
+/* Get the type written by an instruction as a mask of JANET_TFLAG_*, given
+ * the register types before it. */
+static uint16_t ph_type_written(const JanetFuncDef *def, uint32_t instr, const uint16_t *types) {
+    switch (instr & 0xFF) {
+        default:
+            return JANET_SLOTTYPE_ANY;
+        case JOP_LOAD_NIL:
+            return JANET_TFLAG_NIL;
+        case JOP_LOAD_TRUE:
+            return JANET_TFLAG_TRUE;
+        case JOP_LOAD_FALSE:
+            return JANET_TFLAG_FALSE;
+        case JOP_LOAD_CONSTANT:
+            return 1 << janet_type(def->constants[instr >> 16]);
+        case JOP_LOAD_SELF:
+        case JOP_CLOSURE:
+            return JANET_TFLAG_FUNCTION;
+        case JOP_MAKE_ARRAY:
+            return JANET_TFLAG_ARRAY;
+        case JOP_MAKE_BUFFER:
+            return JANET_TFLAG_BUFFER;
+        case JOP_MAKE_STRING:
+            return JANET_TFLAG_STRING;
+        case JOP_MAKE_STRUCT:
+            return JANET_TFLAG_STRUCT;
+        case JOP_MAKE_TABLE:
+            return JANET_TFLAG_TABLE;
+        case JOP_MAKE_TUPLE:
+            return JANET_TFLAG_TUPLE;
+        case JOP_MOVE_NEAR:
+            return types[instr >> 16];
+        case JOP_MOVE_FAR:
+            return types[(instr >> 8) & 0xFF];
+        case JOP_LOAD_INTEGER:
+        case JOP_LENGTH:
+        case JOP_COMPARE:
+        case JOP_BNOT:
+        case JOP_NUMERIC_FOR_LESS_THAN:
+        case JOP_ADD_IMMEDIATE:
+        case JOP_MULTIPLY_IMMEDIATE:
+        case JOP_DIVIDE_IMMEDIATE:
+        case JOP_SHIFT_LEFT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE:
+        case JOP_ADD:
+        case JOP_SUBTRACT:
+        case JOP_MULTIPLY:
+        case JOP_DIVIDE:
+        case JOP_BAND:
+        case JOP_BOR:
+        case JOP_BXOR:
+        case JOP_SHIFT_LEFT:
+        case JOP_SHIFT_RIGHT:
+        case JOP_SHIFT_RIGHT_UNSIGNED:
+            return JANET_TFLAG_NUMBER;
+        case JOP_GREATER_THAN:
+        case JOP_LESS_THAN:
+        case JOP_EQUALS:
+        case JOP_GREATER_THAN_IMMEDIATE:
+        case JOP_LESS_THAN_IMMEDIATE:
+        case JOP_EQUALS_IMMEDIATE:
+        case JOP_NUMERIC_LESS_THAN:
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+        case JOP_NUMERIC_GREATER_THAN:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+        case JOP_NUMERIC_EQUAL:
+        case JOP_NUMERIC_LESS_THAN_JUMP:
+        case JOP_NUMERIC_LESS_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_EQUAL_JUMP:
+        case JOP_EQUALS_JUMP:
+            return JANET_TFLAG_BOOLEAN;
+    }
+}
+
+/* Get the register types after an instruction runs without raising an
+ * error. Instructions that check the types of their operands narrow them. */
+static void ph_type_step(const JanetFuncDef *def, uint32_t instr, const uint16_t *in, uint16_t *out) {
+    PhRegs r;
+    memcpy(out, in, sizeof(uint16_t) * def->slotcount);
+    ph_regs(instr, &r);
+    switch (instr & 0xFF) {
+        default:
+            break;
+        case JOP_TYPECHECK:
+            out[r.reads[0]] &= (uint16_t)(instr >> 16);
+            break;
+        case JOP_ADD_IMMEDIATE:
+        case JOP_MULTIPLY_IMMEDIATE:
+        case JOP_DIVIDE_IMMEDIATE:
+        case JOP_SHIFT_LEFT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_IMMEDIATE:
+        case JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE:
+        case JOP_ADD:
+        case JOP_SUBTRACT:
+        case JOP_MULTIPLY:
+        case JOP_DIVIDE:
+        case JOP_BAND:
+        case JOP_BOR:
+        case JOP_BXOR:
+        case JOP_SHIFT_LEFT:
+        case JOP_SHIFT_RIGHT:
+        case JOP_SHIFT_RIGHT_UNSIGNED:
+        case JOP_BNOT:
+        case JOP_NUMERIC_LESS_THAN:
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+        case JOP_NUMERIC_GREATER_THAN:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+        case JOP_NUMERIC_EQUAL:
+        case JOP_NUMERIC_LESS_THAN_JUMP:
+        case JOP_NUMERIC_LESS_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_JUMP:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP:
+        case JOP_NUMERIC_EQUAL_JUMP:
+        case JOP_NUMERIC_FOR_LESS_THAN:
+            for (int32_t k = 0; k < r.nreads; k++)
+                out[r.reads[k]] &= JANET_TFLAG_NUMBER;
+            break;
+    }
+    if (r.write >= 0) out[r.write] = ph_type_written(def, instr, in);
+}
+
+/* Infer the types registers can hold before each instruction with a
+ * forward dataflow analysis, and use them to remove type checks that
+ * cannot fail and to compare numbers without janet_equals. Registers start
+ * with any type, as the arity is not known yet. Returns the number of
+ * changes. */
+static int ph_types(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int32_t sc = def->slotcount;
+    int32_t i, k, reg;
+    int changes = 0;
+    if (sc == 0 || (int64_t) len * sc * 16 > JANET_PEEPHOLE_MAXLIVE) return 0;
+    uint16_t *types = calloc((size_t) len * sc + sc, sizeof(uint16_t));
+    if (NULL == types) {
+        JANET_OUT_OF_MEMORY;
+    }
+    uint16_t *out = types + (size_t) len * sc;
+    for (reg = 0; reg < sc; reg++) types[reg] = JANET_SLOTTYPE_ANY;
+
+#define PH_JOIN(DST, SRC, SKIP) do { \
+    uint16_t *dst_ = (DST); \
+    for (int32_t r_ = 0; r_ < sc; r_++) { \
+        uint16_t t_ = (r_ == (SKIP)) ? JANET_SLOTTYPE_ANY : (SRC)[r_]; \
+        if ((dst_[r_] | t_) != dst_[r_]) { \
+            dst_[r_] |= t_; \
+            changed = 1; \
+        } \
+    } \
+} while (0)
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (i = 0; i < len; i++) {
+            int32_t succ[3];
+            uint16_t *in = types + (size_t) i * sc;
+            ph_type_step(def, bc[i], in, out);
+            int n = ph_succ(def, i, succ);
+            for (k = 0; k < n; k++)
+                PH_JOIN(types + (size_t) succ[k] * sc, out, -1);
+            /* Handlers can see registers from before or after an instruction */
+            for (k = 0; k < def->handlers_length; k++) {
+                JanetHandler h = def->handlers[k];
+                if (i < h.start || i >= h.end) continue;
+                PH_JOIN(types + (size_t) h.target * sc, in, h.slot);
+                PH_JOIN(types + (size_t) h.target * sc, out, h.slot);
+            }
+        }
+    }
+
+#undef PH_JOIN
+
+    for (i = 0; i < len; i++) {
+        uint32_t instr = bc[i];
+        uint16_t *in = types + (size_t) i * sc;
+        switch (instr & 0xFF) {
+            default:
+                break;
+            case JOP_TYPECHECK:
+                {
+                    uint16_t t = in[(instr >> 8) & 0xFF];
+                    if (t && !(t & ~(uint16_t)(instr >> 16))) {
+                        bc[i] = JOP_NOOP;
+                        changes++;
+                    }
+                }
+                break;
+            case JOP_EQUALS:
+                if (in[(instr >> 16) & 0xFF] == JANET_TFLAG_NUMBER &&
+                        in[instr >> 24] == JANET_TFLAG_NUMBER) {
+                    bc[i] = (instr & 0xFFFFFF00) | JOP_NUMERIC_EQUAL;
+                    changes++;
+                }
+                break;
+        }
+    }
+
+    free(types);
+    return changes;
+}
+
+/* Rotate counted loops, as compiled from for and loop with :range:
+ *
+ * :top
+ * ltnj t i n
+ * jmpno t :done
+ * ...
+ * addim i i k
+ * jmp :top
+ * :done
+ *
+ * The step, test and jump back become a JOP_NUMERIC_FOR_LESS_THAN and a
+ * jump to the body, so only the first test goes through :top. This needs
+ * the test result t to be dead in the body and after the loop. */
+static void ph_fuseloops(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    PhLive l;
+    if (!ph_live_init(&l, def)) return;
+    uint8_t *targets = ph_targets(def);
+    for (int32_t e = 3; e < len; e++) {
+        int32_t top = ph_target(bc[e], e);
+        if ((bc[e] & 0xFF) != JOP_JUMP || top < 0 || top + 3 > e || targets[e]) continue;
+        uint32_t test = bc[top], branch = bc[top + 1], step = bc[e - 1];
+        int32_t t = ph_get(test, PH_A), counter = ph_get(test, PH_B), limit = ph_get(test, PH_C);
+        if ((test & 0xFF) != JOP_NUMERIC_LESS_THAN_JUMP ||
+                (branch & 0xFF) != JOP_JUMP_IF_NOT ||
+                ph_get(branch, PH_A) != t ||
+                ph_target(branch, top + 1) != e + 1 ||
+                (step & 0xFF) != JOP_ADD_IMMEDIATE ||
+                ph_get(step, PH_A) != counter ||
+                ph_get(step, PH_B) != counter ||
+                t == counter || t == limit)
+            continue;
+        if (ph_set_has(l.in + (size_t)(top + 2) * l.words, t) ||
+                (e + 1 < len && ph_set_has(l.in + (size_t)(e + 1) * l.words, t)) ||
+                ph_live_after(&l, e - 1, t))
+            continue;
+        bc[e - 1] = (step & 0xFF000000) | ((uint32_t) limit << 16) |
+                    ((uint32_t) counter << 8) | JOP_NUMERIC_FOR_LESS_THAN;
+        ph_retarget(bc + e, e, top + 2);
+    }
+    free(targets);
+    ph_live_deinit(&l);
+}
+
+/* Reassign registers so that values that are never live at the same time
+ * share a register. Both sides of a move get the same register when
+ * possible, so the move becomes a self move that can be removed. Registers
+ * live on entry, such as arguments, keep their index. Returns 1 if
+ * registers were reassigned. */
+static int ph_rename(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int32_t sc = def->slotcount;
+    int32_t i, reg, changed = 0, maxcolor = -1;
+    PhLive l;
+    if (sc < 2 || sc > JANET_PEEPHOLE_MAXRENAME) return 0;
+    if (!ph_live_init(&l, def)) return 0;
+    int32_t words = l.words;
+    uint32_t *graph = calloc((size_t) sc * words + words, sizeof(uint32_t));
+    int32_t *color = malloc(sizeof(int32_t) * sc * 2);
+    uint8_t *flags = calloc(sc, 1);
+    if (NULL == graph || NULL == color || NULL == flags) {
+        JANET_OUT_OF_MEMORY;
+    }
+    uint32_t *scratch = graph + (size_t) sc * words;
+    int32_t *partner = color + sc;
+    for (reg = 0; reg < sc; reg++) {
+        color[reg] = -1;
+        partner[reg] = -1;
+    }
+
+#define PH_USED 1
+#define PH_NEAR 2
+#define PH_INTERFERE(X, Y) do { \
+    ph_set_add(graph + (size_t)(X) * words, (Y)); \
+    ph_set_add(graph + (size_t)(Y) * words, (X)); \
+} while (0)
+
+    /* Build the interference graph. A register written by an instruction
+     * interferes with everything live after it, except the source of a move. */
+    for (i = 0; i < len; i++) {
+        PhRegs r;
+        ph_regs(bc[i], &r);
+        for (int32_t k = 0; k < r.nreads; k++) {
+            flags[r.reads[k]] |= PH_USED;
+            if (r.fields[k] == PH_A || r.fields[k] == PH_B || r.fields[k] == PH_C)
+                flags[r.reads[k]] |= PH_NEAR;
+        }
+        if (r.write < 0) continue;
+        flags[r.write] |= PH_USED;
+        if (r.wfield == PH_A) flags[r.write] |= PH_NEAR;
+        int32_t src = -1;
+        if ((bc[i] & 0xFF) == JOP_MOVE_NEAR || (bc[i] & 0xFF) == JOP_MOVE_FAR) {
+            src = r.reads[0];
+            if (partner[r.write] < 0) partner[r.write] = src;
+            if (partner[src] < 0) partner[src] = r.write;
+        }
+        memcpy(scratch, ph_live_out(&l, i), sizeof(uint32_t) * words);
+        ph_live_handlers(&l, i, scratch);
+        for (reg = 0; reg < sc; reg++)
+            if (reg != r.write && reg != src && ph_set_has(scratch, reg))
+                PH_INTERFERE(r.write, reg);
+    }
+
+    /* Error handlers write their slot when they start */
+    for (i = 0; i < def->handlers_length; i++) {
+        JanetHandler h = def->handlers[i];
+        uint32_t *tin = l.in + (size_t) h.target * words;
+        flags[h.slot] |= PH_USED;
+        for (reg = 0; reg < sc; reg++)
+            if (reg != h.slot && ph_set_has(tin, reg))
+                PH_INTERFERE(h.slot, reg);
+    }
+
+    /* Registers live on entry hold arguments or rely on starting as nil */
+    for (reg = 0; reg < sc; reg++) {
+        if (ph_set_has(l.in, reg)) {
+            color[reg] = reg;
+            flags[reg] |= PH_USED;
+        }
+    }
+
+    /* Greedy coloring in register order */
+    for (reg = 0; reg < sc; reg++) {
+        if (color[reg] >= 0 || !(flags[reg] & PH_USED)) continue;
+        int32_t limit = (flags[reg] & PH_NEAR) ? 0x100 : sc;
+        uint32_t *edges = graph + (size_t) reg * words;
+        memset(scratch, 0, sizeof(uint32_t) * words);
+        for (int32_t other = 0; other < sc; other++)
+            if (color[other] >= 0 && ph_set_has(edges, other))
+                ph_set_add(scratch, color[other]);
+        int32_t c = -1;
+        int32_t p = partner[reg];
+        if (p >= 0 && color[p] >= 0 && color[p] < limit && !ph_set_has(scratch, color[p])) {
+            c = color[p];
+        } else {
+            for (int32_t k = 0; k < sc && k < limit; k++) {
+                if (!ph_set_has(scratch, k)) {
+                    c = k;
+                    break;
+                }
+            }
+        }
+        if (c < 0) goto done;
+        color[reg] = c;
+    }
+
+    /* Rewrite registers */
+    for (reg = 0; reg < sc; reg++) {
+        if (color[reg] > maxcolor) maxcolor = color[reg];
+        if (color[reg] >= 0 && color[reg] != reg) changed = 1;
+    }
+    if (changed) {
+        for (i = 0; i < len; i++) {
+            PhRegs r;
+            uint32_t instr = bc[i];
+            ph_regs(instr, &r);
+            for (int32_t k = 0; k < r.nreads; k++)
+                ph_set(&instr, r.fields[k], color[r.reads[k]]);
+            if (r.write >= 0)
+                ph_set(&instr, r.wfield, color[r.write]);
+            bc[i] = instr;
+        }
+        for (i = 0; i < def->handlers_length; i++)
+            def->handlers[i].slot = color[def->handlers[i].slot];
+        def->slotcount = maxcolor + 1;
+    }
+
+#undef PH_USED
+#undef PH_NEAR
+#undef PH_INTERFERE
+
+done:
+    free(graph);
+    free(color);
+    free(flags);
+    ph_live_deinit(&l);
+    return changed;
+}
+
+/* Run optimizations until nothing changes */
+static void ph_optimize(JanetFuncDef *def, JanetSourceMapping *map, int uselive) {
+    for (int pass = 0; pass < 4; pass++) {
+        int changes = ph_simplify(def);
+        if (uselive) changes += ph_uselive(def);
+        if (!changes) break;
+        ph_compact(def, map);
+    }
+}
+
+void janetc_peephole(JanetFuncDef *def, JanetSourceMapping *map) {
+    if (def->bytecode_length == 0) return;
+    /* Fusion runs last, so no pass below can split a fused instruction
+     * from its jump, whatever bytecode the function starts with */
+    ph_unfuse(def->bytecode, def->bytecode_length);
+    /* Closures can see the registers of functions that need an environment,
+     * so only optimizations that keep every register write are safe. */
+    int uselive = !(def->flags & JANET_FUNCDEF_FLAG_NEEDSENV);
+    ph_optimize(def, map, uselive);
+    if (uselive && ph_rename(def))
+        ph_optimize(def, map, uselive);
+    if (uselive && ph_types(def))
+        ph_compact(def, map);
+    ph_fuse(def);
+    if (uselive) ph_fuseloops(def);
+}
+
+/* Check if a call to def with argc arguments can be replaced by a copy of
+ * its bytecode. The function must be small and take a fixed number of
+ * arguments, and must not use closures, upvalues, error handlers or
+ * itself. Registers other than the arguments must be written before they
+ * are read, as they do not start as nil in the caller. */
+static int ph_inlinable(JanetFuncDef *def, int32_t argc) {
+    if (def->flags & (JANET_FUNCDEF_FLAG_VARARG | JANET_FUNCDEF_FLAG_NEEDSENV)) return 0;
+    if (def->arity != argc || def->bytecode_length > JANET_INLINE_MAXLENGTH) return 0;
+    if (def->environments_length || def->defs_length || def->handlers_length) return 0;
+    for (int32_t i = 0; i < def->bytecode_length; i++) {
+        switch (def->bytecode[i] & 0xFF) {
+            default:
+                break;
+            case JOP_LOAD_SELF:
+            case JOP_LOAD_UPVALUE:
+            case JOP_SET_UPVALUE:
+            case JOP_CLOSURE:
+                return 0;
+        }
+    }
+    PhLive l;
+    if (!ph_live_init(&l, def)) return 0;
+    int ok = 1;
+    for (int32_t reg = argc; reg < def->slotcount; reg++) {
+        if (ph_set_has(l.in, reg)) {
+            ok = 0;
+            break;
+        }
+    }
+    ph_live_deinit(&l);
+    return ok;
+}
+
+static JanetSlot ph_slot(int32_t reg) {
+    JanetSlot ret;
+    ret.flags = JANET_SLOTTYPE_ANY;
+    ret.index = reg;
+    ret.constant = janet_wrap_nil();
+    ret.envindex = -1;
+    return ret;
+}
+
+/* Compile a call to a small Janet function by copying its bytecode into
+ * the current function with fresh registers. Returns 0 if the function
+ * cannot be inlined. */
+int janetc_inline(JanetFopts opts, JanetSlot *slots, JanetFuncDef *def, JanetSlot *out) {
+    JanetCompiler *c = opts.compiler;
+    int32_t argc = janet_v_count(slots);
+    int32_t len = def->bytecode_length;
+    int32_t i, nexits = 0;
+    int tail = (opts.flags & JANET_FOPTS_TAIL) && !(c->scope->flags & JANET_SCOPE_TOP);
+    janet_funcdef_load(def);
+    if (!ph_inlinable(def, argc)) return 0;
+
+    int32_t *regs = malloc(sizeof(int32_t) * (def->slotcount + 2 * len + 1) +
+                           sizeof(uint32_t) * len);
+    if (NULL == regs) {
+        JANET_OUT_OF_MEMORY;
+    }
+    int32_t *pos = regs + def->slotcount;
+    int32_t *exits = pos + len + 1;
+
+    /* Copy unfused bytecode, as the current function is optimized again and
+     * fused as a whole */
+    uint32_t *bc = (uint32_t *)(exits + len);
+    memcpy(bc, def->bytecode, sizeof(uint32_t) * len);
+    ph_unfuse(bc, len);
+    for (i = 0; i < def->slotcount; i++)
+        regs[i] = janetc_allocfar(c);
+
+    /* Registers in 8 bit fields must stay below 256 */
+    for (i = 0; i < len; i++) {
+        PhRegs r;
+        ph_regs(bc[i], &r);
+        for (int32_t k = 0; k < r.nreads; k++)
+            if (r.fields[k] != PH_D && r.fields[k] != PH_E && regs[r.reads[k]] > 0xFF)
+                goto fail;
+        if (r.write >= 0 && r.wfield == PH_A && regs[r.write] > 0xFF)
+            goto fail;
+    }
+
+    if (tail) {
+        *out = janetc_cslot(janet_wrap_nil());
+        out->flags = JANET_SLOT_RETURNED;
+    } else {
+        *out = janetc_gettarget(opts);
+    }
+    for (i = 0; i < argc; i++)
+        janetc_copy(c, ph_slot(regs[i]), slots[i]);
+
+    for (i = 0; i < len; i++) {
+        uint32_t instr = bc[i];
+        pos[i] = janet_v_count(c->buffer);
+        switch (instr & 0xFF) {
+            default:
+                {
+                    PhRegs r;
+                    ph_regs(instr, &r);
+                    for (int32_t k = 0; k < r.nreads; k++)
+                        ph_set(&instr, r.fields[k], regs[r.reads[k]]);
+                    if (r.write >= 0)
+                        ph_set(&instr, r.wfield, regs[r.write]);
+                    janetc_emit(c, instr);
+                }
+                break;
+            case JOP_LOAD_CONSTANT:
+                janetc_copy(c, ph_slot(regs[(instr >> 8) & 0xFF]),
+                            janetc_cslot(def->constants[instr >> 16]));
+                break;
+            case JOP_RETURN:
+            case JOP_RETURN_NIL:
+                {
+                    JanetSlot ret = ((instr & 0xFF) == JOP_RETURN)
+                                    ? ph_slot(regs[instr >> 8])
+                                    : janetc_cslot(janet_wrap_nil());
+                    if (tail) {
+                        janetc_return(c, ret);
+                        break;
+                    }
+                    janetc_copy(c, *out, ret);
+                    if (i + 1 < len) {
+                        exits[nexits++] = janet_v_count(c->buffer);
+                        janetc_emit(c, JOP_JUMP);
+                    }
+                }
+                break;
+            case JOP_TAILCALL:
+                if (tail) {
+                    janetc_emit_s(c, JOP_TAILCALL, ph_slot(regs[instr >> 8]), 0);
+                    break;
+                }
+                janetc_emit_ss(c, JOP_CALL, *out, ph_slot(regs[instr >> 8]), 1);
+                if (i + 1 < len) {
+                    exits[nexits++] = janet_v_count(c->buffer);
+                    janetc_emit(c, JOP_JUMP);
+                }
+                break;
+        }
+    }
+    pos[len] = janet_v_count(c->buffer);
+
+    /* Jumps keep a single instruction, so only their offsets change */
+    for (i = 0; i < len; i++) {
+        int32_t target = ph_target(bc[i], i);
+        if (target >= 0)
+            ph_retarget(c->buffer + pos[i], pos[i], pos[target]);
+    }
+    for (i = 0; i < nexits; i++)
+        ph_retarget(c->buffer + exits[i], exits[i], pos[len]);
+
+    for (i = 0; i < def->slotcount; i++)
+        janetc_freeslot(c, ph_slot(regs[i]));
+    free(regs);
+    return 1;
+
+fail:
+    for (i = 0; i < def->slotcount; i++)
+        janetc_freeslot(c, ph_slot(regs[i]));
+    free(regs);
+    return 0;
+}
+
+/* Count the reads of a register by an instruction */
+static int32_t ph_reads(uint32_t instr, int32_t reg) {
+    PhRegs r;
+    int32_t n = 0;
+    ph_regs(instr, &r);
+    for (int32_t k = 0; k < r.nreads; k++)
+        if (r.reads[k] == reg) n++;
+    return n;
+}
+
+/* Let a variadic function keep its varargs on the stack instead of in a
+ * new tuple, when the value of the rest parameter is only counted, indexed
+ * or spliced into a call. Those uses are rewritten to read the stack, and
+ * the rest parameter holds the number of varargs. */
+void janetc_stackargs(JanetFuncDef *def) {
+    uint32_t *bc = def->bytecode;
+    int32_t len = def->bytecode_length;
+    int32_t rest = def->arity;
+    int32_t i, k;
+    if (!(def->flags & JANET_FUNCDEF_FLAG_VARARG) ||
+            (def->flags & (JANET_FUNCDEF_FLAG_NEEDSENV | JANET_FUNCDEF_FLAG_STACKARGS)) ||
+            len == 0)
+        return;
+
+    /* Which values the rest register may hold before each instruction */
+#define PH_REST 1
+#define PH_OTHER 2
+    uint8_t *state = calloc(len, 1);
+    if (NULL == state) {
+        JANET_OUT_OF_MEMORY;
+    }
+    state[0] = PH_REST;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (i = 0; i < len; i++) {
+            int32_t succ[2];
+            PhRegs r;
+            if (!state[i]) continue;
+            ph_regs(bc[i], &r);
+            uint8_t out = (r.write == rest) ? PH_OTHER : state[i];
+            int n = ph_succ(def, i, succ);
+            for (k = 0; k < n; k++) {
+                if ((state[succ[k]] | out) != state[succ[k]]) {
+                    state[succ[k]] |= out;
+                    changed = 1;
+                }
+            }
+            for (k = 0; k < def->handlers_length; k++) {
+                JanetHandler h = def->handlers[k];
+                if (i < h.start || i >= h.end) continue;
+                uint8_t hs = (h.slot == rest) ? PH_OTHER : (state[i] | out);
+                if ((state[h.target] | hs) != state[h.target]) {
+                    state[h.target] |= hs;
+                    changed = 1;
+                }
+            }
+        }
+    }
+
+    /* Every read of the varargs must be one we can rewrite */
+    for (i = 0; i < len; i++) {
+        int32_t reads = ph_reads(bc[i], rest);
+        if (!(state[i] & PH_REST) || !reads) continue;
+        int ok = 0;
+        if (state[i] == PH_REST && reads == 1) {
+            switch (bc[i] & 0xFF) {
+                default:
+                    break;
+                case JOP_LENGTH:
+                case JOP_PUSH_ARRAY:
+                    ok = 1;
+                    break;
+                case JOP_GET:
+                case JOP_GET_INDEX:
+                    ok = ph_get(bc[i], PH_B) == rest;
+                    break;
+            }
+        }
+        if (!ok) {
+            free(state);
+            return;
+        }
+    }
+
+    for (i = 0; i < len; i++) {
+        if (state[i] != PH_REST || !ph_reads(bc[i], rest)) continue;
+        switch (bc[i] & 0xFF) {
+            default:
+                break;
+            case JOP_LENGTH:
+                bc[i] = (bc[i] & 0xFFFFFF00) | JOP_MOVE_NEAR;
+                break;
+            case JOP_PUSH_ARRAY:
+                bc[i] = (bc[i] & 0xFFFFFF00) | JOP_PUSH_VARARG;
+                break;
+            case JOP_GET:
+                bc[i] = (bc[i] & 0xFFFFFF00) | JOP_GET_VARARG;
+                break;
+            case JOP_GET_INDEX:
+                bc[i] = (bc[i] & 0xFFFFFF00) | JOP_GET_INDEX_VARARG;
+                break;
+        }
+    }
+#undef PH_REST
+#undef PH_OTHER
+
+    free(state);
+    def->flags |= JANET_FUNCDEF_FLAG_STACKARGS;
+}
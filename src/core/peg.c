@@ -990,6 +990,7 @@ static uint32_t compile1(Builder *b, Janet peg) {
 typedef struct {
     uint32_t *bytecode;
     Janet *constants;
+    size_t bytecode_len;
     uint32_t num_constants;
 } Peg;
 
@@ -1001,12 +1002,158 @@ static int peg_mark(void *p, size_t size) {
     return 0;
 }
 
+static void peg_marshal(void *p, JanetMarshalContext *ctx) {
+    Peg *peg = (Peg *)p;
+    janet_marshal_int(ctx, (int32_t) peg->bytecode_len);
+    janet_marshal_int(ctx, (int32_t) peg->num_constants);
+    for (size_t i = 0; i < peg->bytecode_len; i++)
+        janet_marshal_int(ctx, (int32_t) peg->bytecode[i]);
+    for (uint32_t i = 0; i < peg->num_constants; i++)
+        janet_marshal_janet(ctx, peg->constants[i]);
+}
+
+/* Check that unmarshalled bytecode only refers to rules and constants
+ * that exist, so matching cannot read outside of the peg. */
+static int peg_verify(const uint32_t *bytecode, size_t len, uint32_t num_constants) {
+    uint8_t *is_rule = calloc(1, len);
+    if (!is_rule) {
+        JANET_OUT_OF_MEMORY;
+    }
+    int ok = 1;
+    size_t i = 0;
+    /* Find where each rule starts */
+    while (ok && i < len) {
+        const uint32_t *rule = bytecode + i;
+        size_t size = 0;
+        is_rule[i] = 1;
+        switch (rule[0]) {
+            default:
+                ok = 0;
+                break;
+            case RULE_NCHAR:
+            case RULE_NOTNCHAR:
+            case RULE_RANGE:
+            case RULE_POSITION:
+            case RULE_NOT:
+            case RULE_ERROR:
+            case RULE_DROP:
+                size = 2;
+                break;
+            case RULE_SET:
+                size = 9;
+                break;
+            case RULE_LOOK:
+            case RULE_IF:
+            case RULE_IFNOT:
+            case RULE_GETTAG:
+            case RULE_CAPTURE:
+            case RULE_ARGUMENT:
+            case RULE_CONSTANT:
+            case RULE_ACCUMULATE:
+            case RULE_GROUP:
+                size = 3;
+                break;
+            case RULE_BETWEEN:
+            case RULE_REPLACE:
+            case RULE_MATCHTIME:
+                size = 4;
+                break;
+            case RULE_LITERAL:
+            case RULE_CHOICE:
+            case RULE_SEQUENCE:
+                if (i + 1 >= len) {
+                    ok = 0;
+                    break;
+                }
+                size = rule[0] == RULE_LITERAL
+                       ? 2 + (((size_t) rule[1] + 3) >> 2)
+                       : 2 + (size_t) rule[1];
+                break;
+        }
+        if (size > len - i) ok = 0;
+        i += size;
+    }
+    /* Check the arguments of each rule */
+#define RULEARG(x) if ((x) >= len || !is_rule[(x)]) ok = 0
+    for (i = 0; ok && i < len; i++) {
+        if (!is_rule[i]) continue;
+        const uint32_t *rule = bytecode + i;
+        switch (rule[0]) {
+            default:
+                break;
+            case RULE_LOOK:
+                RULEARG(rule[2]);
+                break;
+            case RULE_CHOICE:
+            case RULE_SEQUENCE:
+                for (uint32_t j = 0; j < rule[1]; j++)
+                    RULEARG(rule[2 + j]);
+                break;
+            case RULE_IF:
+            case RULE_IFNOT:
+                RULEARG(rule[1]);
+                RULEARG(rule[2]);
+                break;
+            case RULE_BETWEEN:
+                RULEARG(rule[3]);
+                break;
+            case RULE_NOT:
+            case RULE_ERROR:
+            case RULE_DROP:
+            case RULE_CAPTURE:
+            case RULE_ACCUMULATE:
+            case RULE_GROUP:
+                RULEARG(rule[1]);
+                break;
+            case RULE_ARGUMENT:
+                if ((int32_t) rule[1] < 0) ok = 0;
+                break;
+            case RULE_CONSTANT:
+                if (rule[1] >= num_constants) ok = 0;
+                break;
+            case RULE_REPLACE:
+            case RULE_MATCHTIME:
+                RULEARG(rule[1]);
+                if (rule[2] >= num_constants) ok = 0;
+                break;
+        }
+    }
+#undef RULEARG
+    free(is_rule);
+    return ok;
+}
+
+static void *peg_unmarshal(JanetMarshalContext *ctx);
+
 static JanetAbstractType peg_type = {
     "core/peg",
     NULL,
-    peg_mark
+    peg_mark,
+    peg_marshal,
+    peg_unmarshal
 };
 
+static void *peg_unmarshal(JanetMarshalContext *ctx) {
+    int32_t bytecode_len = janet_unmarshal_int(ctx);
+    int32_t num_constants = janet_unmarshal_int(ctx);
+    if (bytecode_len <= 0 || num_constants < 0) return NULL;
+    size_t bytecode_size = bytecode_len * sizeof(uint32_t);
+    size_t constants_size = num_constants * sizeof(Janet);
+    char *mem = janet_unmarshal_abstract(ctx, bytecode_size + constants_size + sizeof(Peg));
+    Peg *peg = (Peg *)mem;
+    peg->constants = (Janet *)(mem + sizeof(Peg));
+    peg->bytecode = (uint32_t *)(mem + sizeof(Peg) + constants_size);
+    peg->bytecode_len = bytecode_len;
+    peg->num_constants = 0;
+    for (int32_t i = 0; i < bytecode_len; i++)
+        peg->bytecode[i] = (uint32_t) janet_unmarshal_int(ctx);
+    for (int32_t i = 0; i < num_constants; i++) {
+        peg->constants[i] = janet_unmarshal_janet(ctx);
+        peg->num_constants = i + 1;
+    }
+    return peg_verify(peg->bytecode, peg->bytecode_len, peg->num_constants) ? peg : NULL;
+}
+
 /* Convert Builder to Peg (Janet Abstract Value) */
 static Peg *make_peg(Builder *b) {
     size_t bytecode_size = janet_v_count(b->bytecode) * sizeof(uint32_t);
@@ -1014,8 +1161,9 @@ static Peg *make_peg(Builder *b) {
     size_t total_size = bytecode_size + constants_size + sizeof(Peg);
     char *mem = janet_abstract(&peg_type, total_size);
     Peg *peg = (Peg *)mem;
-    peg->bytecode = (uint32_t *)(mem + sizeof(Peg));
-    peg->constants = (Janet *)(mem + sizeof(Peg) + bytecode_size);
+    peg->constants = (Janet *)(mem + sizeof(Peg));
+    peg->bytecode = (uint32_t *)(mem + sizeof(Peg) + constants_size);
+    peg->bytecode_len = janet_v_count(b->bytecode);
     peg->num_constants = janet_v_count(b->constants);
     memcpy(peg->bytecode, b->bytecode, bytecode_size);
     memcpy(peg->constants, b->constants, constants_size);
@@ -1102,4 +1250,5 @@ static const JanetReg peg_cfuns[] = {
 /* Load the peg module */
 void janet_lib_peg(JanetTable *env) {
     janet_cfuns(env, NULL, peg_cfuns);
+    janet_register_abstract_type(&peg_type);
 }
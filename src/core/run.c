@@ -25,6 +25,33 @@
 #include "state.h"
 #endif
 
+/* Compile and run parsed forms, a batch at a time */
+static int dobatches(JanetTable *env, JanetArray *forms, const uint8_t *where,
+                     const char *sourcePath, Janet *ret) {
+    int32_t i = 0;
+    while (i < forms->count) {
+        int32_t count;
+        JanetCompileResult cres = janet_compile_batch(forms->data + i,
+                                  forms->count - i, env, where, &count, NULL);
+        if (cres.status == JANET_COMPILE_OK) {
+            JanetFunction *f = janet_thunk(cres.funcdef);
+            JanetFiber *fiber = janet_fiber(f, 64, 0, NULL);
+            JanetSignal status = janet_continue(fiber, janet_wrap_nil(), ret);
+            if (status != JANET_SIGNAL_OK) {
+                janet_stacktrace(fiber, *ret);
+                return 0x01;
+            }
+        } else {
+            fprintf(stderr, "compile error in %s: %s\n", sourcePath,
+                    (const char *)cres.error);
+            return 0x02;
+        }
+        i += count;
+    }
+    forms->count = 0;
+    return 0;
+}
+
 /* Run a string */
 int janet_dobytes(JanetTable *env, const uint8_t *bytes, int32_t len, const char *sourcePath, Janet *out) {
     JanetParser parser;
@@ -34,29 +61,22 @@ int janet_dobytes(JanetTable *env, const uint8_t *bytes, int32_t len, const char
     int done = 0;
     Janet ret = janet_wrap_nil();
     const uint8_t *where = sourcePath ? janet_cstring(sourcePath) : NULL;
+    JanetArray *forms = janet_array(0);
+    janet_gcroot(janet_wrap_array(forms));
     if (where) janet_gcroot(janet_wrap_string(where));
     if (NULL == sourcePath) sourcePath = "<unknown>";
     janet_parser_init(&parser);
 
     while (!errflags && !done) {
 
-        /* Evaluate parsed values */
-        while (janet_parser_has_more(&parser)) {
-            Janet form = janet_parser_produce(&parser);
-            JanetCompileResult cres = janet_compile(form, env, where);
-            if (cres.status == JANET_COMPILE_OK) {
-                JanetFunction *f = janet_thunk(cres.funcdef);
-                JanetFiber *fiber = janet_fiber(f, 64, 0, NULL);
-                JanetSignal status = janet_continue(fiber, janet_wrap_nil(), &ret);
-                if (status != JANET_SIGNAL_OK) {
-                    janet_stacktrace(fiber, ret);
-                    errflags |= 0x01;
-                }
-            } else {
-                fprintf(stderr, "compile error in %s: %s\n", sourcePath,
-                        (const char *)cres.error);
-                errflags |= 0x02;
-            }
+        /* Collect parsed values, and evaluate them in batches when
+         * enough are ready or the source is used up */
+        while (janet_parser_has_more(&parser))
+            janet_array_push(forms, janet_parser_produce(&parser));
+        if (forms->count >= JANET_BATCH_MAX || index >= len ||
+                janet_parser_status(&parser) == JANET_PARSE_ERROR) {
+            errflags |= dobatches(env, forms, where, sourcePath, &ret);
+            if (errflags) break;
         }
 
         /* Dispatch based on parse state */
@@ -91,6 +111,7 @@ int janet_dobytes(JanetTable *env, const uint8_t *bytes, int32_t len, const char
 
     }
     janet_parser_deinit(&parser);
+    janet_gcunroot(janet_wrap_array(forms));
     if (where) janet_gcunroot(janet_wrap_string(where));
     if (out) *out = ret;
     return errflags;
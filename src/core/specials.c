@@ -264,6 +264,12 @@ static JanetSlot dohead(JanetCompiler *c, JanetFopts opts, Janet *head, int32_t
 
 /* Def or var a symbol in a local scope */
 static int namelocal(JanetCompiler *c, const uint8_t *head, int32_t flags, JanetSlot ret) {
+    /* Constants bound with def can be named directly, so uses of the
+     * name are folded like literals */
+    if (!(flags & JANET_SLOT_MUTABLE) && (ret.flags & JANET_SLOT_CONSTANT)) {
+        janetc_nameslot(c, head, ret);
+        return 1;
+    }
     int isUnnamedRegister = !(ret.flags & JANET_SLOT_NAMED) &&
         ret.index > 0 &&
         ret.envindex >= 0;
@@ -271,6 +277,9 @@ static int namelocal(JanetCompiler *c, const uint8_t *head, int32_t flags, Janet
         /* Slot is not able to be named */
         JanetSlot localslot = janetc_farslot(c);
         janetc_copy(c, localslot, ret);
+        /* A def keeps the types of its value */
+        if (!(flags & JANET_SLOT_MUTABLE))
+            localslot.flags = (localslot.flags & ~JANET_SLOTTYPE_ANY) | janetc_slottypes(ret);
         ret = localslot;
     }
     ret.flags |= flags;
@@ -296,6 +305,12 @@ static int varleaf(
         janet_table_put(c->env, janet_wrap_symbol(sym), janet_wrap_table(reftab));
         refslot = janetc_cslot(janet_wrap_array(ref));
         janetc_emit_ssu(c, JOP_PUT_INDEX, refslot, s, 0, 0);
+        if (c->scope->flags & JANET_SCOPE_BATCH) {
+            /* Shadow earlier defs of the batch, like the global would */
+            refslot.flags |= JANET_SLOT_REF | JANET_SLOT_MUTABLE | JANET_SLOTTYPE_ANY;
+            refslot.flags &= ~JANET_SLOT_CONSTANT;
+            janetc_nameslot(c, sym, refslot);
+        }
         return 1;
     } else {
         return namelocal(c, sym, JANET_SLOT_MUTABLE, s);
@@ -330,6 +345,11 @@ static int defleaf(
 
         /* Put value in table when evaulated */
         janetc_emit_sss(c, JOP_PUT, tabslot, valsym, s, 0);
+
+        /* Later forms of a batch are compiled before the value is in the
+         * table, so they get it from a local */
+        if (c->scope->flags & JANET_SCOPE_BATCH)
+            namelocal(c, sym, 0, s);
         return 1;
     } else {
         return namelocal(c, sym, 0, s);
@@ -528,13 +548,17 @@ static JanetSlot janetc_while(JanetFopts opts, int32_t argn, const Janet *argv)
         janetc_freeslot(c, janetc_value(subopts, argv[i]));
     }
 
-    /* Check if closure created in while scope. If so,
-     * recompile in a function scope. */
-    if (tempscope.flags & JANET_SCOPE_CLOSURE) {
+    /* Check if a closure created in while scope captures a binding made
+     * in the loop. If so, recompile in a function scope, so each iteration
+     * gets fresh bindings. Closures that only capture bindings from outside
+     * the loop see the same ones either way, so the loop stays a loop. */
+    if (tempscope.flags & JANET_SCOPE_CAPTURED) {
         tempscope.flags |= JANET_SCOPE_UNUSED;
         janetc_popscope(c);
         janet_v__cnt(c->buffer) = labelwt;
         janet_v__cnt(c->mapbuffer) = labelwt;
+        while (janet_v_count(c->handlers) && janet_v_last(c->handlers).start >= labelwt)
+            janet_v_pop(c->handlers);
 
         janetc_scope(&tempscope, c, JANET_SCOPE_FUNCTION, "while-iife");
 
@@ -581,6 +605,87 @@ static JanetSlot janetc_while(JanetFopts opts, int32_t argn, const Janet *argv)
     return janetc_cslot(janet_wrap_nil());
 }
 
+/*
+ * :start
+ * ...
+ * :end
+ * jump done (return if tail)
+ * :handler
+ * ...
+ * :done
+ *
+ * Errors raised between :start and :end unwind to :handler in the
+ * same fiber, with the error value in the handler's slot.
+ */
+static JanetSlot janetc_try(JanetFopts opts, int32_t argn, const Janet *argv) {
+    JanetCompiler *c = opts.compiler;
+    int32_t labels, labele, labeljd, labelh, labeld;
+    JanetFopts bodyopts;
+    JanetSlot body, handler, target, errslot;
+    JanetScope tempscope;
+    const int tail = opts.flags & JANET_FOPTS_TAIL;
+    const int drop = opts.flags & JANET_FOPTS_DROP;
+
+    if (argn != 3) {
+        janetc_cerror(c, "expected 3 arguments to try*");
+        return janetc_cslot(janet_wrap_nil());
+    }
+    if (!janet_checktype(argv[1], JANET_SYMBOL)) {
+        janetc_cerror(c, "expected symbol for error binding");
+        return janetc_cslot(janet_wrap_nil());
+    }
+
+    /* A tail call would drop the frame holding the handler, so the body
+     * is never in tail position. */
+    bodyopts = opts;
+    bodyopts.flags &= ~JANET_FOPTS_TAIL;
+    target = drop
+        ? janetc_cslot(janet_wrap_nil())
+        : janetc_gettarget(opts);
+
+    /* Compile protected body */
+    labels = janet_v_count(c->buffer);
+    janetc_scope(&tempscope, c, 0, "try");
+    body = janetc_value(bodyopts, argv[0]);
+    if (!drop) janetc_copy(c, target, body);
+    janetc_popscope(c);
+    labele = janet_v_count(c->buffer);
+
+    /* Compile jump to done */
+    labeljd = janet_v_count(c->buffer);
+    if (tail) {
+        janetc_return(c, target);
+    } else {
+        janetc_emit(c, JOP_JUMP);
+    }
+
+    /* Compile handler */
+    labelh = janet_v_count(c->buffer);
+    janetc_scope(&tempscope, c, 0, "catch");
+    errslot = janetc_farslot(c);
+    janetc_nameslot(c, janet_unwrap_symbol(argv[1]), errslot);
+    handler = janetc_value(opts, argv[2]);
+    if (!drop && !tail) janetc_copy(c, target, handler);
+    janetc_popscope(c);
+
+    /* Register handler, innermost first. An empty body cannot raise. */
+    if (labele > labels) {
+        JanetHandler h;
+        h.start = labels;
+        h.end = labele;
+        h.target = labelh;
+        h.slot = errslot.index;
+        janet_v_push(c->handlers, h);
+    }
+
+    /* Write jump */
+    labeld = janet_v_count(c->buffer);
+    if (!tail) c->buffer[labeljd] |= (labeld - labeljd) << 8;
+
+    if (tail) target.flags |= JANET_SLOT_RETURNED;
+    return target;
+}
+
 static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
     JanetCompiler *c = opts.compiler;
     JanetFuncDef *def;
@@ -677,6 +782,7 @@ static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
 
     /* Ensure enough slots for vararg function. */
     if (arity + vararg > def->slotcount) def->slotcount = arity + vararg;
+    janetc_stackargs(def);
 
     /* Instantiate closure */
     ret = janetc_gettarget(opts);
@@ -690,6 +796,38 @@ error2:
     return janetc_cslot(janet_wrap_nil());
 }
 
+/* Compile a call to a function literal, as in ((fn [x] ...) 1), as a
+ * block that binds the parameters to the arguments. No closure is made,
+ * so the literal's references to enclosing locals do not need a heap
+ * environment, and an enclosing while loop is not recompiled as a
+ * function. The literal must be unnamed and take exactly the arguments. */
+JanetSlot janetc_iife(JanetFopts opts, const Janet *form, JanetSlot *slots) {
+    JanetCompiler *c = opts.compiler;
+    const Janet *params = janet_unwrap_tuple(form[1]);
+    int32_t i, argn = janet_tuple_length(form) - 2;
+    const Janet *argv = form + 2;
+    JanetSlot ret = janetc_cslot(janet_wrap_nil());
+    JanetFopts subopts = janetc_fopts_default(c);
+    JanetScope tempscope;
+    janetc_scope(&tempscope, c, 0, "fn");
+    for (i = 0; i < janet_tuple_length(params); i++)
+        destructure(c, params[i], slots[i], defleaf, NULL);
+    for (i = 0; i < argn; i++) {
+        if (i != argn - 1) {
+            subopts.flags = JANET_FOPTS_DROP;
+        } else {
+            subopts = opts;
+        }
+        ret = janetc_value(subopts, argv[i]);
+        if (i != argn - 1) {
+            janetc_freeslot(c, ret);
+        }
+    }
+    janetc_popscope_keepslot(c, ret);
+    janetc_freeslots(c, slots);
+    return ret;
+}
+
 /* Keep in lexicographic order */
 static const JanetSpecial janetc_specials[] = {
     {"def", janetc_def},
@@ -700,6 +838,7 @@ static const JanetSpecial janetc_specials[] = {
     {"quote", janetc_quote},
     {"set", janetc_varset},
     {"splice", janetc_splice},
+    {"try*", janetc_try},
     {"unquote", janetc_unquote},
     {"var", janetc_var},
     {"while", janetc_while}
@@ -39,6 +39,14 @@ extern JANET_THREAD_LOCAL int janet_vm_stackn;
  * Set and unset by janet_run. */
 extern JANET_THREAD_LOCAL JanetFiber *janet_vm_fiber;
 
+/* The innermost running fiber with a quota, or NULL. Fibers
+ * with quotas are linked through quotaparent. */
+extern JANET_THREAD_LOCAL JanetFiber *janet_vm_quota;
+
+/* The fiber that ran over its quota while the error is unwinding to its
+ * parent, or NULL. No fiber below the parent can catch the error. */
+extern JANET_THREAD_LOCAL JanetFiber *janet_vm_overquota;
+
 /* The current pointer to the inner most jmp_buf. The current
  * return point for panics. */
 extern JANET_THREAD_LOCAL jmp_buf *janet_vm_jmp_buf;
@@ -48,6 +56,9 @@ extern JANET_THREAD_LOCAL Janet *janet_vm_return_reg;
  * along with otherwise bare c function pointers. */
 extern JANET_THREAD_LOCAL JanetTable *janet_vm_registry;
 
+/* Abstract types that can be unmarshalled, found by name */
+extern JANET_THREAD_LOCAL const JanetAbstractType **janet_vm_abstract_types;
+
 /* Immutable value cache */
 extern JANET_THREAD_LOCAL const uint8_t **janet_vm_cache;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_cache_capacity;
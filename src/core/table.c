@@ -68,6 +68,7 @@ JanetKV *janet_table_find(JanetTable *t, Janet key) {
 /* Resize the dictionary table. */
 static void janet_table_rehash(JanetTable *t, int32_t size) {
     JanetKV *olddata = t->data;
+    janet_gccharge(size * sizeof(JanetKV));
     JanetKV *newdata = (JanetKV *) janet_memalloc_empty(size);
     if (NULL == newdata) {
         JANET_OUT_OF_MEMORY;
@@ -27,6 +27,7 @@
 #include "util.h"
 #include "state.h"
 #include "gc.h"
+#include "vector.h"
 #endif
 
 /* Base 64 lookup table for digits */
@@ -57,7 +58,7 @@ const char *const janet_type_names[16] = {
     "abstract"
 };
 
-const char *const janet_signal_names[14] = {
+const char *const janet_signal_names[15] = {
     "ok",
     "error",
     "debug",
@@ -71,10 +72,11 @@ const char *const janet_signal_names[14] = {
     "user6",
     "user7",
     "user8",
-    "user9"
+    "user9",
+    "interrupt"
 };
 
-const char *const janet_status_names[16] = {
+const char *const janet_status_names[17] = {
     "dead",
     "error",
     "debug",
@@ -89,6 +91,7 @@ const char *const janet_status_names[16] = {
     "user7",
     "user8",
     "user9",
+    "interrupted",
     "new",
     "alive"
 };
@@ -240,6 +243,21 @@ void janet_register(const char *name, JanetCFunction cfun) {
     janet_table_put(janet_vm_registry, key, value);
 }
 
+/* Register an abstract type so its values can be unmarshalled */
+void janet_register_abstract_type(const JanetAbstractType *at) {
+    for (int32_t i = 0; i < janet_v_count(janet_vm_abstract_types); i++)
+        if (janet_vm_abstract_types[i] == at) return;
+    janet_v_push(janet_vm_abstract_types, at);
+}
+
+/* Find a registered abstract type by name, or NULL */
+const JanetAbstractType *janet_get_abstract_type(const uint8_t *name) {
+    for (int32_t i = 0; i < janet_v_count(janet_vm_abstract_types); i++)
+        if (!janet_cstrcmp(name, janet_vm_abstract_types[i]->name))
+            return janet_vm_abstract_types[i];
+    return NULL;
+}
+
 /* Add a def to an environment */
 void janet_def(JanetTable *env, const char *name, Janet val, const char *doc) {
     JanetTable *subt = janet_table(2);
@@ -45,6 +45,13 @@ void janet_buffer_push_types(JanetBuffer *buffer, int types);
 const JanetKV *janet_dict_find(const JanetKV *buckets, int32_t cap, Janet key);
 Janet janet_dict_get(const JanetKV *buckets, int32_t cap, Janet key);
 void janet_memempty(JanetKV *mem, int32_t count);
+void janet_funcdef_load(JanetFuncDef *def);
+uint8_t *janet_sourcemap_encode(const JanetSourceMapping *map, int32_t n, int32_t *len);
+JanetSourceMapping *janet_sourcemap_decode(const JanetFuncDef *def);
+int janet_sourcemap_get(const JanetFuncDef *def, int32_t pc, JanetSourceMapping *out);
+int janet_sourcemap_check(const uint8_t *data, int32_t len, int32_t n);
+FILE *janet_io_getfile(Janet x, int write);
+const JanetAbstractType *janet_get_abstract_type(const uint8_t *name);
 void *janet_memalloc_empty(int32_t count);
 const void *janet_strbinsearch(
         const void *tab,
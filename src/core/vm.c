@@ -27,14 +27,18 @@
 #include "gc.h"
 #include "symcache.h"
 #include "util.h"
+#include "vector.h"
 #endif
 
 /* VM state */
 JANET_THREAD_LOCAL JanetTable *janet_vm_registry;
+JANET_THREAD_LOCAL const JanetAbstractType **janet_vm_abstract_types = NULL;
 JANET_THREAD_LOCAL int janet_vm_stackn = 0;
 JANET_THREAD_LOCAL JanetFiber *janet_vm_fiber = NULL;
 JANET_THREAD_LOCAL Janet *janet_vm_return_reg = NULL;
 JANET_THREAD_LOCAL jmp_buf *janet_vm_jmp_buf = NULL;
+JANET_THREAD_LOCAL JanetFiber *janet_vm_quota = NULL;
+JANET_THREAD_LOCAL JanetFiber *janet_vm_overquota = NULL;
 
 /* Virtual registers
  *
@@ -131,6 +135,16 @@ static void *op_lookup[255] = {
     &&label_JOP_NUMERIC_GREATER_THAN,
     &&label_JOP_NUMERIC_GREATER_THAN_EQUAL,
     &&label_JOP_NUMERIC_EQUAL,
+    &&label_JOP_NUMERIC_LESS_THAN_JUMP,
+    &&label_JOP_NUMERIC_LESS_THAN_EQUAL_JUMP,
+    &&label_JOP_NUMERIC_GREATER_THAN_JUMP,
+    &&label_JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP,
+    &&label_JOP_NUMERIC_EQUAL_JUMP,
+    &&label_JOP_EQUALS_JUMP,
+    &&label_JOP_NUMERIC_FOR_LESS_THAN,
+    &&label_JOP_GET_VARARG,
+    &&label_JOP_GET_INDEX_VARARG,
+    &&label_JOP_PUSH_VARARG,
     &&label_unknown_op
 };
 #else
@@ -150,17 +164,38 @@ static void *op_lookup[255] = {
 } while (0)
 #define vm_return(sig, val) do { \
     vm_commit(); \
-    janet_vm_return_reg[0] = (val); \
-    return (sig); \
+    signal = (sig); \
+    sigval = (val); \
+    goto vm_signal; \
 } while (0)
 
 /* Next instruction variations */
 #define maybe_collect() do {\
-    if (janet_vm_next_collection >= janet_vm_gc_interval) janet_collect(); } while (0)
+    if (janet_vm_next_collection >= janet_vm_gc_interval) janet_collect(); \
+    if (janet_vm_quota) vm_check_quota(0); } while (0)
 #define vm_checkgc_next() maybe_collect(); vm_next()
 #define vm_pcnext() pc++; vm_next()
 #define vm_checkgc_pcnext() maybe_collect(); vm_pcnext()
 
+/* Charge a back edge or call against the fiber's budget. When the budget is
+ * used up, suspend before the instruction runs so resuming the fiber simply
+ * retries it. Costs a single test of the fiber's budget when disabled. */
+#define vm_maybe_interrupt(cond) do { \
+    if (fiber->budget && (cond) && fiber->ticks-- <= 0) { \
+        vm_return(JANET_SIGNAL_INTERRUPT, janet_wrap_nil()); \
+    } \
+    if (janet_vm_quota && (cond)) vm_check_quota(1); \
+} while (0)
+
+/* Raise an error in the running fiber if it or a fiber that resumed it
+ * is over quota. Quotas are only checked at these safe points, so a
+ * single C function may allocate past the memory quota before it is
+ * noticed. */
+#define vm_check_quota(tick) do { \
+    const char *qmsg = vm_quota(tick); \
+    if (NULL != qmsg) vm_throw(qmsg); \
+} while (0)
+
 /* Handle certain errors in main vm loop */
 #define vm_throw(e) do { vm_commit(); janet_panic(e); } while (0)
 #define vm_assert(cond, e) do {if (!(cond)) vm_throw((e)); } while (0)
@@ -209,6 +244,30 @@ static void *op_lookup[255] = {
     }
 #define vm_binop(op) _vm_binop(op, janet_wrap_number)
 #define vm_numcomp(op) _vm_binop(op, janet_wrap_boolean)
+
+/* Compare, then run the JOP_JUMP_IF_NOT on the result that always
+ * follows in the next instruction word. */
+#define vm_compjump(x)\
+    {\
+        int cond = (x);\
+        stack[A] = janet_wrap_boolean(cond);\
+        pc++;\
+        if (cond) {\
+            vm_pcnext();\
+        }\
+        vm_maybe_interrupt(ES <= 0);\
+        pc += ES;\
+        vm_next();\
+    }
+#define vm_numcompjump(op)\
+    {\
+        Janet op1 = stack[B];\
+        Janet op2 = stack[C];\
+        vm_assert_type(op1, JANET_NUMBER);\
+        vm_assert_type(op2, JANET_NUMBER);\
+        vm_compjump(janet_unwrap_number(op1) op janet_unwrap_number(op2));\
+    }
+
 #define _vm_bitop(op, type1)\
     {\
         Janet op1 = stack[B];\
@@ -239,13 +298,142 @@ static Janet call_nonfn(JanetFiber *fiber, Janet callee) {
     return janet_get(ds, key);
 }
 
-/* Interpreter main loop */
-static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status) {
+/* Charge a tick to each running fiber with a quota. Returns an error
+ * message if any of them is over quota, and marks the outermost such
+ * fiber so the error goes to its parent. */
+static const char *vm_quota(int tick) {
+    const char *msg = NULL;
+    for (JanetFiber *q = janet_vm_quota; NULL != q; q = q->quotaparent) {
+        q->tickused += tick;
+        if (q->tickquota && q->tickused > q->tickquota) {
+            msg = "fiber exceeded tick quota";
+            janet_vm_overquota = q;
+        } else if (q->memquota && q->memused > q->memquota) {
+            msg = "fiber exceeded memory quota";
+            janet_vm_overquota = q;
+        }
+    }
+    return msg;
+}
+
+/* Start charging resources to a fiber that is about to run */
+static void vm_quota_enter(JanetFiber *fiber) {
+    if (fiber->memquota || fiber->tickquota) {
+        fiber->quotaparent = janet_vm_quota;
+        janet_vm_quota = fiber;
+    }
+}
+
+/* Stop charging resources to a fiber that has signaled */
+static void vm_quota_leave(JanetFiber *fiber) {
+    if (janet_vm_quota == fiber) {
+        janet_vm_quota = fiber->quotaparent;
+        fiber->quotaparent = NULL;
+    }
+}
+
+/* Look for an error handler covering the current instruction of each frame,
+ * from the top of the stack down to the frame at index bottom. If one is found,
+ * unwind the fiber to that frame, store the error, and move the frame's pc to
+ * the handler. Returns 0 if the error is not handled. Quota errors are
+ * not handled until they leave the fiber that ran over quota. */
+static int vm_catch(JanetFiber *fiber, int32_t bottom, Janet err) {
+    int32_t frame = fiber->frame;
+    if (NULL != janet_vm_overquota) return 0;
+    while (frame > 0 && frame >= bottom) {
+        JanetStackFrame *f = janet_stack_frame(fiber->data + frame);
+        JanetFuncDef *def = f->func ? f->func->def : NULL;
+        if (NULL != def && NULL != def->handlers) {
+            int32_t off = (int32_t)(f->pc - def->bytecode);
+            for (int32_t i = 0; i < def->handlers_length; i++) {
+                JanetHandler h = def->handlers[i];
+                if (off >= h.start && off < h.end) {
+                    while (fiber->frame != frame)
+                        janet_fiber_popframe(fiber);
+                    /* The frame may keep varargs past its slots, so use
+                     * the end left by popping the frames above it. */
+                    fiber->stacktop = fiber->stackstart;
+                    fiber->child = NULL;
+                    fiber->data[frame + h.slot] = err;
+                    f->pc = def->bytecode + h.target;
+                    return 1;
+                }
+            }
+        }
+        frame = f->prevframe;
+    }
+    return 0;
+}
+
+/* Pass a signal from a fiber resumed inline up to the fiber that resumed it,
+ * as janet_continue and JOP_RESUME would. Fibers resumed inline stay alive
+ * and linked through resumer until they signal, and each one counts
+ * towards janet_vm_stackn. Returns the fiber to continue running, or NULL
+ * if the signal reaches root. */
+static JanetFiber *vm_deliver(JanetFiber *root, int32_t bottom,
+        JanetFiber *fiber, JanetSignal sig, Janet val) {
+    while (fiber != root) {
+        JanetFiber *parent = fiber->resumer;
+        fiber->resumer = NULL;
+        janet_vm_stackn--;
+        janet_fiber_set_status(fiber, sig);
+        vm_quota_leave(fiber);
+        int overquota = sig == JANET_SIGNAL_ERROR && NULL != janet_vm_overquota;
+        if (fiber == janet_vm_overquota) {
+            janet_vm_overquota = NULL;
+            overquota = 0;
+        }
+        if (!overquota && (sig == JANET_SIGNAL_OK || (fiber->flags & (1 << sig)))) {
+            Janet *stack = parent->data + parent->frame;
+            uint32_t *pc = janet_stack_frame(stack)->pc;
+            parent->child = NULL;
+            stack[A] = val;
+            janet_stack_frame(stack)->pc = pc + 1;
+            return parent;
+        }
+        if (sig == JANET_SIGNAL_ERROR &&
+                vm_catch(parent, parent == root ? bottom : 0, val))
+            return parent;
+        fiber = parent;
+    }
+    return NULL;
+}
+
+/* Handle an error raised while running root or a fiber resumed inline
+ * from it. The error was raised in janet_vm_fiber, the innermost of them.
+ * Returns the fiber to continue running, or NULL if the error escapes root. */
+static JanetFiber *vm_unwind(JanetFiber *root, int32_t bottom, Janet err) {
+    JanetFiber *fiber = janet_vm_fiber;
+    if (vm_catch(fiber, fiber == root ? bottom : 0, err)) return fiber;
+    return vm_deliver(root, bottom, fiber, JANET_SIGNAL_ERROR, err);
+}
+
+/* Get the number of varargs kept on the stack by the current frame, given
+ * the count in its rest parameter. The count is clamped to the frame, so
+ * assembled bytecode cannot read past it. */
+static int32_t vm_stackargs(JanetFiber *fiber, JanetFunction *func, Janet count) {
+    int32_t avail = fiber->stackstart - JANET_FRAME_SIZE - fiber->frame - func->def->slotcount;
+    int32_t n = janet_checkint(count) ? janet_unwrap_integer(count) : 0;
+    if (n > avail) n = avail;
+    return n < 0 ? 0 : n;
+}
+
+/* Interpreter main loop. Fibers resumed with JOP_RESUME run in this loop
+ * too, so after an error handler has unwound the stack, fiber is the one
+ * resumed from root that the handler is in. */
+static JanetSignal run_vm(JanetFiber *root, JanetFiber *fiber, Janet in, JanetFiberStatus status) {
 
     /* Interpreter state */
     register Janet *stack;
     register uint32_t *pc;
     register JanetFunction *func;
+    JanetSignal signal;
+    Janet sigval;
+    uint8_t first_opcode;
+
+    /* Switch to another fiber */
+vm_enter:
+    janet_vm_fiber = fiber;
     vm_restore();
 
     /* Only should be hit if the fiber is either waiting for a child, or
@@ -261,7 +449,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     /* The first opcode to execute. If the first opcode has
      * the breakpoint bit set and we were in the debug state, skip
      * that first breakpoint. */
-    uint8_t first_opcode = (status == JANET_STATUS_DEBUG)
+    first_opcode = (status == JANET_STATUS_DEBUG)
         ? (*pc & 0x7F)
         : (*pc & 0xFF);
 
@@ -276,7 +464,9 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     vm_pcnext();
 
     VM_OP(JOP_ERROR)
-    vm_return(JANET_SIGNAL_ERROR, stack[A]);
+    vm_commit();
+    janet_panicv(stack[A]);
+    vm_next();
 
     VM_OP(JOP_TYPECHECK)
     vm_assert_types(stack[A], E);
@@ -334,6 +524,43 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     VM_OP(JOP_NUMERIC_EQUAL)
     vm_numcomp(==);
 
+    VM_OP(JOP_NUMERIC_LESS_THAN_JUMP)
+    vm_numcompjump(<);
+
+    VM_OP(JOP_NUMERIC_LESS_THAN_EQUAL_JUMP)
+    vm_numcompjump(<=);
+
+    VM_OP(JOP_NUMERIC_GREATER_THAN_JUMP)
+    vm_numcompjump(>);
+
+    VM_OP(JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP)
+    vm_numcompjump(>=);
+
+    VM_OP(JOP_NUMERIC_EQUAL_JUMP)
+    vm_numcompjump(==);
+
+    VM_OP(JOP_EQUALS_JUMP)
+    vm_compjump(janet_equals(stack[B], stack[C]));
+
+    /* Step a loop counter, then run the JOP_JUMP back to the loop body
+     * that always follows if the counter is still below the limit. */
+    VM_OP(JOP_NUMERIC_FOR_LESS_THAN)
+    {
+        Janet op1 = stack[A];
+        vm_assert_type(op1, JANET_NUMBER);
+        double x1 = janet_unwrap_number(op1) + CS;
+        stack[A] = janet_wrap_number(x1);
+        Janet op2 = stack[B];
+        vm_assert_type(op2, JANET_NUMBER);
+        pc++;
+        if (x1 < janet_unwrap_number(op2)) {
+            vm_maybe_interrupt(DS <= 0);
+            pc += DS;
+            vm_next();
+        }
+        vm_pcnext();
+    }
+
     VM_OP(JOP_DIVIDE_IMMEDIATE)
     vm_binop_immediate(/);
 
@@ -384,11 +611,13 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     vm_pcnext();
 
     VM_OP(JOP_JUMP)
+    vm_maybe_interrupt(DS <= 0);
     pc += DS;
     vm_next();
 
     VM_OP(JOP_JUMP_IF)
     if (janet_truthy(stack[A])) {
+        vm_maybe_interrupt(ES <= 0);
         pc += ES;
     } else {
         pc++;
@@ -399,6 +628,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     if (janet_truthy(stack[A])) {
         pc++;
     } else {
+        vm_maybe_interrupt(ES <= 0);
         pc += ES;
     }
     vm_next();
@@ -550,14 +780,29 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         if (janet_indexed_view(stack[D], &vals, &len)) {
             janet_fiber_pushn(fiber, vals, len);
         } else {
+            vm_commit();
             janet_panicf("expected %T, got %t", JANET_TFLAG_INDEXED, stack[D]);
         }
     }
     stack = fiber->data + fiber->frame;
     vm_checkgc_pcnext();
 
+    VM_OP(JOP_PUSH_VARARG)
+    {
+        int32_t n = vm_stackargs(fiber, func, stack[D]);
+        int32_t newtop = fiber->stacktop + n;
+        if (newtop > fiber->capacity) {
+            vm_commit();
+            janet_fiber_setcapacity(fiber, 2 * newtop);
+            stack = fiber->data + fiber->frame;
+        }
+        janet_fiber_pushn(fiber, stack + func->def->slotcount, n);
+    }
+    vm_checkgc_pcnext();
+
     VM_OP(JOP_CALL)
     {
+        vm_maybe_interrupt(1);
         Janet callee = stack[E];
         if (fiber->stacktop > fiber->maxstack) {
             vm_throw("stack overflow");
@@ -598,6 +843,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
 
     VM_OP(JOP_TAILCALL)
     {
+        vm_maybe_interrupt(1);
         Janet callee = stack[D];
         if (janet_checktype(callee, JANET_KEYWORD)) {
             vm_commit();
@@ -642,8 +888,28 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         Janet retreg;
         vm_assert_type(stack[B], JANET_FIBER);
         JanetFiber *child = janet_unwrap_fiber(stack[B]);
-        fiber->child = child;
+        JanetFiberStatus cstatus = janet_fiber_status(child);
+        int resumable = cstatus != JANET_STATUS_ALIVE &&
+            cstatus != JANET_STATUS_DEAD &&
+            cstatus != JANET_STATUS_ERROR;
+        vm_commit();
+        if (resumable) fiber->child = child;
+        if (resumable && NULL == child->child && janet_vm_stackn < JANET_RECURSION_GUARD) {
+            /* Switch to the child without leaving the loop */
+            janet_vm_stackn++;
+            child->resumer = fiber;
+            janet_fiber_set_status(child, JANET_STATUS_ALIVE);
+            child->ticks = child->budget;
+            vm_quota_enter(child);
+            in = stack[C];
+            status = cstatus;
+            fiber = child;
+            goto vm_enter;
+        }
         JanetSignal sig = janet_continue(child, stack[C], &retreg);
+        if (sig == JANET_SIGNAL_ERROR &&
+                (NULL != janet_vm_overquota || !(child->flags & JANET_FIBER_MASK_ERROR)))
+            janet_panicv(retreg);
         if (sig != JANET_SIGNAL_OK && !(child->flags & (1 << sig)))
             vm_return(sig, retreg);
         fiber->child = NULL;
@@ -656,6 +922,10 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         int32_t s = C;
         if (s > JANET_SIGNAL_USER9) s = JANET_SIGNAL_USER9;
         if (s < 0) s = 0;
+        if (s == JANET_SIGNAL_ERROR) {
+            vm_commit();
+            janet_panicv(stack[B]);
+        }
         vm_return(s, stack[B]);
     }
 
@@ -679,6 +949,23 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     stack[A] = janet_getindex(stack[B], C);
     vm_pcnext();
 
+    VM_OP(JOP_GET_VARARG)
+    {
+        Janet key = stack[C];
+        if (!janet_checkint(key)) vm_throw("expected integer key");
+        int32_t index = janet_unwrap_integer(key);
+        stack[A] = (index >= 0 && index < vm_stackargs(fiber, func, stack[B]))
+                   ? stack[func->def->slotcount + index]
+                   : janet_wrap_nil();
+        vm_pcnext();
+    }
+
+    VM_OP(JOP_GET_INDEX_VARARG)
+    stack[A] = ((int32_t) C < vm_stackargs(fiber, func, stack[B]))
+               ? stack[func->def->slotcount + C]
+               : janet_wrap_nil();
+    vm_pcnext();
+
     VM_OP(JOP_LENGTH)
     vm_commit();
     stack[A] = janet_wrap_integer(janet_length(stack[E]));
@@ -757,11 +1044,28 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_END()
+
+    /* Signals from fibers resumed inline go to their parent fiber */
+vm_signal:
+    if (fiber != root) {
+        JanetFiber *next = vm_deliver(root, 0, fiber, signal, sigval);
+        if (NULL != next) {
+            fiber = next;
+            status = JANET_STATUS_NEW;
+            goto vm_enter;
+        }
+    }
+    janet_vm_fiber = root;
+    janet_vm_return_reg[0] = sigval;
+    return signal;
 }
 
 Janet janet_call(JanetFunction *fun, int32_t argc, const Janet *argv) {
     Janet ret;
+    jmp_buf buf;
     Janet *old_return_reg = janet_vm_return_reg;
+    jmp_buf *old_jmp_buf = janet_vm_jmp_buf;
+    JanetFiber *old_quota = janet_vm_quota;
 
     /* Check entry conditions */
     if (!janet_vm_fiber)
@@ -776,18 +1080,39 @@ Janet janet_call(JanetFunction *fun, int32_t argc, const Janet *argv) {
     }
     janet_fiber_frame(janet_vm_fiber)->flags |= JANET_STACKFRAME_ENTRANCE;
 
-    /* Set up */
+    /* Set up. Interrupts cannot cross the C stack, so run without a budget. */
+    JanetFiber *fiber = janet_vm_fiber;
+    int32_t entrance = fiber->frame;
+    int32_t oldbudget = fiber->budget;
+    fiber->budget = 0;
     int32_t oldn = janet_vm_stackn++;
     int handle = janet_gclock();
     janet_vm_return_reg = &ret;
+    janet_vm_jmp_buf = &buf;
 
-    /* Run vm */
-    JanetSignal signal = run_vm(janet_vm_fiber,
-            janet_wrap_nil(),
-            JANET_STATUS_ALIVE);
+    /* Run vm. Errors may only be handled by frames above the C stack. */
+    JanetSignal signal;
+    if (setjmp(buf)) {
+        JanetFiber *next = vm_unwind(fiber, entrance, ret);
+        if (NULL != next) {
+            janet_vm_gc_suspend = handle + 1;
+            janet_vm_return_reg = &ret;
+            signal = run_vm(fiber, next, janet_wrap_nil(), JANET_STATUS_NEW);
+        } else {
+            signal = JANET_SIGNAL_ERROR;
+        }
+    } else {
+        signal = run_vm(fiber, fiber,
+                janet_wrap_nil(),
+                JANET_STATUS_ALIVE);
+    }
 
     /* Teardown */
+    janet_vm_fiber = fiber;
+    fiber->budget = oldbudget;
     janet_vm_return_reg = old_return_reg;
+    janet_vm_jmp_buf = old_jmp_buf;
+    janet_vm_quota = old_quota;
     janet_vm_stackn = oldn;
     janet_gcunlock(handle);
 
@@ -820,7 +1145,9 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
         janet_vm_stackn++;
         JanetSignal sig = janet_continue(child, in, &in);
         janet_vm_stackn--;
-        if (sig != JANET_SIGNAL_OK && !(child->flags & (1 << sig))) {
+        if (sig != JANET_SIGNAL_OK &&
+                (!(child->flags & (1 << sig)) ||
+                 (sig == JANET_SIGNAL_ERROR && NULL != janet_vm_overquota))) {
             *out = in;
             return sig;
         }
@@ -833,25 +1160,37 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
     JanetFiber *old_vm_fiber = janet_vm_fiber;
     jmp_buf *old_vm_jmp_buf = janet_vm_jmp_buf;
     Janet *old_vm_return_reg = janet_vm_return_reg;
+    JanetFiber *old_vm_quota = janet_vm_quota;
 
     /* Setup fiber */
     janet_vm_fiber = fiber;
     janet_gcroot(janet_wrap_fiber(fiber));
     janet_fiber_set_status(fiber, JANET_STATUS_ALIVE);
+    fiber->ticks = fiber->budget;
+    vm_quota_enter(fiber);
     janet_vm_return_reg = out;
     janet_vm_jmp_buf = &buf;
 
-    /* Run loop */
+    /* Run loop. An error handled inside the fiber continues it in place. */
     JanetSignal signal;
     if (setjmp(buf)) {
-        signal = JANET_SIGNAL_ERROR;
+        JanetFiber *next = vm_unwind(fiber, 0, *out);
+        if (NULL != next) {
+            janet_vm_gc_suspend = handle;
+            janet_vm_return_reg = out;
+            signal = run_vm(fiber, next, janet_wrap_nil(), JANET_STATUS_NEW);
+        } else {
+            signal = JANET_SIGNAL_ERROR;
+        }
     } else {
-        signal = run_vm(fiber, in, old_status);
+        signal = run_vm(fiber, fiber, in, old_status);
     }
 
-    /* Tear down fiber */
+    /* Tear down fiber. A quota error from this fiber can now be caught
+     * by its parent. */
     janet_fiber_set_status(fiber, signal);
     janet_gcunroot(janet_wrap_fiber(fiber));
+    if (janet_vm_overquota == fiber) janet_vm_overquota = NULL;
 
     /* Restore global state */
     janet_vm_gc_suspend = handle;
@@ -859,6 +1198,7 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
     janet_vm_stackn = oldn;
     janet_vm_return_reg = old_vm_return_reg;
     janet_vm_jmp_buf = old_vm_jmp_buf;
+    janet_vm_quota = old_vm_quota;
 
     /* Pop error or return value from fiber stack */
 
@@ -898,16 +1238,20 @@ int janet_init(void) {
     /* Initialize registry */
     janet_vm_registry = janet_table(0);
     janet_gcroot(janet_wrap_table(janet_vm_registry));
+    janet_vm_abstract_types = NULL;
     return 0;
 }
 
 /* Clear all memory associated with the VM */
 void janet_deinit(void) {
     janet_clear_memory();
+    janet_fiber_pool_deinit();
     janet_symcache_deinit();
     free(janet_vm_roots);
     janet_vm_roots = NULL;
     janet_vm_root_count = 0;
     janet_vm_root_capacity = 0;
     janet_vm_registry = NULL;
+    janet_v_free(janet_vm_abstract_types);
+    janet_vm_abstract_types = NULL;
 }
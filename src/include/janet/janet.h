@@ -164,6 +164,10 @@ extern "C" {
 /* Maximum depth to follow table prototypes before giving up and returning nil. */
 #define JANET_MAX_MACRO_EXPAND 200
 
+/* Maximum number of top level forms compiled into one function by
+ * janet_compile_batch. */
+#define JANET_BATCH_MAX 128
+
 /* Define max stack size for stacks before raising a stack overflow error.
  * If this is not defined, fiber stacks can grow without limit (until memory
  * runs out) */
@@ -202,8 +206,8 @@ extern "C" {
 
 /* Names of all of the types */
 extern const char *const janet_type_names[16];
-extern const char *const janet_signal_names[14];
-extern const char *const janet_status_names[16];
+extern const char *const janet_signal_names[15];
+extern const char *const janet_status_names[17];
 
 /* Fiber signals */
 typedef enum {
@@ -220,7 +224,8 @@ typedef enum {
     JANET_SIGNAL_USER6,
     JANET_SIGNAL_USER7,
     JANET_SIGNAL_USER8,
-    JANET_SIGNAL_USER9
+    JANET_SIGNAL_USER9,
+    JANET_SIGNAL_INTERRUPT /* The fiber ran out of its instruction budget */
 } JanetSignal;
 
 /* Fiber statuses - mostly corresponds to signals. */
@@ -239,6 +244,7 @@ typedef enum {
     JANET_STATUS_USER7,
     JANET_STATUS_USER8,
     JANET_STATUS_USER9,
+    JANET_STATUS_INTERRUPTED,
     JANET_STATUS_NEW,
     JANET_STATUS_ALIVE
 } JanetFiberStatus;
@@ -267,6 +273,9 @@ typedef struct JanetStackFrame JanetStackFrame;
 typedef struct JanetAbstractType JanetAbstractType;
 typedef struct JanetReg JanetReg;
 typedef struct JanetSourceMapping JanetSourceMapping;
+typedef struct JanetHandler JanetHandler;
+typedef struct JanetLazyCode JanetLazyCode;
+typedef struct JanetMarshalContext JanetMarshalContext;
 typedef struct JanetView JanetView;
 typedef struct JanetByteView JanetByteView;
 typedef struct JanetDictView JanetDictView;
@@ -588,6 +597,7 @@ JANET_API int janet_checkint64(Janet x);
 
 #define JANET_FIBER_MASK_USERN(N) (16 << (N))
 #define JANET_FIBER_MASK_USER 0x3FF0
+#define JANET_FIBER_MASK_INTERRUPT 0x4000
 
 #define JANET_FIBER_STATUS_MASK 0xFF0000
 #define JANET_FIBER_STATUS_OFFSET 16
@@ -597,12 +607,20 @@ JANET_API int janet_checkint64(Janet x);
 struct JanetFiber {
     Janet *data;
     JanetFiber *child; /* Keep linked list of fibers for restarting pending fibers */
+    JanetFiber *resumer; /* Fiber that resumed this one in the same interpreter loop, while it runs */
     int32_t frame; /* Index of the stack frame */
     int32_t stackstart; /* Beginning of next args */
     int32_t stacktop; /* Top of stack. Where values are pushed and popped from. */
     int32_t capacity;
     int32_t maxstack; /* Arbitrary defined limit for stack overflow */
     int32_t flags; /* Various flags */
+    int32_t budget; /* Back edges and calls allowed per resume before an interrupt. 0 disables. */
+    int32_t ticks; /* Back edges and calls left in the current resume */
+    JanetFiber *quotaparent; /* Next fiber with a quota while this one is running */
+    size_t memquota; /* Bytes this fiber and fibers it resumes may allocate. 0 disables. */
+    size_t memused;
+    size_t tickquota; /* Back edges and calls this fiber and fibers it resumes may run. 0 disables. */
+    size_t tickused;
 };
 
 /* Mark if a stack frame is a tail call for debugging */
@@ -661,6 +679,8 @@ struct JanetKV {
 #define JANET_FUNCDEF_FLAG_HASDEFS 0x200000
 #define JANET_FUNCDEF_FLAG_HASENVS 0x400000
 #define JANET_FUNCDEF_FLAG_HASSOURCEMAP 0x800000
+#define JANET_FUNCDEF_FLAG_HASHANDLERS 0x1000000
+#define JANET_FUNCDEF_FLAG_STACKARGS 0x2000000
 #define JANET_FUNCDEF_FLAG_TAG 0xFFFF
 
 /* Source mapping structure for a bytecode instruction */
@@ -669,18 +689,43 @@ struct JanetSourceMapping {
     int32_t end;
 };
 
+/* An error handler for a range of bytecode. Errors raised while executing
+ * an instruction in [start, end) store the error in slot and continue at target. */
+struct JanetHandler {
+    int32_t start;
+    int32_t end;
+    int32_t target;
+    int32_t slot;
+};
+
+/* Undecoded bytecode and sourcemap of a function definition that was
+ * unmarshalled lazily. image is the string or mapped file holding the
+ * marshalled bytes, or nil if the caller keeps them alive. version is
+ * the marshal format version of the bytes. */
+struct JanetLazyCode {
+    const uint8_t *bytecode;
+    const uint8_t *sourcemap;
+    const uint8_t *end;
+    Janet image;
+    int32_t version;
+};
+
 /* A function definition. Contains information needed to instantiate closures. */
 struct JanetFuncDef {
     int32_t *environments; /* Which environments to capture from parent. */
     Janet *constants;
     JanetFuncDef **defs;
     uint32_t *bytecode;
+    JanetHandler *handlers; /* Innermost first */
 
-    /* Various debug information */
-    JanetSourceMapping *sourcemap;
+    /* Various debug information. The sourcemap is compact, see debug.c */
+    uint8_t *sourcemap;
     const uint8_t *source;
     const uint8_t *name;
 
+    /* Set until the code of a lazily unmarshalled def is first used */
+    JanetLazyCode *lazy;
+
     int32_t flags;
     int32_t slotcount; /* The amount of stack space required for the function */
     int32_t arity; /* Not including varargs */
@@ -688,6 +733,8 @@ struct JanetFuncDef {
     int32_t bytecode_length;
     int32_t environments_length;
     int32_t defs_length;
+    int32_t handlers_length;
+    int32_t sourcemap_length;
 };
 
 /* A function environment */
@@ -733,11 +780,27 @@ struct JanetParser {
     int lookback;
 };
 
-/* Defines an abstract type */
+/* Defines an abstract type. marshal and unmarshal are optional, and let
+ * values of the type be marshalled once the type is registered with
+ * janet_register_abstract_type. unmarshal must create the value with
+ * janet_unmarshal_abstract before reading any janet values, and returns
+ * NULL if the data is invalid. */
 struct JanetAbstractType {
     const char *name;
     int (*gc)(void *data, size_t len);
     int (*gcmark)(void *data, size_t len);
+    void (*marshal)(void *data, JanetMarshalContext *ctx);
+    void *(*unmarshal)(JanetMarshalContext *ctx);
+};
+
+/* State passed to the marshal hooks of an abstract type */
+struct JanetMarshalContext {
+    void *m_state;
+    void *u_state;
+    const JanetAbstractType *at;
+    const uint8_t *data;
+    void *abstract;
+    int flags;
 };
 
 /* Contains information about abstract types */
@@ -876,6 +939,16 @@ enum JanetOpCode {
     JOP_NUMERIC_GREATER_THAN,
     JOP_NUMERIC_GREATER_THAN_EQUAL,
     JOP_NUMERIC_EQUAL,
+    JOP_NUMERIC_LESS_THAN_JUMP,
+    JOP_NUMERIC_LESS_THAN_EQUAL_JUMP,
+    JOP_NUMERIC_GREATER_THAN_JUMP,
+    JOP_NUMERIC_GREATER_THAN_EQUAL_JUMP,
+    JOP_NUMERIC_EQUAL_JUMP,
+    JOP_EQUALS_JUMP,
+    JOP_NUMERIC_FOR_LESS_THAN,
+    JOP_GET_VARARG,
+    JOP_GET_INDEX_VARARG,
+    JOP_PUSH_VARARG,
     JOP_INSTRUCTION_COUNT
 };
 
@@ -928,6 +1001,7 @@ struct JanetCompileResult {
     enum JanetCompileStatus status;
 };
 JANET_API JanetCompileResult janet_compile(Janet source, JanetTable *env, const uint8_t *where);
+JANET_API JanetCompileResult janet_compile_batch(const Janet *forms, int32_t n, JanetTable *env, const uint8_t *where, int32_t *count, JanetArray *progress);
 
 /* Get the default environment for janet */
 JANET_API JanetTable *janet_core_env(void);
@@ -970,6 +1044,8 @@ JANET_API void janet_buffer_push_u8(JanetBuffer *buffer, uint8_t x);
 JANET_API void janet_buffer_push_u16(JanetBuffer *buffer, uint16_t x);
 JANET_API void janet_buffer_push_u32(JanetBuffer *buffer, uint32_t x);
 JANET_API void janet_buffer_push_u64(JanetBuffer *buffer, uint64_t x);
+JANET_API void janet_buffer_compress(JanetBuffer *buffer, const uint8_t *data, int32_t len);
+JANET_API int janet_buffer_decompress(JanetBuffer *buffer, const uint8_t *data, int32_t len);
 
 /* Tuple */
 #define janet_tuple_raw(t) ((int32_t *)(t) - 4)
@@ -1066,6 +1142,8 @@ typedef void (*JanetModule)(JanetTable *);
 JANET_API JanetModule janet_native(const char *name, const uint8_t **error);
 
 /* Marshaling */
+#define JANET_MARSHAL_LAZY 0x10000
+#define JANET_MARSHAL_COMPRESS 0x20000
 JANET_API int janet_marshal(
         JanetBuffer *buf,
         Janet x,
@@ -1079,7 +1157,26 @@ JANET_API int janet_unmarshal(
         Janet *out,
         JanetTable *reg,
         const uint8_t **next);
+JANET_API int janet_marshal_file(
+        FILE *file,
+        Janet x,
+        Janet *errval,
+        JanetTable *rreg,
+        int flags);
+JANET_API int janet_unmarshal_file(
+        FILE *file,
+        int flags,
+        Janet *out,
+        JanetTable *reg);
 JANET_API JanetTable *janet_env_lookup(JanetTable *env);
+JANET_API void janet_register_abstract_type(const JanetAbstractType *at);
+JANET_API void janet_marshal_int(JanetMarshalContext *ctx, int32_t value);
+JANET_API void janet_marshal_bytes(JanetMarshalContext *ctx, const uint8_t *bytes, int32_t len);
+JANET_API void janet_marshal_janet(JanetMarshalContext *ctx, Janet x);
+JANET_API int32_t janet_unmarshal_int(JanetMarshalContext *ctx);
+JANET_API void janet_unmarshal_bytes(JanetMarshalContext *ctx, uint8_t *dest, int32_t len);
+JANET_API Janet janet_unmarshal_janet(JanetMarshalContext *ctx);
+JANET_API void *janet_unmarshal_abstract(JanetMarshalContext *ctx, size_t size);
 
 /* GC */
 JANET_API void janet_mark(Janet x);